@@ -25,6 +25,17 @@
 #include "SoundController/SoundController.h"
 
 #include "RenderControl\ShaderManager.h"
+#include "RenderControl\RenderDevice.h"
+#include "RenderControl\RenderThread.h"
+
+// Include CAssetLoader
+#include "System\AssetLoader.h"
+// Include CTexturePack
+#include "System\TexturePack.h"
+// Include CJobSystem
+#include "System\JobSystem.h"
+// Include CProfiler
+#include "TimeControl\Profiler.h"
 
 // Include CGameStateManager
 #include "GameStateManagement/GameStateManager.h"
@@ -40,6 +51,7 @@
 #include "System\filesystem.h"
 
 #include <iostream>
+#include <cmath>
 using namespace std;
 
 // Include GLFW
@@ -81,7 +93,7 @@ void repos_callback(GLFWwindow* window, int xpos, int ypos)
 	CSettings::GetInstance()->iWindowPosX = xpos;
 	CSettings::GetInstance()->iWindowPosY = ypos;
 	// Update the glViewPort
-	glViewport(0, 0, CSettings::GetInstance()->iWindowWidth, CSettings::GetInstance()->iWindowHeight);
+	CRenderDevice::GetActive()->SetViewport(0, 0, CSettings::GetInstance()->iWindowWidth, CSettings::GetInstance()->iWindowHeight);
 }
 
 /**
@@ -96,7 +108,7 @@ void resize_callback(GLFWwindow* window, int width, int height)
 	CSettings::GetInstance()->iWindowWidth = width;
 	CSettings::GetInstance()->iWindowHeight = height;
 	// Update the glViewPort
-	glViewport(0, 0, width, height);
+	CRenderDevice::GetActive()->SetViewport(0, 0, width, height);
 }
 
 /**
@@ -138,6 +150,9 @@ Application::~Application(void)
  */
 bool Application::Init(void)
 {
+	// Start timer to calculate the time to the first frame
+	cStartupTimer.StartTimer();
+
 	// glfw: initialize and configure
 	// ------------------------------
 	//Initialize GLFW
@@ -231,18 +246,35 @@ bool Application::Init(void)
 	//	return false;
 	//}
 
+	// Name the main thread in the profiler, which also creates it before the worker threads use it
+	PROFILE_THREAD_NAME("Main");
+
+	// Start the worker threads which decode the assets
+	CAssetLoader::GetInstance()->Init();
+	// Start the worker threads which run the per-frame game work, e.g. the enemy updates
+	CJobSystem::GetInstance()->Init();
+	// Map the texture pack. The images which are not in it are decoded from their files.
+	if (cSettings->bUseTexturePack == true)
+		CTexturePack::GetInstance()->Open("Image\\Textures.pack");
+
 	// Add the shaders to the ShaderManager
 	CShaderManager::GetInstance()->Add("2DShader", "Shader//Scene2D.vs", "Shader//Scene2D.fs");
 	CShaderManager::GetInstance()->Add("2DColorShader", "Shader//Scene2DColor.vs",
 		"Shader//Scene2DColor.fs");
 	CShaderManager::GetInstance()->Add("textShader", "Shader//text.vs", "Shader//text.fs");
+	// Print out the time to compile or load the shaders, to compare a cold start with a warm start
+	CShaderManager::GetInstance()->PrintSelf();
 
 	// Initialise the CFPSCounter instance
 	cFPSCounter = CFPSCounter::GetInstance();
 	cFPSCounter->Init();
-	CSoundController::GetInstance()->LoadSound(FileSystem::getPath("Sounds\\click.wav"), "uiClick", true);
-	CSoundController::GetInstance()->LoadSound(FileSystem::getPath("Sounds\\menu_bg.wav"), "menuBG", true, true);
-	CSoundController::GetInstance()->LoadSound(FileSystem::getPath("Sounds\\game_bg.wav"), "gameBG", true, true);
+	// The UI clicks have their own voice cap, so that they are not stolen by the game effects
+	CSoundController::GetInstance()->SetSoundCategory("uiClick", CSoundInfo::UI);
+	// Read the sounds on the worker threads. The background music is streamed instead.
+	CSoundController::GetInstance()->PreloadSound("Sounds\\click.wav", "uiClick");
+	CSoundController::GetInstance()->PreloadSound("Sounds\\menu_bg.wav", "menuBG", true);
+	CSoundController::GetInstance()->PreloadSound("Sounds\\game_bg.wav", "gameBG", true);
+	CAssetLoader::GetInstance()->WaitForAll();
 
 	// Create the Game States
 	CGameStateManager::GetInstance()->AddGameState("MenuState", new CMenuState());
@@ -252,6 +284,11 @@ bool Application::Init(void)
 	// Set the active scene
 	CGameStateManager::GetInstance()->SetActiveGameState("MenuState");
 
+	// Hand the OpenGL context to the render thread, which renders each frame while the next one is updated.
+	// The game states are initialised in the first frame, so all their OpenGL calls go through it.
+	if (cSettings->bRenderThread == true)
+		CRenderThread::GetInstance()->Init(cSettings->pWindow);
+
 	return true;
 }
 
@@ -264,14 +301,23 @@ void Application::Run(void)
 	cStopWatch.StartTimer();
 
 	double dElapsedTime = 0.0;
-	double dDelayTime = 0.0;
-	double dTotalFrameTime = 0.0;
+	bool bFirstFrame = true;
+
+	// The simulation is advanced in fixed time steps, by the time which has accumulated over the frames
+	const double dTimeStep = 1.0 / cSettings->iTickRate;
+	double dAccumulator = 0.0;
 	CSoundController::GetInstance()->PlaySoundByName("menuBG");
 
+	// The render thread, or NULL to render on this thread
+	CRenderThread* cRenderThread = (CRenderThread::GetInstance()->IsRunning() ? CRenderThread::GetInstance() : NULL);
+
 	// Render loop
 	while (!glfwWindowShouldClose(cSettings->pWindow))
 		//&& (!CKeyboardController::GetInstance()->IsKeyReleased(GLFW_KEY_ESCAPE)))
 	{
+		if (cRenderThread)
+			cRenderThread->BeginFrame();
+
 		//// Call the cScene2D's update method
 		//cScene2D->Update(dElapsedTime);
 
@@ -284,24 +330,67 @@ void Application::Run(void)
 		//// Call the cScene2D's post render method
 		//cScene2D->PostRender();
 
-		// This is to prevent the program from crashing due to long dElapsedTime
-		// Causing Physics to calculate a large jump/fall for the player
-		if (dElapsedTime > 0.0166666666666667)
-			dElapsedTime = 0.0166666666666667;
-
-		// Call the active Game State's Update method
+		// Call the active Game State's Update method, which updates the menus and GUI once per frame
 		if (CGameStateManager::GetInstance()->Update(dElapsedTime) == false)
 		{
 			break;
 		}
 
-		// Call the active Game State's Render method
-		CGameStateManager::GetInstance()->Render();
+		// Advance the sound backend, which mixes the sounds itself if there is no audio device
+		CSoundController::GetInstance()->Update(dElapsedTime);
+
+		// Call the active Game State's FixedUpdate method for each fixed time step which has passed.
+		// The physics then behaves the same at any frame rate, and a long frame runs more steps instead of a large jump/fall.
+		dAccumulator += dElapsedTime;
+		unsigned int iNumSteps = 0;
+		bool bQuit = false;
+		while ((dAccumulator >= dTimeStep) && (iNumSteps < cSettings->iMaxTickSteps))
+		{
+			// Key and button presses are tracked per step, so that a press is seen by exactly one step
+			CKeyboardController::GetInstance()->BeginFixedUpdate();
+			CMouseController::GetInstance()->BeginFixedUpdate();
+			bQuit = (CGameStateManager::GetInstance()->FixedUpdate(dTimeStep) == false);
+			CKeyboardController::GetInstance()->EndFixedUpdate();
+			CMouseController::GetInstance()->EndFixedUpdate();
+			if (bQuit)
+				break;
+
+			dAccumulator -= dTimeStep;
+			iNumSteps++;
+		}
+		if (bQuit)
+			break;
+		// Drop the time which could not be caught up with
+		if (iNumSteps == cSettings->iMaxTickSteps)
+			dAccumulator = fmod(dAccumulator, dTimeStep);
+
+		// Reset the render device counters so that they are per frame
+		CRenderDevice::GetActive()->ResetStats();
+
+		// Call the active Game State's Render method, interpolating the entities between the last two fixed time steps
+		CGameStateManager::GetInstance()->Render(dAccumulator / dTimeStep);
 
 
 		// glfw: swap buffers and poll IO events (keys pressed/released, mouse moved etc.)
+		// The render thread replays the frame and swaps the buffers, while this thread goes on to the next frame.
 		// -------------------------------------------------------------------------------
-		glfwSwapBuffers(cSettings->pWindow);
+		if (cRenderThread)
+			cRenderThread->Submit();
+		else
+		{
+			PROFILE_ZONE("glfwSwapBuffers");
+			glfwSwapBuffers(cSettings->pWindow);
+		}
+
+		// Print out the time to the first frame, to compare CSettings::bParallelAssetLoading on and off
+		if (bFirstFrame)
+		{
+			bFirstFrame = false;
+			cout << "Time to first frame: " << cStartupTimer.GetElapsedTime() * 1000.0 << " ms ("
+				 << (cSettings->bParallelAssetLoading ? "parallel" : "serial") << " asset loading, "
+				 << CAssetLoader::GetInstance()->GetNumWorkers() << " worker threads, "
+				 << (CTexturePack::GetInstance()->IsOpen() ? "texture pack" : "no texture pack") << ")" << endl;
+		}
 
 		// Perform Post Update Input Devices
 		PostUpdateInputDevices();
@@ -312,17 +401,26 @@ void Application::Run(void)
 		// Update Input Devices
 		UpdateInputDevices();
 
-		// Calculate the elapsed time since the last frame
-		dElapsedTime = cStopWatch.GetElapsedTime();
+#ifdef ENABLE_PROFILER
+		// Write the recent zones to a Chrome trace, which can be opened in chrome://tracing
+		if (CKeyboardController::GetInstance()->IsKeyPressed(GLFW_KEY_F9))
+			CProfiler::GetInstance()->WriteChromeTrace("profile.json");
+#endif
 
-		// Frame rate limiter. Limits each frame to a specified time in ms by sleeping.
-		// Comment out these 2 lines if you do not want FPS limitation
-		dDelayTime = cSettings->frameTime - dElapsedTime * 1000;
-		cStopWatch.WaitUntil((const long long)dDelayTime);
+		// Frame rate limiter. Limits each frame to a specified time in ms by sleeping, and spinning for the last fraction of a ms.
+		// Set CSettings::bLimitFrameRate to false if you do not want FPS limitation
+		if (cSettings->bLimitFrameRate)
+		{
+			PROFILE_ZONE("CStopWatch::WaitUntil");
+			cStopWatch.WaitUntil(1000.0 / cSettings->FPS);
+		}
+
+		// Calculate the elapsed time since the start of this frame, including the wait
+		dElapsedTime = cStopWatch.GetElapsedTime();
 
-		// Update the FPS Counter
-		dTotalFrameTime = dElapsedTime + dDelayTime * 0.001;
-		cFPSCounter->Update(dTotalFrameTime);
+		// Update the FPS Counter and the frame time percentiles
+		cFPSCounter->Update(dElapsedTime);
+		PROFILE_END_FRAME(dElapsedTime);
 	}
 }
 
@@ -334,8 +432,17 @@ void Application::Destroy(void)
 	// Destroy the keyboard instance
 	CKeyboardController::GetInstance()->Destroy();
 	CSoundController::GetInstance()->Destroy();
-	CShaderManager::GetInstance()->Destroy();
+	// The game states release their OpenGL objects through the render thread, which is then stopped,
+	// so that the OpenGL context is current on this thread again for the shaders
 	CGameStateManager::GetInstance()->Destroy();
+	if (CRenderThread::GetInstance()->IsRunning())
+		CRenderThread::GetInstance()->PrintSelf();
+	CRenderThread::GetInstance()->Destroy();
+	CShaderManager::GetInstance()->Destroy();
+	CAssetLoader::GetInstance()->Destroy();
+	CJobSystem::GetInstance()->Destroy();
+	CTexturePack::GetInstance()->Destroy();
+	CProfiler::GetInstance()->Destroy();
 
 	// Destroy the CFPSCounter instance
 	if (cFPSCounter)
@@ -40,6 +40,8 @@ public:
 protected:
 	// Declare timer for calculating time per frame
 	CStopWatch cStopWatch;
+	// Declare timer for calculating the time from the start of Init to the first frame
+	CStopWatch cStartupTimer;
 
 	// The handler to the CSettings instance
 	CSettings* cSettings;
@@ -11,6 +11,8 @@ using namespace std;
 
 // Include Shader Manager
 #include "RenderControl\ShaderManager.h"
+// Include Render Device
+#include "RenderControl\RenderDevice.h"
 // Include Mesh Builder
 #include "Primitives/MeshBuilder.h"
 // Include ImageLoader
@@ -26,8 +28,8 @@ CBullets::~CBullets(void)
 
 bool CBullets::Init() {
     cSettings = CSettings::GetInstance();
-    glGenVertexArrays(1, &VAO);
-    glBindVertexArray(VAO);
+    VAO = CRenderDevice::GetActive()->CreateVertexArray();
+    CRenderDevice::GetActive()->BindVertexArray(VAO);
     mesh = CMeshBuilder::GenerateQuad(glm::vec4(1, 1, 1, 1), cSettings->TILE_WIDTH, cSettings->TILE_HEIGHT);
     if (LoadTexture("Image/Characters/Enemy2.png")) {
         return true;
@@ -45,18 +47,16 @@ void CBullets::Update(const double dElapsedTime)
 
 void CBullets::PreRender(void)
 {
-    glActiveTexture(GL_TEXTURE0);
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    CRenderDevice::GetActive()->ActiveTexture(GL_TEXTURE0);
+    CRenderDevice::GetActive()->SetBlend(true);
     CShaderManager::GetInstance()->Use("2DShader");
 }
 
 void CBullets::Render(void)
 {
-    glBindVertexArray(VAO);
-    unsigned int transformLoc = glGetUniformLocation(CShaderManager::GetInstance()->activeShader->ID, "transform");
-    unsigned int colorLoc = glGetUniformLocation(CShaderManager::GetInstance()->activeShader->ID, "runtime_color");
-    glUniformMatrix4fv(transformLoc, 1, GL_FALSE, glm::value_ptr(transform));
+    CRenderDevice* cRenderDevice = CRenderDevice::GetActive();
+    cRenderDevice->BindVertexArray(VAO);
+    GLint transformLoc = cRenderDevice->GetUniformLocation(CShaderManager::GetInstance()->activeShader->ID, "transform");
 
     transform = glm::mat4(1.0f);
     transform = glm::translate(transform, glm::vec3(vec2UVCoordinate.x,
@@ -65,16 +65,16 @@ void CBullets::Render(void)
     transform = glm::rotate(transform, rotation, glm::vec3(0, 0, 1));
     transform = glm::scale(transform, vec3Scale);
 
-    glUniformMatrix4fv(transformLoc, 1, GL_FALSE, glm::value_ptr(transform));
+    cRenderDevice->SetUniformMatrix4(transformLoc, glm::value_ptr(transform));
 
-    glBindTexture(GL_TEXTURE_2D, iTextureID);
+    cRenderDevice->BindTexture(iTextureID);
 
     mesh->Render();
 
-    glBindVertexArray(0);
+    cRenderDevice->BindVertexArray(0);
 }
 
 void CBullets::PostRender(void)
 {
-    glDisable(GL_BLEND);
+    CRenderDevice::GetActive()->SetBlend(false);
 }
\ No newline at end of file
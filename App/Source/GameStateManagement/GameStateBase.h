@@ -25,6 +25,9 @@ public:
 	// These are pure virtual functions
 	virtual bool Init() = 0;
 	virtual bool Update(const double dElapsedTime) = 0;
-	virtual void Render() = 0;
+	virtual void Render(const double dAlpha) = 0;
 	virtual void Destroy() = 0;
+
+	// Advance the simulation by one fixed time step. States without a simulation do not override this.
+	virtual bool FixedUpdate(const double dTimeStep) { return true; }
 };
@@ -74,13 +74,26 @@ bool CGameStateManager::Update(const double dElapsedTime)
 	return true;
 }
 
+/**
+ @brief Advance the simulation of the active CGameState by one fixed time step
+ @param dTimeStep The fixed time step in seconds
+ */
+bool CGameStateManager::FixedUpdate(const double dTimeStep)
+{
+	if (activeGameState)
+		return activeGameState->FixedUpdate(dTimeStep);
+
+	return true;
+}
+
 /**
  @brief Render this class instance
+ @param dAlpha The fraction of a fixed time step from the last fixed update to this frame, to interpolate the entities with
  */
-void CGameStateManager::Render(void)
+void CGameStateManager::Render(const double dAlpha)
 {
 	if (activeGameState)
-		activeGameState->Render();
+		activeGameState->Render(dAlpha);
 }
 
 /**
@@ -18,8 +18,10 @@ public:
 	// System Interface
 	// Update this class instance
 	bool Update(const double dElapsedTime);
+	// Advance the simulation of the active CGameState by one fixed time step
+	bool FixedUpdate(const double dTimeStep);
 	// Render this class instance
-	void Render(void);
+	void Render(const double dAlpha);
 
 	// User Interface
 	bool AddGameState(const std::string& _name, CGameStateBase* _scene);
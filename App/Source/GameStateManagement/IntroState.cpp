@@ -23,6 +23,8 @@
 #include "System\ImageLoader.h"
 // Include Shader Manager
 #include "RenderControl\ShaderManager.h"
+// Include CRenderDevice
+#include "RenderControl\RenderDevice.h"
 
  // Include shader
 #include "RenderControl\shader.h"
@@ -94,10 +96,10 @@ bool CIntroState::Update(const double dElapsedTime)
 /**
  @brief Render this class instance
  */
-void CIntroState::Render()
+void CIntroState::Render(const double dAlpha)
 {
 	// Clear the screen and buffer
-	glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+	CRenderDevice::GetActive()->Clear(0.2f, 0.3f, 0.3f, 1.0f);
 
 	//Draw the background
  	background->Render();
@@ -26,7 +26,7 @@ public:
 	// Update this class instance
 	virtual bool Update(const double dElapsedTime);
 	// Render this class instance
-	virtual void Render(void);
+	virtual void Render(const double dAlpha);
 	// Destroy this class instance
 	virtual void Destroy(void);
 
@@ -21,8 +21,12 @@
 #include "Primitives/MeshBuilder.h"
 // Include ImageLoader
 #include "System\ImageLoader.h"
+// Include AssetManager
+#include "System\AssetManager.h"
 // Include Shader Manager
 #include "RenderControl\ShaderManager.h"
+// Include CRenderDevice
+#include "RenderControl\RenderDevice.h"
 
  // Include shader
 #include "RenderControl\shader.h"
@@ -82,7 +86,7 @@ bool CMenuState::Init(void)
 	// Setup Platform/Renderer bindings
 	ImGui_ImplGlfw_InitForOpenGL(CSettings::GetInstance()->pWindow, true);
 	const char* glsl_version = "#version 330";
-	ImGui_ImplOpenGL3_Init(glsl_version);
+	CRenderDevice::GetActive()->InitGUI(glsl_version);
 
 	// Load the images for buttons
 	CImageLoader* il = CImageLoader::GetInstance();
@@ -104,7 +108,7 @@ bool CMenuState::Init(void)
 bool CMenuState::Update(const double dElapsedTime)
 {
 	// Start the Dear ImGui frame
-	ImGui_ImplOpenGL3_NewFrame();
+	CRenderDevice::GetActive()->NewGUIFrame();
 	ImGui_ImplGlfw_NewFrame();
 	ImGui::NewFrame();
 
@@ -210,17 +214,10 @@ bool CMenuState::Update(const double dElapsedTime)
 /**
  @brief Render this class instance
  */
-void CMenuState::Render(void)
+void CMenuState::Render(const double dAlpha)
 {
-	// Reset the OpenGL rendering environment
-	glLoadIdentity();
-
 	// Clear the screen and buffer
-	glClearColor(0.0f, 0.55f, 1.f, 0.8f);
-	glClear(GL_COLOR_BUFFER_BIT);
-
-	// Enable 2D texture rendering
-	glEnable(GL_TEXTURE_2D);
+	CRenderDevice::GetActive()->Clear(0.0f, 0.55f, 1.f, 0.8f);
 
 
 	//Render Background
@@ -228,7 +225,7 @@ void CMenuState::Render(void)
 
 	// Rendering
 	ImGui::Render();
-	ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+	CRenderDevice::GetActive()->RenderGUI(ImGui::GetDrawData());
 
 	cout << "CMenuState::Render()\n" << endl;
 }
@@ -245,8 +242,13 @@ void CMenuState::Destroy(void)
 		background = NULL;
 	}
 
+	// Release the images for buttons
+	CAssetManager::GetInstance()->ReleaseTexture(startButtonData.textureID);
+	CAssetManager::GetInstance()->ReleaseTexture(optionButtonData.textureID);
+	CAssetManager::GetInstance()->ReleaseTexture(quitButtonData.textureID);
+
 	// Cleanup
-	ImGui_ImplOpenGL3_Shutdown();
+	CRenderDevice::GetActive()->ShutdownGUI();
 	ImGui_ImplGlfw_Shutdown();
 	ImGui::DestroyContext();
 
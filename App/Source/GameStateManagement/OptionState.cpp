@@ -21,8 +21,12 @@
 #include "Primitives/MeshBuilder.h"
 // Include ImageLoader
 #include "System\ImageLoader.h"
+// Include AssetManager
+#include "System\AssetManager.h"
 // Include Shader Manager
 #include "RenderControl\ShaderManager.h"
+// Include CRenderDevice
+#include "RenderControl\RenderDevice.h"
 
  // Include shader
 #include "RenderControl\shader.h"
@@ -85,7 +89,7 @@ bool COptionState::Init(void)
 	// Setup Platform/Renderer bindings
 	ImGui_ImplGlfw_InitForOpenGL(CSettings::GetInstance()->pWindow, true);
 	const char* glsl_version = "#version 330";
-	ImGui_ImplOpenGL3_Init(glsl_version);
+	CRenderDevice::GetActive()->InitGUI(glsl_version);
 
 	// Load the images for buttons
 	CImageLoader* il = CImageLoader::GetInstance();
@@ -105,7 +109,7 @@ bool COptionState::Init(void)
 bool COptionState::Update(const double dElapsedTime)
 {
 	// Start the Dear ImGui frame
-	ImGui_ImplOpenGL3_NewFrame();
+	CRenderDevice::GetActive()->NewGUIFrame();
 	ImGui_ImplGlfw_NewFrame();
 	ImGui::NewFrame();
 
@@ -212,17 +216,17 @@ bool COptionState::Update(const double dElapsedTime)
 /**
  @brief Render this class instance
  */
-void COptionState::Render(void)
+void COptionState::Render(const double dAlpha)
 {
 	// Clear the screen and buffer
-	glClearColor(0.0f, 0.55f, 1.00f, 1.00f);
+	CRenderDevice::GetActive()->Clear(0.0f, 0.55f, 1.00f, 1.00f);
 
 	//Render Background
 	background->Render();
 
 	// Rendering
 	ImGui::Render();
-	ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+	CRenderDevice::GetActive()->RenderGUI(ImGui::GetDrawData());
 
 	cout << "COptionState::Render()\n" << endl;
 }
@@ -239,8 +243,13 @@ void COptionState::Destroy(void)
 		background = NULL;
 	}
 
+	// Release the images for buttons
+	CAssetManager::GetInstance()->ReleaseTexture(backButtonData.textureID);
+	CAssetManager::GetInstance()->ReleaseTexture(survivalButtonData.textureID);
+	CAssetManager::GetInstance()->ReleaseTexture(creativeButtonData.textureID);
+
 	// Cleanup
-	ImGui_ImplOpenGL3_Shutdown();
+	CRenderDevice::GetActive()->ShutdownGUI();
 	ImGui_ImplGlfw_Shutdown();
 	ImGui::DestroyContext();
 
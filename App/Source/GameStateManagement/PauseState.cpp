@@ -21,8 +21,12 @@
 #include "Primitives/MeshBuilder.h"
 // Include ImageLoader
 #include "System\ImageLoader.h"
+// Include AssetManager
+#include "System\AssetManager.h"
 // Include Shader Manager
 #include "RenderControl\ShaderManager.h"
+// Include CRenderDevice
+#include "RenderControl\RenderDevice.h"
 
  // Include shader
 #include "RenderControl\shader.h"
@@ -82,7 +86,7 @@ bool CPauseState::Init(void)
 	// Setup Platform/Renderer bindings
 	ImGui_ImplGlfw_InitForOpenGL(CSettings::GetInstance()->pWindow, true);
 	const char* glsl_version = "#version 330";
-	ImGui_ImplOpenGL3_Init(glsl_version);
+	CRenderDevice::GetActive()->InitGUI(glsl_version);
 
 	// Load the images for buttons
 	CImageLoader* il = CImageLoader::GetInstance();
@@ -100,7 +104,7 @@ bool CPauseState::Init(void)
 bool CPauseState::Update(const double dElapsedTime)
 {
 	// Start the Dear ImGui frame
-	ImGui_ImplOpenGL3_NewFrame();
+	CRenderDevice::GetActive()->NewGUIFrame();
 	ImGui_ImplGlfw_NewFrame();
 	ImGui::NewFrame();
 
@@ -191,17 +195,17 @@ bool CPauseState::Update(const double dElapsedTime)
 /**
  @brief Render this class instance
  */
-void CPauseState::Render(void)
+void CPauseState::Render(const double dAlpha)
 {
 	// Clear the screen and buffer
-	glClearColor(0.0f, 0.55f, 1.00f, 1.00f);
+	CRenderDevice::GetActive()->Clear(0.0f, 0.55f, 1.00f, 1.00f);
 
 	//Render Background
 	background->Render();
 
 	// Rendering
 	ImGui::Render();
-	ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+	CRenderDevice::GetActive()->RenderGUI(ImGui::GetDrawData());
 
 	cout << "CPauseState::Render()\n" << endl;
 }
@@ -218,8 +222,12 @@ void CPauseState::Destroy(void)
 		background = NULL;
 	}
 
+	// Release the images for buttons
+	CAssetManager::GetInstance()->ReleaseTexture(resumeButtonData.textureID);
+	CAssetManager::GetInstance()->ReleaseTexture(menuButtonData.textureID);
+
 	// Cleanup
-	ImGui_ImplOpenGL3_Shutdown();
+	CRenderDevice::GetActive()->ShutdownGUI();
 	ImGui_ImplGlfw_Shutdown();
 	ImGui::DestroyContext();
 
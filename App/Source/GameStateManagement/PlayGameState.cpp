@@ -14,6 +14,10 @@
 
 // Include ImageLoader
 #include "System\ImageLoader.h"
+// Include AssetManager
+#include "System\AssetManager.h"
+// Include CRenderDevice
+#include "RenderControl\RenderDevice.h"
 
 // Include CKeyboardController
 #include "Inputs/KeyboardController.h"
@@ -89,7 +93,7 @@ bool CPlayGameState::Update(const double dElapsedTime)
 	{
 
 		// Start the Dear ImGui frame
-		ImGui_ImplOpenGL3_NewFrame();
+		CRenderDevice::GetActive()->NewGUIFrame();
 		ImGui_ImplGlfw_NewFrame();
 		ImGui::NewFrame();
 
@@ -152,10 +156,24 @@ bool CPlayGameState::Update(const double dElapsedTime)
 	return true;
 }
 
+/**
+ @brief Advance the simulation of the scene by one fixed time step
+ @param dTimeStep The fixed time step in seconds
+ */
+bool CPlayGameState::FixedUpdate(const double dTimeStep)
+{
+	// The scene does not move while the pause menu is shown
+	if (!paused)
+		cScene2D->FixedUpdate(dTimeStep);
+
+	return true;
+}
+
 /**
  @brief Render this class instance
+ @param dAlpha The fraction of a fixed time step from the last fixed update to this frame
  */
-void CPlayGameState::Render(void)
+void CPlayGameState::Render(const double dAlpha)
 {
 	//cout << "CPlayGameState::Render()\n" << endl;
 
@@ -163,7 +181,7 @@ void CPlayGameState::Render(void)
 	cScene2D->PreRender();
 
 	// Call the cScene2D's Render method
-	cScene2D->Render();
+	cScene2D->Render(dAlpha);
 
 	// Call the cScene2D's PostRender method
 	cScene2D->PostRender();
@@ -172,7 +190,7 @@ void CPlayGameState::Render(void)
 	{
 		// Rendering
 		ImGui::Render();
-		ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+		CRenderDevice::GetActive()->RenderGUI(ImGui::GetDrawData());
 	}
 }
 
@@ -183,6 +201,10 @@ void CPlayGameState::Destroy(void)
 {
 	cout << "CPlayGameState::Destroy()\n" << endl;
 
+	// Release the images for buttons
+	CAssetManager::GetInstance()->ReleaseTexture(resumeButtonData.textureID);
+	CAssetManager::GetInstance()->ReleaseTexture(menuButtonData.textureID);
+
 	// Destroy the cScene2D instance
 	if (cScene2D)
 	{
@@ -23,8 +23,10 @@ public:
 	virtual bool Init(void);
 	// Update this class instance
 	virtual bool Update(const double dElapsedTime);
+	// Advance the simulation of the scene by one fixed time step
+	virtual bool FixedUpdate(const double dTimeStep);
 	// Render this class instance
-	virtual void Render(void);
+	virtual void Render(const double dAlpha);
 	// Destroy this class instance
 	virtual void Destroy(void);
 
@@ -7,6 +7,8 @@
 
  //For allowing creating of Quad Mesh 
 #include "Primitives/MeshBuilder.h"
+// Include Render Device
+#include "RenderControl\RenderDevice.h"
 
 #include <iostream>
 #include <vector>
@@ -25,8 +27,8 @@ CBackgroundEntity::~CBackgroundEntity()
 
 bool CBackgroundEntity::Init()
 {
-	glGenVertexArrays(1, &VAO);
-	glBindVertexArray(VAO);
+	VAO = CRenderDevice::GetActive()->CreateVertexArray();
+	CRenderDevice::GetActive()->BindVertexArray(VAO);
 
 	if (LoadTexture(textureName.c_str()) == false)
 	{
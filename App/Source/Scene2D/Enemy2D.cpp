@@ -7,18 +7,21 @@
 
 #include <iostream>
 using namespace std;
-bool spawnEnemy = false;
 
 // Include Shader Manager
 #include "RenderControl\ShaderManager.h"
+// Include Render Device
+#include "RenderControl\RenderDevice.h"
+// Include Render Queue
+#include "RenderControl\RenderQueue.h"
 // Include Mesh Builder
 #include "Primitives/MeshBuilder.h"
 
 // Include GLEW
 #include <GL/glew.h>
 
-// Include ImageLoader
-#include "System\ImageLoader.h"
+// Include AssetManager
+#include "System\AssetManager.h"
 
 #include "../SoundController/SoundController.h"
 
@@ -26,6 +29,10 @@ bool spawnEnemy = false;
 #include "Map2D.h"
 
 #include "Scene2D.h"
+// Include CProfiler
+#include "TimeControl\Profiler.h"
+// Include CJobSystem
+#include "System\JobSystem.h"
 // Include math.h
 #include <math.h>
 
@@ -41,6 +48,8 @@ CEnemy2D::CEnemy2D(void)
 	, sCurrentFSM(FSM::IDLE)
 	, enemyType(ENEMY_TYPE::DEFAULT_ENEMY)
 	, iFSMCounter(0)
+	, fDeferredPlayerDamage(0.0f)
+	, bDeferredSpawnMinion(false)
 {
 	transform = glm::mat4(1.0f);	// make sure to initialize matrix to identity matrix first
 
@@ -77,9 +86,7 @@ CEnemy2D::~CEnemy2D(void)
 	}
 
 	// optional: de-allocate all resources once they've outlived their purpose:
-	glDeleteVertexArrays(1, &VAO);
-	glDeleteBuffers(1, &VBO);
-	glDeleteBuffers(1, &EBO);
+	CRenderDevice::GetActive()->DeleteVertexArray(VAO);
 }
 
 /**
@@ -127,6 +134,9 @@ bool CEnemy2D::Init(void)
 	}
 	cMap2D->SetMapInfo(uiRow, uiCol, 0);
 
+	// Seed the random numbers of this enemy
+	cRandom.seed(rand());
+
 	// Erase the value of the player in the arrMapInfo
 
 	// Set the start position of the Player to iRow and iCol
@@ -134,8 +144,8 @@ bool CEnemy2D::Init(void)
 	// By default, microsteps should be zero
 	i32vec2NumMicroSteps = glm::i32vec2(0, 0);
 
-	glGenVertexArrays(1, &VAO);
-	glBindVertexArray(VAO);
+	VAO = CRenderDevice::GetActive()->CreateVertexArray();
+	CRenderDevice::GetActive()->BindVertexArray(VAO);
 
 	//CS: Create the Quad Mesh using the mesh builder
 	quadMesh = CMeshBuilder::GenerateQuad(glm::vec4(1, 1, 1, 1), cSettings->TILE_WIDTH, cSettings->TILE_HEIGHT);
@@ -208,6 +218,8 @@ void CEnemy2D::Update(const double dElapsedTime)
 	if (!bIsActive)
 		return;
 
+	PROFILE_ZONE("CEnemy2D::Update");
+
 	if (i32vec2Direction.x > 0)
 	{
 		animatedSprites->PlayAnimation("runLeft", -1, 1.0f);
@@ -272,6 +284,57 @@ void CEnemy2D::Update(const double dElapsedTime)
 	vec2UVCoordinate.y = cSettings->ConvertFloatIndexToUVSpace(cSettings->y, i32vec2Index.y, false, i32vec2NumMicroSteps.y * cSettings->MICRO_STEP_YAXIS);
 }
 
+/**
+ @brief Apply what the last Update did to the player and the sounds, in the order of the enemies
+ @return A bool value. true if this enemy wants a minion to be spawned at its position, else false
+ */
+bool CEnemy2D::CommitUpdate(void)
+{
+	if (fDeferredPlayerDamage > 0.0f)
+	{
+		cPlayer2D->health -= fDeferredPlayerDamage;
+		fDeferredPlayerDamage = 0.0f;
+	}
+
+	for (unsigned int i = 0; i < vDeferredSounds.size(); i++)
+		CSoundController::GetInstance()->PlaySoundByName(vDeferredSounds[i]);
+	vDeferredSounds.clear();
+
+	const bool bSpawnMinion = bDeferredSpawnMinion;
+	bDeferredSpawnMinion = false;
+	return bSpawnMinion;
+}
+
+/**
+ @brief Update the enemies in parallel on CJobSystem. The map and the player are not changed while they update,
+		so each enemy sees the same map and player whichever thread updates it.
+		Then apply what they did to the player and the sounds, in the same order as if they were updated one by one.
+ @param vEnemies The enemies
+ @param dElapsedTime The time step in seconds
+ @param vSpawnPositions The positions where minions should be spawned are added to this
+ */
+void CEnemy2D::UpdateAll(const std::vector<CEnemy2D*>& vEnemies,
+						 const double dElapsedTime,
+						 std::vector<glm::i32vec2>& vSpawnPositions)
+{
+	{
+		PROFILE_ZONE("CEnemy2D::UpdateAll");
+		// An enemy update is short, so give each job a few enemies
+		CJobSystem::GetInstance()->ParallelFor((unsigned int)vEnemies.size(), 4,
+			[&vEnemies, dElapsedTime](const unsigned int uiBegin, const unsigned int uiEnd) {
+				for (unsigned int i = uiBegin; i < uiEnd; i++)
+					vEnemies[i]->Update(dElapsedTime);
+			});
+	}
+
+	PROFILE_ZONE("CEnemy2D::CommitUpdate");
+	for (unsigned int i = 0; i < vEnemies.size(); i++)
+	{
+		if (vEnemies[i]->CommitUpdate())
+			vSpawnPositions.push_back(vEnemies[i]->Geti32vec2Index());
+	}
+}
+
 /**
  @brief Set up the OpenGL display environment before rendering
  */
@@ -281,11 +344,10 @@ void CEnemy2D::PreRender(void)
 		return;
 
 	// bind textures on corresponding texture units
-	glActiveTexture(GL_TEXTURE0);
+	CRenderDevice::GetActive()->ActiveTexture(GL_TEXTURE0);
 
 	// Activate blending mode
-	glEnable(GL_BLEND);
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	CRenderDevice::GetActive()->SetBlend(true);
 
 	// Activate the shader
 	CShaderManager::GetInstance()->Use(sShaderName);
@@ -299,30 +361,20 @@ void CEnemy2D::Render(void)
 	if (!bIsActive)
 		return;
 
-	glBindVertexArray(VAO);
-	// get matrix's uniform location and set matrix
-	unsigned int transformLoc = glGetUniformLocation(CShaderManager::GetInstance()->activeShader->ID, "transform");
-	unsigned int colorLoc = glGetUniformLocation(CShaderManager::GetInstance()->activeShader->ID, "runtime_color");
-	glUniformMatrix4fv(transformLoc, 1, GL_FALSE, glm::value_ptr(transform));
-
 	transform = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
-	transform = glm::translate(transform, glm::vec3(vec2UVCoordinate.x,
-													vec2UVCoordinate.y,
+	// Render between the last two fixed time steps, so that the movement is smooth at any frame rate
+	const glm::vec2 vec2RenderUVCoordinate = GetRenderUVCoordinate();
+	transform = glm::translate(transform, glm::vec3(vec2RenderUVCoordinate.x,
+													vec2RenderUVCoordinate.y,
 													0.0f));
-	// Update the shaders with the latest transform
-	glUniformMatrix4fv(transformLoc, 1, GL_FALSE, glm::value_ptr(transform));
-	glUniform4fv(colorLoc, 1, glm::value_ptr(currentColor));
-
-	// Get the texture to be rendered
-	glBindTexture(GL_TEXTURE_2D, iTextureID);
-
-	// Render the tile
-	//glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
-	//quadMesh->Render();
-	animatedSprites->Render();
-
-	glBindVertexArray(0);
 
+	// Queue the animated sprite with its texture, transform and colour
+	CRenderQueue::GetInstance()->Submit(CRenderQueue::LAYER_ENTITIES,
+										sShaderName,
+										iTextureID,
+										animatedSprites,
+										transform,
+										currentColor);
 }
 
 /**
@@ -334,7 +386,7 @@ void CEnemy2D::PostRender(void)
 		return;
 
 	// Disable blending
-	glDisable(GL_BLEND);
+	CRenderDevice::GetActive()->SetBlend(false);
 }
 
 /**
@@ -383,38 +435,12 @@ void CEnemy2D::SetPlayer2D(CPlayer2D* cPlayer2D)
 */
 bool CEnemy2D::LoadTexture(const char* filename, GLuint& iTextureID)
 {
-	// Variables used in loading the texture
-	int width, height, nrChannels;
-
-	// texture 1
-	// ---------
-	glGenTextures(1, &iTextureID);
-	glBindTexture(GL_TEXTURE_2D, iTextureID);
-	// set the texture wrapping parameters
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-	// set texture filtering parameters
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-	CImageLoader* cImageLoader = CImageLoader::GetInstance();
-	unsigned char* data = cImageLoader->Load(filename, width, height, nrChannels, true);
-	if (data)
-	{
-		if (nrChannels == 3)
-			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, data);
-		else if (nrChannels == 4)
-			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
-
-		// Generate mipmaps
-		glGenerateMipmap(GL_TEXTURE_2D);
-	}
-	else
-	{
+	// Get the shared texture, and release the one which was loaded before
+	GLuint uiNewTextureID = CAssetManager::GetInstance()->AcquireTexture(filename);
+	if (uiNewTextureID == 0)
 		return false;
-	}
-	// Free up the memory of the file data read in
-	free(data);
+	CAssetManager::GetInstance()->ReleaseTexture(iTextureID);
+	iTextureID = uiNewTextureID;
 
 	return true;
 }
@@ -466,122 +492,24 @@ void CEnemy2D::Constraint(DIRECTION eDirection)
 /**
  @brief Check if a position is possible to move into
  @param eDirection A DIRECTION enumerated data type which indicates the direction to check
+ @param uiTileFlags The TILE_FLAGs of the tiles which cannot be moved into
  */
-bool CEnemy2D::CheckPosition(DIRECTION eDirection, int minIndex, int maxIndex)
+bool CEnemy2D::CheckPosition(DIRECTION eDirection, const unsigned int uiTileFlags)
 {
-	if (eDirection == LEFT)
-	{
-		// If the new position is fully within a row, then check this row only
-		if (i32vec2NumMicroSteps.y == 0)
-		{
-			// If the grid is not accessible, then return false
-			if (cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x) >= minIndex &&
-				(cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x) <= maxIndex))
-			{
-				return false;
-			}
-		}
-		// If the new position is between 2 rows, then check both rows as well
-		else if (i32vec2NumMicroSteps.y != 0)
-		{
-			// If the 2 grids are not accessible, then return false
-			if ((cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x) >= minIndex) && (cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x) <= maxIndex) ||
-				(cMap2D->GetMapInfo(i32vec2Index.y + 1, i32vec2Index.x) >= minIndex) && (cMap2D->GetMapInfo(i32vec2Index.y + 1, i32vec2Index.x) <= maxIndex))
-			{
-				return false;
-			}
-		}
-	}
-	else if (eDirection == RIGHT)
+	if ((eDirection < LEFT) || (eDirection >= NUM_DIRECTIONS))
 	{
-		// If the new position is at the top row, then return true
-		if (i32vec2Index.x >= cSettings->NUM_TILES_XAXIS - 1)
-		{
-			i32vec2NumMicroSteps.x = 0;
-			return true;
-		}
-
-		// If the new position is fully within a row, then check this row only
-		if (i32vec2NumMicroSteps.y == 0)
-		{
-			// If the grid is not accessible, then return false
-			if ((cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x + 1) >= minIndex) &&
-				(cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x + 1) <= maxIndex))
-			{
-				return false;
-			}
-		}
-		// If the new position is between 2 rows, then check both rows as well
-		else if (i32vec2NumMicroSteps.y != 0)
-		{
-			// If the 2 grids are not accessible, then return false
-			if ((cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x + 1) >= minIndex) && (cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x + 1) <= maxIndex) ||
-				(cMap2D->GetMapInfo(i32vec2Index.y + 1, i32vec2Index.x + 1) >= minIndex) && (cMap2D->GetMapInfo(i32vec2Index.y + 1, i32vec2Index.x + 1) <= maxIndex))
-			{
-				return false;
-			}
-		}
-
+		cout << "CEnemy2D::CheckPosition: Unknown direction." << endl;
+		return true;
 	}
-	else if (eDirection == UP)
-	{
-		// If the new position is at the top row, then return true
-		if (i32vec2Index.y >= cSettings->NUM_TILES_YAXIS - 1)
-		{
-			i32vec2NumMicroSteps.y = 0;
-			return true;
-		}
 
-		// If the new position is fully within a column, then check this column only
-		if (i32vec2NumMicroSteps.x == 0)
-		{
-			// If the grid is not accessible, then return false
-			if ((cMap2D->GetMapInfo(i32vec2Index.y + 1, i32vec2Index.x) >= minIndex) &&
-				(cMap2D->GetMapInfo(i32vec2Index.y + 1, i32vec2Index.x) <= maxIndex))
-			{
-				return false;
-			}
-		}
-		// If the new position is between 2 columns, then check both columns as well
-		else if (i32vec2NumMicroSteps.x != 0)
-		{
-			// If the 2 grids are not accessible, then return false
-			if ((cMap2D->GetMapInfo(i32vec2Index.y + 1, i32vec2Index.x) >= minIndex) && (cMap2D->GetMapInfo(i32vec2Index.y + 1, i32vec2Index.x) <= maxIndex) ||
-				(cMap2D->GetMapInfo(i32vec2Index.y + 1, i32vec2Index.x + 1) >= minIndex) && (cMap2D->GetMapInfo(i32vec2Index.y + 1, i32vec2Index.x + 1) <= maxIndex))
-			{
-				return false;
-			}
-		}
-	}
-	else if (eDirection == DOWN)
-	{
-		// If the new position is fully within a column, then check this column only
-		if (i32vec2NumMicroSteps.x == 0)
-		{
-			// If the grid is not accessible, then return false
-			if ((cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x) >= minIndex) &&
-				(cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x) <= maxIndex))
-			{
-				return false;
-			}
-		}
-		// If the new position is between 2 columns, then check both columns as well
-		else if (i32vec2NumMicroSteps.x != 0)
-		{
-			// If the 2 grids are not accessible, then return false
-			if ((cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x) >= minIndex) && (cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x) <= maxIndex) ||
-				(cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x + 1) >= minIndex) && (cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x + 1) <= maxIndex))
-			{
-				return false;
-			}
-		}
-	}
-	else
-	{
-		cout << "CPlayer2D::CheckPosition: Unknown direction." << endl;
-	}
+	// At the right end or the top row there is no tile to move into, so align with the tile
+	if ((eDirection == RIGHT) && (i32vec2Index.x >= cSettings->NUM_TILES_XAXIS - 1))
+		i32vec2NumMicroSteps.x = 0;
+	else if ((eDirection == UP) && (i32vec2Index.y >= cSettings->NUM_TILES_YAXIS - 1))
+		i32vec2NumMicroSteps.y = 0;
 
-	return true;
+	// Check the 1 or 2 tiles which the edge of the new position is in
+	return !cMap2D->IsEdgeBlocked(i32vec2Index, i32vec2NumMicroSteps, CMap2D::DIRECTION_VECTORS[eDirection], uiTileFlags);
 }
 
 // Check if the enemy2D is in mid-air
@@ -632,22 +560,22 @@ void CEnemy2D::UpdateJumpFall(const double dElapsedTime)
 		// Constraint the player's position within the screen boundary
 		Constraint(UP);
 
-		// Iterate through all rows until the proposed row
+		// Sweep through all rows until the proposed row
 		// Check if the player will hit a tile; stop jump if so.
 		int iIndex_YAxis_Proposed = i32vec2Index.y;
-		for (int i = iIndex_YAxis_OLD; i <= iIndex_YAxis_Proposed; i++)
+		int iIndex_YAxis_Blocked = 0;
+		if (cMap2D->SweepRows(glm::i32vec2(i32vec2Index.x, iIndex_YAxis_OLD), i32vec2NumMicroSteps, 1, iIndex_YAxis_Proposed, TILE_SOLID, iIndex_YAxis_Blocked))
 		{
-			// Change the player's index to the current i value
-			i32vec2Index.y = i;
-			// If the new position is not feasible, then revert to old position
-			if (CheckPosition(UP, 1, 99) == false)
-			{
-				// Align with the row
-				i32vec2NumMicroSteps.y = 0;
-				// Set the Physics to fall status
-				cPhysics2D.SetStatus(CPhysics2D::STATUS::FALL);
-				break;
-			}
+			// Stop at the row below the tile, and align with the row
+			i32vec2Index.y = iIndex_YAxis_Blocked;
+			i32vec2NumMicroSteps.y = 0;
+			// Set the Physics to fall status
+			cPhysics2D.SetStatus(CPhysics2D::STATUS::FALL);
+		}
+		else if (i32vec2Index.y >= (int)cSettings->NUM_TILES_YAXIS - 1)
+		{
+			// Align with the top row
+			i32vec2NumMicroSteps.y = 0;
 		}
 
 		// If the player is still jumping and the initial velocity has reached zero or below zero, 
@@ -686,24 +614,17 @@ void CEnemy2D::UpdateJumpFall(const double dElapsedTime)
 		// Constraint the player's position within the screen boundary
 		Constraint(DOWN);
 
-		// Iterate through all rows until the proposed row
+		// Sweep through all rows until the proposed row
 		// Check if the player will hit a tile; stop fall if so.
 		int iIndex_YAxis_Proposed = i32vec2Index.y;
-		for (int i = iIndex_YAxis_OLD; i >= iIndex_YAxis_Proposed; i--)
+		int iIndex_YAxis_Blocked = 0;
+		if (cMap2D->SweepRows(glm::i32vec2(i32vec2Index.x, iIndex_YAxis_OLD), i32vec2NumMicroSteps, -1, iIndex_YAxis_Proposed, TILE_SOLID, iIndex_YAxis_Blocked))
 		{
-			// Change the player's index to the current i value
-			i32vec2Index.y = i;
-			// If the new position is not feasible, then revert to old position
-			if (CheckPosition(DOWN, 1, 99) == false)
-			{
-				// Revert to the previous position
-				if (i != iIndex_YAxis_OLD)
-					i32vec2Index.y = i + 1;
-				// Set the Physics to idle status
-				cPhysics2D.SetStatus(CPhysics2D::STATUS::IDLE);
-				i32vec2NumMicroSteps.y = 0;
-				break;
-			}
+			// Revert to the row above the tile
+			i32vec2Index.y = (iIndex_YAxis_Blocked != iIndex_YAxis_OLD ? iIndex_YAxis_Blocked + 1 : iIndex_YAxis_OLD);
+			// Set the Physics to idle status
+			cPhysics2D.SetStatus(CPhysics2D::STATUS::IDLE);
+			i32vec2NumMicroSteps.y = 0;
 		}
 	}
 }
@@ -727,19 +648,19 @@ bool CEnemy2D::InteractWithPlayer(void)
 		if (!cPlayer2D->isSurvival)
 			return false;
 
+		// The damage and the sound are applied in CommitUpdate
 		switch (enemyType)
 		{
 		case MINION_ENEMY:
-			cPlayer2D->health -= 1.f;
+			fDeferredPlayerDamage += 1.f;
 			sCurrentFSM = IDLE;
 			break;
 		case BOSS_ENEMY:
-			cPlayer2D->health -= 10.f;
+			fDeferredPlayerDamage += 10.f;
 			sCurrentFSM = DEFEND;
 			break;
 		}
-		CSoundController::GetInstance()->PlaySoundByName("playerAttack");
-		cout << "Gotcha!" << endl;
+		vDeferredSounds.push_back("playerAttack");
 		iFSMCounter = 0;
 		iAttackCooldownCounter = 0;
 		return true;
@@ -755,7 +676,7 @@ void CEnemy2D::UpdateDirection(void)
 	if (cPlayer2D->isSurvival)
 		i32vec2Destination = cPlayer2D->i32vec2Index;
 	else
-		i32vec2Destination = glm::i32vec2(Math::RandIntMinMax(0, cSettings->NUM_TILES_XAXIS), i32vec2Index.y);
+		i32vec2Destination = glm::i32vec2(std::uniform_int_distribution<int>(0, cSettings->NUM_TILES_XAXIS)(cRandom), i32vec2Index.y);
 
 	// Calculate the direction between enemy2D and player2D
 	i32vec2Direction = i32vec2Destination - i32vec2Index;
@@ -811,7 +732,7 @@ void CEnemy2D::UpdatePosition(void)
 		Constraint(LEFT);
 
 		// Find a feasible position for the enemy2D's current position
-		if (CheckPosition(LEFT, 1, 99) == false)
+		if (CheckPosition(LEFT, TILE_SOLID) == false)
 		{
 			FlipHorizontalDirection();
 			i32vec2Index = i32vec2OldIndex;
@@ -846,7 +767,7 @@ void CEnemy2D::UpdatePosition(void)
 		Constraint(RIGHT);
 
 		// Find a feasible position for the enemy2D's current position
-		if (CheckPosition(RIGHT, 1, 99) == false)
+		if (CheckPosition(RIGHT, TILE_SOLID) == false)
 		{
 			FlipHorizontalDirection();
 			i32vec2Index = i32vec2OldIndex;
@@ -963,7 +884,6 @@ void CEnemy2D::UpdateDefaultEnemy()
 			{
 				sCurrentFSM = PATROL;
 				iFSMCounter = 0;
-				cout << "ATTACK : Reset counter: " << iFSMCounter << endl;
 			}
 			iFSMCounter++;
 		}
@@ -975,7 +895,6 @@ void CEnemy2D::UpdateDefaultEnemy()
 
 void CEnemy2D::UpdateBossEnemy()
 {
-	std::cout << health << " " << maxHealth << std::endl;
 	//CEnemy2D* newEnemy = SpawnEnemy(301);
 
 	switch (sCurrentFSM)
@@ -1032,8 +951,7 @@ void CEnemy2D::UpdateBossEnemy()
 		iFSMCounter++;
 		break;
 	case SPAWN:
-		cout << "spawning" << endl;
-		spawnEnemy = true;
+		bDeferredSpawnMinion = true;
 		readyToSpawnMinion = false;
 		sCurrentFSM = DEFEND;
 		iFSMCounter = 0;
@@ -1098,7 +1016,6 @@ void CEnemy2D::UpdateBossEnemy()
 			UpdateDirection();
 
 			// Update the Enemy2D's position for attack
-			std::cout << "updated pos" << std::endl;
 			UpdatePosition();
 		}
 		else
@@ -1108,21 +1025,17 @@ void CEnemy2D::UpdateBossEnemy()
 			{
 				sCurrentFSM = PATROL;
 				iFSMCounter = 0;
-				cout << "ATTACK : Reset counter: " << iFSMCounter << endl;
 			}
 			iFSMCounter++;
 		}
 		break;
 	case DEFEND:
-		std::cout << "defending" << std::endl;
-		std::cout << iAggressionCounter << std::endl;
 		//check if distance between player is less than 10, if yes, retreat and run the opposite direction of the player
 		if (cPhysics2D.CalculateDistance(i32vec2Index, cPlayer2D->i32vec2Index) < 10.0f)
 		{
 			iAttackCooldownCounter++;
 			if (iAggressionCounter > 120 && iAttackCooldownCounter > 60)
 			{
-				std::cout << "STRIKE" << std::endl;
 				sCurrentFSM = ATTACK;
 				iFSMCounter = 0;
 			}
@@ -1323,7 +1236,6 @@ void CEnemy2D::UpdateMinionEnemy()
 			{
 				sCurrentFSM = PATROL;
 				iFSMCounter = 0;
-				cout << "ATTACK : Reset counter: " << iFSMCounter << endl;
 			}
 			iFSMCounter++;
 		}
@@ -1339,7 +1251,7 @@ void CEnemy2D::AttackEnemy()
 	{
 		if (CKeyboardController::GetInstance()->IsKeyPressed(GLFW_KEY_E))
 		{
-			CSoundController::GetInstance()->PlaySoundByName("enemyAttack");
+			vDeferredSounds.push_back("enemyAttack");
 			health--;
 			currentColor = glm::vec4(1.f, 0.f, 0.f, 1.f);
 		}
@@ -31,8 +31,13 @@ class CMap2D;
 // Include Player2D
 #include "Player2D.h"
 
+#include <random>
+#include <vector>
+
 class CEnemy2D : public CEntity2D
 {
+	// Let the benchmarks put the enemies back to where they started
+	friend class CScene2DBenchmarks;
 public:
 	// Constructor
 	CEnemy2D(void);
@@ -43,9 +48,18 @@ public:
 	// Init
 	bool Init(void);
 
-	// Update
+	// Update. It only reads the map and the player, so that the enemies can be updated in parallel.
 	void Update(const double dElapsedTime);
 
+	// Apply what the last Update did to the player and the sounds. Returns true if a minion should be spawned.
+	bool CommitUpdate(void);
+
+	// Update the enemies in parallel on CJobSystem, then apply what they did in order.
+	// The positions where minions should be spawned are added to vSpawnPositions.
+	static void UpdateAll(const std::vector<CEnemy2D*>& vEnemies,
+						  const double dElapsedTime,
+						  std::vector<glm::i32vec2>& vSpawnPositions);
+
 	// PreRender
 	void PreRender(void);
 
@@ -128,9 +142,6 @@ protected:
 	// A tile's width or height is in multiples of these microsteps
 	glm::i32vec2 i32vec2NumMicroSteps;
 
-	// The vec2 variable which stores the UV coordinates to render the enemy2D
-	glm::vec2 vec2UVCoordinate;
-
 	// The i32vec2 which stores the indices of the destination for enemy2D in the Map2D
 	glm::i32vec2 i32vec2Destination;
 	// The i32vec2 which stores the direction for enemy2D movement in the Map2D
@@ -171,7 +182,7 @@ protected:
 	void Constraint(DIRECTION eDirection = LEFT);
 
 	// Check if a position is possible to move into
-	bool CheckPosition(DIRECTION eDirection, int minIndex, int maxIndex);
+	bool CheckPosition(DIRECTION eDirection, const unsigned int uiTileFlags);
 
 	// Check if the enemy2D is in mid-air
 	bool IsMidAir(void);
@@ -204,5 +215,13 @@ protected:
 	int iAttackCooldownCounter = 0;
 
 	bool readyToSpawnMinion = true;
+
+	// What Update did to the player, the sounds and the map, which CommitUpdate applies after all the enemies are updated
+	float fDeferredPlayerDamage;
+	std::vector<const char*> vDeferredSounds;
+	bool bDeferredSpawnMinion;
+
+	// The random numbers of this enemy. It is seeded from rand() in Init, so that a run does not depend on which thread updates it.
+	std::minstd_rand cRandom;
 };
 
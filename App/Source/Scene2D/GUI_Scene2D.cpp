@@ -6,6 +6,20 @@
 #include "GUI_Scene2D.h"
 #include "Player2D.h"
 
+// Include Render Queue
+#include "RenderControl\RenderQueue.h"
+// Include Text Renderer
+#include "RenderControl\TextRenderer.h"
+// Include CRenderDevice
+#include "RenderControl\RenderDevice.h"
+// Include AssetManager
+#include "System\AssetManager.h"
+// Include SoundController
+#include "..\SoundController\SoundController.h"
+// Include CProfiler
+#include "TimeControl\Profiler.h"
+
+#include <climits>
 #include <iostream>
 using namespace std;
 /**
@@ -16,8 +30,14 @@ CGUI_Scene2D::CGUI_Scene2D(void)
 	window_flags(0),
 	m_fProgressBar(0.0f),
 	cInventoryManager(NULL),
-	cInventoryItem(NULL)
+	cInventoryItem(NULL),
+	iLabelFrameRate(-1)
 {
+	for (int i = 0; i < sizeof(iLabelItemCounts) / sizeof(*iLabelItemCounts); i++)
+	{
+		iLabelItemCounts[i] = INT_MIN;
+		sInventoryWindowNames[i] = "InventoryItem" + to_string(i);
+	}
 }
 
 /**
@@ -35,7 +55,7 @@ CGUI_Scene2D::~CGUI_Scene2D(void)
 	}
 
 	//cleanup
-	ImGui_ImplOpenGL3_Shutdown();
+	CRenderDevice::GetActive()->ShutdownGUI();
 	ImGui_ImplGlfw_Shutdown();
 	ImGui::DestroyContext();
 }
@@ -67,6 +87,33 @@ void CGUI_Scene2D::RenderShop()
 	ImGui::End();
 }
 
+/**
+ @brief Render the frame time percentiles and the zone times from CProfiler. The zones are in a window which starts collapsed.
+ */
+void CGUI_Scene2D::RenderProfiler()
+{
+#ifdef ENABLE_PROFILER
+	CProfiler* cProfiler = CProfiler::GetInstance();
+	ImGui::TextColored(ImVec4(1, 1, 0, 1), "Frame time p50: %.2f ms, p95: %.2f ms, p99: %.2f ms (F9 to write profile.json)",
+		cProfiler->GetFrameTimeP50(),
+		cProfiler->GetFrameTimeP95(),
+		cProfiler->GetFrameTimeP99());
+
+	ImGui::SetNextWindowPos(ImVec2(10.0f, 300.0f), ImGuiCond_FirstUseEver);
+	ImGui::SetNextWindowCollapsed(true, ImGuiCond_FirstUseEver);
+	ImGui::Begin("Profiler", NULL, ImGuiWindowFlags_AlwaysAutoResize);
+	const std::vector<CProfiler::ZoneStats>& vZoneStats = cProfiler->GetZoneStats();
+	for (unsigned int i = 0; i < vZoneStats.size(); i++)
+	{
+		ImGui::Text("%-28s %7.3f ms  %4u calls",
+			vZoneStats[i].pName,
+			vZoneStats[i].dAverageTime,
+			vZoneStats[i].uiFrameCalls);
+	}
+	ImGui::End();
+#endif
+}
+
 void CGUI_Scene2D::RenderWeapon()
 {
 	if (cInventoryManager->currentWeapon == nullptr)
@@ -123,7 +170,7 @@ bool CGUI_Scene2D::Init(void)
 	//setup renderer
 	ImGui_ImplGlfw_InitForOpenGL(CSettings::GetInstance()->pWindow, true);
 	const char* glsl_version = "#version 330";
-	ImGui_ImplOpenGL3_Init(glsl_version);
+	CRenderDevice::GetActive()->InitGUI(glsl_version);
 
 	//define window flags
 	window_flags = 0;
@@ -141,8 +188,10 @@ bool CGUI_Scene2D::Init(void)
  */
 void CGUI_Scene2D::Update(const double dElapsedTime)
 {
+	PROFILE_ZONE("CGUI_Scene2D::Update");
+
 	//start imgui frame
-	ImGui_ImplOpenGL3_NewFrame();
+	CRenderDevice::GetActive()->NewGUIFrame();
 	ImGui_ImplGlfw_NewFrame();
 	ImGui::NewFrame();
 
@@ -153,7 +202,34 @@ void CGUI_Scene2D::Update(const double dElapsedTime)
 	ImGui::SetWindowFontScale(1.5f);
 
 	ImVec4 col = ImVec4(0.0f, 1.0f, 0.0f, 1.0f);
-	ImGui::TextColored(ImVec4(1, 1, 0, 1), "FPS: %d", cFPSCounter->GetFrameRate());
+	if (iLabelFrameRate != cFPSCounter->GetFrameRate())
+	{
+		iLabelFrameRate = cFPSCounter->GetFrameRate();
+		sFPSLabel = "FPS: " + to_string(iLabelFrameRate);
+	}
+	ImGui::TextColored(ImVec4(1, 1, 0, 1), "%s", sFPSLabel.c_str());
+	ImGui::TextColored(ImVec4(1, 1, 0, 1), "Frame time jitter: %.2f ms, Max frame time: %.2f ms, CPU: %.0f%%",
+		cFPSCounter->GetFrameTimeJitter(),
+		cFPSCounter->GetMaxFrameTime(),
+		cFPSCounter->GetCPUUsage());
+	// Display the render queue counters from the last frame
+	const RenderQueueStats& sRenderStats = CRenderQueue::GetInstance()->GetStats();
+	ImGui::TextColored(ImVec4(1, 1, 0, 1), "Draws: %u, State changes saved: %u",
+		sRenderStats.uiNumDrawCalls, sRenderStats.uiNumStateChangesSaved);
+	ImGui::TextColored(ImVec4(1, 1, 0, 1), "Text cache hit rate: %.1f%%, Glyph atlas: %u KB, %u glyphs",
+		CTextRenderer::GetInstance()->GetCacheHitRate() * 100.0f,
+		CTextRenderer::GetInstance()->GetAtlasMemory() / 1024,
+		CTextRenderer::GetInstance()->GetNumGlyphs());
+	ImGui::TextColored(ImVec4(1, 1, 0, 1), "Textures: %u (%u KB), Image decodes: %u",
+		CAssetManager::GetInstance()->GetNumTextures(),
+		CAssetManager::GetInstance()->GetTextureMemory() / 1024,
+		CAssetManager::GetInstance()->GetNumDecodes());
+	ImGui::TextColored(ImVec4(1, 1, 0, 1), "Voices: %u, Voice steals: %u, Audio memory: %u KB, Play cost: %.3f ms",
+		CSoundController::GetInstance()->GetNumActiveVoices(),
+		CSoundController::GetInstance()->GetNumVoiceSteals(),
+		CSoundController::GetInstance()->GetAudioMemory() / 1024,
+		CSoundController::GetInstance()->GetAveragePlayTime());
+	RenderProfiler();
 
 	for (int i = 0; i < sizeof(cInventoryManager->inventoryArray) / sizeof(*cInventoryManager->inventoryArray); i++)
 	{
@@ -169,8 +245,7 @@ void CGUI_Scene2D::Update(const double dElapsedTime)
 			ImGuiWindowFlags_NoCollapse |
 			ImGuiWindowFlags_NoScrollbar;
 
-		string begin = "InventoryItem" + to_string(i);
-		ImGui::Begin(begin.c_str(), NULL, InventoryWindowFlags);
+		ImGui::Begin(sInventoryWindowNames[i].c_str(), NULL, InventoryWindowFlags);
 		ImGui::SetWindowPos(ImVec2(1210, 240 + i * 30));
 		ImGui::SetWindowSize(ImVec2(100.0f, 25.0f));
 		cInventoryItem = cInventoryManager->inventoryArray[i];
@@ -182,7 +257,12 @@ void CGUI_Scene2D::Update(const double dElapsedTime)
 			ImVec2(0, 1), ImVec2(1, 0));
 		ImGui::SameLine();
 		ImGui::SetWindowFontScale(1.5f);
-		ImGui::TextColored(ImVec4(1, 1, 0, 1), "%d", itemCount);
+		if (iLabelItemCounts[i] != itemCount)
+		{
+			iLabelItemCounts[i] = itemCount;
+			sItemCountLabels[i] = to_string(itemCount);
+		}
+		ImGui::TextColored(ImVec4(1, 1, 0, 1), "%s", sItemCountLabels[i].c_str());
 		ImGui::End();
 	}
 
@@ -258,9 +338,11 @@ void CGUI_Scene2D::PreRender(void)
  */
 void CGUI_Scene2D::Render()
 {
+	PROFILE_ZONE("CGUI_Scene2D::Render");
+
 	//Rendering
 	ImGui::Render();
-	ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+	CRenderDevice::GetActive()->RenderGUI(ImGui::GetDrawData());
 }
 
 /**
@@ -86,7 +86,17 @@ protected:
 	ImGuiWindowFlags window_flags;
 	float m_fProgressBar;
 
+	// The HUD labels, which are only rebuilt when their values change
+	int iLabelFrameRate;
+	string sFPSLabel;
+	int iLabelItemCounts[5];
+	string sItemCountLabels[5];
+	string sInventoryWindowNames[5];
+
 	void RenderShop();
 
 	void RenderWeapon();
+
+	// Render the frame time percentiles and the zone times from CProfiler
+	void RenderProfiler();
 };
@@ -0,0 +1,487 @@
+/**
+ CHeadlessDriver
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#include "HeadlessDriver.h"
+
+// Include CScene2D
+#include "Scene2D.h"
+
+// Include the render devices
+#include "RenderControl\RenderDevice.h"
+#include "RenderControl\RecordingRenderDevice.h"
+// Include CAssetLoader and CTexturePack to load the assets as the Application does
+#include "System\AssetLoader.h"
+#include "System\TexturePack.h"
+// Include CJobSystem to update the enemies in parallel as the Application does
+#include "System\JobSystem.h"
+// Include CStopWatch to time the ticks
+#include "TimeControl\StopWatch.h"
+
+// Include GLFW for the key and mouse button codes
+#include <GLFW/glfw3.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cctype>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+using namespace std;
+
+/**
+ @brief Constructor
+ */
+CHeadlessDriver::CHeadlessDriver(void)
+	: cScene2D(NULL)
+	, pRenderDevice(NULL)
+	, uiNextInput(0)
+	, dTimeStep(0.0)
+{
+}
+
+/**
+ @brief Destructor
+ */
+CHeadlessDriver::~CHeadlessDriver(void)
+{
+	Destroy();
+}
+
+/**
+ @brief Initialise the scene without a window
+ @param uiSeed The seed of the random number generator, so that a run can be repeated
+ @return A bool value. true if the scene was initialised, else false
+ */
+bool CHeadlessDriver::Init(const unsigned int uiSeed)
+{
+	CSettings* cSettings = CSettings::GetInstance();
+	cSettings->bHeadless = true;
+	cSettings->bOfflineAudio = true;
+	dTimeStep = 1.0 / cSettings->iTickRate;
+
+	// Record the calls to the renderer, without storing them, as there is no GL context
+	pRenderDevice = new CRecordingRenderDevice();
+	pRenderDevice->SetRecordCommands(false);
+	CRenderDevice::SetActive(pRenderDevice);
+
+	srand(uiSeed);
+
+	// Load the assets in the same way as the Application
+	CAssetLoader::GetInstance()->Init();
+	CJobSystem::GetInstance()->Init();
+	if (cSettings->bUseTexturePack == true)
+		CTexturePack::GetInstance()->Open("Image\\Textures.pack");
+
+	cScene2D = CScene2D::GetInstance();
+	if (cScene2D->Init() == false)
+	{
+		cout << "Failed to initialise CScene2D without a window" << endl;
+		return false;
+	}
+
+	vTickTimes.clear();
+	return true;
+}
+
+/**
+ @brief Destroy the scene and restore the OpenGL render device
+ */
+void CHeadlessDriver::Destroy(void)
+{
+	if (cScene2D)
+	{
+		cScene2D->Destroy();
+		cScene2D = NULL;
+	}
+
+	if (pRenderDevice)
+	{
+		CRenderDevice::SetActive(nullptr);
+		delete pRenderDevice;
+		pRenderDevice = NULL;
+	}
+}
+
+/**
+ @brief Load a world from the Maps folder, or generate it if it does not exist
+ @param worldName The name of the world, e.g. START
+ @return A bool value. true if the world was loaded or generated, else false
+ */
+bool CHeadlessDriver::LoadWorld(const std::string& worldName)
+{
+	if (cScene2D == NULL)
+		return false;
+	return cScene2D->LoadWorld(worldName);
+}
+
+/**
+ @brief Load scripted input from a file, with one event per line. The lines which start with # are comments.
+		<tick>, key, <name or GLFW code>, press|release
+		<tick>, mouse, left|right|middle, press|release, <x>, <y>
+ @param filename The name of the script file
+ @return A bool value. true if every line was read, else false
+ */
+bool CHeadlessDriver::LoadScript(const std::string& filename)
+{
+	ifstream inFile(filename.c_str());
+	if (!inFile.is_open())
+	{
+		cout << "Unable to open the input script " << filename << endl;
+		return false;
+	}
+
+	string line;
+	unsigned int uiLine = 0;
+	while (getline(inFile, line))
+	{
+		uiLine++;
+		if ((line.empty()) || (line[0] == '#'))
+			continue;
+
+		// Split the line into its fields, without the spaces around them
+		vector<string> vFields;
+		stringstream ss(line);
+		string field;
+		while (getline(ss, field, ','))
+		{
+			field.erase(0, field.find_first_not_of(" \t\r"));
+			field.erase(field.find_last_not_of(" \t\r") + 1);
+			vFields.push_back(field);
+		}
+		if ((vFields.size() == 1) && (vFields[0].empty()))
+			continue;
+
+		InputEvent sEvent;
+		sEvent.uiTick = (unsigned int)atoi(vFields[0].c_str());
+		sEvent.bMouse = ((vFields.size() > 1) && (vFields[1] == "mouse"));
+		sEvent.iCode = -1;
+		sEvent.bPress = ((vFields.size() > 3) && (vFields[3] == "press"));
+		sEvent.dX = 0.0;
+		sEvent.dY = 0.0;
+		if ((vFields.size() == 4) && (vFields[1] == "key"))
+		{
+			sEvent.iCode = ParseKey(vFields[2]);
+		}
+		else if ((vFields.size() == 6) && (sEvent.bMouse))
+		{
+			sEvent.iCode = ParseMouseButton(vFields[2]);
+			sEvent.dX = atof(vFields[4].c_str());
+			sEvent.dY = atof(vFields[5].c_str());
+		}
+		if ((sEvent.iCode < 0) || ((!sEvent.bPress) && (vFields[3] != "release")))
+		{
+			cout << filename << "(" << uiLine << "): invalid input event: " << line << endl;
+			return false;
+		}
+		AddInput(sEvent);
+	}
+	return true;
+}
+
+/**
+ @brief Add a scripted input event. The events for the ticks which were run already are ignored.
+ @param sEvent The input event
+ */
+void CHeadlessDriver::AddInput(const InputEvent& sEvent)
+{
+	if (sEvent.uiTick < GetNumTicks())
+	{
+		cout << "Ignoring an input event for tick " << sEvent.uiTick << ", which was run already" << endl;
+		return;
+	}
+
+	// Keep the events sorted by their ticks, and in the order in which they were added within a tick
+	vector<InputEvent>::iterator it = upper_bound(vInputs.begin(), vInputs.end(), sEvent,
+		[](const InputEvent& a, const InputEvent& b) { return a.uiTick < b.uiTick; });
+	vInputs.insert(it, sEvent);
+}
+
+/**
+ @brief Add a key press or release
+ @param uiTick The tick to apply the event before
+ @param iKey The GLFW key code
+ @param bPress A bool which is true for a press, and false for a release
+ */
+void CHeadlessDriver::AddKey(const unsigned int uiTick, const int iKey, const bool bPress)
+{
+	InputEvent sEvent = { uiTick, false, iKey, bPress, 0.0, 0.0 };
+	AddInput(sEvent);
+}
+
+/**
+ @brief Add a mouse button press or release at a position
+ @param uiTick The tick to apply the event before
+ @param iButton The GLFW mouse button code
+ @param bPress A bool which is true for a press, and false for a release
+ @param dX The x position of the mouse in window pixels
+ @param dY The y position of the mouse in window pixels
+ */
+void CHeadlessDriver::AddMouseButton(const unsigned int uiTick, const int iButton, const bool bPress, const double dX, const double dY)
+{
+	InputEvent sEvent = { uiTick, true, iButton, bPress, dX, dY };
+	AddInput(sEvent);
+}
+
+/**
+ @brief Run a number of ticks, continuing from the last tick which was run.
+		Each tick runs the same steps as a fixed update in Application::Run.
+ @param uiNumTicks The number of ticks to run
+ */
+void CHeadlessDriver::Run(const unsigned int uiNumTicks)
+{
+	if (cScene2D == NULL)
+		return;
+
+	CKeyboardController* cKeyboardController = CKeyboardController::GetInstance();
+	CMouseController* cMouseController = CMouseController::GetInstance();
+	CSoundController* cSoundController = CSoundController::GetInstance();
+	CStopWatch cStopWatch;
+
+	vTickTimes.reserve(vTickTimes.size() + uiNumTicks);
+	for (unsigned int i = 0; i < uiNumTicks; i++)
+	{
+		ApplyInputs(GetNumTicks());
+
+		cStopWatch.StartTimer();
+
+		cKeyboardController->BeginFixedUpdate();
+		cMouseController->BeginFixedUpdate();
+		cScene2D->FixedUpdate(dTimeStep);
+		cKeyboardController->EndFixedUpdate();
+		cMouseController->EndFixedUpdate();
+
+		// Mix the sounds which were played in this tick
+		cSoundController->Update(dTimeStep);
+
+		vTickTimes.push_back(cStopWatch.GetElapsedTime() * 1000.0);
+
+		cKeyboardController->PostUpdate();
+		cMouseController->PostUpdate();
+	}
+}
+
+/**
+ @brief Get the number of ticks which were run
+ */
+unsigned int CHeadlessDriver::GetNumTicks(void) const
+{
+	return (unsigned int)vTickTimes.size();
+}
+
+/**
+ @brief Get the time of each tick in milliseconds
+ */
+const std::vector<double>& CHeadlessDriver::GetTickTimes(void) const
+{
+	return vTickTimes;
+}
+
+/**
+ @brief Get a percentile of the tick times
+ @param dPercentile The percentile, from 0 to 100
+ @return The tick time in milliseconds, or 0 if no ticks were run
+ */
+double CHeadlessDriver::GetTickTimePercentile(const double dPercentile) const
+{
+	if (vTickTimes.empty())
+		return 0.0;
+
+	vector<double> vSortedTimes(vTickTimes);
+	const size_t uiIndex = (size_t)((vSortedTimes.size() - 1) * dPercentile / 100.0 + 0.5);
+	nth_element(vSortedTimes.begin(), vSortedTimes.begin() + uiIndex, vSortedTimes.end());
+	return vSortedTimes[uiIndex];
+}
+
+/**
+ @brief Get the scene which is run
+ */
+CScene2D* CHeadlessDriver::GetScene2D(void) const
+{
+	return cScene2D;
+}
+
+/**
+ @brief Print out the tick time statistics and the state of the player and enemies
+ */
+void CHeadlessDriver::PrintReport(void) const
+{
+	double dTotalTime = 0.0;
+	for (unsigned int i = 0; i < vTickTimes.size(); i++)
+		dTotalTime += vTickTimes[i];
+
+	cout << "CHeadlessDriver::PrintReport()" << endl;
+	cout << "Ticks: " << vTickTimes.size() << " at " << 1.0 / dTimeStep << " Hz, total: " << dTotalTime << " ms" << endl;
+	if (!vTickTimes.empty())
+	{
+		cout << "Tick time mean: " << dTotalTime / vTickTimes.size()
+			 << " ms, p50: " << GetTickTimePercentile(50.0)
+			 << " ms, p95: " << GetTickTimePercentile(95.0)
+			 << " ms, p99: " << GetTickTimePercentile(99.0)
+			 << " ms, max: " << GetTickTimePercentile(100.0) << " ms" << endl;
+		cout << "Ticks per second: " << vTickTimes.size() * 1000.0 / dTotalTime << endl;
+	}
+
+	if (cScene2D)
+	{
+		const CPlayer2D* cPlayer2D = cScene2D->GetPlayer2D();
+		cout << "Player tile: " << cPlayer2D->i32vec2Index.x << ", " << cPlayer2D->i32vec2Index.y
+			 << ", health: " << cPlayer2D->health << " / " << cPlayer2D->maxHealth << endl;
+		cout << "Enemies: " << cScene2D->GetEnemies().size() << endl;
+	}
+}
+
+/**
+ @brief Write the time of each tick to a CSV file
+ @param filename The name of the CSV file
+ @return A bool value. true if the file was written, else false
+ */
+bool CHeadlessDriver::WriteCSV(const std::string& filename) const
+{
+	ofstream outFile(filename.c_str());
+	if (!outFile.is_open())
+	{
+		cout << "Unable to write the tick times to " << filename << endl;
+		return false;
+	}
+
+	outFile << "tick,ms" << endl;
+	for (unsigned int i = 0; i < vTickTimes.size(); i++)
+		outFile << i << "," << vTickTimes[i] << endl;
+	return true;
+}
+
+/**
+ @brief Parse the command line arguments after --headless, and run the scene.
+		--ticks <number>	The number of ticks to run. The default is 600.
+		--world <name>		The world to load or generate. The default is the map loaded by CScene2D::Init.
+		--script <file>		The scripted input
+		--seed <number>		The seed of the random number generator. The default is 0.
+		--csv <file>		Write the time of each tick to a CSV file
+ @param argc The number of arguments
+ @param argv The arguments
+ @return The exit code. 0 if the scene was run, else 1
+ */
+int CHeadlessDriver::RunFromCommandLine(const int argc, char* argv[])
+{
+	unsigned int uiNumTicks = 600;
+	unsigned int uiSeed = 0;
+	string worldName, scriptName, csvName;
+	for (int i = 1; i < argc; i++)
+	{
+		const string arg = argv[i];
+		const bool bHasValue = (i + 1 < argc);
+		if (arg == "--headless")
+			continue;
+		else if ((arg == "--ticks") && (bHasValue))
+			uiNumTicks = (unsigned int)atoi(argv[++i]);
+		else if ((arg == "--world") && (bHasValue))
+			worldName = argv[++i];
+		else if ((arg == "--script") && (bHasValue))
+			scriptName = argv[++i];
+		else if ((arg == "--seed") && (bHasValue))
+			uiSeed = (unsigned int)atoi(argv[++i]);
+		else if ((arg == "--csv") && (bHasValue))
+			csvName = argv[++i];
+		else
+		{
+			cout << "Unknown argument: " << arg << endl;
+			cout << "Usage: --headless [--ticks <number>] [--world <name>] [--script <file>] [--seed <number>] [--csv <file>]" << endl;
+			return 1;
+		}
+	}
+
+	CHeadlessDriver cDriver;
+	if (!cDriver.Init(uiSeed))
+		return 1;
+	if ((!worldName.empty()) && (!cDriver.LoadWorld(worldName)))
+		return 1;
+	if ((!scriptName.empty()) && (!cDriver.LoadScript(scriptName)))
+		return 1;
+
+	cDriver.Run(uiNumTicks);
+	cDriver.PrintReport();
+	if ((!csvName.empty()) && (!cDriver.WriteCSV(csvName)))
+		return 1;
+	return 0;
+}
+
+/**
+ @brief Convert the name of a key to a GLFW key code
+ @param name A letter or digit, a name such as SPACE or LEFT_SHIFT, or a GLFW key code
+ @return The GLFW key code, or -1 if the name is not known
+ */
+int CHeadlessDriver::ParseKey(const std::string& name)
+{
+	// Letters and digits have the same GLFW codes as their upper case characters
+	if ((name.length() == 1) && (isalnum((unsigned char)name[0])))
+		return toupper((unsigned char)name[0]);
+	if ((!name.empty()) && (isdigit((unsigned char)name[0])))
+		return atoi(name.c_str());
+
+	static const struct
+	{
+		const char* pName;
+		int iKey;
+	} sKeyNames[] = {
+		{ "SPACE", GLFW_KEY_SPACE },
+		{ "ENTER", GLFW_KEY_ENTER },
+		{ "ESCAPE", GLFW_KEY_ESCAPE },
+		{ "TAB", GLFW_KEY_TAB },
+		{ "BACKSPACE", GLFW_KEY_BACKSPACE },
+		{ "LEFT", GLFW_KEY_LEFT },
+		{ "RIGHT", GLFW_KEY_RIGHT },
+		{ "UP", GLFW_KEY_UP },
+		{ "DOWN", GLFW_KEY_DOWN },
+		{ "LEFT_SHIFT", GLFW_KEY_LEFT_SHIFT },
+		{ "CAPS_LOCK", GLFW_KEY_CAPS_LOCK },
+	};
+	for (unsigned int i = 0; i < sizeof(sKeyNames) / sizeof(sKeyNames[0]); i++)
+	{
+		if (name == sKeyNames[i].pName)
+			return sKeyNames[i].iKey;
+	}
+	return -1;
+}
+
+/**
+ @brief Convert the name of a mouse button to a GLFW mouse button code
+ @param name left, right or middle
+ @return The GLFW mouse button code, or -1 if the name is not known
+ */
+int CHeadlessDriver::ParseMouseButton(const std::string& name)
+{
+	if (name == "left")
+		return GLFW_MOUSE_BUTTON_LEFT;
+	if (name == "right")
+		return GLFW_MOUSE_BUTTON_RIGHT;
+	if (name == "middle")
+		return GLFW_MOUSE_BUTTON_MIDDLE;
+	return -1;
+}
+
+/**
+ @brief Apply the scripted input events of a tick to the keyboard and mouse controllers
+ @param uiTick The tick which is about to run
+ */
+void CHeadlessDriver::ApplyInputs(const unsigned int uiTick)
+{
+	while ((uiNextInput < vInputs.size()) && (vInputs[uiNextInput].uiTick <= uiTick))
+	{
+		const InputEvent& sEvent = vInputs[uiNextInput];
+		if (sEvent.bMouse)
+		{
+			CMouseController::GetInstance()->UpdateMousePosition(sEvent.dX, sEvent.dY);
+			if (sEvent.bPress)
+				CMouseController::GetInstance()->UpdateMouseButtonPressed(sEvent.iCode);
+			else
+				CMouseController::GetInstance()->UpdateMouseButtonReleased(sEvent.iCode);
+		}
+		else
+		{
+			CKeyboardController::GetInstance()->Update(sEvent.iCode, sEvent.bPress ? GLFW_PRESS : GLFW_RELEASE);
+		}
+		uiNextInput++;
+	}
+}
@@ -0,0 +1,100 @@
+/**
+ CHeadlessDriver
+ @brief Runs CScene2D without a window or GL context. The calls to the renderer are sent to a
+		CRecordingRenderDevice and the sounds are mixed by the offline sound backend.
+		It loads a world, feeds scripted key and mouse input, and steps CScene2D::FixedUpdate
+		a number of ticks while timing each tick. It is used from the command line with
+		--headless to benchmark and soak test the game on machines without a GPU, and from tests.
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#pragma once
+
+#include <string>
+#include <vector>
+
+class CScene2D;
+class CRecordingRenderDevice;
+
+class CHeadlessDriver
+{
+public:
+	// A scripted key or mouse button event, which is applied before a tick
+	struct InputEvent
+	{
+		unsigned int uiTick;
+		bool bMouse;
+		// The GLFW key or mouse button
+		int iCode;
+		bool bPress;
+		// The mouse position in window pixels, for mouse events
+		double dX;
+		double dY;
+	};
+
+	// Constructor
+	CHeadlessDriver(void);
+	// Destructor
+	~CHeadlessDriver(void);
+
+	// Initialise the scene without a window. The random number generator is seeded with uiSeed.
+	bool Init(const unsigned int uiSeed = 0);
+	// Destroy the scene and restore the OpenGL render device
+	void Destroy(void);
+
+	// Load a world from the Maps folder, or generate it if it does not exist
+	bool LoadWorld(const std::string& worldName);
+
+	// Load scripted input from a file, with one event per line:
+	// <tick>, key, <name or GLFW code>, press|release
+	// <tick>, mouse, left|right|middle, press|release, <x>, <y>
+	bool LoadScript(const std::string& filename);
+	// Add a scripted input event
+	void AddInput(const InputEvent& sEvent);
+	// Add a key press or release
+	void AddKey(const unsigned int uiTick, const int iKey, const bool bPress);
+	// Add a mouse button press or release at a position in window pixels
+	void AddMouseButton(const unsigned int uiTick, const int iButton, const bool bPress, const double dX, const double dY);
+
+	// Run a number of ticks, continuing from the last tick which was run
+	void Run(const unsigned int uiNumTicks);
+
+	// Get the number of ticks which were run
+	unsigned int GetNumTicks(void) const;
+	// Get the time of each tick in milliseconds
+	const std::vector<double>& GetTickTimes(void) const;
+	// Get a percentile of the tick times in milliseconds, from 0 to 100
+	double GetTickTimePercentile(const double dPercentile) const;
+	// Get the scene which is run
+	CScene2D* GetScene2D(void) const;
+
+	// Print out the tick time statistics and the state of the player and enemies
+	void PrintReport(void) const;
+	// Write the time of each tick to a CSV file
+	bool WriteCSV(const std::string& filename) const;
+
+	// Parse the command line arguments after --headless, and run the scene. The return value is the exit code.
+	static int RunFromCommandLine(const int argc, char* argv[]);
+
+protected:
+	// Convert the name of a key, e.g. A, SPACE or LEFT_SHIFT, or a GLFW code to a GLFW key code, or return -1
+	static int ParseKey(const std::string& name);
+	// Convert the name of a mouse button to a GLFW mouse button code, or return -1
+	static int ParseMouseButton(const std::string& name);
+
+	// Apply the scripted input events of a tick to the keyboard and mouse controllers
+	void ApplyInputs(const unsigned int uiTick);
+
+	CScene2D* cScene2D;
+	// The render device which records the calls instead of sending them to a GPU
+	CRecordingRenderDevice* pRenderDevice;
+
+	// The scripted input events, sorted by their ticks, and the next one to apply
+	std::vector<InputEvent> vInputs;
+	unsigned int uiNextInput;
+
+	// The fixed time step in seconds
+	double dTimeStep;
+	// The time of each tick in milliseconds
+	std::vector<double> vTickTimes;
+};
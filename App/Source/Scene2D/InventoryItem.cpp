@@ -7,7 +7,9 @@
 @brief Constructor
 */
 CInventoryItem::CInventoryItem(const char* imagePath)
-	: iItemCount(0)
+	: iItemID(-1)
+	, bCyclable(true)
+	, iItemCount(0)
 	, iItemMaxCount(0)
 	, vec2Size(glm::vec2(0.0f))
 {
@@ -36,6 +36,10 @@ public:
 
 	// Name of the inventory item
 	std::string sName;
+	// The ID of the item in CInventoryManager, which is used instead of the name while the game runs
+	int iItemID;
+	// If the item is in the slots which CInventoryManager::CycleThroughInventory cycles through
+	bool bCyclable;
 	// The size of the image to render in the GUI
 	glm::vec2 vec2Size;
 
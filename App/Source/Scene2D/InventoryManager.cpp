@@ -24,7 +24,7 @@ CInventoryManager::~CInventoryManager(void)
 }
 
 /**
-@brief Cycle through inventoryMap
+@brief Cycle through the items, in the order of their names
 */
 void CInventoryManager::CycleThroughInventory()
 {
@@ -35,28 +35,29 @@ void CInventoryManager::CycleThroughInventory()
 	}
 
 	bool cycle = false;
-	for (const auto& p : inventoryMap)
+	for (const int iItemID : vCycleOrder)
 	{
+		CInventoryItem* cItem = vItems[iItemID];
 		if (inventoryArray[0] == nullptr) //check if first inventory array is nullptr, then set first item to that
 		{
-			inventoryArray[0] = p.second;
+			inventoryArray[0] = cItem;
 			break;
 		}
-		if (p.second->sName == "Selector" || p.second->sName == "Fist" || p.second->sName == "StoneSword") //skip selector
+		if (!cItem->bCyclable) //skip selector, fist and weapons
 			continue;
-		if (cycle) //cycle to next item in inventoryMap 
+		if (cycle) //cycle to next item in vCycleOrder 
 		{
-			inventoryArray[0] = p.second;
+			inventoryArray[0] = cItem;
 			break;
 		}
-		else if (p.second == inventoryArray[0]) //check if first inventory array is current p 
+		else if (cItem == inventoryArray[0]) //check if first inventory array is current item 
 		{
-			cycle = true; //next p iteration, set the first inventory array to be that (basically cycle to next item)
+			cycle = true; //next iteration, set the first inventory array to be that (basically cycle to next item)
 			continue;
 		}
-		else if (inventoryArray[0] == (--inventoryMap.end())->second) //check if first inventory array == last element in inventoryMap
+		else if (inventoryArray[0] == vItems[vCycleOrder.back()]) //check if first inventory array == last item in vCycleOrder
 		{
-			inventoryArray[0] = inventoryMap.begin()->second; //if yes, set it back to the first element
+			inventoryArray[0] = vItems[vCycleOrder.front()]; //if yes, set it back to the first item
 			break;
 		}
 	}
@@ -126,22 +127,19 @@ void CInventoryManager::PostRender(void)
 */
 void CInventoryManager::Exit(void)
 {
-	// Delete all scenes stored and empty the entire map
-	//inventoryMap->Release();
-	//inventoryMap = nullptr;
-	std::map<std::string, CInventoryItem*>::iterator it, end;
-	end = inventoryMap.end();
-	for (it = inventoryMap.begin(); it != end; ++it)
+	// Delete all the items and empty the slots
+	for (unsigned int i = 0; i < vItems.size(); i++)
 	{
-		delete it->second;
-		it->second = nullptr;
+		delete vItems[i];
+		vItems[i] = nullptr;
 	}
-	inventoryMap.clear();
+	vItems.clear();
+	mItemIDs.clear();
+	vCycleOrder.clear();
 }
 
 /**
-@brief 
-a Scene to this Inventory Manager
+@brief Add an item to this Inventory Manager. Its name is given an ID, which the item keeps in iItemID.
 */
 CInventoryItem* CInventoryManager::Add(	const std::string& _name,
 								const char* imagePath,
@@ -160,8 +158,22 @@ CInventoryItem* CInventoryManager::Add(	const std::string& _name,
 	cNewItem->iItemCount = iItemCount;
 	cNewItem->sName = _name;
 
-	// Nothing wrong, add the scene to our map
-	inventoryMap[_name] = cNewItem;
+	// Use the ID of the name if it had an item before, else give it the next ID
+	std::map<std::string, int>::const_iterator it = mItemIDs.find(_name);
+	if (it != mItemIDs.end())
+	{
+		cNewItem->iItemID = it->second;
+	}
+	else
+	{
+		cNewItem->iItemID = (int)vItems.size();
+		mItemIDs[_name] = cNewItem->iItemID;
+		vItems.push_back(nullptr);
+	}
+
+	// Nothing wrong, add the item to its slot
+	vItems[cNewItem->iItemID] = cNewItem;
+	UpdateCycleOrder();
 
 	return cNewItem;
 }
@@ -172,18 +184,19 @@ CInventoryItem* CInventoryManager::Add(	const std::string& _name,
 bool CInventoryManager::Remove(const std::string& _name)
 {
 	// Does nothing if it does not exist
-	if (Check(_name))
+	if (!Check(_name))
 	{
 		// Item is not available, unable to proceed
 		throw std::exception("Unknown item name provided");
 		return false;
 	}
 
-	CInventoryItem* target = inventoryMap[_name];
+	const int iItemID = GetItemID(_name);
 
-	// Delete and remove from our map
-	delete target;
-	inventoryMap.erase(_name);
+	// Delete and empty its slot
+	delete vItems[iItemID];
+	vItems[iItemID] = nullptr;
+	UpdateCycleOrder();
 
 	return true;
 }
@@ -191,22 +204,51 @@ bool CInventoryManager::Remove(const std::string& _name)
 /**
 @brief Check if a item exists in this Inventory Manager
 */
-bool CInventoryManager::Check(const std::string& _name)
+bool CInventoryManager::Check(const std::string& _name) const
 {
-	return inventoryMap.count(_name) != 0;
+	return Check(GetItemID(_name));
+}
+
+/**
+@brief Check if a item exists in this Inventory Manager
+@param iItemID The ID of the item
+*/
+bool CInventoryManager::Check(const int iItemID) const
+{
+	return (iItemID >= 0) && (iItemID < (int)vItems.size()) && (vItems[iItemID] != nullptr);
+}
+
+/**
+@brief Get the ID of an item by its name. It is for the UI and the files, so that the game uses the ID instead.
+*/
+int CInventoryManager::GetItemID(const std::string& _name) const
+{
+	std::map<std::string, int>::const_iterator it = mItemIDs.find(_name);
+	if (it == mItemIDs.end())
+		return NO_ITEM;
+	return it->second;
 }
 
 /**
 @brief Get an item by its name
 */ 
-CInventoryItem* CInventoryManager::GetItem(const std::string& _name)
+CInventoryItem* CInventoryManager::GetItem(const std::string& _name) const
+{
+	return GetItem(GetItemID(_name));
+}
+
+/**
+@brief Get an item by its ID
+@param iItemID The ID of the item
+@return The item, or NULL if it does not exist
+*/
+CInventoryItem* CInventoryManager::GetItem(const int iItemID) const
 {
 	// Does nothing if it does not exist
-	if (!Check(_name))
+	if (!Check(iItemID))
 		return NULL;
 
-	// Find and return the item
-	return inventoryMap[_name];
+	return vItems[iItemID];
 }
 
 /**
@@ -214,5 +256,26 @@ CInventoryItem* CInventoryManager::GetItem(const std::string& _name)
 */
 int CInventoryManager::GetNumItems(void) const
 {
-	return inventoryMap.size();
-}
\ No newline at end of file
+	return (int)vCycleOrder.size();
+}
+
+/**
+@brief Get the number of item IDs
+*/
+int CInventoryManager::GetNumItemIDs(void) const
+{
+	return (int)vItems.size();
+}
+
+/**
+@brief Rebuild vCycleOrder from the names of the items, after an item was added or removed
+*/
+void CInventoryManager::UpdateCycleOrder(void)
+{
+	vCycleOrder.clear();
+	for (std::map<std::string, int>::const_iterator it = mItemIDs.begin(); it != mItemIDs.end(); ++it)
+	{
+		if (vItems[it->second] != nullptr)
+			vCycleOrder.push_back(it->second);
+	}
+}
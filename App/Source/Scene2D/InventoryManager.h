@@ -10,6 +10,7 @@ Date: Mar 2020
 
 #include <map>
 #include <string>
+#include <vector>
 #include "InventoryItem.h"
 
 class CInventoryManager : public CSingletonTemplate<CInventoryManager>
@@ -25,6 +26,9 @@ public:
 	*/
 	void Exit(void);
 
+	// The ID of an item which is not in the inventory
+	static const int NO_ITEM = -1;
+
 	// Add a new item
 	CInventoryItem* Add(	const std::string& _name,
 							const char* imagePath, 
@@ -32,12 +36,19 @@ public:
 							const int iItemCount = 0);
 	// Remove an item
 	bool Remove(const std::string& _name);
-	// Check if an item exists in inventoryMap
-	bool Check(const std::string& _name);
+	// Check if an item exists
+	bool Check(const std::string& _name) const;
+	bool Check(const int iItemID) const;
+	// Get the ID of an item by its name, or NO_ITEM if it does not exist
+	int GetItemID(const std::string& _name) const;
 	// Get an item by its name
-	CInventoryItem* GetItem(const std::string& _name);
+	CInventoryItem* GetItem(const std::string& _name) const;
+	// Get an item by its ID
+	CInventoryItem* GetItem(const int iItemID) const;
 	// Get the number of items
 	int GetNumItems(void) const;
+	// Get the number of item IDs. The IDs are less than it, and an ID has no item if it was removed.
+	int GetNumItemIDs(void) const;
 
 	int slotNumber = 0;
 	
@@ -50,17 +61,22 @@ public:
 	//cycle through inventory
 	void CycleThroughInventory();
 
-	// The map containing all the items
-	std::map<std::string, CInventoryItem*> inventoryMap;
-
 	bool renderShop = false;
 
 protected:
+	// The items, indexed by their IDs. The slot of an item which was removed is nullptr.
+	std::vector<CInventoryItem*> vItems;
+	// The IDs of the names of the items. A name keeps its ID after the item is removed.
+	std::map<std::string, int> mItemIDs;
+	// The IDs of the items, in the order of their names, which CycleThroughInventory goes through
+	std::vector<int> vCycleOrder;
+
+	// Rebuild vCycleOrder after an item was added or removed
+	void UpdateCycleOrder(void);
+
 	// Constructor
 	CInventoryManager(void);
 
 	// Destructor
 	virtual ~CInventoryManager(void);
-
-
 };
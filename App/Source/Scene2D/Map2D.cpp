@@ -8,16 +8,32 @@
 // Include Shader Manager
 #include "RenderControl\ShaderManager.h"
 
+// Include Render Queue
+#include "RenderControl\RenderQueue.h"
+
+// Include Render Device
+#include "RenderControl\RenderDevice.h"
+
 // Include Filesystem
 #include "System\filesystem.h"
 
-// Include ImageLoader
-#include "System\ImageLoader.h"
+// Include AssetManager
+#include "System\AssetManager.h"
+// Include AssetLoader
+#include "System\AssetLoader.h"
+// Include CProfiler
+#include "TimeControl\Profiler.h"
+// Include CJobSystem to generate the chunks of the map in parallel
+#include "System\JobSystem.h"
+// Include CTerrainGenerator
+#include "TerrainGenerator.h"
 
 #include <iostream>
 #include <vector>
+#include <algorithm>
 using namespace std;
 string CMap2D::activeWorld = "START";
+const glm::i32vec2 CMap2D::DIRECTION_VECTORS[4] = { glm::i32vec2(-1, 0), glm::i32vec2(1, 0), glm::i32vec2(0, 1), glm::i32vec2(0, -1) };
 CMap2D::BLOCK_TYPE blockType;
 
 // For AStar PathFinding
@@ -28,6 +44,8 @@ using namespace std::placeholders;
  */
 CMap2D::CMap2D(void)
 	: uiCurLevel(0)
+	, uiNumSolidWords(0)
+	, uiWorldSeed(0)
 	, mapOffset(glm::vec2(0.0f))
 	, mapOffset_MicroSteps(glm::vec2(0.0f))
 {
@@ -50,9 +68,12 @@ CMap2D::~CMap2D(void)
 	delete[] arrMapInfo;
 
 	// optional: de-allocate all resources once they've outlived their purpose:
-	glDeleteVertexArrays(1, &VAO);
-	//glDeleteBuffers(1, &VBO);
-	//glDeleteBuffers(1, &EBO);
+	CRenderDevice::GetActive()->DeleteVertexArray(VAO);
+
+	// Release the shared textures
+	for (map<int, int>::iterator it = MapOfTextureIDs.begin(); it != MapOfTextureIDs.end(); ++it)
+		CAssetManager::GetInstance()->ReleaseTexture(it->second);
+	MapOfTextureIDs.clear();
 
 	// Set this to NULL since it was created elsewhere, so we let it be deleted there.
 	cSettings = NULL;
@@ -86,7 +107,7 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 			for (int uiCol = 0; uiCol < uiNumCols; uiCol++) 
 			{
 				arrMapInfo[uiLevel][uiRow][uiCol].value = 0;
-				arrMapInfo[uiLevel][uiRow][uiCol].timer = 0;
+				arrMapInfo[uiLevel][uiRow][uiCol].seedTimer = 0;
 				arrMapInfo[uiLevel][uiRow][uiCol].health = 100.f;
 			}
 		}
@@ -98,114 +119,49 @@ bool CMap2D::Init(	const unsigned int uiNumLevels,
 	// Store the map sizes in cSettings
 	uiCurLevel = 0;
 	this->uiNumLevels = uiNumLevels;
+	vSeedGrowths.assign(uiNumLevels, std::map<int, SeedGrowth>());
 	cSettings->NUM_TILES_XAXIS = uiNumCols;
 	cSettings->NUM_TILES_YAXIS = uiNumRows;
 	cSettings->UpdateSpecifications();
+	vSolidTiles.assign(uiNumLevels, std::vector<unsigned long long>());
+	for (unsigned int uiLevel = 0; uiLevel < uiNumLevels; uiLevel++)
+		BuildSolidTiles(uiLevel);
 
-	glGenVertexArrays(1, &VAO);
-	glBindVertexArray(VAO);
+	VAO = CRenderDevice::GetActive()->CreateVertexArray();
+	CRenderDevice::GetActive()->BindVertexArray(VAO);
 
 	// Initialise the variables for AStar
-	m_weight = 1;
-	m_startPos = glm::i32vec2(0, 0);
-	m_targetPos = glm::i32vec2(0, 0);
 	//m_size = cSettings->NUM_TILES_YAXIS* cSettings->NUM_TILES_XAXIS;
 
 	m_nrOfDirections = 4;
 	m_directions = { { -1, 0 }, { 1, 0 }, { 0, 1 }, { 0, -1 },
 						{ -1, -1 }, { 1, 1 }, { -1, 1 }, { 1, -1 } };
 
-	// Resize these 2 lists
-	m_cameFromList.resize(cSettings->NUM_TILES_YAXIS * cSettings->NUM_TILES_XAXIS);
-	m_closedList.resize(cSettings->NUM_TILES_YAXIS * cSettings->NUM_TILES_XAXIS, false);
+	// The lists of each thread are sized for the map when it first searches it, in ResetAStarLists
 	
 	//generate the quad mesh using the meshbuilder
 	quadMesh = CMeshBuilder::GenerateQuad(glm::vec4(1, 1, 1, 1), cSettings->TILE_WIDTH, cSettings->TILE_HEIGHT);
-	//default blocks
-	if (LoadTexture("Image/Blocks/Bedrock.png", 1) == false)
-	{
-		std::cout << "Failed to load bedrock block texture" << std::endl;
-		return false;
-	}
-	if (LoadTexture("Image/Blocks/GrassBlock.png", 2) == false)
-	{
-		std::cout << "Failed to load grass block texture" << std::endl;
-		return false;
-	}
-	if (LoadTexture("Image/Blocks/DirtBlock.png", 3) == false)
-	{
-		std::cout << "Failed to load dirt block texture" << std::endl;
-		return false;
-	}
-	if (LoadTexture("Image/Blocks/Chest.png", 4) == false)
-	{
-		std::cout << "Failed to load dirt block texture" << std::endl;
-		return false;
-	}
-	if (LoadTexture("Image/Blocks/Lava.png", 5) == false)
-	{
-		std::cout << "Failed to load lava block texture" << std::endl;
-		return false;
-	}
-	if (LoadTexture("Image/Blocks/Shop.png", 6) == false)
-	{
-		std::cout << "Failed to load shop block texture" << std::endl;
-		return false;
-	}
-	  
-	//trees & seeds
-	if (LoadTexture("Image/Trees/GrassTree.png", 100) == false)
-	{
-		std::cout << "Failed to load grass tree seed block texture" << std::endl;
-		return false;
-	}
-	if (LoadTexture("Image/Trees/GrassTreeGrown.png", 101) == false)
-	{
-		std::cout << "Failed to load grass tree block texture" << std::endl;
-		return false;
-	}
-	if (LoadTexture("Image/Trees/DirtTree.png", 102) == false)
-	{
-		std::cout << "Failed to load dirt tree seed block texture" << std::endl;
-		return false;
-	}
-	if (LoadTexture("Image/Trees/DirtTreeGrown.png", 103) == false)
-	{
-		std::cout << "Failed to load dirt tree block texture" << std::endl;
-		return false;
-	}
-
-	//drop items
-	if (LoadTexture("Image/Items/Stone.png", 301) == false)
+	// Decode the textures of the tiles in TILE_DEFINITIONS on the worker threads of CAssetLoader, then store them in MapOfTextureIDs
+	for (unsigned int i = 0; i < NUM_TILE_DEFINITIONS; i++)
 	{
-		std::cout << "Failed to load stone block texture" << std::endl;
-		return false;
+		const TileDefinition& sTile = TILE_DEFINITIONS[i];
+		if ((sTile.sProperties.pTexture != nullptr) && (MapOfTextureIDs.find(sTile.iTile) == MapOfTextureIDs.end()))
+			CAssetLoader::GetInstance()->PreloadTexture(sTile.sProperties.pTexture);
 	}
-	if (LoadTexture("Image/Items/Cheese.png", 302) == false)
-	{
-		std::cout << "Failed to load dirt seed drop texture" << std::endl;
-		return false;
-	}
-
-	//background items
-	if (LoadTexture("Image/Blocks/Door.png", 201) == false)
+	CAssetLoader::GetInstance()->WaitForAll();
+	for (unsigned int i = 0; i < NUM_TILE_DEFINITIONS; i++)
 	{
-		std::cout << "Failed to load door texture" << std::endl;
-		return false;
-	}
-	//background items
-	if (LoadTexture("Image/UI/blockRange.png", 202) == false)
-	{
-		std::cout << "Failed to load block range texture" << std::endl;
-		return false;
-	}
-
-	//Enemy
-	if (LoadTexture("Image/Characters/Enemy.png", 401) == false)
-	{
-		std::cout << "Failed to load enemy texture" << std::endl;
-		return false;
+		const TileDefinition& sTile = TILE_DEFINITIONS[i];
+		if (sTile.sProperties.pTexture == nullptr)
+			continue;
+		if (LoadTexture(sTile.sProperties.pTexture, sTile.iTile) == false)
+		{
+			std::cout << "Failed to load " << sTile.sProperties.pTexture << std::endl;
+			return false;
+		}
 	}
+	// MapOfTextureIDs holds the textures now
+	CAssetLoader::GetInstance()->ReleasePreloaded();
 
 	// Load the map into an array
 	if (LoadMap("Maps/START.csv", 0) == false)
@@ -230,11 +186,10 @@ void CMap2D::Update(const double dElapsedTime)
 void CMap2D::PreRender(void)
 {
 	// Activate blending mode
-	glEnable(GL_BLEND);
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	CRenderDevice::GetActive()->SetBlend(true);
 
 	// bind textures on corresponding texture units
-	glActiveTexture(GL_TEXTURE0);
+	CRenderDevice::GetActive()->ActiveTexture(GL_TEXTURE0);
 
 	// Activate the shader
 	CShaderManager::GetInstance()->Use(sShaderName);
@@ -245,22 +200,17 @@ void CMap2D::PreRender(void)
  */
 void CMap2D::Render(void)
 {
-	// get matrix's uniform location and set matrix
-	unsigned int transformLoc = glGetUniformLocation(CShaderManager::GetInstance()->activeShader->ID, "transform");
-	glUniformMatrix4fv(transformLoc, 1, GL_FALSE, glm::value_ptr(transform));
-	
+	PROFILE_ZONE("CMap2D::Render");
+
+	// The map scrolls with the player
+	const float xOffset = GetScrollOffsetX();
+
+	// Submit the tiles to the render queue, which will sort them by texture
 	// Render
 	for (unsigned int uiRow = 0; uiRow < cSettings->NUM_TILES_YAXIS; uiRow++)
 	{
 		for (unsigned int uiCol = 0; uiCol < cSettings->NUM_TILES_XAXIS; uiCol++)
 		{
-			float xOffset = 0.f;
-			if (CPlayer2D::GetInstance()->i32vec2Index.x > cSettings->TILE_RATIO_XAXIS / 2)
-				xOffset = (CPlayer2D::GetInstance()->i32vec2Index.x + (CPlayer2D::GetInstance()->i32vec2NumMicroSteps.x / cSettings->NUM_STEPS_PER_TILE_XAXIS)) - cSettings->TILE_RATIO_XAXIS / 2;
-
-			if (CPlayer2D::GetInstance()->i32vec2Index.x > cSettings->NUM_TILES_XAXIS - cSettings->TILE_RATIO_XAXIS / 2)
-				xOffset = cSettings->NUM_TILES_XAXIS - cSettings->TILE_RATIO_XAXIS;
-
 			/*float yOffset = 0.f;
 			if (CPlayer2D::GetInstance()->i32vec2Index.y > cSettings->TILE_RATIO_YAXIS / 2)
 				yOffset = (CPlayer2D::GetInstance()->i32vec2Index.y + (CPlayer2D::GetInstance()->i32vec2NumMicroSteps.y / cSettings->NUM_STEPS_PER_TILE_YAXIS)) - cSettings->TILE_RATIO_YAXIS / 2;
@@ -279,13 +229,40 @@ void CMap2D::Render(void)
 			//												0.0f));
 			//transform = glm::rotate(transform, (float)glfwGetTime(), glm::vec3(0.0f, 0.0f, 1.0f));
 
-			// Update the shaders with the latest transform
-			glUniformMatrix4fv(transformLoc, 1, GL_FALSE, glm::value_ptr(transform));
-
 			// Render a tile
 			RenderTile(uiRow, uiCol);
 		}
 	}
+
+	// Submit the markers in their own layer, over the tiles
+	for (unsigned int i = 0; i < vTileMarkers.size(); i++)
+	{
+		const TileMarker& sMarker = vTileMarkers[i];
+		map<int, int>::const_iterator it = MapOfTextureIDs.find(sMarker.iTextureCode);
+		if (it == MapOfTextureIDs.end())
+			continue;
+
+		transform = glm::mat4(1.0f);
+		transform = glm::translate(transform, glm::vec3(cSettings->ConvertFloatIndexToUVSpace(cSettings->x, sMarker.uiCol - xOffset, false, 0),
+			cSettings->ConvertFloatIndexToUVSpace(cSettings->y, sMarker.uiRow, true, 0),
+			0.0f));
+		CRenderQueue::GetInstance()->Submit(CRenderQueue::LAYER_TILE_MARKERS, sShaderName, it->second, quadMesh, transform);
+	}
+}
+
+/**
+ @brief Get the number of tiles which the map is scrolled to the left by, so that the player stays in the middle of the screen
+ */
+float CMap2D::GetScrollOffsetX(void) const
+{
+	float xOffset = 0.f;
+	if (CPlayer2D::GetInstance()->i32vec2Index.x > cSettings->TILE_RATIO_XAXIS / 2)
+		xOffset = (CPlayer2D::GetInstance()->i32vec2Index.x + (CPlayer2D::GetInstance()->i32vec2NumMicroSteps.x / cSettings->NUM_STEPS_PER_TILE_XAXIS)) - cSettings->TILE_RATIO_XAXIS / 2;
+
+	if (CPlayer2D::GetInstance()->i32vec2Index.x > cSettings->NUM_TILES_XAXIS - cSettings->TILE_RATIO_XAXIS / 2)
+		xOffset = cSettings->NUM_TILES_XAXIS - cSettings->TILE_RATIO_XAXIS;
+
+	return xOffset;
 }
 
 //unsigned CMap2D::getCurrX(void) {
@@ -299,7 +276,7 @@ void CMap2D::Render(void)
 void CMap2D::PostRender(void)
 {
 	// Disable blending
-	glDisable(GL_BLEND);
+	CRenderDevice::GetActive()->SetBlend(false);
 }
 
 // Set the specifications of the map
@@ -371,9 +348,9 @@ void CMap2D::SetNumSteps(const CSettings::AXIS sAxis, const unsigned int uiValue
 void CMap2D::SetMapInfo(const unsigned int uiRow, const unsigned int uiCol, const int iValue, const bool bInvert)
 {
 	if (bInvert)
-		arrMapInfo[uiCurLevel][cSettings->NUM_TILES_YAXIS - uiRow - 1][uiCol].value = iValue;
+		SetTileValue(uiCurLevel, cSettings->NUM_TILES_YAXIS - uiRow - 1, uiCol, iValue);
 	else
-		arrMapInfo[uiCurLevel][uiRow][uiCol].value = iValue;
+		SetTileValue(uiCurLevel, uiRow, uiCol, iValue);
 }
 
 void CMap2D::SetSaveMapInfo(const unsigned int uiRow, const unsigned int uiCol, const int iValue, const bool bInvert, const bool docSave)
@@ -382,12 +359,12 @@ void CMap2D::SetSaveMapInfo(const unsigned int uiRow, const unsigned int uiCol,
 	{
 		if (bInvert)
 		{
-			arrMapInfo[uiCurLevel][cSettings->NUM_TILES_YAXIS - uiRow - 1][uiCol].value = iValue;
+			SetTileValue(uiCurLevel, cSettings->NUM_TILES_YAXIS - uiRow - 1, uiCol, iValue);
 			doc.SetCell(uiCol, cSettings->NUM_TILES_YAXIS - uiRow - 1, arrMapInfo[uiCurLevel][cSettings->NUM_TILES_YAXIS - uiRow - 1][uiCol].value);
 		}
 		else
 		{
-			arrMapInfo[uiCurLevel][uiRow][uiCol].value = iValue;
+			SetTileValue(uiCurLevel, uiRow, uiCol, iValue);
 			doc.SetCell(uiCol, uiRow, arrMapInfo[uiCurLevel][uiRow][uiCol].value);
 		}
 		if (docSave)
@@ -395,6 +372,34 @@ void CMap2D::SetSaveMapInfo(const unsigned int uiRow, const unsigned int uiCol,
 	}
 }
 
+/**
+ @brief Add a marker over a tile, e.g. to highlight the tiles which the player can reach.
+		The markers are drawn over the tiles, and are not part of the map, so they do not collide and are not saved.
+ @param uiRow The row index of the tile
+ @param uiCol The column index of the tile
+ @param iTextureCode The code of the texture to draw the marker with
+ @param bInvert A const bool variable which indicates if the row information is inverted
+ */
+void CMap2D::AddTileMarker(const unsigned int uiRow, const unsigned int uiCol, const int iTextureCode, const bool bInvert)
+{
+	if ((uiRow >= cSettings->NUM_TILES_YAXIS) || (uiCol >= cSettings->NUM_TILES_XAXIS))
+		return;
+
+	TileMarker sMarker;
+	sMarker.uiRow = (bInvert ? cSettings->NUM_TILES_YAXIS - uiRow - 1 : uiRow);
+	sMarker.uiCol = uiCol;
+	sMarker.iTextureCode = iTextureCode;
+	vTileMarkers.push_back(sMarker);
+}
+
+/**
+ @brief Remove all the markers over the tiles
+ */
+void CMap2D::ClearTileMarkers(void)
+{
+	vTileMarkers.clear();
+}
+
 /**
  @brief Get the value at certain indices in the arrMapInfo
  @param iRow A const int variable containing the row index of the element to get from
@@ -412,6 +417,121 @@ int CMap2D::GetMapInfo(const unsigned int uiRow, const int unsigned uiCol, const
 	}
 }
 
+/**
+ @brief Check if the tile at certain indices in the arrMapInfo has any of some TILE_FLAGs
+ @param uiRow A const int variable containing the row index of the tile
+ @param uiCol A const int variable containing the column index of the tile
+ @param uiFlags The TILE_FLAGs to check for
+ @param bInvert A const bool variable which indicates if the row information is inverted
+ @return false if the tile is outside the map
+ */
+bool CMap2D::HasTileFlags(const unsigned int uiRow, const unsigned int uiCol, const unsigned int uiFlags, const bool bInvert) const
+{
+	if ((uiRow >= cSettings->NUM_TILES_YAXIS) || (uiCol >= cSettings->NUM_TILES_XAXIS))
+		return false;
+
+	const unsigned int uiValue = arrMapInfo[uiCurLevel][bInvert ? cSettings->NUM_TILES_YAXIS - uiRow - 1 : uiRow][uiCol].value;
+	return (GetTileProperties(uiValue).uiFlags & uiFlags) != 0;
+}
+
+/**
+ @brief Check if any tile in a box of tiles has any of some TILE_FLAGs. The tiles outside the map have no flags.
+		TILE_SOLID is checked with the bits of the solid tiles, a row at a time, so it takes a few word operations.
+ @param iRow The bottom row of the box, where the rows are counted from the bottom as with bInvert
+ @param iCol The left column of the box
+ @param iNumRows The number of rows in the box
+ @param iNumCols The number of columns in the box
+ @param uiFlags The TILE_FLAGs to check for
+ */
+bool CMap2D::HasTileFlagsInBox(const int iRow, const int iCol, const int iNumRows, const int iNumCols, const unsigned int uiFlags) const
+{
+	const int iRowMin = max(iRow, 0);
+	const int iRowMax = min(iRow + iNumRows - 1, (int)cSettings->NUM_TILES_YAXIS - 1);
+	const int iColMin = max(iCol, 0);
+	const int iColMax = min(iCol + iNumCols - 1, (int)cSettings->NUM_TILES_XAXIS - 1);
+	if ((iRowMin > iRowMax) || (iColMin > iColMax))
+		return false;
+
+	for (int iBoxRow = iRowMin; iBoxRow <= iRowMax; iBoxRow++)
+	{
+		if (uiFlags == TILE_SOLID)
+		{
+			if (HasSolidTile(cSettings->NUM_TILES_YAXIS - iBoxRow - 1, iColMin, iColMax))
+				return true;
+			continue;
+		}
+		for (int iBoxCol = iColMin; iBoxCol <= iColMax; iBoxCol++)
+		{
+			if (HasTileFlags(iBoxRow, iBoxCol, uiFlags))
+				return true;
+		}
+	}
+	return false;
+}
+
+/**
+ @brief Check if the tiles which an entity moves into in a direction have any of some TILE_FLAGs.
+		The entity is at its new position already. It covers the next row or column too if it is between them,
+		so the edge which it moves into is 1 or 2 tiles long.
+ @param i32vec2Index The column and row of the entity, where the rows are counted from the bottom
+ @param i32vec2NumMicroSteps The micro steps of the entity into the next column and row
+ @param i32vec2Direction The direction, which is (-1, 0), (1, 0), (0, 1) or (0, -1)
+ @param uiFlags The TILE_FLAGs of the tiles which block the entity
+ */
+bool CMap2D::IsEdgeBlocked(	const glm::i32vec2& i32vec2Index, const glm::i32vec2& i32vec2NumMicroSteps,
+							const glm::i32vec2& i32vec2Direction, const unsigned int uiFlags) const
+{
+	const int iNumRows = (i32vec2NumMicroSteps.y != 0 ? 2 : 1);
+	const int iNumCols = (i32vec2NumMicroSteps.x != 0 ? 2 : 1);
+
+	if (i32vec2Direction.x < 0)
+		return HasTileFlagsInBox(i32vec2Index.y, i32vec2Index.x, iNumRows, 1, uiFlags);
+	else if (i32vec2Direction.x > 0)
+		return HasTileFlagsInBox(i32vec2Index.y, i32vec2Index.x + 1, iNumRows, 1, uiFlags);
+	else if (i32vec2Direction.y > 0)
+		return HasTileFlagsInBox(i32vec2Index.y + 1, i32vec2Index.x, 1, iNumCols, uiFlags);
+	else if (i32vec2Direction.y < 0)
+		return HasTileFlagsInBox(i32vec2Index.y, i32vec2Index.x, 1, iNumCols, uiFlags);
+	return false;
+}
+
+/**
+ @brief Sweep an entity up or down, one row at a time from its row to a row, and find the first row
+		where IsEdgeBlocked is true. It replaces calling IsEdgeBlocked for each row.
+ @param i32vec2Index The column and row of the entity, where the rows are counted from the bottom
+ @param i32vec2NumMicroSteps The micro steps of the entity into the next column and row
+ @param iDirectionY 1 to sweep up, or -1 to sweep down. No row is swept if iToRow is the other way.
+ @param iToRow The last row to sweep to
+ @param uiFlags The TILE_FLAGs of the tiles which block the entity
+ @param iBlockedRow Set to the first row of the entity where its edge is blocked, if there is one
+ @return true if the edge of the entity is blocked at a row
+ */
+bool CMap2D::SweepRows(	const glm::i32vec2& i32vec2Index, const glm::i32vec2& i32vec2NumMicroSteps,
+						const int iDirectionY, const int iToRow, const unsigned int uiFlags, int& iBlockedRow) const
+{
+	// The edge of an entity which moves up is the row above it
+	const int iEdgeOffset = (iDirectionY > 0 ? 1 : 0);
+	const int iColMin = max(i32vec2Index.x, 0);
+	const int iColMax = min(i32vec2Index.x + (i32vec2NumMicroSteps.x != 0 ? 1 : 0), (int)cSettings->NUM_TILES_XAXIS - 1);
+
+	for (int iRow = i32vec2Index.y; (iDirectionY > 0) ? (iRow <= iToRow) : (iRow >= iToRow); iRow += iDirectionY)
+	{
+		const int iEdgeRow = iRow + iEdgeOffset;
+		if ((iEdgeRow < 0) || (iEdgeRow >= (int)cSettings->NUM_TILES_YAXIS) || (iColMin > iColMax))
+			continue;
+
+		const bool bBlocked = (uiFlags == TILE_SOLID) ?
+			HasSolidTile(cSettings->NUM_TILES_YAXIS - iEdgeRow - 1, iColMin, iColMax) :
+			HasTileFlagsInBox(iEdgeRow, iColMin, 1, iColMax - iColMin + 1, uiFlags);
+		if (bBlocked)
+		{
+			iBlockedRow = iRow;
+			return true;
+		}
+	}
+	return false;
+}
+
 /**
  @brief Load a map
  */ 
@@ -439,13 +559,27 @@ bool CMap2D::LoadMap(string filename, const unsigned int uiCurLevel)
 		// Load a particular CSV value into the arrMapInfo
 		for (unsigned int uiCol = 0; uiCol < cSettings->NUM_TILES_XAXIS; ++uiCol)
 		{
-			arrMapInfo[uiCurLevel][uiRow][uiCol].value = (int)stoi(row[uiCol]);
+			arrMapInfo[uiCurLevel][uiRow][uiCol].value = GetLoadedTileValue((int)stoi(row[uiCol]));
 		}
 	}
 
+	// Start the timers of the seeds which were loaded
+	ScheduleAllSeeds(uiCurLevel);
+	BuildSolidTiles(uiCurLevel);
+
 	return true;
 }
 
+/**
+ @brief Get the value of a tile which was read from a map file.
+		The block range markers which older saves wrote into the map are drawn by the marker overlay now, so they are emptied.
+ @param iValue The value in the map file
+ */
+int CMap2D::GetLoadedTileValue(const int iValue)
+{
+	return (iValue == 202) ? 0 : iValue;
+}
+
 /**
  @brief Save the tilemap to a text file
  @param filename A string variable containing the name of the text file to save the map to
@@ -475,6 +609,7 @@ bool CMap2D::SaveMap(string filename, const unsigned int uiCurLevel)
 bool CMap2D::GenerateNewMap(string worldName)
 {
 	LoadNewMap("Maps/" + worldName + ".csv");
+	SetWorldSeed((unsigned int)rand());
 	GenerateRandomMap();
 	SaveMap("Maps/" + worldName + ".csv");
 	return true;
@@ -508,203 +643,68 @@ bool CMap2D::LoadNewMap(string filename)
 		// Load a particular CSV value into the arrMapInfo
 		for (unsigned int uiCol = 0; uiCol < cSettings->NUM_TILES_XAXIS; ++uiCol)
 		{
-			arrMapInfo[uiCurLevel][uiRow][uiCol].value = (int)stoi(row[uiCol]);
+			arrMapInfo[uiCurLevel][uiRow][uiCol].value = GetLoadedTileValue((int)stoi(row[uiCol]));
 		}
 	}
 
+	// Start the timers of the seeds which were loaded
+	ScheduleAllSeeds(uiCurLevel);
+	BuildSolidTiles(uiCurLevel);
+
 	return true;
 }
 
 /**
-@brief Generate a fully loaded random map
+@brief Generate a fully loaded random map from the world seed, from the column after the door to the end of the map
 */
 bool CMap2D::GenerateRandomMap()
 {
-	int current = 20;
-	int chestSpawned = 0;
-	int chestSpawnRate = 20;
-	int lavaSpawnRate = 10;
-	int treeSpawnRate = 8;
-	int enemySpawnRate = 20;
-	bool enemySpawned = false;
-
-	for (int i = 3; i < cSettings->NUM_TILES_XAXIS; i++)
-	{
-		bool done = false;
-		while (!done)
-		{
-			int random = Math::RandIntMinMax(18, 24);
-			if (random + 1 > cSettings->NUM_TILES_YAXIS - 1 || random - 1 < 0)
-				continue;
-
-			if (random + 1 == current || random - 1 == current || random == current)
-			{
-				//spawn trees
-				int treeRandom = Math::RandIntMinMax(0, treeSpawnRate);
-				if (treeRandom == 0)
-				{
-					int treeType = Math::RandIntMinMax(1, 2);
-					switch (treeType)
-					{
-					case 1:
-						SetMapInfo(random - 1, i, 100, false);
-						break;
-					case 2:
-						SetMapInfo(random - 1, i, 102, false);
-						break;
-					default:
-						break;
-					}
-				}
-
-				//spawn chest
-				int chestRandom = Math::RandIntMinMax(0, chestSpawnRate);
-				if (chestRandom == 0)
-				{
-					SetMapInfo(random - 1, i, 4, false);
-					chestSpawned++;
-				}
-
-				//spawn enemies
-				int enemyRandom = Math::RandIntMinMax(0, enemySpawnRate);
-				if (enemyRandom == 0 && !enemySpawned)
-				{
-					SetMapInfo(random - 1, i, 302, false);
-					enemySpawned = true;
-				}
-
-				//force spawn chest
-				if (i == 99 && chestSpawned == 0)
-					SetMapInfo(random - 1, i, 4, false);
-
-				//set grass and dirt floor
-				SetMapInfo(random, i, 2, false);
-				for (int j = 1; j < cSettings->NUM_TILES_YAXIS - random; j++)
-				{
-					if (j == cSettings->NUM_TILES_YAXIS - random - 1)
-						SetMapInfo(random + j, i, 1, false);
-					else
-						SetMapInfo(random + j, i, 3, false);
-				}
-
-				int lavaRandom = Math::RandIntMinMax(0, lavaSpawnRate);
-				if (lavaRandom == 0)
-				{
-					if (random + 1 == cSettings->NUM_TILES_YAXIS - 1)
-						continue;
-					SetMapInfo(random + 1, i, 5, false);
-				}
-
-				done = true;
-				current = random;
-			}
-		}
-	}
-
+	GenerateColumns(3, cSettings->NUM_TILES_XAXIS, 302, true);
 	return true;
 }
 
+/**
+@brief Add 10 columns to the map, generated from the world seed, and save the active world
+*/
 bool CMap2D::ProceduralGeneration()
 {
 	std::cout << "GENERATING" << std::endl;
-	int initialNumTilesXAxis = cSettings->NUM_TILES_XAXIS;
+	const unsigned int uiInitialNumTilesXAxis = cSettings->NUM_TILES_XAXIS;
 	cSettings->NUM_TILES_XAXIS += 10;
 	std::cout << cSettings->NUM_TILES_XAXIS << std::endl;
 
-	int current = 20;
-	int chestSpawned = 0;
-	int chestSpawnRate = 20;
-	int lavaSpawnRate = 10;
-	int treeSpawnRate = 8;
-	int enemySpawnRate = 20;
+	GenerateColumns(uiInitialNumTilesXAxis, cSettings->NUM_TILES_XAXIS, 401, false);
 
-	for (int i = initialNumTilesXAxis; i < cSettings->NUM_TILES_XAXIS; i++)
+	// Copy the new columns into the rapidcsv::Document once they are all generated
+	for (unsigned int uiRow = 0; uiRow < cSettings->NUM_TILES_YAXIS; uiRow++)
 	{
-		for (int j = 0; j < cSettings->NUM_TILES_YAXIS; j++)
-		{
-			SetSaveMapInfo(j, i, 0, false, false);
-		}
+		for (unsigned int uiCol = uiInitialNumTilesXAxis; uiCol < cSettings->NUM_TILES_XAXIS; uiCol++)
+			doc.SetCell(uiCol, uiRow, arrMapInfo[uiCurLevel][uiRow][uiCol].value);
 	}
 
-	std::cout << "SET ALL TO 0" << std::endl;
-
-	for (int i = initialNumTilesXAxis; i < cSettings->NUM_TILES_XAXIS; i++)
-	{
-		bool done = false;
-		while (!done)
-		{
-			int random = Math::RandIntMinMax(18, 24);
-			if (random + 1 > cSettings->NUM_TILES_YAXIS - 1 || random - 1 < 0)
-				continue;
-
-			if (random + 1 == current || random - 1 == current || random == current)
-			{
-				//spawn trees
-				int treeRandom = Math::RandIntMinMax(0, treeSpawnRate);
-				if (treeRandom == 0)
-				{
-					int treeType = Math::RandIntMinMax(1, 2);
-					switch (treeType)
-					{
-					case 1:
-						SetSaveMapInfo(random - 1, i, 100, false, false);
-						break;
-					case 2:
-						SetSaveMapInfo(random - 1, i, 102, false, false);
-						break;
-					default:
-						break;
-					}
-				}
-
-				//spawn chest
-				int chestRandom = Math::RandIntMinMax(0, chestSpawnRate);
-				if (chestRandom == 0)
-				{
-					SetSaveMapInfo(random - 1, i, 4, false, false);
-					chestSpawned++;
-				}
-
-				//spawn enemies
-				//spawn chest
-				int enemyRandom = Math::RandIntMinMax(0, enemySpawnRate);
-				if (enemyRandom == 0)
-				{
-					SetSaveMapInfo(random - 1, i, 401, false, false);
-				}
-
-				//force spawn chest
-				if (i == 99 && chestSpawned == 0)
-					SetSaveMapInfo(random - 1, i, 4, false, false);
-
-				//set grass and dirt floor
-				SetSaveMapInfo(random, i, 2, false, false);
-				for (int j = 1; j < cSettings->NUM_TILES_YAXIS - random; j++)
-				{
-					if (j == cSettings->NUM_TILES_YAXIS - random - 1)
-						SetSaveMapInfo(random + j, i, 1, false, false);
-					else
-						SetSaveMapInfo(random + j, i, 3, false, false);
-				}
-
-				int lavaRandom = Math::RandIntMinMax(0, lavaSpawnRate);
-				if (lavaRandom == 0)
-				{
-					if (random + 1 == cSettings->NUM_TILES_YAXIS - 1)
-						continue;
-					SetSaveMapInfo(random + 1, i, 5, false, false);
-				}
-
-				done = true;
-				current = random;
-			}
-		}
-	}
 	std::cout << "SAVING FILE" << std::endl;
 	doc.Save(FileSystem::getPath(GetActiveWorldPath()).c_str());
 	return true;
 }
 
+/**
+ @brief Set the world seed which GenerateRandomMap and ProceduralGeneration make the columns from.
+		The same seed generates the same columns.
+ @param uiWorldSeed The world seed
+ */
+void CMap2D::SetWorldSeed(const unsigned int uiWorldSeed)
+{
+	this->uiWorldSeed = uiWorldSeed;
+}
+
+/**
+ @brief Get the world seed
+ */
+unsigned int CMap2D::GetWorldSeed(void) const
+{
+	return uiWorldSeed;
+}
+
 /**
 @brief Find the indices of a certain value in arrMapInfo
 @param iValue A const int variable containing the row index of the found element
@@ -775,42 +775,17 @@ string CMap2D::KilledEnemy(glm::vec2 playerPos, float damage)
  */
 bool CMap2D::LoadTexture(const char* filename, const int iTextureCode)
 {
-	// Variables used in loading the texture
-	int width, height, nrChannels;
-	unsigned int textureID;
-
-	// texture 1
-	// ---------
-	glGenTextures(1, &textureID);
-	glBindTexture(GL_TEXTURE_2D, textureID);
-	// set the texture wrapping parameters
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-	// set texture filtering parameters
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-	CImageLoader* cImageLoader = CImageLoader::GetInstance();
-	unsigned char *data = cImageLoader->Load(filename, width, height, nrChannels, true);
-	if (data)
-	{
-		if (nrChannels == 3)
-			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, data);
-		else if (nrChannels == 4)
-			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
-
-		// Generate mipmaps
-		glGenerateMipmap(GL_TEXTURE_2D);
+	// Init may be called again when the game is restarted, so keep the texture which is already there
+	if (MapOfTextureIDs.find(iTextureCode) != MapOfTextureIDs.end())
+		return true;
 
-		// Store the texture ID into MapOfTextureIDs
-		MapOfTextureIDs.insert(pair<int, int>(iTextureCode, textureID));
-	}
-	else
-	{
+	// Get the shared texture
+	GLuint textureID = CAssetManager::GetInstance()->AcquireTexture(filename);
+	if (textureID == 0)
 		return false;
-	}
-	// Free up the memory of the file data read in
-	free(data);
+
+	// Store the texture ID into MapOfTextureIDs
+	MapOfTextureIDs.insert(pair<int, int>(iTextureCode, textureID));
 
 	return true;
 }
@@ -822,16 +797,15 @@ bool CMap2D::LoadTexture(const char* filename, const int iTextureCode)
  */
 void CMap2D::RenderTile(const unsigned int uiRow, const unsigned int uiCol)
 {
-	if (arrMapInfo[uiCurLevel][uiRow][uiCol].value != 0)
+	if ((arrMapInfo[uiCurLevel][uiRow][uiCol].value != 0) &&
+		(arrMapInfo[uiCurLevel][uiRow][uiCol].value < totalTextures))
 	{
-		if (arrMapInfo[uiCurLevel][uiRow][uiCol].value < totalTextures)
- 			glBindTexture(GL_TEXTURE_2D, MapOfTextureIDs.at(arrMapInfo[uiCurLevel][uiRow][uiCol].value));
-
-		glBindVertexArray(VAO);
-		// Render the tile
-		//glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
-		quadMesh->Render();
-		glBindVertexArray(0);
+		// Queue the tile with its texture and the latest transform
+		CRenderQueue::GetInstance()->Submit(CRenderQueue::LAYER_TILES,
+											sShaderName,
+											MapOfTextureIDs.at(arrMapInfo[uiCurLevel][uiRow][uiCol].value),
+											quadMesh,
+											transform);
 	}
 }
 
@@ -860,7 +834,8 @@ void CMap2D::SetTotalWorldsGenerated(int num)
 }
 
 /**
- @brief Update individual seed timer
+ @brief Grow the seeds of a type whose timers expired, into the tile in their TileProperties. Each seed has a timer in a CTimerWheel,
+		which is started when it is planted or loaded, so only the seeds which grow are visited.
  @param name (Optional) A string for item name, for reference only.
  @param dt Delta time
  @param blockNumber The seed's block number to be updated
@@ -868,22 +843,268 @@ void CMap2D::SetTotalWorldsGenerated(int num)
  */
 void CMap2D::UpdateSeed(string itemName, double dt, int blockNumber, float timer)
 {
+	PROFILE_ZONE("CMap2D::UpdateSeed");
+
+	std::map<int, SeedGrowth>& mapOfSeedGrowths = vSeedGrowths[uiCurLevel];
+	std::map<int, SeedGrowth>::iterator it = mapOfSeedGrowths.find(blockNumber);
+	if (it == mapOfSeedGrowths.end())
+	{
+		// The first update of this type of seed. Start the timers of the seeds which are in the map already.
+		it = mapOfSeedGrowths.insert(make_pair(blockNumber, SeedGrowth())).first;
+		it->second.fGrowTime = timer;
+		it->second.cTimerWheel.Init(1.0 / cSettings->iTickRate);
+		ScheduleSeeds(uiCurLevel, blockNumber);
+	}
+	// The seeds which are planted from now on take this time to grow
+	it->second.fGrowTime = timer;
+
+	vExpiredSeeds.clear();
+	it->second.cTimerWheel.Advance(dt, vExpiredSeeds);
+	for (unsigned int i = 0; i < vExpiredSeeds.size(); i++)
+	{
+		const unsigned int uiRow = vExpiredSeeds[i] >> 16;
+		const unsigned int uiCol = vExpiredSeeds[i] & 0xFFFF;
+		arrMapInfo[uiCurLevel][uiRow][uiCol].seedTimer = 0;
+		SetSaveMapInfo(uiRow, uiCol, GetTileProperties(blockNumber).iGrowsInto, false, true);
+	}
+}
+
+/**
+ @brief Set the value of a tile. The timer of the seed which was on it is cancelled,
+		and a timer is started if the value is a type of seed which is growing.
+ @param uiLevel The level of the tile
+ @param uiRow The row of the tile, which is not inverted
+ @param uiCol The column of the tile
+ @param iValue The value to assign to the tile
+ */
+void CMap2D::SetTileValue(const unsigned int uiLevel, const unsigned int uiRow, const unsigned int uiCol, const int iValue)
+{
+	Grid& sGrid = arrMapInfo[uiLevel][uiRow][uiCol];
+	std::map<int, SeedGrowth>& mapOfSeedGrowths = vSeedGrowths[uiLevel];
+
+	if (sGrid.seedTimer != 0)
+	{
+		std::map<int, SeedGrowth>::iterator it = mapOfSeedGrowths.find(sGrid.value);
+		if (it != mapOfSeedGrowths.end())
+			it->second.cTimerWheel.Cancel(sGrid.seedTimer);
+		sGrid.seedTimer = 0;
+	}
+
+	sGrid.value = iValue;
+
+	// Keep the bit of the tile in vSolidTiles the same as its value
+	std::vector<unsigned long long>& vSolidRows = vSolidTiles[uiLevel];
+	const size_t uiWord = uiRow * uiNumSolidWords + (uiCol >> 6);
+	if (uiWord < vSolidRows.size())
+	{
+		const unsigned long long ullBit = 1ULL << (uiCol & 63);
+		if (GetTileProperties(iValue).uiFlags & TILE_SOLID)
+			vSolidRows[uiWord] |= ullBit;
+		else
+			vSolidRows[uiWord] &= ~ullBit;
+	}
+
+	std::map<int, SeedGrowth>::iterator it = mapOfSeedGrowths.find(iValue);
+	if (it != mapOfSeedGrowths.end())
+		sGrid.seedTimer = it->second.cTimerWheel.Add(it->second.fGrowTime, (uiRow << 16) | uiCol);
+}
+
+/**
+ @brief Set the bits of the solid tiles of a level from its tiles, after they were loaded.
+		The rows are sized for the current map, which may be a different size after loading it.
+ @param uiLevel The level
+ */
+void CMap2D::BuildSolidTiles(const unsigned int uiLevel)
+{
+	uiNumSolidWords = (cSettings->NUM_TILES_XAXIS + 63) / 64;
+	std::vector<unsigned long long>& vSolidRows = vSolidTiles[uiLevel];
+	vSolidRows.assign(cSettings->NUM_TILES_YAXIS * uiNumSolidWords, 0);
+
 	for (unsigned int uiRow = 0; uiRow < cSettings->NUM_TILES_YAXIS; uiRow++)
 	{
 		for (unsigned int uiCol = 0; uiCol < cSettings->NUM_TILES_XAXIS; uiCol++)
 		{
-			if (arrMapInfo[uiCurLevel][uiRow][uiCol].value == blockNumber)
+			if (GetTileProperties(arrMapInfo[uiLevel][uiRow][uiCol].value).uiFlags & TILE_SOLID)
+				vSolidRows[uiRow * uiNumSolidWords + (uiCol >> 6)] |= 1ULL << (uiCol & 63);
+		}
+	}
+}
+
+/**
+ @brief Check if a row of the current level has a solid tile from a column to another,
+		by masking the words of the row which the columns are in
+ @param uiRow The row, which is not inverted
+ @param iColMin The first column, which must be in the map
+ @param iColMax The last column, which must be in the map and not before iColMin
+ */
+bool CMap2D::HasSolidTile(const unsigned int uiRow, const int iColMin, const int iColMax) const
+{
+	const std::vector<unsigned long long>& vSolidRows = vSolidTiles[uiCurLevel];
+	const unsigned int uiWordMin = iColMin >> 6;
+	const unsigned int uiWordMax = iColMax >> 6;
+	if ((uiRow + 1) * uiNumSolidWords > vSolidRows.size())
+		return false;
+
+	const unsigned long long* pRow = &vSolidRows[uiRow * uiNumSolidWords];
+	for (unsigned int uiWord = uiWordMin; uiWord <= uiWordMax; uiWord++)
+	{
+		unsigned long long ullMask = ~0ULL;
+		if (uiWord == uiWordMin)
+			ullMask &= ~0ULL << (iColMin & 63);
+		if (uiWord == uiWordMax)
+			ullMask &= ~0ULL >> (63 - (iColMax & 63));
+		if (pRow[uiWord] & ullMask)
+			return true;
+	}
+	return false;
+}
+
+/**
+ @brief Start the timers of the seeds of a type on a level, replacing the timers they had
+ @param uiLevel The level
+ @param iBlockNumber The block number of the seeds
+ */
+void CMap2D::ScheduleSeeds(const unsigned int uiLevel, const int iBlockNumber)
+{
+	std::map<int, SeedGrowth>::iterator it = vSeedGrowths[uiLevel].find(iBlockNumber);
+	if (it == vSeedGrowths[uiLevel].end())
+		return;
+
+	it->second.cTimerWheel.Clear();
+	for (unsigned int uiRow = 0; uiRow < cSettings->NUM_TILES_YAXIS; uiRow++)
+	{
+		for (unsigned int uiCol = 0; uiCol < cSettings->NUM_TILES_XAXIS; uiCol++)
+		{
+			Grid& sGrid = arrMapInfo[uiLevel][uiRow][uiCol];
+			if (sGrid.value == iBlockNumber)
+				sGrid.seedTimer = it->second.cTimerWheel.Add(it->second.fGrowTime, (uiRow << 16) | uiCol);
+		}
+	}
+}
+
+/**
+ @brief Start the timers of the seeds of every type on a level, after its tiles were loaded
+ @param uiLevel The level
+ */
+void CMap2D::ScheduleAllSeeds(const unsigned int uiLevel)
+{
+	// The timers of the tiles which were replaced belong to the cleared timer wheels
+	for (unsigned int uiRow = 0; uiRow < cSettings->NUM_TILES_YAXIS; uiRow++)
+	{
+		for (unsigned int uiCol = 0; uiCol < cSettings->NUM_TILES_XAXIS; uiCol++)
+			arrMapInfo[uiLevel][uiRow][uiCol].seedTimer = 0;
+	}
+
+	for (std::map<int, SeedGrowth>::iterator it = vSeedGrowths[uiLevel].begin(); it != vSeedGrowths[uiLevel].end(); ++it)
+		ScheduleSeeds(uiLevel, it->first);
+}
+
+/**
+ @brief Cancel the timers of the seeds in some columns of a level, before their tiles are replaced
+ @param uiLevel The level
+ @param uiFirstCol The first column
+ @param uiEndCol The column after the last one
+ */
+void CMap2D::CancelSeedsInColumns(const unsigned int uiLevel, const unsigned int uiFirstCol, const unsigned int uiEndCol)
+{
+	std::map<int, SeedGrowth>& mapOfSeedGrowths = vSeedGrowths[uiLevel];
+	for (unsigned int uiRow = 0; uiRow < cSettings->NUM_TILES_YAXIS; uiRow++)
+	{
+		for (unsigned int uiCol = uiFirstCol; uiCol < uiEndCol; uiCol++)
+		{
+			Grid& sGrid = arrMapInfo[uiLevel][uiRow][uiCol];
+			if (sGrid.seedTimer == 0)
+				continue;
+
+			std::map<int, SeedGrowth>::iterator it = mapOfSeedGrowths.find(sGrid.value);
+			if (it != mapOfSeedGrowths.end())
+				it->second.cTimerWheel.Cancel(sGrid.seedTimer);
+			sGrid.seedTimer = 0;
+		}
+	}
+}
+
+/**
+ @brief Start the timers of the seeds in some columns of a level, after their tiles were replaced
+ @param uiLevel The level
+ @param uiFirstCol The first column
+ @param uiEndCol The column after the last one
+ */
+void CMap2D::ScheduleSeedsInColumns(const unsigned int uiLevel, const unsigned int uiFirstCol, const unsigned int uiEndCol)
+{
+	std::map<int, SeedGrowth>& mapOfSeedGrowths = vSeedGrowths[uiLevel];
+	for (unsigned int uiRow = 0; uiRow < cSettings->NUM_TILES_YAXIS; uiRow++)
+	{
+		for (unsigned int uiCol = uiFirstCol; uiCol < uiEndCol; uiCol++)
+		{
+			Grid& sGrid = arrMapInfo[uiLevel][uiRow][uiCol];
+			std::map<int, SeedGrowth>::iterator it = mapOfSeedGrowths.find(sGrid.value);
+			if (it != mapOfSeedGrowths.end())
+				sGrid.seedTimer = it->second.cTimerWheel.Add(it->second.fGrowTime, (uiRow << 16) | uiCol);
+		}
+	}
+}
+
+/**
+ @brief Generate the tiles of some columns of the current level from the world seed, replacing the whole columns.
+		The ground starts within a row of the ground of the column before the first one.
+		The chunks which the columns are in are generated in parallel on CJobSystem. Each job writes only
+		the columns of its own chunks into arrMapInfo, so the jobs do not share any tiles.
+		Then the solid tiles are rebuilt, and the timers of the seeds which were generated are started.
+ @param uiFirstCol The first column
+ @param uiEndCol The column after the last one
+ @param iEnemyTile The tile which is placed for an enemy
+ @param bSingleEnemy If true, only the first enemy in the columns is placed
+ */
+void CMap2D::GenerateColumns(const unsigned int uiFirstCol, const unsigned int uiEndCol, const int iEnemyTile, const bool bSingleEnemy)
+{
+	PROFILE_ZONE("CMap2D::GenerateColumns");
+
+	if (uiFirstCol >= uiEndCol)
+		return;
+
+	CTerrainGenerator cTerrainGenerator;
+	cTerrainGenerator.Init(uiWorldSeed, cSettings->NUM_TILES_YAXIS, uiFirstCol, iEnemyTile, bSingleEnemy);
+	// Make the ground meet the top solid tile of the column before, e.g. the ground by the door
+	if (uiFirstCol > 0)
+	{
+		for (unsigned int uiRow = 0; uiRow < cSettings->NUM_TILES_YAXIS; uiRow++)
+		{
+			if (GetTileProperties(arrMapInfo[uiCurLevel][uiRow][uiFirstCol - 1].value).uiFlags & TILE_SOLID)
 			{
-				arrMapInfo[uiCurLevel][uiRow][uiCol].timer += dt;
-				if (arrMapInfo[uiCurLevel][uiRow][uiCol].timer > timer)
-				{
-					arrMapInfo[uiCurLevel][uiRow][uiCol].value = blockNumber + 1;
-					SetSaveMapInfo(uiRow, uiCol, arrMapInfo[uiCurLevel][uiRow][uiCol].value, false, true);
-					arrMapInfo[uiCurLevel][uiRow][uiCol].timer = 0;
-				}
+				cTerrainGenerator.SetAnchor(uiFirstCol - 1, uiRow);
+				break;
 			}
 		}
 	}
+
+	CancelSeedsInColumns(uiCurLevel, uiFirstCol, uiEndCol);
+
+	const unsigned int uiFirstChunk = uiFirstCol / CTerrainGenerator::NUM_CHUNK_COLS;
+	const unsigned int uiNumChunks = (uiEndCol - 1) / CTerrainGenerator::NUM_CHUNK_COLS - uiFirstChunk + 1;
+	const unsigned int uiNumRows = cSettings->NUM_TILES_YAXIS;
+	Grid** arrRows = arrMapInfo[uiCurLevel];
+	// A chunk is quick to generate, so give each job a few chunks
+	CJobSystem::GetInstance()->ParallelFor(uiNumChunks, 4,
+		[&cTerrainGenerator, uiFirstChunk, uiFirstCol, uiEndCol, uiNumRows, arrRows](const unsigned int uiBegin, const unsigned int uiEnd) {
+			std::vector<int> vTiles;
+			for (unsigned int uiChunk = uiFirstChunk + uiBegin; uiChunk < uiFirstChunk + uiEnd; uiChunk++)
+			{
+				cTerrainGenerator.GenerateChunk(uiChunk, vTiles);
+				const unsigned int uiChunkCol = uiChunk * CTerrainGenerator::NUM_CHUNK_COLS;
+				const unsigned int uiColMin = max(uiChunkCol, uiFirstCol);
+				const unsigned int uiColMax = min(uiChunkCol + CTerrainGenerator::NUM_CHUNK_COLS, uiEndCol);
+				for (unsigned int uiCol = uiColMin; uiCol < uiColMax; uiCol++)
+				{
+					const int* pColumn = &vTiles[(uiCol - uiChunkCol) * uiNumRows];
+					for (unsigned int uiRow = 0; uiRow < uiNumRows; uiRow++)
+						arrRows[uiRow][uiCol].value = pColumn[uiRow];
+				}
+			}
+		});
+
+	BuildSolidTiles(uiCurLevel);
+	ScheduleSeedsInColumns(uiCurLevel, uiFirstCol, uiEndCol);
 }
 
 /**
@@ -892,23 +1113,17 @@ void CMap2D::UpdateSeed(string itemName, double dt, int blockNumber, float timer
 */
 CMap2D::BLOCK_TYPE CMap2D::GetBlockType(int blockNumber)
 {
-	if (blockNumber >= 1 && blockNumber < 100)
-		return BLOCKS;
-	else if (blockNumber >= 100 && blockNumber < 200)
-		return TREES;
-	else if (blockNumber >= 200 && blockNumber < 300)
-		return BACKGROUND_BLOCKS;
-	else if (blockNumber >= 300 && blockNumber < 400)
-		return COLLECTABLES;
-	else
-		return TOTAL_BLOCK_TYPE;
+	static_assert((int)TOTAL_BLOCK_TYPE == (int)TILE_LAYER_NONE, "TILE_LAYER must be in the order of BLOCK_TYPE");
+	return (BLOCK_TYPE)GetTileProperties(blockNumber).eLayer;
 }
 
 /**
  @brief Find a path
  */
-std::vector<glm::i32vec2> CMap2D::PathFind(const glm::i32vec2& startPos, const glm::i32vec2& targetPos, HeuristicFunction heuristicFunc, int weight)
+std::vector<glm::i32vec2> CMap2D::PathFind(const glm::i32vec2& startPos, const glm::i32vec2& targetPos, HeuristicFunction heuristicFunc, int weight) const
 {
+	PROFILE_ZONE("CMap2D::PathFind");
+
 	// Check if the startPos and targetPost are blocked
 	if (isBlocked(startPos.y, startPos.x) ||
 		(isBlocked(targetPos.y, targetPos.x)))
@@ -919,41 +1134,42 @@ std::vector<glm::i32vec2> CMap2D::PathFind(const glm::i32vec2& startPos, const g
 		return path;
 	}
 
-	// Set up the variables and lists
-	m_startPos = startPos;
-	m_targetPos = targetPos;
-	m_weight = weight;
-	m_heuristic = std::bind(heuristicFunc, _1, _2, _3);
+	// Set up the variables and lists of this thread
+	AStarSearch& sSearch = GetAStarSearch();
+	sSearch.m_startPos = startPos;
+	sSearch.m_targetPos = targetPos;
+	sSearch.m_weight = weight;
+	sSearch.m_heuristic = std::bind(heuristicFunc, _1, _2, _3);
 
 	// Reset AStar lists
-	ResetAStarLists();
+	ResetAStarLists(sSearch);
 
 	// Add the start pos to 2 lists
-	m_cameFromList[ConvertTo1D(m_startPos)].parent = m_startPos;
-	m_openList.push(Grid(m_startPos, 0));
+	sSearch.m_cameFromList[ConvertTo1D(sSearch.m_startPos)].parent = sSearch.m_startPos;
+	sSearch.m_openList.push(Grid(sSearch.m_startPos, 0));
 
 	unsigned int fNew, gNew, hNew;
 	glm::i32vec2 currentPos;
 
 	// Start the path finding...
-	while (!m_openList.empty())
+	while (!sSearch.m_openList.empty())
 	{
 		// Get the node with the least f value
-		currentPos = m_openList.top().pos;
+		currentPos = sSearch.m_openList.top().pos;
 		//cout << endl << "*** New position to check: " << currentPos.x << ", " << currentPos.y << endl;
 		//cout << "*** targetPos: " << m_targetPos.x << ", " << m_targetPos.y << endl;
 
 		// If the targetPos was reached, then quit this loop
-		if (currentPos == m_targetPos)
+		if (currentPos == sSearch.m_targetPos)
 		{
 			//cout << "=== Found the targetPos: " << m_targetPos.x << ", " << m_targetPos.y << endl;
-			while (m_openList.size() != 0)
-				m_openList.pop();
+			while (sSearch.m_openList.size() != 0)
+				sSearch.m_openList.pop();
 			break;
 		}
 
-		m_openList.pop();
-		m_closedList[ConvertTo1D(currentPos)] = true;
+		sSearch.m_openList.pop();
+		sSearch.m_closedList[ConvertTo1D(currentPos)] = true;
 
 		// Check the neighbors of the current node
 		for (unsigned int i = 0; i < m_nrOfDirections; ++i)
@@ -964,22 +1180,22 @@ std::vector<glm::i32vec2> CMap2D::PathFind(const glm::i32vec2& startPos, const g
 			//cout << "\t#" << i << ": Check this: " << neighborPos.x << ", " << neighborPos.y << ":\t";
 			if (!isValid(neighborPos) ||
 				isBlocked(neighborPos.y, neighborPos.x) ||
-				m_closedList[neighborIndex] == true)
+				sSearch.m_closedList[neighborIndex] == true)
 			{
 				//cout << "This position is not valid. Going to next neighbour." << endl;
 				continue;
 			}
 
-			gNew = m_cameFromList[ConvertTo1D(currentPos)].g + 1;
-			hNew = m_heuristic(neighborPos, m_targetPos, m_weight);
+			gNew = sSearch.m_cameFromList[ConvertTo1D(currentPos)].g + 1;
+			hNew = sSearch.m_heuristic(neighborPos, sSearch.m_targetPos, sSearch.m_weight);
 			fNew = gNew + hNew;
 
-			if (m_cameFromList[neighborIndex].f == 0 || fNew < m_cameFromList[neighborIndex].f)
+			if (sSearch.m_cameFromList[neighborIndex].f == 0 || fNew < sSearch.m_cameFromList[neighborIndex].f)
 			{
 				//cout << "Adding to Open List: " << neighborPos.x << ", " << neighborPos.y;
 				//cout << ". [ f : " << fNew << ", g : " << gNew << ", h : " << hNew << "]" << endl;
-				m_openList.push(Grid(neighborPos, fNew));
-				m_cameFromList[neighborIndex] = { neighborPos, currentPos, fNew, gNew, hNew };
+				sSearch.m_openList.push(Grid(neighborPos, fNew));
+				sSearch.m_cameFromList[neighborIndex] = { neighborPos, currentPos, fNew, gNew, hNew };
 			}
 			else
 			{
@@ -989,22 +1205,22 @@ std::vector<glm::i32vec2> CMap2D::PathFind(const glm::i32vec2& startPos, const g
 		//system("pause");
 	}
 
-	return BuildPath();
+	return BuildPath(sSearch);
 }
 
 /**
  @brief Build a path
  */
-std::vector<glm::i32vec2> CMap2D::BuildPath() const
+std::vector<glm::i32vec2> CMap2D::BuildPath(const AStarSearch& sSearch) const
 {
 	std::vector<glm::i32vec2> path;
-	auto currentPos = m_targetPos;
+	auto currentPos = sSearch.m_targetPos;
 	auto currentIndex = ConvertTo1D(currentPos);
 
-	while (!(m_cameFromList[currentIndex].parent == currentPos))
+	while (!(sSearch.m_cameFromList[currentIndex].parent == currentPos))
 	{
 		path.push_back(currentPos);
-		currentPos = m_cameFromList[currentIndex].parent;
+		currentPos = sSearch.m_cameFromList[currentIndex].parent;
 		currentIndex = ConvertTo1D(currentPos);
 	}
 
@@ -1014,14 +1230,14 @@ std::vector<glm::i32vec2> CMap2D::BuildPath() const
 		// if m_startPos is next to m_targetPos, then having 1 path point is OK
 		if (m_nrOfDirections == 4)
 		{
-			if (abs(m_targetPos.y - m_startPos.y) + abs(m_targetPos.x - m_startPos.x) > 1)
+			if (abs(sSearch.m_targetPos.y - sSearch.m_startPos.y) + abs(sSearch.m_targetPos.x - sSearch.m_startPos.x) > 1)
 				path.clear();
 		}
 		else
 		{
-			if (abs(m_targetPos.y - m_startPos.y) + abs(m_targetPos.x - m_startPos.x) > 2)
+			if (abs(sSearch.m_targetPos.y - sSearch.m_startPos.y) + abs(sSearch.m_targetPos.x - sSearch.m_startPos.x) > 2)
 				path.clear();
-			else if (abs(m_targetPos.y - m_startPos.y) + abs(m_targetPos.x - m_startPos.x) > 1)
+			else if (abs(sSearch.m_targetPos.y - sSearch.m_startPos.y) + abs(sSearch.m_targetPos.x - sSearch.m_startPos.x) > 1)
 				path.clear();
 		}
 	}
@@ -1089,19 +1305,11 @@ bool CMap2D::isBlocked(const unsigned int uiRow, const unsigned int uiCol, const
 {
 	if (bInvert == true)
 	{
-		if ((arrMapInfo[uiCurLevel][cSettings->NUM_TILES_YAXIS - uiRow - 1][uiCol].value >= 100) &&
-			(arrMapInfo[uiCurLevel][cSettings->NUM_TILES_YAXIS - uiRow - 1][uiCol].value < 200))
-			return true;
-		else
-			return false;
+		return (GetTileProperties(arrMapInfo[uiCurLevel][cSettings->NUM_TILES_YAXIS - uiRow - 1][uiCol].value).uiFlags & TILE_PATH_BLOCKING) != 0;
 	}
 	else
 	{
-		if ((arrMapInfo[uiCurLevel][uiRow][uiCol].value >= 100) &&
-			(arrMapInfo[uiCurLevel][uiRow][uiCol].value < 200))
-			return true;
-		else
-			return false;
+		return (GetTileProperties(arrMapInfo[uiCurLevel][uiRow][uiCol].value).uiFlags & TILE_PATH_BLOCKING) != 0;
 	}
 }
 
@@ -1115,43 +1323,57 @@ int CMap2D::ConvertTo1D(const glm::i32vec2& pos) const
 }
 
 /**
- @brief Delete AStar lists
+ @brief Get the AStar lists of the calling thread. They are kept between searches, so that they are not allocated for each search.
+ */
+AStarSearch& CMap2D::GetAStarSearch(void)
+{
+	static thread_local AStarSearch sSearch;
+	return sSearch;
+}
+
+/**
+ @brief Delete the AStar lists of the calling thread
  */
 bool CMap2D::DeleteAStarLists(void)
 {
+	AStarSearch& sSearch = GetAStarSearch();
 	// Delete m_openList
-	while (m_openList.size() != 0)
-		m_openList.pop();
+	while (sSearch.m_openList.size() != 0)
+		sSearch.m_openList.pop();
 	// Delete m_cameFromList
-	m_cameFromList.clear();
+	sSearch.m_cameFromList.clear();
 	// Delete m_closedList
-	m_closedList.clear();
+	sSearch.m_closedList.clear();
 
 	return true;
 }
 
 
 /**
- @brief Reset AStar lists
+ @brief Reset AStar lists, sizing them for the current map
  */
-bool CMap2D::ResetAStarLists(void)
+bool CMap2D::ResetAStarLists(AStarSearch& sSearch) const
 {
 	// Delete m_openList
-	while (m_openList.size() != 0)
-		m_openList.pop();
+	while (sSearch.m_openList.size() != 0)
+		sSearch.m_openList.pop();
+	// Resize the lists if the map has changed size since the last search of this thread
+	const unsigned int uiNumGrids = cSettings->NUM_TILES_YAXIS * cSettings->NUM_TILES_XAXIS;
+	sSearch.m_cameFromList.resize(uiNumGrids);
+	sSearch.m_closedList.resize(uiNumGrids);
 	// Reset m_cameFromList
-	for (int i = 0; i < m_cameFromList.size(); i++)
+	for (int i = 0; i < sSearch.m_cameFromList.size(); i++)
 	{
-		m_cameFromList[i].pos = glm::i32vec2(0, 0);
-		m_cameFromList[i].parent = glm::i32vec2(0, 0);
-		m_cameFromList[i].f = 0;
-		m_cameFromList[i].g = 0;
-		m_cameFromList[i].h = 0;
+		sSearch.m_cameFromList[i].pos = glm::i32vec2(0, 0);
+		sSearch.m_cameFromList[i].parent = glm::i32vec2(0, 0);
+		sSearch.m_cameFromList[i].f = 0;
+		sSearch.m_cameFromList[i].g = 0;
+		sSearch.m_cameFromList[i].h = 0;
 	}
 	// Reset m_closedList
-	for (int i = 0; i < m_closedList.size(); i++)
+	for (int i = 0; i < sSearch.m_closedList.size(); i++)
 	{
-		m_closedList[i] = false;
+		sSearch.m_closedList[i] = false;
 	}
 
 	return true;
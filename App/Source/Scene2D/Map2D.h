@@ -28,6 +28,12 @@
 // Include Settings
 #include "GameControl\Settings.h"
 
+// Include CTimerWheel
+#include "TimeControl\TimerWheel.h"
+
+// Include the properties of the tiles
+#include "TileTable.h"
+
 // Include Entity2D
 #include "Primitives/Entity2D.h"
 
@@ -51,12 +57,13 @@ struct MapSize {
 // It includes data to be used for A* Path Finding
 struct Grid {
 	unsigned int value;
-	float timer;
+	// The handle of the timer of the seed on this tile, or 0 if it is not a growing seed
+	unsigned int seedTimer;
 	float health;
 
-	Grid() : value(0), pos(0, 0), parent(-1, -1), f(0), g(0), h(0) {}
-	Grid(const glm::i32vec2& pos, unsigned int f) : value(0), pos(pos), parent(-1, 1), f(f), g(0), h(0) {}
-	Grid(const glm::i32vec2& pos, const glm::i32vec2& parent, unsigned int f, unsigned int g, unsigned int h) : value(0), pos(pos), parent(parent), f(f), g(g), h(h) {}
+	Grid() : value(0), seedTimer(0), pos(0, 0), parent(-1, -1), f(0), g(0), h(0) {}
+	Grid(const glm::i32vec2& pos, unsigned int f) : value(0), seedTimer(0), pos(pos), parent(-1, 1), f(f), g(0), h(0) {}
+	Grid(const glm::i32vec2& pos, const glm::i32vec2& parent, unsigned int f, unsigned int g, unsigned int h) : value(0), seedTimer(0), pos(pos), parent(parent), f(f), g(g), h(h) {}
 
 	glm::i32vec2 pos;
 	glm::i32vec2 parent;
@@ -66,6 +73,21 @@ struct Grid {
 };
 
 using HeuristicFunction = std::function<unsigned int(const glm::i32vec2&, const glm::i32vec2&, int)>;
+
+// The variables and lists of an A* search. Each thread has its own, so that the enemies can find their paths in parallel.
+struct AStarSearch {
+	int m_weight;
+	glm::i32vec2 m_startPos;
+	glm::i32vec2 m_targetPos;
+
+	// The handle for heuristic functions
+	HeuristicFunction m_heuristic;
+
+	// Lists for A-Star PathFinding
+	std::priority_queue<Grid> m_openList;
+	std::vector<bool> m_closedList;
+	std::vector<Grid> m_cameFromList;
+};
 // Reverse std::priority_queue to get the smallest element on top
 inline bool operator< (const Grid& a, const Grid& b) { return b.f < a.f; }
 
@@ -118,9 +140,27 @@ public:
 
 	void SetSaveMapInfo(const unsigned int uiRow, const unsigned int uiCol, const int iValue, const bool bInvert = true, const bool docSave = true);
 
+	// Add a marker over a tile, which is drawn over the map but is not part of it
+	void AddTileMarker(const unsigned int uiRow, const unsigned int uiCol, const int iTextureCode, const bool bInvert = true);
+	// Remove all the markers over the tiles
+	void ClearTileMarkers(void);
+
 	// Get the value at certain indices in the arrMapInfo
 	int GetMapInfo(const unsigned int uiRow, const unsigned int uiCol, const bool bInvert = true) const;
 
+	// Check if the tile at certain indices has any of some TILE_FLAGs
+	bool HasTileFlags(const unsigned int uiRow, const unsigned int uiCol, const unsigned int uiFlags, const bool bInvert = true) const;
+	// Check if any tile in a box of tiles has any of some TILE_FLAGs. The rows are counted from the bottom.
+	bool HasTileFlagsInBox(const int iRow, const int iCol, const int iNumRows, const int iNumCols, const unsigned int uiFlags) const;
+	// The direction of each DIRECTION of CPlayer2D and CEnemy2D in the map, where the rows are counted from the bottom
+	static const glm::i32vec2 DIRECTION_VECTORS[4];
+	// Check if the tiles which an entity moves into in a direction have any of some TILE_FLAGs
+	bool IsEdgeBlocked(	const glm::i32vec2& i32vec2Index, const glm::i32vec2& i32vec2NumMicroSteps,
+						const glm::i32vec2& i32vec2Direction, const unsigned int uiFlags) const;
+	// Sweep an entity up or down to a row, and get the first row where its edge is blocked
+	bool SweepRows(	const glm::i32vec2& i32vec2Index, const glm::i32vec2& i32vec2NumMicroSteps,
+					const int iDirectionY, const int iToRow, const unsigned int uiFlags, int& iBlockedRow) const;
+
 	// Load a map
 	bool LoadMap(string filename, const unsigned int uiLevel = 0);
 
@@ -136,8 +176,14 @@ public:
 	//generate a randomly loaded map
 	bool GenerateRandomMap();
 
+	//add 10 generated columns to the map and save it
 	bool ProceduralGeneration();
 
+	// Set the world seed which the generated columns are made from
+	void SetWorldSeed(const unsigned int uiWorldSeed);
+	// Get the world seed
+	unsigned int GetWorldSeed(void) const;
+
 	// Find the indices of a certain value in arrMapInfo
 	bool FindValue(const int iValue, unsigned int& uirRow, unsigned int& uirCol, const bool bInvert = true);
 
@@ -168,15 +214,15 @@ public:
 	glm::vec2 mapOffset;
 	glm::vec2 mapOffset_MicroSteps;
 
-	//update individual block seeds based on timing
+	//grow the seeds whose timers expired
 	void UpdateSeed(string itemName, double dt, int blockNumber, float timer);
 
 	BLOCK_TYPE GetBlockType(int blockNumber);
 
 	//unsigned getCurrX(void);
 
-	// For AStar PathFinding
-	std::vector<glm::i32vec2> PathFind(const glm::i32vec2& startPos, const glm::i32vec2& targetPos, HeuristicFunction heuristicFunc, int weight = 1);
+	// For AStar PathFinding. It does not change the map, and can be called from several threads at once.
+	std::vector<glm::i32vec2> PathFind(const glm::i32vec2& startPos, const glm::i32vec2& targetPos, HeuristicFunction heuristicFunc, int weight = 1) const;
 	// Set if AStar PathFinding will consider diagonal movements
 	void SetDiagonalMovement(const bool bEnable);
 	// Print out details about this class instance in the console window
@@ -218,12 +264,64 @@ protected:
 	// Render a tile
 	void RenderTile(const unsigned int uiRow, const unsigned int uiCol);
 
+	// Get the number of tiles which the map is scrolled to the left by
+	float GetScrollOffsetX(void) const;
+
+	// A marker which is drawn over a tile, e.g. the range which the player can reach
+	struct TileMarker {
+		unsigned int uiRow;
+		unsigned int uiCol;
+		int iTextureCode;
+	};
+	// The markers over the tiles, which are kept apart from arrMapInfo, with the rows not inverted
+	std::vector<TileMarker> vTileMarkers;
+	// Get the value of a tile which was read from a map file, emptying the markers which older saves wrote into the map
+	static int GetLoadedTileValue(const int iValue);
+
+	// The seeds of a type on a level, which grow when their timers expire
+	struct SeedGrowth {
+		// The time in seconds which the seeds take to grow
+		float fGrowTime;
+		// The timers of the seeds, with the row and column of their tile as the payload
+		CTimerWheel cTimerWheel;
+	};
+	// The seeds of each level, by the block number of the seeds. A type is added when UpdateSeed first grows it.
+	std::vector<std::map<int, SeedGrowth>> vSeedGrowths;
+	// The tiles of the seeds whose timers expired in UpdateSeed
+	std::vector<unsigned int> vExpiredSeeds;
+
+	// The solid tiles of each level, as a bit for each column, with uiNumSolidWords words for each row which is not inverted
+	std::vector<std::vector<unsigned long long>> vSolidTiles;
+	// The number of words in each row of vSolidTiles
+	unsigned int uiNumSolidWords;
+
+	// Set the bits of the solid tiles of a level from its tiles, after they were loaded
+	void BuildSolidTiles(const unsigned int uiLevel);
+	// Check if a row which is not inverted has a solid tile from iColMin to iColMax
+	bool HasSolidTile(const unsigned int uiRow, const int iColMin, const int iColMax) const;
+
+	// Set the value of a tile, start or cancel the timer of its seed, and update its solid bit
+	void SetTileValue(const unsigned int uiLevel, const unsigned int uiRow, const unsigned int uiCol, const int iValue);
+	// Start the timers of the seeds of a type on a level, replacing their timers
+	void ScheduleSeeds(const unsigned int uiLevel, const int iBlockNumber);
+	// Start the timers of the seeds of every type on a level, after the tiles were loaded
+	void ScheduleAllSeeds(const unsigned int uiLevel);
+	// Cancel the timers of the seeds in some columns of a level, before their tiles are replaced
+	void CancelSeedsInColumns(const unsigned int uiLevel, const unsigned int uiFirstCol, const unsigned int uiEndCol);
+	// Start the timers of the seeds in some columns of a level, after their tiles were replaced
+	void ScheduleSeedsInColumns(const unsigned int uiLevel, const unsigned int uiFirstCol, const unsigned int uiEndCol);
+
+	// The seed of the columns which are generated by CTerrainGenerator
+	unsigned int uiWorldSeed;
+	// Generate the tiles of some columns of the current level from the world seed, a chunk on each job
+	void GenerateColumns(const unsigned int uiFirstCol, const unsigned int uiEndCol, const int iEnemyTile, const bool bSingleEnemy);
+
 	unsigned int xList; //column
 	unsigned int yList; //row
 
 	// For A-Star PathFinding
 	// Build a path from m_cameFromList after calling PathFind()
-	std::vector<glm::i32vec2> BuildPath() const;
+	std::vector<glm::i32vec2> BuildPath(const AStarSearch& sSearch) const;
 	// Check if a grid is valid
 	bool isValid(const glm::i32vec2& pos) const;
 	// Check if a grid is blocked
@@ -233,24 +331,15 @@ protected:
 	// Convert a position to a 1D position in the array
 	int ConvertTo1D(const glm::i32vec2& pos) const;
 
-	// Delete AStar lists
+	// Get the AStar lists of the calling thread
+	static AStarSearch& GetAStarSearch(void);
+	// Delete the AStar lists of the calling thread
 	bool DeleteAStarLists(void);
-	// Reset AStar lists
-	bool ResetAStarLists(void);
+	// Reset AStar lists, sizing them for the current map
+	bool ResetAStarLists(AStarSearch& sSearch) const;
 
 	// Variables for A-Star PathFinding
-	int m_weight;
 	unsigned int m_nrOfDirections;
-	glm::i32vec2 m_startPos;
-	glm::i32vec2 m_targetPos;
-
-	// The handle for heuristic functions
-	HeuristicFunction m_heuristic;
-
-	// Lists for A-Star PathFinding
-	std::priority_queue<Grid> m_openList;
-	std::vector<bool> m_closedList;
-	std::vector<Grid> m_cameFromList;
 	std::vector<glm::i32vec2> m_directions;
 
 private:
@@ -12,13 +12,10 @@ using namespace std;
  @brief Constructor This constructor has protected access modifier as this class will be a Singleton
  */
 CPhysics2D::CPhysics2D(void)
-	: v2InitialVelocity(glm::vec2(0.0f))
-	, v2FinalVelocity(glm::vec2(0.0f))
-	, v2Acceleration(glm::vec2(0.0f))
-	, v2Displacement(glm::vec2(0.0f))
-	, fTime(0.0f)
-	, sCurrentStatus(STATUS::IDLE)
+	: cPhysicsWorld2D(CPhysicsWorld2D::GetInstance())
+	, uiBody(0)
 {
+	uiBody = cPhysicsWorld2D->AddBody();
 }
 
 /**
@@ -26,6 +23,7 @@ CPhysics2D::CPhysics2D(void)
  */
 CPhysics2D::~CPhysics2D(void)
 {
+	cPhysicsWorld2D->RemoveBody(uiBody);
 }
 
 /**
@@ -34,11 +32,11 @@ CPhysics2D::~CPhysics2D(void)
 bool CPhysics2D::Init(void)
 {
 	// Reset these variables
-	v2InitialVelocity = glm::vec2(0.0f);
-	v2FinalVelocity = glm::vec2(0.0f);
-	//v2Acceleration = glm::vec2(0.0f);		// Acceleration does not need to be reset here.
-	v2Displacement = glm::vec2(0.0f);
-	fTime = 0.0f;
+	SetInitialVelocity(glm::vec2(0.0f));
+	SetFinalVelocity(glm::vec2(0.0f));
+	//SetAcceleration(glm::vec2(0.0f));		// Acceleration does not need to be reset here.
+	SetDisplacement(glm::vec2(0.0f));
+	SetTime(0.0f);
 	return true;
 }
 
@@ -46,44 +44,52 @@ bool CPhysics2D::Init(void)
 // Set Initial velocity
 void CPhysics2D::SetInitialVelocity(const glm::vec2 v2InitialVelocity)
 {
-	this->v2InitialVelocity = v2InitialVelocity;	// Initial velocity
+	cPhysicsWorld2D->vInitialVelocityX[uiBody] = v2InitialVelocity.x;	// Initial velocity
+	cPhysicsWorld2D->vInitialVelocityY[uiBody] = v2InitialVelocity.y;
+	cPhysicsWorld2D->vIntegrated[uiBody] = 0;
 }
 
 // Set Final velocity
 void CPhysics2D::SetFinalVelocity(const glm::vec2 v2FinalVelocity)
 {
-	this->v2FinalVelocity = v2FinalVelocity;		// Final velocity
+	cPhysicsWorld2D->vFinalVelocityX[uiBody] = v2FinalVelocity.x;		// Final velocity
+	cPhysicsWorld2D->vFinalVelocityY[uiBody] = v2FinalVelocity.y;
 }
 
 // Set Acceleration
 void CPhysics2D::SetAcceleration(const glm::vec2 v2Acceleration)
 {
-	this->v2Acceleration = v2Acceleration;		// Acceleration
+	cPhysicsWorld2D->vAccelerationX[uiBody] = v2Acceleration.x;		// Acceleration
+	cPhysicsWorld2D->vAccelerationY[uiBody] = v2Acceleration.y;
 }
 
 // Set Displacement
 void CPhysics2D::SetDisplacement(const glm::vec2 v2Displacement)
 {
-	this->v2Displacement = v2Displacement;		// Displacement
+	cPhysicsWorld2D->vDisplacementX[uiBody] = v2Displacement.x;		// Displacement
+	cPhysicsWorld2D->vDisplacementY[uiBody] = v2Displacement.y;
 }
 
 // Set Time
 void CPhysics2D::SetTime(const float fTime)
 {
-	this->fTime = fTime;					// Time
+	// The result of CPhysicsWorld2D::Step is kept only if it used the same time
+	if (cPhysicsWorld2D->vTime[uiBody] != fTime)
+		cPhysicsWorld2D->vIntegrated[uiBody] = 0;
+	cPhysicsWorld2D->vTime[uiBody] = fTime;					// Time
 }
 
 // Set Status
 void CPhysics2D::SetStatus(const STATUS sStatus)
 {
 	// If there is a change in status, then reset to default values
-	if (sCurrentStatus != sStatus)
+	if (GetStatus() != sStatus)
 	{
 		// Reset to default values
 		Init();
 
 		// Store the new status
-		sCurrentStatus = sStatus;
+		cPhysicsWorld2D->vStatus[uiBody] = sStatus;
 	}
 }
 
@@ -91,59 +97,77 @@ void CPhysics2D::SetStatus(const STATUS sStatus)
 // Get Initial velocity
 glm::vec2 CPhysics2D::GetInitialVelocity(void) const
 {
-	return v2InitialVelocity;	// Initial velocity
+	return glm::vec2(cPhysicsWorld2D->vInitialVelocityX[uiBody], cPhysicsWorld2D->vInitialVelocityY[uiBody]);	// Initial velocity
 }
 
 // Get Final velocity
 glm::vec2 CPhysics2D::GetFinalVelocity(void) const
 {
-	return v2FinalVelocity;		// Final velocity
+	return glm::vec2(cPhysicsWorld2D->vFinalVelocityX[uiBody], cPhysicsWorld2D->vFinalVelocityY[uiBody]);		// Final velocity
 }
 
 // Get Acceleration
 glm::vec2 CPhysics2D::GetAcceleration(void) const
 {
-	return v2Acceleration;		// Acceleration
+	return glm::vec2(cPhysicsWorld2D->vAccelerationX[uiBody], cPhysicsWorld2D->vAccelerationY[uiBody]);		// Acceleration
 }
 
 // Get Displacement
 glm::vec2 CPhysics2D::GetDisplacement(void) const
 {
-	return v2Displacement;		// Displacement
+	return glm::vec2(cPhysicsWorld2D->vDisplacementX[uiBody], cPhysicsWorld2D->vDisplacementY[uiBody]);		// Displacement
 }
 
 // Get Time
 float CPhysics2D::GetTime(void) const
 {
-	return fTime;					// Time
+	return cPhysicsWorld2D->vTime[uiBody];					// Time
 }
 
 // Get Status
 CPhysics2D::STATUS CPhysics2D::GetStatus(void) const
 {
-	return sCurrentStatus;
+	return (STATUS)cPhysicsWorld2D->vStatus[uiBody];
 }
 
 // Update
 void CPhysics2D::Update(void)
 {
+	// Let CPhysicsWorld2D::Step integrate this body in the next step
+	cPhysicsWorld2D->vUpdated[uiBody] = 1;
+
 	// If the player is in IDLE mode, 
 	// then we don't calculate further
-	if (sCurrentStatus == IDLE)
+	if (GetStatus() == IDLE)
+		return;
+
+	// If CPhysicsWorld2D::Step has calculated the final velocity and the displacement, then use them
+	if (cPhysicsWorld2D->vIntegrated[uiBody] != 0)
+	{
+		const glm::vec2 v2FinalVelocity(cPhysicsWorld2D->vStepFinalVelocityX[uiBody], cPhysicsWorld2D->vStepFinalVelocityY[uiBody]);
+		SetDisplacement(glm::vec2(cPhysicsWorld2D->vStepDisplacementX[uiBody], cPhysicsWorld2D->vStepDisplacementY[uiBody]));
+		SetFinalVelocity(v2FinalVelocity);
+		// Update v2InitialVelocity. It also marks the result as used.
+		SetInitialVelocity(v2FinalVelocity);
 		return;
+	}
+
+	const glm::vec2& v2Gravity = CPhysicsWorld2D::v2Gravity;
+	const float fTime = GetTime();
 
 	// Calculate the final velocity
-	v2FinalVelocity = v2InitialVelocity + v2Gravity * fTime;
+	const glm::vec2 v2FinalVelocity = GetInitialVelocity() + v2Gravity * fTime;
 	// Calculate the displacement
-	v2Displacement = v2FinalVelocity * fTime - 0.5f * v2Gravity * fTime * fTime;
+	SetDisplacement(v2FinalVelocity * fTime - 0.5f * v2Gravity * fTime * fTime);
+	SetFinalVelocity(v2FinalVelocity);
 	// Update v2InitialVelocity
-	v2InitialVelocity = v2FinalVelocity;
+	SetInitialVelocity(v2FinalVelocity);
 }
 
 // Add elapsed time
 void CPhysics2D::AddElapsedTime(const float fElapseTime)
 {
-	fTime = fElapseTime;
+	SetTime(fElapseTime);
 }
 
 // Calculate the distance between two vec2 varables
@@ -156,9 +180,14 @@ float CPhysics2D::CalculateDistance(glm::vec2 source, glm::vec2 destination)
 void CPhysics2D::PrintSelf(void)
 {
 	cout << "CPhysics2D::PrintSelf()" << endl;
+	const glm::vec2 v2InitialVelocity = GetInitialVelocity();
+	const glm::vec2 v2FinalVelocity = GetFinalVelocity();
+	const glm::vec2 v2Acceleration = GetAcceleration();
+	const glm::vec2 v2Displacement = GetDisplacement();
+	cout << "uiBody\t=\t" << uiBody << endl;
 	cout << "v2InitialVelocity\t=\t" << v2InitialVelocity.x << ", " << v2InitialVelocity.y << endl;
 	cout << "v2FinalVelocity\t=\t" << v2FinalVelocity.x << ", " << v2FinalVelocity.y << endl;
 	cout << "v2Acceleration\t=\t" << v2Acceleration.x << ", " << v2Acceleration.y << endl;
 	cout << "v2Displacement\t=\t" << v2Displacement.x << ", " << v2Displacement.y << endl;
-	cout << "fTime\t=\t" << fTime << endl;
+	cout << "fTime\t=\t" << GetTime() << endl;
 }
@@ -9,6 +9,13 @@
 #include <includes/gtc/matrix_transform.hpp>
 #include <includes/gtc/type_ptr.hpp>
 
+// Include CPhysicsWorld2D, which stores the members of the bodies
+#include "PhysicsWorld2D.h"
+
+/**
+ @brief A handle of a body in CPhysicsWorld2D. The body is added when this class instance is created
+		and removed when it is destroyed, so it cannot be copied.
+ */
 class CPhysics2D
 {
 public:
@@ -58,15 +65,12 @@ public:
 	void PrintSelf(void);
 
 protected:
-	// Variables for SUVAT calculations
-	glm::vec2 v2InitialVelocity;	// Initial velocity
-	glm::vec2 v2FinalVelocity;		// Final velocity
-	glm::vec2 v2Acceleration;		// Acceleration
-	glm::vec2 v2Displacement;		// Displacement
-	float fTime;					// Time
-
-	const glm::vec2 v2Gravity = glm::vec2( 0.0f, -10.0f);		// Gravity constant
+	// The world which stores the variables for SUVAT calculations, and the index of this body in it
+	CPhysicsWorld2D* cPhysicsWorld2D;
+	unsigned int uiBody;
 
-	STATUS sCurrentStatus;
+	// The body cannot be copied, as it would be removed twice
+	CPhysics2D(const CPhysics2D&);
+	CPhysics2D& operator=(const CPhysics2D&);
 };
 
@@ -0,0 +1,187 @@
+/**
+ CPhysicsWorld2D
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#include "PhysicsWorld2D.h"
+
+// Include CPhysics2D for the statuses of the bodies
+#include "Physics2D.h"
+
+// Include the SSE2 instructions
+#include <emmintrin.h>
+
+#include <algorithm>
+#include <iostream>
+using namespace std;
+
+static_assert(CPhysics2D::IDLE == 0, "The bodies which are added or past the last one must be IDLE");
+
+const glm::vec2 CPhysicsWorld2D::v2Gravity = glm::vec2(0.0f, -10.0f);
+
+/**
+ @brief Constructor This constructor has protected access modifier as this class will be a Singleton
+ */
+CPhysicsWorld2D::CPhysicsWorld2D(void)
+	: uiNumBodies(0)
+	, uiNumIntegrated(0)
+{
+}
+
+/**
+ @brief Destructor This destructor has protected access modifier as this class will be a Singleton
+ */
+CPhysicsWorld2D::~CPhysicsWorld2D(void)
+{
+}
+
+/**
+ @brief Add a body with no velocity, which is IDLE. The arrays of the bodies may be moved,
+		so it must not be called while the bodies are being updated on other threads.
+ @return The index of the body
+ */
+unsigned int CPhysicsWorld2D::AddBody(void)
+{
+	if (vFreeBodies.empty() == false)
+	{
+		const unsigned int uiBody = vFreeBodies.back();
+		vFreeBodies.pop_back();
+		return uiBody;
+	}
+
+	const unsigned int uiBody = uiNumBodies++;
+	if (uiBody >= vStatus.size())
+	{
+		// Double the arrays, keeping them a multiple of NUM_LANES long. The new bodies are all 0, so they are IDLE.
+		const size_t uiSize = max(vStatus.size() * 2, (size_t)NUM_LANES * 16);
+		vInitialVelocityX.resize(uiSize, 0.0f);
+		vInitialVelocityY.resize(uiSize, 0.0f);
+		vFinalVelocityX.resize(uiSize, 0.0f);
+		vFinalVelocityY.resize(uiSize, 0.0f);
+		vAccelerationX.resize(uiSize, 0.0f);
+		vAccelerationY.resize(uiSize, 0.0f);
+		vDisplacementX.resize(uiSize, 0.0f);
+		vDisplacementY.resize(uiSize, 0.0f);
+		vTime.resize(uiSize, 0.0f);
+		vStepFinalVelocityX.resize(uiSize, 0.0f);
+		vStepFinalVelocityY.resize(uiSize, 0.0f);
+		vStepDisplacementX.resize(uiSize, 0.0f);
+		vStepDisplacementY.resize(uiSize, 0.0f);
+		vStatus.resize(uiSize, 0);
+		vUpdated.resize(uiSize, 0);
+		vIntegrated.resize(uiSize, 0);
+	}
+	return uiBody;
+}
+
+/**
+ @brief Remove a body, so that its index can be used by the next body which is added
+ @param uiBody The index of the body
+ */
+void CPhysicsWorld2D::RemoveBody(const unsigned int uiBody)
+{
+	if (uiBody >= uiNumBodies)
+		return;
+
+	ResetBody(uiBody);
+	vFreeBodies.push_back(uiBody);
+}
+
+/**
+ @brief Integrate the bodies which are not IDLE, were updated in the last step and whose time is fTime, 4 at a time.
+		The SUVAT equations are calculated in the same order as CPhysics2D::Update, so the results are the same.
+		The results are kept apart from the members of the bodies, and are used only for the bodies which were integrated.
+ @param fTime The time step in seconds, which the entities also pass to CPhysics2D::SetTime
+ */
+void CPhysicsWorld2D::Step(const float fTime)
+{
+	uiNumIntegrated = 0;
+
+	// The terms of the equations which are the same for every body
+	const __m128 mTime = _mm_set1_ps(fTime);
+	const __m128 mGravityTimeX = _mm_set1_ps(v2Gravity.x * fTime);
+	const __m128 mGravityTimeY = _mm_set1_ps(v2Gravity.y * fTime);
+	const __m128 mHalfGravityTimeSquaredX = _mm_set1_ps(0.5f * v2Gravity.x * fTime * fTime);
+	const __m128 mHalfGravityTimeSquaredY = _mm_set1_ps(0.5f * v2Gravity.y * fTime * fTime);
+	const __m128i mZero = _mm_setzero_si128();
+	const __m128i mOne = _mm_set1_epi32(1);
+
+	const unsigned int uiSize = (uiNumBodies + NUM_LANES - 1) / NUM_LANES * NUM_LANES;
+	for (unsigned int i = 0; i < uiSize; i += NUM_LANES)
+	{
+		// All the bits are set in the lanes of the bodies which are not integrated
+		const __m128i mSkipped = _mm_or_si128(
+			_mm_or_si128(_mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)&vStatus[i]), mZero),
+						 _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)&vUpdated[i]), mZero)),
+			_mm_castps_si128(_mm_cmpneq_ps(_mm_loadu_ps(&vTime[i]), mTime)));
+		const __m128 mSkippedMask = _mm_castsi128_ps(mSkipped);
+		const int iSkippedLanes = _mm_movemask_ps(mSkippedMask);
+		if (iSkippedLanes == 0xF)
+		{
+			_mm_storeu_si128((__m128i*)&vIntegrated[i], mZero);
+			continue;
+		}
+
+		// v = u + at
+		const __m128 mFinalVelocityX = _mm_add_ps(_mm_loadu_ps(&vInitialVelocityX[i]), mGravityTimeX);
+		const __m128 mFinalVelocityY = _mm_add_ps(_mm_loadu_ps(&vInitialVelocityY[i]), mGravityTimeY);
+		// s = vt - 0.5at^2
+		_mm_storeu_ps(&vStepDisplacementX[i], _mm_sub_ps(_mm_mul_ps(mFinalVelocityX, mTime), mHalfGravityTimeSquaredX));
+		_mm_storeu_ps(&vStepDisplacementY[i], _mm_sub_ps(_mm_mul_ps(mFinalVelocityY, mTime), mHalfGravityTimeSquaredY));
+		_mm_storeu_ps(&vStepFinalVelocityX[i], mFinalVelocityX);
+		_mm_storeu_ps(&vStepFinalVelocityY[i], mFinalVelocityY);
+		_mm_storeu_si128((__m128i*)&vIntegrated[i], _mm_andnot_si128(mSkipped, mOne));
+
+		for (unsigned int uiLane = 0; uiLane < NUM_LANES; uiLane++)
+		{
+			if ((iSkippedLanes & (1 << uiLane)) == 0)
+				uiNumIntegrated++;
+		}
+	}
+
+	// The bodies have to be updated again to be integrated in the next step
+	if (uiSize > 0)
+		fill(vUpdated.begin(), vUpdated.begin() + uiSize, 0);
+}
+
+/**
+ @brief Get the number of bodies which were added and not removed
+ */
+unsigned int CPhysicsWorld2D::GetNumBodies(void) const
+{
+	return uiNumBodies - (unsigned int)vFreeBodies.size();
+}
+
+/**
+ @brief Get the number of bodies which the last Step integrated
+ */
+unsigned int CPhysicsWorld2D::GetNumIntegrated(void) const
+{
+	return uiNumIntegrated;
+}
+
+/**
+ @brief Print out details about this class instance in the console window
+ */
+void CPhysicsWorld2D::PrintSelf(void) const
+{
+	cout << "CPhysicsWorld2D::PrintSelf()" << endl;
+	cout << "Number of bodies\t=\t" << GetNumBodies() << endl;
+	cout << "Integrated in the last step\t=\t" << uiNumIntegrated << endl;
+}
+
+/**
+ @brief Reset the members of a body to those of a body which was just added
+ @param uiBody The index of the body
+ */
+void CPhysicsWorld2D::ResetBody(const unsigned int uiBody)
+{
+	vInitialVelocityX[uiBody] = vInitialVelocityY[uiBody] = 0.0f;
+	vFinalVelocityX[uiBody] = vFinalVelocityY[uiBody] = 0.0f;
+	vAccelerationX[uiBody] = vAccelerationY[uiBody] = 0.0f;
+	vDisplacementX[uiBody] = vDisplacementY[uiBody] = 0.0f;
+	vTime[uiBody] = 0.0f;
+	vStatus[uiBody] = CPhysics2D::IDLE;
+	vUpdated[uiBody] = 0;
+	vIntegrated[uiBody] = 0;
+}
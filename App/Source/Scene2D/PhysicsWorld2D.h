@@ -0,0 +1,85 @@
+/**
+ CPhysicsWorld2D
+ @brief The bodies of every CPhysics2D, which are integrated together in one pass.
+		The velocities, times and statuses of the bodies are kept in arrays of floats and ints, one array for each
+		member, so that Step integrates 4 bodies at a time with SSE instructions.
+		Step is called once at the start of each fixed time step. It integrates each body which is not IDLE, was
+		updated in the last step and was given the same time, with the same SUVAT equations as CPhysics2D::Update.
+		The body keeps the result until its CPhysics2D::Update is called, so the entity reads it as if it had
+		integrated the body itself. A body which was changed after Step, e.g. by a jump, is integrated again
+		in CPhysics2D::Update.
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#pragma once
+
+// Include SingletonTemplate
+#include "DesignPatterns\SingletonTemplate.h"
+
+#include <includes/glm.hpp>
+
+#include <vector>
+
+class CPhysicsWorld2D : public CSingletonTemplate<CPhysicsWorld2D>
+{
+	friend CSingletonTemplate<CPhysicsWorld2D>;
+	friend class CPhysics2D;
+public:
+	// The number of bodies which Step integrates at a time
+	static const unsigned int NUM_LANES = 4;
+	// Gravity constant
+	static const glm::vec2 v2Gravity;
+
+	// Add a body with no velocity, which is IDLE, and return its index
+	unsigned int AddBody(void);
+	// Remove a body, so that its index can be used by the next body which is added
+	void RemoveBody(const unsigned int uiBody);
+
+	// Integrate the bodies which are not IDLE and were updated in the last step with a time of fTime seconds
+	void Step(const float fTime);
+
+	// Get the number of bodies
+	unsigned int GetNumBodies(void) const;
+	// Get the number of bodies which the last Step integrated
+	unsigned int GetNumIntegrated(void) const;
+
+	// Print out details about this class instance in the console window
+	void PrintSelf(void) const;
+
+protected:
+	// The members of the bodies. The arrays are a multiple of NUM_LANES long, and the bodies past the last one are IDLE.
+	std::vector<float> vInitialVelocityX;
+	std::vector<float> vInitialVelocityY;
+	std::vector<float> vFinalVelocityX;
+	std::vector<float> vFinalVelocityY;
+	std::vector<float> vAccelerationX;
+	std::vector<float> vAccelerationY;
+	std::vector<float> vDisplacementX;
+	std::vector<float> vDisplacementY;
+	std::vector<float> vTime;
+	// The final velocity and the displacement which Step calculated for each body
+	std::vector<float> vStepFinalVelocityX;
+	std::vector<float> vStepFinalVelocityY;
+	std::vector<float> vStepDisplacementX;
+	std::vector<float> vStepDisplacementY;
+	// The CPhysics2D::STATUS of each body
+	std::vector<int> vStatus;
+	// 1 if CPhysics2D::Update was called since the last Step, else 0
+	std::vector<int> vUpdated;
+	// 1 if Step has integrated the body and CPhysics2D::Update has not used the result yet, else 0
+	std::vector<int> vIntegrated;
+
+	// The number of bodies, including the removed ones, and the removed bodies
+	unsigned int uiNumBodies;
+	std::vector<unsigned int> vFreeBodies;
+	// The number of bodies which the last Step integrated
+	unsigned int uiNumIntegrated;
+
+	// Constructor
+	CPhysicsWorld2D(void);
+	// Destructor
+	virtual ~CPhysicsWorld2D(void);
+
+	// Reset the members of a body to those of a body which was just added
+	void ResetBody(const unsigned int uiBody);
+};
@@ -10,9 +10,13 @@ using namespace std;
 
 // Include Shader Manager
 #include "RenderControl\ShaderManager.h"
+// Include Render Device
+#include "RenderControl\RenderDevice.h"
+// Include Render Queue
+#include "RenderControl\RenderQueue.h"
 
-// Include ImageLoader
-#include "System\ImageLoader.h"
+// Include AssetManager
+#include "System\AssetManager.h"
 
 // Include the Map2D as we will use it to check the player's movements and actions
 #include "Map2D.h"
@@ -21,6 +25,8 @@ using namespace std;
 #include "Primitives/MeshBuilder.h"
 
 #include "../SoundController/SoundController.h"
+// Include CProfiler
+#include "TimeControl\Profiler.h"
 
 /**
  @brief Constructor This constructor has protected access modifier as this class will be a Singleton
@@ -33,6 +39,9 @@ CPlayer2D::CPlayer2D(void)
 	, playerOffset(glm::vec2(0.0f))
 	, cInventoryManager(NULL)
 	, cInventoryItem(NULL)
+	, iStoneItemID(CInventoryManager::NO_ITEM)
+	, iStoneSwordItemID(CInventoryManager::NO_ITEM)
+	, iCheeseItemID(CInventoryManager::NO_ITEM)
 	, cEntityManager(NULL)
 	, cEntityFactory(NULL)
 {
@@ -75,9 +84,7 @@ CPlayer2D::~CPlayer2D(void)
 	}
 
 	// optional: de-allocate all resources once they've outlived their purpose:
-	glDeleteVertexArrays(1, &VAO);
-	glDeleteBuffers(1, &VBO);
-	glDeleteBuffers(1, &EBO);
+	CRenderDevice::GetActive()->DeleteVertexArray(VAO);
 }
 
 /**
@@ -136,8 +143,8 @@ bool CPlayer2D::Init(void)
 	i32vec2NumMicroSteps = glm::i32vec2(0, 0);
 
 	//CS: Create the Quad Mesh using the mesh builder
-	glGenVertexArrays(1, &VAO);
-	glBindVertexArray(VAO);
+	VAO = CRenderDevice::GetActive()->CreateVertexArray();
+	CRenderDevice::GetActive()->BindVertexArray(VAO);
 	quadMesh = CMeshBuilder::GenerateQuad(glm::vec4(1, 1, 1, 1), cSettings->TILE_WIDTH, cSettings->TILE_HEIGHT);
 
 	// Load the player texture
@@ -164,46 +171,46 @@ bool CPlayer2D::Init(void)
 
 	cInventoryItem = cInventoryManager->Add("Cheese", "Image/Items/Cheese.png", 32, 0);
 	cInventoryItem->vec2Size = glm::vec2(25, 25);
+	iCheeseItemID = cInventoryItem->iItemID;
 
 	cInventoryItem = cInventoryManager->Add("Stone", "Image/Items/Stone.png", 64, 5);
 	cInventoryItem->vec2Size = glm::vec2(25, 25);
+	iStoneItemID = cInventoryItem->iItemID;
 
 	//add fist
 	cInventoryItem = cInventoryManager->Add("Fist", "Image/Items/Fist.png", 1, 1);
 	cInventoryItem->vec2Size = glm::vec2(25, 25);
+	cInventoryItem->bCyclable = false;
 
 	//add sword
 	cInventoryItem = cInventoryManager->Add("StoneSword", "Image/Items/StoneSword.png", 1, 0);
 	cInventoryItem->vec2Size = glm::vec2(25, 25);
+	cInventoryItem->bCyclable = false;
+	iStoneSwordItemID = cInventoryItem->iItemID;
 
 	//add selector
 	cInventoryItem = cInventoryManager->Add("Selector", "Image/UI/selector.png", 1, 0);
 	cInventoryItem->vec2Size = glm::vec2(25, 25);
+	cInventoryItem->bCyclable = false;
 
-	//block items
-	itemList.push_back(make_pair("Bedrock", 1));
-	itemList.push_back(make_pair("GrassBlock", 2));
-	itemList.push_back(make_pair("DirtBlock", 3));
-	itemList.push_back(make_pair("Chest", 4));
-	itemList.push_back(make_pair("LavaBlock", 5));
-	itemList.push_back(make_pair("GrassSeed", 100));
-	itemList.push_back(make_pair("GrassTreeGrown", 101));
-	itemList.push_back(make_pair("DirtSeed", 102));
-	itemList.push_back(make_pair("DirtTreeGrown", 103));
-	itemList.push_back(make_pair("Stone", 301));
-	itemList.push_back(make_pair("Cheese", 302));
-	
-	//for seeds and tree blocks maps
-	MapOfBlocksToSeeds.insert(make_pair("DirtTreeGrown", "DirtBlock"));
-	MapOfBlocksToSeeds.insert(make_pair("GrassTreeGrown", "GrassBlock"));
-
-	MapOfTreesToBlocks.insert(make_pair("GrassSeed", "GrassTreeGrown"));
-	MapOfTreesToBlocks.insert(make_pair("DirtSeed", "DirtTreeGrown"));
+	//look up the items of the tiles by name once, so that the player uses their IDs afterwards
+	vTileItemIDs.assign(NUM_TILE_NUMBERS, CInventoryManager::NO_ITEM);
+	vItemTiles.assign(cInventoryManager->GetNumItemIDs(), 0);
+	for (unsigned int i = 0; i < NUM_TILE_DEFINITIONS; i++)
+	{
+		const char* pName = TILE_DEFINITIONS[i].sProperties.pName;
+		const int iItemID = (pName != nullptr ? cInventoryManager->GetItemID(pName) : CInventoryManager::NO_ITEM);
+		if (iItemID == CInventoryManager::NO_ITEM)
+			continue;
+		vTileItemIDs[TILE_DEFINITIONS[i].iTile] = iItemID;
+		if (vItemTiles[iItemID] == 0)
+			vItemTiles[iItemID] = TILE_DEFINITIONS[i].iTile;
+	}
 
 	for (int i = 0; i < 5; i++)
 		cInventoryManager->CycleThroughInventory();
 
-	cInventoryManager->currentWeapon = cInventoryManager->GetItem("StoneSword");
+	cInventoryManager->currentWeapon = cInventoryManager->GetItem(iStoneSwordItemID);
 	cInventoryManager->currentItem = cInventoryManager->currentWeapon;
 
 
@@ -215,6 +222,8 @@ bool CPlayer2D::Init(void)
  */
 void CPlayer2D::Update(const double dElapsedTime)
 {
+	PROFILE_ZONE("CPlayer2D::Update");
+
 	RenderBlockRangeTiles();
 	health = Math::Clamp(health, 0.f, maxHealth);
 
@@ -224,11 +233,11 @@ void CPlayer2D::Update(const double dElapsedTime)
 		i32vec2Index = glm::i32vec2(0, 4);
 		i32vec2NumMicroSteps = glm::i32vec2(0, 0);
 		health = 100.f;
-		cInventoryManager->GetNumItems();
-		for (auto const& x : cInventoryManager->inventoryMap)
+		for (int i = 0; i < cInventoryManager->GetNumItemIDs(); i++)
 		{
-			cInventoryItem = cInventoryManager->GetItem(x.first);
-			cInventoryItem->iItemCount = 0;
+			cInventoryItem = cInventoryManager->GetItem(i);
+			if (cInventoryItem != nullptr)
+				cInventoryItem->iItemCount = 0;
 		}
 	}
 
@@ -238,10 +247,10 @@ void CPlayer2D::Update(const double dElapsedTime)
 	////	playerPosition = glm::vec2(cSettings->TILE_RATIO_XAXIS / 2 - (int)playerOffset.x, i32vec2Index.y);
 
 	Shop();
-	CollectChest(4, 4);
-	AttackEnemy(300, 301);
-	CollectItem(301, 302);
-	CollideDamageBlock(dElapsedTime, 5, 5);
+	CollectChest(TILE_CHEST);
+	AttackEnemy(TILE_ENEMY);
+	CollectItem(TILE_COLLECTABLE);
+	CollideDamageBlock(dElapsedTime, TILE_DAMAGING);
 	SetInventorySelector();
 
 	// Store the old position
@@ -380,7 +389,7 @@ void CPlayer2D::Update(const double dElapsedTime)
 		Constraint(LEFT);
 
 		// If the new position is not feasible, then revert to old position
-		if (CheckPosition(LEFT, 1, 99) == false)
+		if (CheckPosition(LEFT, TILE_SOLID) == false)
 		{
 			i32vec2Index = i32vec2OldIndex;
 			i32vec2NumMicroSteps.x = 0;
@@ -418,7 +427,7 @@ void CPlayer2D::Update(const double dElapsedTime)
 		Constraint(RIGHT);
 
 		// If the new position is not feasible, then revert to old position
-		if (CheckPosition(RIGHT, 1, 99) == false)
+		if (CheckPosition(RIGHT, TILE_SOLID) == false)
 		{
 			i32vec2NumMicroSteps.x = 0;
 		}
@@ -614,11 +623,10 @@ void CPlayer2D::Update(const double dElapsedTime)
 void CPlayer2D::PreRender(void)
 {
 	// bind textures on corresponding texture units
-	glActiveTexture(GL_TEXTURE0);
+	CRenderDevice::GetActive()->ActiveTexture(GL_TEXTURE0);
 
 	// Activate blending mode
-	glEnable(GL_BLEND);
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	CRenderDevice::GetActive()->SetBlend(true);
 
 	// Activate the shader
 	CShaderManager::GetInstance()->Use(sShaderName);
@@ -629,31 +637,20 @@ void CPlayer2D::PreRender(void)
  */
 void CPlayer2D::Render(void)
 {
-	glBindVertexArray(VAO);
-	// get matrix's uniform location and set matrix
-	unsigned int transformLoc = glGetUniformLocation(CShaderManager::GetInstance()->activeShader->ID, "transform");
-	unsigned int colourLoc = glGetUniformLocation(CShaderManager::GetInstance()->activeShader->ID, "runtime_color");
-	glUniformMatrix4fv(transformLoc, 1, GL_FALSE, glm::value_ptr(transform));
-
 	transform = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
-	transform = glm::translate(transform, glm::vec3(vec2UVCoordinate.x,
-													vec2UVCoordinate.y,
+	// Render between the last two fixed time steps, so that the movement is smooth at any frame rate
+	const glm::vec2 vec2RenderUVCoordinate = GetRenderUVCoordinate();
+	transform = glm::translate(transform, glm::vec3(vec2RenderUVCoordinate.x,
+													vec2RenderUVCoordinate.y,
 													0.0f));
-	// Update the shaders with the latest transform
-	glUniformMatrix4fv(transformLoc, 1, GL_FALSE, glm::value_ptr(transform));
-	glUniform4fv(colourLoc, 1, glm::value_ptr(playerColour));
-
-	// Get the texture to be rendered
-	glBindTexture(GL_TEXTURE_2D, iTextureID);
-
-	// Render the tile
-	//glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
-	//CS: Render the tile
-	//quadMesh->Render();
-	//CS: Render the animation
-	animatedSprites->Render();
-	glBindVertexArray(0);
 
+	// Queue the animated sprite with its texture, transform and colour
+	CRenderQueue::GetInstance()->Submit(CRenderQueue::LAYER_PLAYER,
+										sShaderName,
+										iTextureID,
+										animatedSprites,
+										transform,
+										playerColour);
 }
 
 /**
@@ -662,7 +659,7 @@ void CPlayer2D::Render(void)
 void CPlayer2D::PostRender(void)
 {
 	// Disable blending
-	glDisable(GL_BLEND);
+	CRenderDevice::GetActive()->SetBlend(false);
 }
 
 /**
@@ -671,38 +668,12 @@ void CPlayer2D::PostRender(void)
 */
 bool CPlayer2D::LoadTexture(const char* filename, GLuint& iTextureID)
 {
-	// Variables used in loading the texture
-	int width, height, nrChannels;
-	
-	// texture 1
-	// ---------
-	glGenTextures(1, &iTextureID);
-	glBindTexture(GL_TEXTURE_2D, iTextureID);
-	// set the texture wrapping parameters
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-	// set texture filtering parameters
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-	CImageLoader* cImageLoader = CImageLoader::GetInstance();
-	unsigned char *data = cImageLoader->Load(filename, width, height, nrChannels, true);
-	if (data)
-	{
-		if (nrChannels == 3)
-			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, data);
-		else if (nrChannels == 4)
-			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
-
-		// Generate mipmaps
-		glGenerateMipmap(GL_TEXTURE_2D);
-	}
-	else
-	{
+	// Get the shared texture, and release the one which was loaded before
+	GLuint uiNewTextureID = CAssetManager::GetInstance()->AcquireTexture(filename);
+	if (uiNewTextureID == 0)
 		return false;
-	}
-	// Free up the memory of the file data read in
-	free(data);
+	CAssetManager::GetInstance()->ReleaseTexture(iTextureID);
+	iTextureID = uiNewTextureID;
 
 	return true;
 }
@@ -811,122 +782,24 @@ void CPlayer2D::Constraint(DIRECTION eDirection)
 /**
  @brief Check if a position is possible to move into
  @param eDirection A DIRECTION enumerated data type which indicates the direction to check
+ @param uiTileFlags The TILE_FLAGs of the tiles which cannot be moved into
  */
-bool CPlayer2D::CheckPosition(DIRECTION eDirection, int minIndex, int maxIndex)
+bool CPlayer2D::CheckPosition(DIRECTION eDirection, const unsigned int uiTileFlags)
 {
-	if (eDirection == LEFT)
-	{
-		// If the new position is fully within a row, then check this row only
-		if (i32vec2NumMicroSteps.y == 0)
-		{
-			// If the grid is not accessible, then return false
-			if (cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x) >= minIndex && 
-				(cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x) <= maxIndex))
-			{
-				return false;
-			}
-		}
-		// If the new position is between 2 rows, then check both rows as well
-		else if (i32vec2NumMicroSteps.y != 0)
-		{
-			// If the 2 grids are not accessible, then return false
-			if ((cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x) >= minIndex) && (cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x) <= maxIndex) ||
-				(cMap2D->GetMapInfo(i32vec2Index.y + 1, i32vec2Index.x) >= minIndex) && (cMap2D->GetMapInfo(i32vec2Index.y + 1, i32vec2Index.x) <= maxIndex))
-			{
-				return false;
-			}
-		}
-	}
-	else if (eDirection == RIGHT)
-	{
-		// If the new position is at the top row, then return true
-		if (i32vec2Index.x >= cSettings->NUM_TILES_XAXIS - 1)
-		{
-			i32vec2NumMicroSteps.x = 0;
-			return true;
-		}
-
-		// If the new position is fully within a row, then check this row only
-		if (i32vec2NumMicroSteps.y == 0)
-		{
-			// If the grid is not accessible, then return false
-			if ((cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x + 1) >= minIndex) &&
-				(cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x + 1) <= maxIndex))
-			{
-				return false;
-			}
-		}
-		// If the new position is between 2 rows, then check both rows as well
-		else if (i32vec2NumMicroSteps.y != 0)
-		{
-			// If the 2 grids are not accessible, then return false
-			if ((cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x + 1) >= minIndex) && (cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x + 1) <= maxIndex) ||
-				(cMap2D->GetMapInfo(i32vec2Index.y + 1, i32vec2Index.x + 1) >= minIndex) && (cMap2D->GetMapInfo(i32vec2Index.y + 1, i32vec2Index.x + 1) <= maxIndex))
-			{
-				return false;
-			}
-		}
-
-	}
-	else if (eDirection == UP)
-	{
-		// If the new position is at the top row, then return true
-		if (i32vec2Index.y >= cSettings->NUM_TILES_YAXIS - 1)
-		{
-			i32vec2NumMicroSteps.y = 0;
-			return true;
-		}
-
-		// If the new position is fully within a column, then check this column only
-		if (i32vec2NumMicroSteps.x == 0)
-		{
-			// If the grid is not accessible, then return false
-			if ((cMap2D->GetMapInfo(i32vec2Index.y + 1, i32vec2Index.x) >= minIndex) && 
-				(cMap2D->GetMapInfo(i32vec2Index.y + 1, i32vec2Index.x) <= maxIndex))
-			{
-				return false;
-			}
-		}
-		// If the new position is between 2 columns, then check both columns as well
-		else if (i32vec2NumMicroSteps.x != 0)
-		{
-			// If the 2 grids are not accessible, then return false
-			if ((cMap2D->GetMapInfo(i32vec2Index.y + 1, i32vec2Index.x) >= minIndex) && (cMap2D->GetMapInfo(i32vec2Index.y + 1, i32vec2Index.x) <= maxIndex) ||
-				(cMap2D->GetMapInfo(i32vec2Index.y + 1, i32vec2Index.x + 1) >= minIndex) && (cMap2D->GetMapInfo(i32vec2Index.y + 1, i32vec2Index.x + 1) <= maxIndex))
-			{
-				return false;
-			}
-		}
-	}
-	else if (eDirection == DOWN)
-	{
-		// If the new position is fully within a column, then check this column only
-		if (i32vec2NumMicroSteps.x == 0)
-		{
-			// If the grid is not accessible, then return false
-			if ((cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x) >= minIndex) &&
-				(cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x) <= maxIndex))
-			{
-				return false;
-			}
-		}
-		// If the new position is between 2 columns, then check both columns as well
-		else if (i32vec2NumMicroSteps.x != 0)
-		{
-			// If the 2 grids are not accessible, then return false
-			if ((cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x) >= minIndex) && (cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x) <= maxIndex) ||
-				(cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x + 1) >= minIndex) && (cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x + 1) <= maxIndex))
-			{
-				return false;
-			}
-		}
-	}
-	else
+	if ((eDirection < LEFT) || (eDirection >= NUM_DIRECTIONS))
 	{
 		cout << "CPlayer2D::CheckPosition: Unknown direction." << endl;
+		return true;
 	}
 
-	return true;
+	// At the right end or the top row there is no tile to move into, so align with the tile
+	if ((eDirection == RIGHT) && (i32vec2Index.x >= cSettings->NUM_TILES_XAXIS - 1))
+		i32vec2NumMicroSteps.x = 0;
+	else if ((eDirection == UP) && (i32vec2Index.y >= cSettings->NUM_TILES_YAXIS - 1))
+		i32vec2NumMicroSteps.y = 0;
+
+	// Check the 1 or 2 tiles which the edge of the new position is in
+	return !cMap2D->IsEdgeBlocked(i32vec2Index, i32vec2NumMicroSteps, CMap2D::DIRECTION_VECTORS[eDirection], uiTileFlags);
 }
 /*
 bool CPlayer2D::CheckPosition(DIRECTION eDirection, int minIndex, int maxIndex)
@@ -1191,75 +1064,52 @@ bool CPlayer2D::CheckPosition(DIRECTION eDirection, int minIndex, int maxIndex)
 */
 
 /**
- @brief Harvest fully grown trees for item blocks
+ @brief Harvest fully grown trees for item blocks, and blocks for seeds
  @param x An int for positionX to harvest
  @param y An int for positionY to harvest
  */
 void CPlayer2D::Harvest(int x, int y)
 {
-	string harvestItemName = GetStringItemList(cMap2D->GetMapInfo(y, x, false));
-
-	//get seed name or get block name for item harvested
-	string dropName = "";
-	bool changeToSeed = false;
-	for (auto const& x : MapOfBlocksToSeeds)
-	{
-		if (harvestItemName == x.first)
-		{
-			dropName = x.second;
-			break;
-		}
-		else if (harvestItemName == x.second)
-		{
-			dropName = x.first;
-			changeToSeed = true;
-			break;
-		}
-	}
-
-	if (changeToSeed)
-	{
-		for (auto const& x : MapOfTreesToBlocks)
-		{
-			if (dropName == x.second)
-			{
-				dropName = x.first;
-				break;
-			}
-		}
-	}
+	//get the item which the harvested tile drops, e.g. a block for a tree and a seed for a block
+	const TileProperties& sTile = GetTileProperties(cMap2D->GetMapInfo(y, x, false));
+	if ((sTile.uiFlags & TILE_HARVESTABLE) == 0)
+		return;
+	const int iDropItem = sTile.iDropItem;
+	if (iDropItem == 0)
+		return;
 
-	if (!cInventoryManager->Check(dropName))
+	const int iItemID = GetTileItemID(iDropItem);
+	if (!cInventoryManager->Check(iItemID))
 		return;
 
-	cInventoryItem = cInventoryManager->GetItem(dropName);
+	cInventoryItem = cInventoryManager->GetItem(iItemID);
 	cInventoryItem->Add(Math::RandIntMinMax(1, 4));
 }
 
 /**
  @brief Return the item block's quantity
- @param itemName A string for item block name
+ @param iItemID An int for the inventory item ID of the item block
  */
-bool CPlayer2D::CheckQuantity(string itemName, bool survival)
+bool CPlayer2D::CheckQuantity(const int iItemID, bool survival)
 {
 	if (!survival)
 		return true;
-	cInventoryItem = cInventoryManager->GetItem(itemName);
-	if (cInventoryItem->CheckAvailableQuantity())
+	cInventoryItem = cInventoryManager->GetItem(iItemID);
+	if ((cInventoryItem != nullptr) && cInventoryItem->CheckAvailableQuantity())
 		return true;
 	return false;
 }
 
 /**
  @brief Reduce item block quantity by a set amount
- @param itemName A string for item block name
+ @param iItemID An int for the inventory item ID of the item block
  @param quantity An int for the amount of quantity to reduce
  */
-void CPlayer2D::ReduceQuantity(string itemName, int quantity)
+void CPlayer2D::ReduceQuantity(const int iItemID, int quantity)
 {
-	if (itemName == "none")
+	cInventoryItem = cInventoryManager->GetItem(iItemID);
+	if (cInventoryItem == nullptr)
 		return;
-	cInventoryItem = cInventoryManager->GetItem(itemName);
 	cInventoryItem->Remove(quantity);
 }
 
@@ -1295,20 +1145,21 @@ void CPlayer2D::UpdateJumpFall(const double dElapsedTime)
 		// Constraint the player's position within the screen boundary
 		Constraint(UP);
 
-		// Iterate through all rows until the proposed row
+		// Sweep through all rows until the proposed row
 		// Check if the player will hit a tile; stop jump if so.
 		int iIndex_YAxis_Proposed = i32vec2Index.y;
-		for (int i = iIndex_YAxis_OLD; i <= iIndex_YAxis_Proposed; i++)
+		int iIndex_YAxis_Blocked = 0;
+		if (cMap2D->SweepRows(glm::i32vec2(i32vec2Index.x, iIndex_YAxis_OLD), i32vec2NumMicroSteps, 1, iIndex_YAxis_Proposed, TILE_SOLID, iIndex_YAxis_Blocked))
 		{
-			// Change the player's index to the current i value
-			i32vec2Index.y = i;
-			// If the new position is not feasible, then revert to old position
-			if (!CheckPosition(UP, 1, 99))
-			{
-				// Set the Physics to fall status
-				cPhysics2D.SetStatus(CPhysics2D::STATUS::FALL);
-				break;
-			}
+			// Stop at the row below the tile
+			i32vec2Index.y = iIndex_YAxis_Blocked;
+			// Set the Physics to fall status
+			cPhysics2D.SetStatus(CPhysics2D::STATUS::FALL);
+		}
+		else if (i32vec2Index.y >= (int)cSettings->NUM_TILES_YAXIS - 1)
+		{
+			// Align with the top row
+			i32vec2NumMicroSteps.y = 0;
 		}
 
 		// If the player is still jumping and the initial velocity has reached zero or below zero, 
@@ -1348,25 +1199,18 @@ void CPlayer2D::UpdateJumpFall(const double dElapsedTime)
 		// Constraint the player's position within the screen boundary
 		Constraint(DOWN);
 
-		// Iterate through all rows until the proposed row
+		// Sweep through all rows until the proposed row
 		// Check if the player will hit a tile; stop fall if so.
 		int iIndex_YAxis_Proposed = i32vec2Index.y;
-		for (int i = iIndex_YAxis_OLD; i >= iIndex_YAxis_Proposed; i--)
+		int iIndex_YAxis_Blocked = 0;
+		if (cMap2D->SweepRows(glm::i32vec2(i32vec2Index.x, iIndex_YAxis_OLD), i32vec2NumMicroSteps, -1, iIndex_YAxis_Proposed, TILE_SOLID, iIndex_YAxis_Blocked))
 		{
-			// Change the player's index to the current i value
-			i32vec2Index.y = i;
-			// If the new position is not feasible, then revert to old position
-			if (!CheckPosition(DOWN, 1, 99))
-			{
-				// Revert to the previous position
-				if (i != iIndex_YAxis_OLD)
-					i32vec2Index.y = i + 1;
-				// Set the Physics to idle status
-				cPhysics2D.SetStatus(CPhysics2D::STATUS::IDLE);
+			// Revert to the row above the tile
+			i32vec2Index.y = (iIndex_YAxis_Blocked != iIndex_YAxis_OLD ? iIndex_YAxis_Blocked + 1 : iIndex_YAxis_OLD);
+			// Set the Physics to idle status
+			cPhysics2D.SetStatus(CPhysics2D::STATUS::IDLE);
 
-				i32vec2NumMicroSteps.y = 0;
-				break;
-			}
+			i32vec2NumMicroSteps.y = 0;
 		}
 	}
 }
@@ -1485,10 +1329,10 @@ bool CPlayer2D::IsMidAir()
 		return false;
 	
 	//check if the tile below the player's current pos is empty
-	if ((i32vec2NumMicroSteps.x == 0) && (cMap2D->GetMapInfo(i32vec2Index.y - 1, i32vec2Index.x) == 0) || (cMap2D->GetMapInfo(i32vec2Index.y - 1, i32vec2Index.x) == 202))
+	if ((i32vec2NumMicroSteps.x == 0) && (cMap2D->GetMapInfo(i32vec2Index.y - 1, i32vec2Index.x) == 0))
 		return true;
 
-	else if ((i32vec2NumMicroSteps.x == 0) && (cMap2D->GetMapInfo(i32vec2Index.y - 1, i32vec2Index.x - (int)playerOffset.x) == 0) || (cMap2D->GetMapInfo(i32vec2Index.y - 1, i32vec2Index.x - (int)playerOffset.x) == 202))
+	else if ((i32vec2NumMicroSteps.x == 0) && (cMap2D->GetMapInfo(i32vec2Index.y - 1, i32vec2Index.x - (int)playerOffset.x) == 0))
 		return true;
 
 	return false;
@@ -1497,133 +1341,35 @@ bool CPlayer2D::IsMidAir()
 /**
  @brief Check for player's collision at both the left and right ends
  @param eDirection An enum for player's direction
+ @param uiTileFlags The TILE_FLAGs of the tiles to check for
  */
-bool CPlayer2D::Collision(DIRECTION eDirection, int minIndex, int maxIndex)
+bool CPlayer2D::Collision(DIRECTION eDirection, const unsigned int uiTileFlags)
 {
-	if (eDirection == LEFT)
-	{
-		// If the new position is fully within a row, then check this row only
-		if (i32vec2NumMicroSteps.y == 0)
-		{
-			// If the grid is not accessible, then return false
-			if (cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x - (int)playerOffset.x) >= minIndex && 
-				cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x - (int)playerOffset.x) <= maxIndex)
-			{
-				return true;
-			}
-		}
-		// If the new position is between 2 rows, then check both rows as well
-		else if (i32vec2NumMicroSteps.y != 0)
-		{
-			// If the 2 grids are not accessible, then return false
-			if ((cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x - (int)playerOffset.x) >= minIndex) && 
-				(cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x - (int)playerOffset.x) <= maxIndex) ||
-
-				(cMap2D->GetMapInfo(i32vec2Index.y + 1, i32vec2Index.x - (int)playerOffset.x) >= minIndex) && 
-				(cMap2D->GetMapInfo(i32vec2Index.y + 1, i32vec2Index.x - (int)playerOffset.x) <= maxIndex))
-			{
-				return true;
-			}
-		}
-	}
-	else if (eDirection == RIGHT)
+	if ((eDirection < LEFT) || (eDirection >= NUM_DIRECTIONS))
 	{
-		// If the new position is at the top row, then return true
-		if (i32vec2Index.x >= cSettings->NUM_TILES_XAXIS - 1)
-		{
-			i32vec2NumMicroSteps.x = 0;
-			return false;
-		}
-
-		// If the new position is fully within a row, then check this row only
-		if (i32vec2NumMicroSteps.y == 0)
-		{
-			// If the grid is not accessible, then return false
-			if (cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x - (int)playerOffset.x + 1) >= minIndex &&
-				cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x - (int)playerOffset.x + 1) <= maxIndex)
-			{
-				return true;
-			}
-		}
-		// If the new position is between 2 rows, then check both rows as well
-		else if (i32vec2NumMicroSteps.y != 0)
-		{
-			// If the 2 grids are not accessible, then return false
-			if ((cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x - (int)playerOffset.x + 1) >= minIndex) &&
-				(cMap2D->GetMapInfo(i32vec2Index.y, i32vec2Index.x - (int)playerOffset.x + 1) <= maxIndex) ||
-
-				(cMap2D->GetMapInfo(i32vec2Index.y + 1, i32vec2Index.x - (int)playerOffset.x + 1) >= minIndex) && 
-				(cMap2D->GetMapInfo(i32vec2Index.y + 1, i32vec2Index.x - (int)playerOffset.x + 1) <= maxIndex))
-			{
-				return true;
-			}
-		}
-
+		cout << "CPlayer2D::Collision: Unknown direction." << endl;
+		return false;
 	}
-	else if (eDirection == UP)
-	{
-		// If the new position is at the top row, then return true
-		if (i32vec2Index.y >= cSettings->NUM_TILES_YAXIS - 1)
-		{
-			i32vec2NumMicroSteps.y = 0;
-			return false;
-		}
 
-		// If the new position is fully within a column, then check this column only
-		if (i32vec2NumMicroSteps.x == 0)
-		{
-			// If the grid is not accessible, then return false
-			if ((cMap2D->GetMapInfo(i32vec2Index.y + 1, i32vec2Index.x - (int)playerOffset.x) >= minIndex) && 
-				(cMap2D->GetMapInfo(i32vec2Index.y + 1, i32vec2Index.x - (int)playerOffset.x) <= maxIndex))
-			{
-				return true;
-			}
-		}
-		// If the new position is between 2 columns, then check both columns as well
-		else if (i32vec2NumMicroSteps.x != 0)
-		{
-			// If the 2 grids are not accessible, then return false
-			if ((cMap2D->GetMapInfo(i32vec2Index.y + 1, i32vec2Index.x - (int)playerOffset.x) >= minIndex) &&
-				(cMap2D->GetMapInfo(i32vec2Index.y + 1, i32vec2Index.x - (int)playerOffset.x) <= maxIndex) ||
-
-				(cMap2D->GetMapInfo(i32vec2Index.y + 1, i32vec2Index.x - (int)playerOffset.x + 1) >= minIndex) &&
-				(cMap2D->GetMapInfo(i32vec2Index.y + 1, i32vec2Index.x - (int)playerOffset.x + 1) <= maxIndex))
-			{
-				return true;
-			}
-		}
-	}
-	else if (eDirection == DOWN)
+	// At the right end or the top row there is no tile to collide with
+	if ((eDirection == RIGHT) && (i32vec2Index.x >= cSettings->NUM_TILES_XAXIS - 1))
 	{
-		// If the new position is fully within a column, then check this column only
-		if (i32vec2NumMicroSteps.x == 0)
-		{
-			// If the grid is not accessible, then return false
-			if ((cMap2D->GetMapInfo(i32vec2Index.y - 1, i32vec2Index.x - (int)playerOffset.x) >= minIndex) &&
-				(cMap2D->GetMapInfo(i32vec2Index.y - 1, i32vec2Index.x - (int)playerOffset.x) <= maxIndex))
-			{
-				return true;
-			}
-		}
-		// If the new position is between 2 columns, then check both columns as well
-		else if (i32vec2NumMicroSteps.x != 0)
-		{
-			// If the 2 grids are not accessible, then return false
-			if ((cMap2D->GetMapInfo(i32vec2Index.y - 1, i32vec2Index.x - (int)playerOffset.x) >= minIndex) &&
-				((cMap2D->GetMapInfo(i32vec2Index.y - 1, i32vec2Index.x - (int)playerOffset.x) <= maxIndex) ||
-
-				(cMap2D->GetMapInfo(i32vec2Index.y - 1, i32vec2Index.x - (int)playerOffset.x + 1) >= minIndex) && 
-				(cMap2D->GetMapInfo(i32vec2Index.y - 1, i32vec2Index.x - (int)playerOffset.x + 1) <= maxIndex)))
-			{									   
-				return true;
-			}
-		}
+		i32vec2NumMicroSteps.x = 0;
+		return false;
 	}
-	else
+	else if ((eDirection == UP) && (i32vec2Index.y >= cSettings->NUM_TILES_YAXIS - 1))
 	{
-		cout << "CPlayer2D::CheckPosition: Unknown direction." << endl;
+		i32vec2NumMicroSteps.y = 0;
+		return false;
 	}
-	return false;
+
+	// The tile of the player in the map, which is scrolled by playerOffset.
+	// The player has not moved yet, so the tiles below it are in the row below.
+	glm::i32vec2 i32vec2MapIndex(i32vec2Index.x - (int)playerOffset.x, i32vec2Index.y);
+	if (eDirection == DOWN)
+		i32vec2MapIndex.y--;
+
+	return cMap2D->IsEdgeBlocked(i32vec2MapIndex, i32vec2NumMicroSteps, CMap2D::DIRECTION_VECTORS[eDirection], uiTileFlags);
 }
 //
 ///**
@@ -1790,8 +1536,9 @@ void CPlayer2D::ResetPosition()
  @param dt Delta time
  @param x A double value for mouse position X
  @param y A double value for mouse position Y
+ @param iItemID An int for the inventory item ID of the current item
  */
-void CPlayer2D::UpdateMouse(MOUSE_CLICK mouseClick, double x, double y, string itemName)
+void CPlayer2D::UpdateMouse(MOUSE_CLICK mouseClick, double x, double y, const int iItemID)
 {
 	//check for player hit range
 	if (x > i32vec2Index.x + hitRange || x < i32vec2Index.x - hitRange)
@@ -1805,41 +1552,37 @@ void CPlayer2D::UpdateMouse(MOUSE_CLICK mouseClick, double x, double y, string i
 	else if (y >= cSettings->NUM_TILES_YAXIS || y < 0)
 		return;
 
-	int blockNumber = GetIntItemList(itemName);
+	int blockNumber = GetItemTile(iItemID);
 
 	switch (mouseClick)
 	{
 	case MOUSE_LEFT:
-		if (itemName == "")
+		if (iItemID == CInventoryManager::NO_ITEM)
 			return;
 
 		//do not allow for blocks to get replaced.
-		if (cMap2D->GetMapInfo(y, x, false) == 202)
-		{
-
-		}
-		else if (cMap2D->GetMapInfo(y, x, false) != 0)
+		if (cMap2D->GetMapInfo(y, x, false) != 0)
 			return;
 
 		//check if player has enough block quantity
-		if (CheckQuantity(itemName, isSurvival))
+		if (CheckQuantity(iItemID, isSurvival))
 		{
 			bool playSound = true;
 			switch (cMap2D->GetBlockType(blockNumber))
 			{
 			case CMap2D::BLOCK_TYPE::BLOCKS:
 				if (UpdateBlockItem(blockNumber, glm::vec2(x, y)))
-					ReduceQuantity(itemName, 1);
+					ReduceQuantity(iItemID, 1);
 				break;
 			case CMap2D::BLOCK_TYPE::TREES:
 				if (UpdateTreeItem(blockNumber, glm::vec2(x, y)))
-					ReduceQuantity(itemName, 1);
+					ReduceQuantity(iItemID, 1);
 				else
 					playSound = false;
 				break;
 			case CMap2D::BLOCK_TYPE::COLLECTABLES:
-				if (UpdateCollectableItem(itemName))
-					ReduceQuantity(itemName, 1);
+				if (UpdateCollectableItem(iItemID))
+					ReduceQuantity(iItemID, 1);
 				break;
 			}
 			if (playSound)
@@ -1852,7 +1595,7 @@ void CPlayer2D::UpdateMouse(MOUSE_CLICK mouseClick, double x, double y, string i
 		break;
 	case MOUSE_RIGHT:
 		//break blocks or trees
-		if (cMap2D->GetMapInfo(y, x, false) == 1 || cMap2D->GetMapInfo(y, x, false) == 0 || cMap2D->GetMapInfo(y, x, false) == 201 || cMap2D->GetMapInfo(y, x, false) == 202)
+		if (!cMap2D->HasTileFlags(y, x, TILE_BREAKABLE, false))
 			return;
 
 		//harvest item
@@ -1867,12 +1610,11 @@ void CPlayer2D::UpdateMouse(MOUSE_CLICK mouseClick, double x, double y, string i
 
 /**
  @brief Update collectable type blocks
- @param blockNumber An int for block number
- @param position A vec2 for position to be placed
+ @param iItemID An int for the inventory item ID
  */
-bool CPlayer2D::UpdateCollectableItem(string itemName)
+bool CPlayer2D::UpdateCollectableItem(const int iItemID)
 {
-	if (itemName == "Cheese")
+	if (iItemID == iCheeseItemID)
 	{
 		health += 50;
 		return true;
@@ -1917,26 +1659,29 @@ bool CPlayer2D::UpdateBlockItem(int blockNumber, glm::vec2 position)
  */
 void CPlayer2D::UpdateSeeds(double dt)
 {
-	cMap2D->UpdateSeed("GrassTree", dt, 100, 2);
-	cMap2D->UpdateSeed("DirtTree", dt, 102, 1);
+	for (unsigned int i = 0; i < NUM_TILE_DEFINITIONS; i++)
+	{
+		const TileProperties& sTile = TILE_DEFINITIONS[i].sProperties;
+		if (sTile.iGrowsInto != 0)
+			cMap2D->UpdateSeed(sTile.pName, dt, TILE_DEFINITIONS[i].iTile, sTile.fGrowTime);
+	}
 }
 
 /**
  @brief Checks if player collects chest
- @param minIndex minimum block number to start with
- @param maxIndex maximum block number to end with
+ @param uiTileFlags The TILE_FLAGs of the tiles to check for
  */
-void CPlayer2D::CollectChest(int minIndex, int maxIndex)
+void CPlayer2D::CollectChest(const unsigned int uiTileFlags)
 {
 	bool isBesideChest = false;
 	int offset = 0;
 
-	if (Collision(LEFT, minIndex, maxIndex))
+	if (Collision(LEFT, uiTileFlags))
 	{
 		isBesideChest = true;
 		offset = -1;
 	}
-	else if (Collision(RIGHT, minIndex, maxIndex))
+	else if (Collision(RIGHT, uiTileFlags))
 	{
 		isBesideChest = true;
 		offset = 1;
@@ -1952,17 +1697,17 @@ void CPlayer2D::CollectChest(int minIndex, int maxIndex)
 	}
 }
 
-void CPlayer2D::AttackEnemy(int minIndex, int maxIndex)
+void CPlayer2D::AttackEnemy(const unsigned int uiTileFlags)
 {
 	bool isBesideEenmy = false;
 	int offset = 0;
 
-	if (Collision(LEFT, minIndex, maxIndex))
+	if (Collision(LEFT, uiTileFlags))
 	{
 		isBesideEenmy = true;
 		offset = -1;
 	}
-	else if (Collision(RIGHT, minIndex, maxIndex))
+	else if (Collision(RIGHT, uiTileFlags))
 	{
 		isBesideEenmy = true;
 		offset = 1;
@@ -1975,7 +1720,7 @@ void CPlayer2D::AttackEnemy(int minIndex, int maxIndex)
 	if (cKeyboardController->IsKeyPressed(GLFW_KEY_E))
 	{
 		float damage = 25.f;
-		if (cInventoryManager->currentWeapon == cInventoryManager->GetItem("StoneSword"))
+		if (cInventoryManager->currentWeapon == cInventoryManager->GetItem(iStoneSwordItemID))
 			damage = 50.f;
 		cMap2D->KilledEnemy(glm::vec2(i32vec2Index.x + offset, i32vec2Index.y), damage);
 	}
@@ -1987,10 +1732,10 @@ void CPlayer2D::Shop()
 	{
 		if (cKeyboardController->IsKeyPressed(GLFW_KEY_E))
 		{
-			cInventoryItem = cInventoryManager->GetItem("Stone");
+			cInventoryItem = cInventoryManager->GetItem(iStoneItemID);
 			if (cInventoryItem->GetCount() >= 5)
 			{
-				cInventoryManager->currentWeapon = cInventoryManager->GetItem("StoneSword");
+				cInventoryManager->currentWeapon = cInventoryManager->GetItem(iStoneSwordItemID);
 				cInventoryManager->currentItem = cInventoryManager->currentWeapon;
 				cInventoryItem->Remove(5);
 			}
@@ -2000,12 +1745,12 @@ void CPlayer2D::Shop()
 	bool isBesideShop = false;
 	int offset = 0;
 
-	if (Collision(LEFT, 6, 6))
+	if (Collision(LEFT, TILE_SHOP))
 	{
 		isBesideShop = true;
 		offset = -1;
 	}
-	else if (Collision(RIGHT, 6, 6))
+	else if (Collision(RIGHT, TILE_SHOP))
 	{
 		isBesideShop = true;
 		offset = 1;
@@ -2023,23 +1768,23 @@ void CPlayer2D::Shop()
 	}
 }
 
-void CPlayer2D::CollideDamageBlock(double dt, int minIndex, int maxIndex)
+void CPlayer2D::CollideDamageBlock(double dt, const unsigned int uiTileFlags)
 {
 	bool isBesideDamageBlock = false;
 
-	if (Collision(LEFT, minIndex, maxIndex))
+	if (Collision(LEFT, uiTileFlags))
 	{
 		isBesideDamageBlock = true;
 	}
-	else if (Collision(RIGHT, minIndex, maxIndex))
+	else if (Collision(RIGHT, uiTileFlags))
 	{
 		isBesideDamageBlock = true;
 	}
-	if (Collision(LEFT, minIndex, maxIndex))
+	if (Collision(LEFT, uiTileFlags))
 	{
 		isBesideDamageBlock = true;
 	}
-	else if (Collision(RIGHT, minIndex, maxIndex))
+	else if (Collision(RIGHT, uiTileFlags))
 	{
 		isBesideDamageBlock = true;
 	}
@@ -2098,30 +1843,29 @@ void CPlayer2D::SetInventorySelector()
 
 /**
  @brief Update if player has collected item from chest
- @param minIndex minimum block number to start with
- @param maxIndex maximum block number to end with
+ @param uiTileFlags The TILE_FLAGs of the tiles to check for
  */
-void CPlayer2D::CollectItem(int minIndex, int maxIndex)
+void CPlayer2D::CollectItem(const unsigned int uiTileFlags)
 {
 	bool isCollected = false;
 	glm::i32vec2 itemPosition;
 
-	if (Collision(LEFT, minIndex, maxIndex))
+	if (Collision(LEFT, uiTileFlags))
 	{
 		isCollected = true;
 		itemPosition = i32vec2Index;
 	}
-	else if (Collision(RIGHT, minIndex, maxIndex))
+	else if (Collision(RIGHT, uiTileFlags))
 	{
 		isCollected = true;
 		itemPosition = i32vec2Index;
 	}
-	if (Collision(UP, minIndex, maxIndex))
+	if (Collision(UP, uiTileFlags))
 	{
 		isCollected = true;
 		itemPosition = i32vec2Index;
 	}
-	else if (Collision(DOWN, minIndex, maxIndex))
+	else if (Collision(DOWN, uiTileFlags))
 	{
 		isCollected = true;
 		itemPosition = i32vec2Index;
@@ -2132,61 +1876,46 @@ void CPlayer2D::CollectItem(int minIndex, int maxIndex)
 
 	int itemNumber = cMap2D->GetMapInfo(itemPosition.y, itemPosition.x);
 
-	string itemName = GetStringItemList(itemNumber);
+	const int iItemID = GetTileItemID(itemNumber);
 
-	if (!cInventoryManager->Check(itemName))
+	if (!cInventoryManager->Check(iItemID))
 		return;
 
 	cMap2D->SetSaveMapInfo(itemPosition.y, itemPosition.x, 0, true);
-	cInventoryItem = cInventoryManager->GetItem(itemName);
+	cInventoryItem = cInventoryManager->GetItem(iItemID);
 	cInventoryItem->Add(1);
 	CSoundController::GetInstance()->PlaySoundByName("pickUp");
 }
 
 /**
- @brief Get string pair from item list vector
+ @brief Get the inventory item ID of a block number, which was looked up from the tile table at Init
  @param blockNumber An int for block number
  */
-string CPlayer2D::GetStringItemList(int blockNumber)
+int CPlayer2D::GetTileItemID(int blockNumber)
 {
-	string itemName = "";
-	for (int i = 0; i < itemList.size(); i++)
-	{
-		if (itemList[i].second == blockNumber)
-			itemName = itemList[i].first;
-	}
-	return itemName;
+	if ((blockNumber < 0) || (blockNumber >= (int)vTileItemIDs.size()))
+		return CInventoryManager::NO_ITEM;
+	return vTileItemIDs[blockNumber];
 }
 
 /**
- @brief Get int pair from item list vector
- @param itemName A string for item name
+ @brief Get the block number of an inventory item ID, or 0 if the item is not a tile
+ @param iItemID An int for the inventory item ID
  */
-int CPlayer2D::GetIntItemList(string itemName)
+int CPlayer2D::GetItemTile(int iItemID)
 {
-	int blockNumber = 0;
-	for (int i = 0; i < itemList.size(); i++)
-	{
-		if (itemList[i].first == itemName)
-			blockNumber = itemList[i].second;
-	}
-	return blockNumber;
+	if ((iItemID < 0) || (iItemID >= (int)vItemTiles.size()))
+		return 0;
+	return vItemTiles[iItemID];
 }
 
+/**
+ @brief Mark the empty tiles which the player can place the current item on.
+		The markers are kept by CMap2D apart from the tiles, so only the tiles in range are visited.
+ */
 void CPlayer2D::RenderBlockRangeTiles()
 {
-	bool foundAll = false;
-	while (!foundAll)
-	{
-		unsigned int col = -1;
-		unsigned int row = -1;
-		if (cMap2D->FindValue(202, row, col))
-		{
-			cMap2D->SetMapInfo(row, col, 0);
-		}
-		else
-			foundAll = true;
-	}
+	cMap2D->ClearTileMarkers();
 
 	if (cInventoryManager->currentItem == cInventoryManager->currentWeapon)
 		return;
@@ -2195,9 +1924,10 @@ void CPlayer2D::RenderBlockRangeTiles()
 	{
 		for (int j = cSettings->NUM_TILES_YAXIS - i32vec2Index.y - hitRange; j <= cSettings->NUM_TILES_YAXIS - i32vec2Index.y + hitRange; j++)
 		{
-			if (cMap2D->GetMapInfo(j, i, false) == 0)
+			if ((j >= 0) && (j < (int)cSettings->NUM_TILES_YAXIS) && (i >= 0) && (i < (int)cSettings->NUM_TILES_XAXIS) &&
+				(cMap2D->GetMapInfo(j, i, false) == 0))
 			{
-				cMap2D->SetMapInfo(j, i, 202, false);
+				cMap2D->AddTileMarker(j, i, 202, false);
 			}
 		}
 	}
@@ -50,9 +50,9 @@ class CMap2D;
 class CPlayer2D : public CSingletonTemplate<CPlayer2D>, public CEntity2D
 {
 	friend CSingletonTemplate<CPlayer2D>;
+	// Let the benchmarks call the collision checks directly
+	friend class CScene2DBenchmarks;
 public:
-	
-	std::vector<std::pair<std::string, int>> itemList;
 
 	enum MOUSE_CLICK
 	{
@@ -79,13 +79,13 @@ public:
 	// Let player interact with the map
 	void Harvest(int x, int y);
 
-	bool CheckQuantity(string itemName, bool survival);
+	bool CheckQuantity(const int iItemID, bool survival);
 
-	void ReduceQuantity(string itemName, int quantity);
+	void ReduceQuantity(const int iItemID, int quantity);
 
 	void ResetPosition();
 
-	void UpdateMouse(MOUSE_CLICK mouseClick, double x, double y, string itemName);		// Update Placing/Harvesting Blocks using mouse position
+	void UpdateMouse(MOUSE_CLICK mouseClick, double x, double y, const int iItemID);		// Update Placing/Harvesting Blocks using mouse position
 
 	void UpdateSeeds(double dt);
 
@@ -129,6 +129,15 @@ protected:
 	//Inventoy Item
 	CInventoryItem* cInventoryItem;
 
+	//inventory item ID of each tile number, and tile number of each inventory item ID
+	std::vector<int> vTileItemIDs;
+	std::vector<int> vItemTiles;
+
+	//inventory item IDs of the items which the player uses
+	int iStoneItemID;
+	int iStoneSwordItemID;
+	int iCheeseItemID;
+
 	CEntityManager* cEntityManager;
 
 	CEntityFactory* cEntityFactory;
@@ -149,7 +158,7 @@ protected:
 	void Constraint(DIRECTION eDirection = LEFT);
 
 	// Check if a position is possible to move into
-	bool CheckPosition(DIRECTION eDirection, int minIndex, int maxIndex);
+	bool CheckPosition(DIRECTION eDirection, const unsigned int uiTileFlags);
 
 	//Update jump
 	void UpdateJumpFall(const double dElapsedTime = 0.0166666666666667);
@@ -157,39 +166,35 @@ protected:
 	bool IsMidAir();
 
 	//checks for collision
-	bool Collision(DIRECTION eDirection, int minIndex, int maxIndex);
+	bool Collision(DIRECTION eDirection, const unsigned int uiTileFlags);
 	//bool CollisionEnd(DIRECTION eDirection, int minIndex, int maxIndex);
 
 	//checks if chest have been picked up
-	void CollectChest(int minIndex, int maxIndex);
+	void CollectChest(const unsigned int uiTileFlags);
 
-	void AttackEnemy(int minIndex, int maxIndex);
+	void AttackEnemy(const unsigned int uiTileFlags);
 
 	void Shop();
 
 	//checks if player hits damage blocks (lava, etc)
-	void CollideDamageBlock(double dt, int minIndex, int maxIndex);
+	void CollideDamageBlock(double dt, const unsigned int uiTileFlags);
 
 	//change invetory selector on ui
 	void SetInventorySelector();
 
 	//checks if item has been picked up
-	void CollectItem(int minIndex, int maxIndex);
+	void CollectItem(const unsigned int uiTileFlags);
 
-	//get string item list by block number
-	string GetStringItemList(int blockNumber);
+	//get inventory item ID by block number
+	int GetTileItemID(int blockNumber);
 
-	//get int item list by item name
-	int GetIntItemList(string itemName);
+	//get block number by inventory item ID
+	int GetItemTile(int iItemID);
 
 	void RenderBlockRangeTiles();
 
-	std::map<std::string, std::string> MapOfBlocksToSeeds;
-
-	std::map<std::string, std::string> MapOfTreesToBlocks;
-
 	//update different block items
-	bool UpdateCollectableItem(string itemName);
+	bool UpdateCollectableItem(const int iItemID);
 	bool UpdateTreeItem(int blockNumber, glm::vec2 position);
 	bool UpdateBlockItem(int blockNumber, glm::vec2 position);
 
@@ -5,12 +5,19 @@
 #include <string>
 #include <algorithm>
 using namespace std;
-extern bool spawnEnemy;
 
 // Include Shader Manager
 #include "RenderControl\ShaderManager.h"
+// Include Render Device
+#include "RenderControl\RenderDevice.h"
 
 #include "System\filesystem.h"
+// Include AssetManager
+#include "System\AssetManager.h"
+// Include CProfiler
+#include "TimeControl\Profiler.h"
+// Include CPhysicsWorld2D
+#include "PhysicsWorld2D.h"
 
 
 bool is_file_exist(string fileName)
@@ -31,6 +38,7 @@ CScene2D::CScene2D(void)
 	, cPlayer2D(NULL)
 	, cSoundController(NULL)
 	, cEntityManager(NULL)
+	, cRenderQueue(NULL)
 {
 }
 
@@ -78,6 +86,7 @@ CScene2D::~CScene2D(void)
 	cKeyboardController = NULL;
 	cMouseController = NULL;
 	cEntityManager = NULL;
+	cRenderQueue = NULL;
 }
 
 /**
@@ -85,10 +94,16 @@ CScene2D::~CScene2D(void)
 */ 
 bool CScene2D::Init(void)
 {
+	// Without a window, there are no shaders or GUI, and only the simulation is run
+	const bool bHeadless = CSettings::GetInstance()->bHeadless;
+
 	// Include Shader Manager
 	//CShaderManager::GetInstance()->Add("2DShader", "Shader//Scene2D.vs", "Shader//Scene2D.fs");
-	CShaderManager::GetInstance()->Use("2DShader");
-	CShaderManager::GetInstance()->activeShader->setInt("texture1", 0);
+	if (!bHeadless)
+	{
+		CShaderManager::GetInstance()->Use("2DShader");
+		CShaderManager::GetInstance()->activeShader->setInt("texture1", 0);
+	}
 
 	// Create and initialise the Map 2D
 	cMap2D = CMap2D::GetInstance();
@@ -98,9 +113,16 @@ bool CScene2D::Init(void)
 	cEntityManager = CEntityManager::GetInstance();
 	cEntityManager->Init();
 
+	// Create and initialise the render queue
+	cRenderQueue = CRenderQueue::GetInstance();
+	cRenderQueue->Init();
+
 	// Load Scene2DColor into ShaderManager
-	CShaderManager::GetInstance()->Use("2DColorShader");
-	CShaderManager::GetInstance()->activeShader->setInt("texture1", 0);
+	if (!bHeadless)
+	{
+		CShaderManager::GetInstance()->Use("2DColorShader");
+		CShaderManager::GetInstance()->activeShader->setInt("texture1", 0);
+	}
 	// Create and initialise the CPlayer2D
 	cPlayer2D = CPlayer2D::GetInstance();
 	// Pass shader to cPlayer2D
@@ -108,7 +130,8 @@ bool CScene2D::Init(void)
 
 
 	// Setup the shaders
-	CShaderManager::GetInstance()->Use("textShader");
+	if (!bHeadless)
+		CShaderManager::GetInstance()->Use("textShader");
 
 	// Store the keyboard and mouse controller singleton instance here
 	cKeyboardController = CKeyboardController::GetInstance();
@@ -116,24 +139,28 @@ bool CScene2D::Init(void)
 	cInventoryManager = CInventoryManager::GetInstance();
 
 	// Setup cGUI
-	cGUI = CGUI_Scene2D::GetInstance();
-	cGUI->Init();
+	if (!bHeadless)
+	{
+		cGUI = CGUI_Scene2D::GetInstance();
+		cGUI->Init();
 
-	cGUI2 = CGUI::GetInstance();
-	cGUI2->Init();
+		cGUI2 = CGUI::GetInstance();
+		cGUI2->Init();
+	}
 
 	cSoundController = CSoundController::GetInstance();
 	cSoundController->Init();
-	cSoundController->LoadSound(FileSystem::getPath("Sounds\\jump.wav"), "jump", true);
-	cSoundController->LoadSound(FileSystem::getPath("Sounds\\click.wav"), "uiClick", true);
-	cSoundController->LoadSound(FileSystem::getPath("Sounds\\hit.wav"), "playerAttack", true);
-	cSoundController->LoadSound(FileSystem::getPath("Sounds\\hurt2.wav"), "enemyAttack", true);
-	cSoundController->LoadSound(FileSystem::getPath("Sounds\\placeBlock.wav"), "place", true);
-	cSoundController->LoadSound(FileSystem::getPath("Sounds\\placeBlockFail.wav"), "placeFail", true);
-	cSoundController->LoadSound(FileSystem::getPath("Sounds\\breakBlock.wav"), "break", true);
-	cSoundController->LoadSound(FileSystem::getPath("Sounds\\pickUp.wav"), "pickUp", true);
-	cSoundController->LoadSound(FileSystem::getPath("Sounds\\openChest.wav"), "openChest", true);
-	cSoundController->LoadSound(FileSystem::getPath("Sounds\\spawnMinion.wav"), "spawnMinion", true);
+	// Read the sounds on the worker threads of CAssetLoader. They are loaded while CMap2D::Init waits for its textures.
+	cSoundController->PreloadSound("Sounds\\jump.wav", "jump");
+	cSoundController->PreloadSound("Sounds\\click.wav", "uiClick");
+	cSoundController->PreloadSound("Sounds\\hit.wav", "playerAttack");
+	cSoundController->PreloadSound("Sounds\\hurt2.wav", "enemyAttack");
+	cSoundController->PreloadSound("Sounds\\placeBlock.wav", "place");
+	cSoundController->PreloadSound("Sounds\\placeBlockFail.wav", "placeFail");
+	cSoundController->PreloadSound("Sounds\\breakBlock.wav", "break");
+	cSoundController->PreloadSound("Sounds\\pickUp.wav", "pickUp");
+	cSoundController->PreloadSound("Sounds\\openChest.wav", "openChest");
+	cSoundController->PreloadSound("Sounds\\spawnMinion.wav", "spawnMinion");
 
 	//init map instance
 	if (cMap2D->Init(1, 24, 100) == false)
@@ -157,21 +184,12 @@ bool CScene2D::Init(void)
 	}
 
 	//Create and Init CEnemy2D
-	enemyVector.clear();
-	while (true)
-	{
-		CEnemy2D* cEnemy2D = new CEnemy2D();
-		//Pass shader to enemy
-		cEnemy2D->SetShader("2DColorShader");
-		//Init instance
-		if (cEnemy2D->Init())
-		{
-			cEnemy2D->SetPlayer2D(cPlayer2D);
-			enemyVector.push_back(cEnemy2D);
-		}
-		else
-			break;
-	}
+	CreateEnemies();
+
+	// Display the texture memory and decode count after loading
+	CAssetManager::GetInstance()->PrintSelf();
+	// Display the audio memory after loading
+	cSoundController->PrintSelf();
 
 	return true;
 }
@@ -181,36 +199,14 @@ bool CScene2D::Init(void)
 */
 void CScene2D::Update(const double dElapsedTime)
 {
+	PROFILE_ZONE("CScene2D::Update");
+
 	//update gui
 	cGUI->Update(dElapsedTime);
 	cGUI->playerHealth = cPlayer2D->health;
 	cGUI->playerMaxHealth = cPlayer2D->maxHealth;
 	cGUI2->Update(dElapsedTime);
 
-	//spawn new enemy from boss
-	if (spawnEnemy)
-	{
-		for (CEnemy2D* bossEnemy : enemyVector)
-		{
-			if (bossEnemy->enemyType == CEnemy2D::BOSS_ENEMY)
-			{
-				SpawnEnemy(bossEnemy->Geti32vec2Index(), 301);
-				break;
-			}
-		}
-		spawnEnemy = false;
-	}
-
-	//update enemy before map
-	for (CEntity2D* enemy : enemyVector)
-	{
-		enemy->Update(dElapsedTime);
-	}
-
-	//update player
-	if (!enableTyping)
-		cPlayer2D->Update(dElapsedTime);
-
 	if (cKeyboardController->IsKeyPressed(GLFW_KEY_ENTER))
 	{
 		if (cGUI2->worldInput.length() == 0)
@@ -238,92 +234,159 @@ void CScene2D::Update(const double dElapsedTime)
 		else if (cKeyboardController->IsKeyReleased(GLFW_KEY_ENTER) && cGUI2->worldInput.length() > 0)
 		{
 			enableTyping = false;
-			try 
+			if (!LoadWorld(cGUI2->worldInput))
+				return;
+			cGUI2->worldInput.clear();
+		}
+	}
+}
+
+/**
+ @brief Load a world from its file, or generate it if it does not exist, and reset the player and enemies in it
+ @param worldName The name of the world
+ @return A bool value. false if the world exists but could not be loaded, else true
+ */
+bool CScene2D::LoadWorld(const string& worldName)
+{
+	try 
+	{
+		bool worldExists = false;
+		fstream inFile;
+		inFile.open("Maps/WorldsList.txt");
+		string line;
+		string listedWorldName;
+
+		if (inFile.fail()) //if file fails to load
+		{
+			cout << "Error loading WorldsList file" << endl;
+		}
+
+		while (getline(inFile, line)) //get each line of the file and add the existing world names to vector
+		{
+			stringstream ss(line);
+			getline(ss, listedWorldName);
+			cMap2D->worldNameList.push_back(listedWorldName);
+		}
+
+		for (int i = 0; i < cMap2D->worldNameList.size(); i++) //cycle through vector to see if user inputted world name has already existed before
+		{
+			if (cMap2D->worldNameList.at(i) == worldName) //if world already exist, turn worldExist bool to true
 			{
-				bool worldExists = false;
-				fstream inFile;
-				inFile.open("Maps/WorldsList.txt");
-				string line;
-				string worldName;
-
-				if (inFile.fail()) //if file fails to load
-				{
-					cout << "Error loading WorldsList file" << endl;
-				}
-
-				while (getline(inFile, line)) //get each line of the file and add the existing world names to vector
-				{
-					stringstream ss(line);
-					getline(ss, worldName);
-					cMap2D->worldNameList.push_back(worldName);
-				}
-
-				for (int i = 0; i < cMap2D->worldNameList.size(); i++) //cycle through vector to see if user inputted world name has already existed before
-				{
-					if (cMap2D->worldNameList.at(i) == cGUI2->worldInput) //if world already exist, turn worldExist bool to true
-					{
-						worldExists = true;
-					}
-				}
-
-				if (worldExists) //if world already exist, load that world
-				{
-					cMap2D->activeWorld = cGUI2->worldInput; //set active world to current loaded world
-					if (!cMap2D->LoadMap("Maps/" + cGUI2->worldInput + ".csv")) //check if world is able to load
-					{
-						std::cout << "Unable to load existing map: " << cGUI2->worldInput << std::endl;
-						return;
-					}
-				}
-				else
-				{
-					throw runtime_error("world name " + cGUI2->worldInput + " does not exists, creating a new world for it.");
-				}
+				worldExists = true;
 			}
-			catch (runtime_error e) //else generate a new world with user inputted world name
+		}
+
+		if (worldExists) //if world already exist, load that world
+		{
+			cMap2D->activeWorld = worldName; //set active world to current loaded world
+			if (!cMap2D->LoadMap("Maps/" + worldName + ".csv")) //check if world is able to load
 			{
-				//update saved map
-				if (cMap2D->GenerateNewMap(cGUI2->worldInput))
-				{
-					ofstream outFile;
-					outFile.open("Maps/WorldsList.txt", ios::app);
-					outFile << cGUI2->worldInput << endl;
-					outFile.close();
-					cMap2D->activeWorld = cGUI2->worldInput;
-					cMap2D->SetTotalWorldsGenerated(cMap2D->GetTotalWorldsGenerated() + 1);
-				}
-				else
-				{
-					cout << "failed to create a new map for " + cGUI2->worldInput << endl;
-				}
-				//cMap2D->SaveMap("Maps/" + cGUI->worldInput + ".csv");
+				std::cout << "Unable to load existing map: " << worldName << std::endl;
+				return false;
 			}
+		}
+		else
+		{
+			throw runtime_error("world name " + worldName + " does not exists, creating a new world for it.");
+		}
+	}
+	catch (runtime_error e) //else generate a new world with user inputted world name
+	{
+		//update saved map
+		if (cMap2D->GenerateNewMap(worldName))
+		{
+			ofstream outFile;
+			outFile.open("Maps/WorldsList.txt", ios::app);
+			outFile << worldName << endl;
+			outFile.close();
+			cMap2D->activeWorld = worldName;
+			cMap2D->SetTotalWorldsGenerated(cMap2D->GetTotalWorldsGenerated() + 1);
+		}
+		else
+		{
+			cout << "failed to create a new map for " + worldName << endl;
+		}
+		//cMap2D->SaveMap("Maps/" + cGUI->worldInput + ".csv");
+	}
 
-			cGUI2->worldInput.clear();
-			cPlayer2D->ResetPosition();
-			cMouseController->mouseOffset = glm::vec2(0.0f);
+	cPlayer2D->ResetPosition();
+	cMouseController->mouseOffset = glm::vec2(0.0f);
 
-			//Create and Init CEnemy2D
-			enemyVector.clear();
-			while (true)
-			{
-				CEnemy2D* cEnemy2D = new CEnemy2D();
-				//Pass shader to enemy
-				cEnemy2D->SetShader("2DColorShader");
-				//Init instance
-				if (cEnemy2D->Init())
-				{
-					cEnemy2D->SetPlayer2D(cPlayer2D);
-					enemyVector.push_back(cEnemy2D);
-				}
-				else
-					break;
-			}
+	//Create and Init CEnemy2D, deleting the enemies of the previous world
+	CreateEnemies();
+
+	// Display the texture memory and decode count after switching worlds
+	CAssetManager::GetInstance()->PrintSelf();
+
+	return true;
+}
+
+/**
+ @brief Create the enemies which are placed in the current map, deleting the enemies of the previous map
+ */
+void CScene2D::CreateEnemies(void)
+{
+	for (CEntity2D* enemy : enemyVector)
+		delete enemy;
+	enemyVector.clear();
+	vPendingSpawnPositions.clear();
+	while (true)
+	{
+		CEnemy2D* cEnemy2D = new CEnemy2D();
+		//Pass shader to enemy
+		cEnemy2D->SetShader("2DColorShader");
+		//Init instance
+		if (cEnemy2D->Init())
+		{
+			cEnemy2D->SetPlayer2D(cPlayer2D);
+			enemyVector.push_back(cEnemy2D);
 		}
+		else
+			break;
+	}
+}
+
+/**
+@brief FixedUpdate Advance the player, enemies, seeds and entities of this instance by one fixed time step
+@param dTimeStep The fixed time step in seconds
+*/
+void CScene2D::FixedUpdate(const double dTimeStep)
+{
+	PROFILE_ZONE("CScene2D::FixedUpdate");
+
+	// Keep the positions before this step, so that the rendering can interpolate from them
+	cPlayer2D->SavePreviousUVCoordinate();
+	for (CEntity2D* enemy : enemyVector)
+	{
+		enemy->SavePreviousUVCoordinate();
 	}
 
+	//spawn new enemy from boss, which asked for it in the last step
+	for (const glm::i32vec2& spawnPosition : vPendingSpawnPositions)
+	{
+		SpawnEnemy(spawnPosition, 301);
+	}
+	vPendingSpawnPositions.clear();
+
+	//integrate the jumps and falls of the player and the enemies together, before they read them in their updates
+	{
+		PROFILE_ZONE("Physics");
+		CPhysicsWorld2D::GetInstance()->Step((float)dTimeStep);
+	}
+
+	//update enemy before map, in parallel. The map and the player are only read while the enemies update,
+	//and what the enemies did to them is applied afterwards
+	{
+		PROFILE_ZONE("Enemies");
+		CEnemy2D::UpdateAll(enemyVector, dTimeStep, vPendingSpawnPositions);
+	}
+
+	//update player
+	if (!enableTyping)
+		cPlayer2D->Update(dTimeStep);
+
 	////procedural generation
-	//proceduralGenerationCooldown -= dElapsedTime;
+	//proceduralGenerationCooldown -= dTimeStep;
 
 	//if (cPlayer2D->i32vec2Index.x + 35 >= CSettings::GetInstance()->NUM_TILES_XAXIS)
 	//{
@@ -336,10 +399,10 @@ void CScene2D::Update(const double dElapsedTime)
 	//}
 
 	//update CMap2D
-	//cMap2D->Update(dElapsedTime);
+	//cMap2D->Update(dTimeStep);
 	
 	//Update seeds timer
-	cPlayer2D->UpdateSeeds(dElapsedTime);
+	cPlayer2D->UpdateSeeds(dTimeStep);
 
 	int multiplier = 0;
 	if (cPlayer2D->isCenter)
@@ -353,17 +416,17 @@ void CScene2D::Update(const double dElapsedTime)
 	if (cMouseController->IsButtonPressed(GLFW_MOUSE_BUTTON_1))
 	{
 		if (cInventoryManager->currentItem != cInventoryManager->currentWeapon)
-			cPlayer2D->UpdateMouse(cPlayer2D->MOUSE_LEFT, cMouseController->GetMousePositionXOnScreen(), cMouseController->GetMousePositionYOnScreen(), cInventoryManager->currentItem->sName);
+			cPlayer2D->UpdateMouse(cPlayer2D->MOUSE_LEFT, cMouseController->GetMousePositionXOnScreen(), cMouseController->GetMousePositionYOnScreen(), cInventoryManager->currentItem->iItemID);
 	}
 
 	if (cMouseController->IsButtonPressed(GLFW_MOUSE_BUTTON_2))
 	{
 		if (cInventoryManager->currentItem != cInventoryManager->currentWeapon)
-			cPlayer2D->UpdateMouse(cPlayer2D->MOUSE_RIGHT, cMouseController->GetMousePositionXOnScreen(), cMouseController->GetMousePositionYOnScreen(), cInventoryManager->currentItem->sName);
+			cPlayer2D->UpdateMouse(cPlayer2D->MOUSE_RIGHT, cMouseController->GetMousePositionXOnScreen(), cMouseController->GetMousePositionYOnScreen(), cInventoryManager->currentItem->iItemID);
 	}
 
 	//call entity manager update
-	cEntityManager->Update(dElapsedTime);
+	cEntityManager->Update(dTimeStep);
 }
 
 /**
@@ -371,15 +434,8 @@ void CScene2D::Update(const double dElapsedTime)
  */
 void CScene2D::PreRender(void)
 {
-	// Reset the OpenGL rendering environment
-	glLoadIdentity();
-
 	// Clear the screen and buffer
-	glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
-	glClear(GL_COLOR_BUFFER_BIT);
-
-	// Enable 2D texture rendering
-	glEnable(GL_TEXTURE_2D);
+	CRenderDevice::GetActive()->Clear(0.2f, 0.3f, 0.3f, 1.0f);
 
 	//call cGUI preRender
 	cGUI->PreRender();
@@ -398,15 +454,32 @@ void CScene2D::PreRender(void)
 
 /**
  @brief Render Render this instance
+ @param dAlpha The fraction of a fixed time step from the last fixed update to this frame
  */
-void CScene2D::Render(void)
+void CScene2D::Render(const double dAlpha)
 {
-	//call map2d preRender
-	cMap2D->PreRender();
-	//call map2d render
+	PROFILE_ZONE("CScene2D::Render");
+
+	// Submit the map tiles to the render queue
 	cMap2D->Render();
-	//call map2d postRender
-	cMap2D->PostRender();
+
+	// Submit the enemies to the render queue
+	for (CEntity2D* enemy : enemyVector)
+	{
+		enemy->SetRenderAlpha((float)dAlpha);
+		enemy->Render();
+	}
+
+	// Submit the player to the render queue
+	cPlayer2D->SetRenderAlpha((float)dAlpha);
+	cPlayer2D->Render();
+
+	// The layers of the render queue are flushed in the order which the scene is drawn in:
+	// the map, the GUIs, the enemies, the entities of the entity manager, and the player over them
+	{
+		PROFILE_ZONE("CRenderQueue::Flush");
+		cRenderQueue->Flush(CRenderQueue::LAYER_TILE_MARKERS);
+	}
 
 	// Call the cGUI's PreRender()
 	cGUI->PreRender();
@@ -422,25 +495,18 @@ void CScene2D::Render(void)
 	// Call the cGUI's PostRender()
 	cGUI2->PostRender();
 
-	for (CEntity2D* enemy : enemyVector)
 	{
-		// Call the enemy PreRender()
-		enemy->PreRender();
-		// Call the enemy Render()
-		enemy->Render();
-		// Call the enemy PostRender()
-		enemy->PostRender();
+		PROFILE_ZONE("CRenderQueue::Flush");
+		cRenderQueue->Flush(CRenderQueue::LAYER_ENTITIES);
 	}
 
 	//call entity manager render
 	cEntityManager->Render();
 
-	// Call the cPlayer2D's PreRender()
-	cPlayer2D->PreRender();
-	// Call the cPlayer2D's Render()
-	cPlayer2D->Render();
-	// Call the cPlayer2D's PostRender()
-	cPlayer2D->PostRender();
+	{
+		PROFILE_ZONE("CRenderQueue::Flush");
+		cRenderQueue->Flush();
+	}
 }
 
 /**
@@ -450,6 +516,22 @@ void CScene2D::PostRender(void)
 {
 }
 
+/**
+ @brief Get the player
+ */
+CPlayer2D* CScene2D::GetPlayer2D(void) const
+{
+	return cPlayer2D;
+}
+
+/**
+ @brief Get the enemies
+ */
+const vector<CEnemy2D*>& CScene2D::GetEnemies(void) const
+{
+	return enemyVector;
+}
+
 /**
  @brief Spawn new enemy based on parameter vec2
  */
@@ -21,6 +21,8 @@
 
 // Include Shader Manager
 #include "RenderControl\ShaderManager.h"
+// Include Render Queue
+#include "RenderControl\RenderQueue.h"
 
 // Include Keyboard controller
 #include "Inputs\KeyboardController.h"
@@ -58,22 +60,35 @@ public:
 	// Update
 	void Update(const double dElapsedTime);
 
+	// Advance the simulation by one fixed time step
+	void FixedUpdate(const double dTimeStep);
+
 	// PreRender
 	void PreRender(void);
 
 	// Render
-	void Render(void);
+	void Render(const double dAlpha);
 
 	// PostRender
 	void PostRender(void);
 
 	bool SpawnEnemy(glm::i32vec2, int enemyMapNumber);
+
+	// Load a world from its file, or generate it if it does not exist, and reset the player and enemies in it
+	bool LoadWorld(const string& worldName);
+
+	// Get the player and the enemies, e.g. to check the state of a headless run
+	CPlayer2D* GetPlayer2D(void) const;
+	const vector<CEnemy2D*>& GetEnemies(void) const;
 protected:
 	// Constructor
 	CScene2D(void);
 	// Destructor
 	virtual ~CScene2D(void);
 
+	// Create the enemies which are placed in the current map, deleting the enemies of the previous map
+	void CreateEnemies(void);
+
 	// Keyboard Controller singleton instance
 	CKeyboardController* cKeyboardController;
 
@@ -97,7 +112,12 @@ protected:
 
 	CEntityManager* cEntityManager;
 
+	// The render queue which sorts the map, enemies and player draws
+	CRenderQueue* cRenderQueue;
+
 	vector<CEnemy2D*> enemyVector;
+	// The positions where the bosses asked for minions in the last fixed time step, which are spawned at the start of the next one
+	vector<glm::i32vec2> vPendingSpawnPositions;
 
 	CInventoryManager* cInventoryManager;
 
@@ -0,0 +1,276 @@
+/**
+ CTerrainGenerator
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#include "TerrainGenerator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+using namespace std;
+
+// The row which the ground is around, and the most rows which it goes up or down from it
+static const float SURFACE_ROW = 21.0f;
+static const float SURFACE_AMPLITUDE = 3.0f;
+// The highest and the lowest rows of the ground, counted from the top
+static const int SURFACE_ROW_MIN = 18;
+static const int SURFACE_ROW_MAX = 24;
+
+// The chance of each item on a column is 1 in (rate + 1)
+static const int TREE_SPAWN_RATE = 8;
+static const int CHEST_SPAWN_RATE = 20;
+static const int ENEMY_SPAWN_RATE = 20;
+static const int LAVA_SPAWN_RATE = 10;
+// The column which gets a chest if there is none from the first column up to it
+static const unsigned int FORCED_CHEST_COL = 99;
+// The salts of the random numbers of the columns, so that the chests and the enemies have their own numbers
+static const unsigned long long CHEST_SALT = 0x200000000ULL;
+static const unsigned long long ENEMY_SALT = 0x200000001ULL;
+
+/**
+ @brief Constructor
+ */
+CTerrainGenerator::CTerrainGenerator(void)
+	: uiSeed(0)
+	, uiNumRows(24)
+	, uiFirstCol(0)
+	, iEnemyTile(302)
+	, bSingleEnemy(false)
+	, bAnchored(false)
+	, uiAnchorCol(0)
+	, uiAnchorRow(0)
+{
+}
+
+/**
+ @brief Destructor
+ */
+CTerrainGenerator::~CTerrainGenerator(void)
+{
+}
+
+/**
+ @brief Init Initialise this instance
+ @param uiSeed The world seed
+ @param uiNumRows The number of rows of the map
+ @param uiFirstCol The first column which is generated, from which the chests and enemies are counted
+ @param iEnemyTile The tile which is placed for an enemy
+ @param bSingleEnemy If true, only the first enemy from uiFirstCol is placed, else an enemy is placed wherever it is drawn
+ */
+void CTerrainGenerator::Init(const unsigned int uiSeed, const unsigned int uiNumRows, const unsigned int uiFirstCol,
+							 const int iEnemyTile, const bool bSingleEnemy)
+{
+	this->uiSeed = uiSeed;
+	this->uiNumRows = uiNumRows;
+	this->uiFirstCol = uiFirstCol;
+	this->iEnemyTile = iEnemyTile;
+	this->bSingleEnemy = bSingleEnemy;
+	bAnchored = false;
+}
+
+/**
+ @brief Make the ground meet the grass of a column which is not generated, e.g. the last column of the map
+		before the generated columns. The ground of each column is kept within a row of the anchor for every
+		column between them, so the ground goes up or down by at most one row a column from the anchor.
+ @param uiCol The column of the anchor
+ @param uiSurfaceRow The row of the grass of the anchor, counted from the top
+ */
+void CTerrainGenerator::SetAnchor(const unsigned int uiCol, const unsigned int uiSurfaceRow)
+{
+	bAnchored = true;
+	uiAnchorCol = uiCol;
+	uiAnchorRow = uiSurfaceRow;
+}
+
+/**
+ @brief Get the row of the grass of a column, counted from the top. The noise changes by less than
+		a row from one column to the next, so the ground goes up or down by at most one row a column.
+		If there is an anchor, the row is kept within a row of the anchor for every column between them.
+		There is always a row above the grass for the items, and a row of bedrock below it.
+ @param uiCol The column
+ */
+unsigned int CTerrainGenerator::GetSurfaceRow(const unsigned int uiCol) const
+{
+	const float fNoise = (GetNoise(uiCol, 32, 0) + 0.5f * GetNoise(uiCol, 8, 1)) / 1.5f;
+	int iRow = (int)floor(SURFACE_ROW + SURFACE_AMPLITUDE * fNoise + 0.5f);
+	iRow = min(max(iRow, SURFACE_ROW_MIN), SURFACE_ROW_MAX);
+	if (bAnchored)
+	{
+		const int iDistance = abs((int)uiCol - (int)uiAnchorCol);
+		iRow = min(max(iRow, (int)uiAnchorRow - iDistance), (int)uiAnchorRow + iDistance);
+	}
+	iRow = min(max(iRow, 1), (int)uiNumRows - 2);
+	return (unsigned int)iRow;
+}
+
+/**
+ @brief Generate the tiles of a chunk. Each column has grass at its surface row, dirt below it and bedrock at the bottom.
+		The tile above the grass may be a tree, a chest or an enemy, and the tile below it may be lava.
+		The random numbers of a column are drawn in the same order whatever is placed.
+		If bSingleEnemy is true, an enemy is placed only if no enemy was drawn from uiFirstCol to the column before it.
+		FORCED_CHEST_COL gets a chest if no chest was drawn from uiFirstCol up to it.
+		The draws of the columns before the chunk are drawn again for these, which is cheap
+		as the draws stop at the first one which is 0.
+ @param uiChunk The index of the chunk. Its first column is uiChunk * NUM_CHUNK_COLS.
+ @param vTiles The tiles are written to this, NUM_CHUNK_COLS columns of uiNumRows tiles, with the rows counted from the top
+ */
+void CTerrainGenerator::GenerateChunk(const unsigned int uiChunk, std::vector<int>& vTiles) const
+{
+	vTiles.assign(NUM_CHUNK_COLS * uiNumRows, 0);
+	if (uiNumRows < 3)
+		return;
+
+	unsigned long long ullState = Hash(uiSeed, uiChunk);
+	const unsigned int uiChunkCol = uiChunk * NUM_CHUNK_COLS;
+	// Whether an enemy was drawn in the generated columns before this chunk
+	bool bEnemySpawned = bSingleEnemy && IsDrawnInColumns(ENEMY_SALT, ENEMY_SPAWN_RATE, uiFirstCol, uiChunkCol);
+	// Whether FORCED_CHEST_COL is generated in this chunk, and gets a chest as no chest was drawn up to it
+	const bool bForceChest = (FORCED_CHEST_COL >= max(uiChunkCol, uiFirstCol))
+		&& (FORCED_CHEST_COL < uiChunkCol + NUM_CHUNK_COLS)
+		&& (IsDrawnInColumns(CHEST_SALT, CHEST_SPAWN_RATE, uiFirstCol, FORCED_CHEST_COL + 1) == false);
+
+	for (unsigned int i = 0; i < NUM_CHUNK_COLS; i++)
+	{
+		const unsigned int uiCol = uiChunkCol + i;
+		const unsigned int uiSurfaceRow = GetSurfaceRow(uiCol);
+		int* pColumn = &vTiles[i * uiNumRows];
+
+		//set grass and dirt floor, with bedrock at the bottom
+		pColumn[uiSurfaceRow] = 2;
+		for (unsigned int uiRow = uiSurfaceRow + 1; uiRow < uiNumRows - 1; uiRow++)
+			pColumn[uiRow] = 3;
+		pColumn[uiNumRows - 1] = 1;
+
+		const int iTreeRandom = RandomInt(ullState, TREE_SPAWN_RATE);
+		const int iTreeType = RandomInt(ullState, 1);
+		const int iLavaRandom = RandomInt(ullState, LAVA_SPAWN_RATE);
+		const int iChestRandom = GetColumnRandom(CHEST_SALT, uiCol, CHEST_SPAWN_RATE);
+		const int iEnemyRandom = GetColumnRandom(ENEMY_SALT, uiCol, ENEMY_SPAWN_RATE);
+
+		//spawn trees, chests and enemies above the grass, each replacing the one before it
+		int& iAbove = pColumn[uiSurfaceRow - 1];
+		if (iTreeRandom == 0)
+			iAbove = (iTreeType == 0) ? 100 : 102;
+		if (iChestRandom == 0)
+			iAbove = 4;
+		if ((iEnemyRandom == 0) && (bEnemySpawned == false))
+		{
+			iAbove = iEnemyTile;
+			bEnemySpawned = bSingleEnemy;
+		}
+		//force spawn chest
+		if ((uiCol == FORCED_CHEST_COL) && bForceChest)
+			iAbove = 4;
+
+		//spawn lava below the grass, unless it would replace the bedrock
+		if ((iLavaRandom == 0) && (uiSurfaceRow + 1 < uiNumRows - 1))
+			pColumn[uiSurfaceRow + 1] = 5;
+	}
+}
+
+/**
+ @brief Get the world seed
+ */
+unsigned int CTerrainGenerator::GetSeed(void) const
+{
+	return uiSeed;
+}
+
+/**
+ @brief Get the number of rows of the chunks
+ */
+unsigned int CTerrainGenerator::GetNumRows(void) const
+{
+	return uiNumRows;
+}
+
+/**
+ @brief Get the value noise of a column. A random value from -1 to 1 is hashed for every iPeriod columns,
+		and the columns between them are smoothly interpolated, so the noise changes slowly along the columns.
+ @param uiCol The column
+ @param uiPeriod The number of columns between the random values
+ @param uiOctave The index of the noise, so that each octave has its own random values
+ @return The noise, from -1 to 1
+ */
+float CTerrainGenerator::GetNoise(const unsigned int uiCol, const unsigned int uiPeriod, const unsigned int uiOctave) const
+{
+	const unsigned long long ullOctaveSeed = Hash(uiSeed, 0x100000000ULL + uiOctave);
+	const unsigned int uiLattice = uiCol / uiPeriod;
+	const float fValue0 = (float)(Hash(ullOctaveSeed, uiLattice) >> 40) / (float)(1 << 24) * 2.0f - 1.0f;
+	const float fValue1 = (float)(Hash(ullOctaveSeed, uiLattice + 1ULL) >> 40) / (float)(1 << 24) * 2.0f - 1.0f;
+
+	// Smoothstep, so that the slope is 0 at the random values
+	const float fT = (float)(uiCol % uiPeriod) / (float)uiPeriod;
+	const float fSmoothT = fT * fT * (3.0f - 2.0f * fT);
+	return fValue0 + (fValue1 - fValue0) * fSmoothT;
+}
+
+/**
+ @brief Get a random number of a column from 0 to iMax. It is drawn from the world seed and the column only,
+		so it is the same whichever chunk is generated, and it can be drawn again for the rules of the whole map.
+ @param ullSalt The salt of the item which the number is for
+ @param uiCol The column
+ @param iMax The largest number, which is at least 0
+ */
+int CTerrainGenerator::GetColumnRandom(const unsigned long long ullSalt, const unsigned int uiCol, const int iMax) const
+{
+	unsigned long long ullState = Hash(Hash(uiSeed, ullSalt), uiCol);
+	return RandomInt(ullState, iMax);
+}
+
+/**
+ @brief Check if the random number of a column is 0 for any column in a range. The columns are checked
+		in order and the check stops at the first 0, so a long range is usually checked quickly.
+ @param ullSalt The salt of the item which the numbers are for
+ @param iMax The largest number, which is at least 0
+ @param uiBeginCol The first column
+ @param uiEndCol The column after the last one
+ @return A bool value. true if the number of any column is 0, else false
+ */
+bool CTerrainGenerator::IsDrawnInColumns(const unsigned long long ullSalt, const int iMax,
+										 const unsigned int uiBeginCol, const unsigned int uiEndCol) const
+{
+	for (unsigned int uiCol = uiBeginCol; uiCol < uiEndCol; uiCol++)
+	{
+		if (GetColumnRandom(ullSalt, uiCol, iMax) == 0)
+			return true;
+	}
+	return false;
+}
+
+/**
+ @brief Hash two numbers into a 64-bit number, with the finaliser of SplitMix64
+ @param ullA The first number
+ @param ullB The second number
+ */
+unsigned long long CTerrainGenerator::Hash(const unsigned long long ullA, const unsigned long long ullB)
+{
+	unsigned long long ullState = ullA;
+	unsigned long long ullHash = NextRandom(ullState);
+	ullState = ullHash + ullB;
+	return NextRandom(ullState);
+}
+
+/**
+ @brief Get the next number of a random number stream, with SplitMix64
+ @param ullState The state of the stream, which is advanced
+ */
+unsigned long long CTerrainGenerator::NextRandom(unsigned long long& ullState)
+{
+	ullState += 0x9E3779B97F4A7C15ULL;
+	unsigned long long ullValue = ullState;
+	ullValue = (ullValue ^ (ullValue >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	ullValue = (ullValue ^ (ullValue >> 27)) * 0x94D049BB133111EBULL;
+	return ullValue ^ (ullValue >> 31);
+}
+
+/**
+ @brief Get a random number of a stream from 0 to iMax, from the top 32 bits of the next number
+ @param ullState The state of the stream, which is advanced
+ @param iMax The largest number, which is at least 0
+ */
+int CTerrainGenerator::RandomInt(unsigned long long& ullState, const int iMax)
+{
+	return (int)(((NextRandom(ullState) >> 32) * (unsigned long long)(iMax + 1)) >> 32);
+}
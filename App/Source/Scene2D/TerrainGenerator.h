@@ -0,0 +1,78 @@
+/**
+ CTerrainGenerator
+ @brief A class which generates the tiles of CMap2D from a world seed, a chunk of NUM_CHUNK_COLS columns at a time.
+		The height of the ground is value noise of the column, so any chunk is generated on its own from the seed
+		and its index, and the ground of a chunk meets the ground of the chunks beside it.
+		The ground can be anchored to a column which is in the map already, e.g. the ground by the door,
+		so that the generated ground goes up or down from it by at most one row a column.
+		The trees and lava of a chunk are drawn from a random number stream which is seeded by the world seed
+		and the chunk index. The chests and enemies are drawn from the world seed and the column, so the rules
+		for the whole map, e.g. a single enemy, are decided from the draws of the columns before a chunk.
+		Thus the chunks are the same whichever order or thread they are generated on.
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#pragma once
+
+#include <vector>
+
+class CTerrainGenerator
+{
+public:
+	// The number of columns in a chunk
+	static const unsigned int NUM_CHUNK_COLS = 16;
+
+	// Constructor
+	CTerrainGenerator(void);
+	// Destructor
+	~CTerrainGenerator(void);
+
+	// Init
+	void Init(const unsigned int uiSeed, const unsigned int uiNumRows, const unsigned int uiFirstCol,
+			  const int iEnemyTile, const bool bSingleEnemy);
+	// Make the ground meet the grass of a column which is not generated
+	void SetAnchor(const unsigned int uiCol, const unsigned int uiSurfaceRow);
+
+	// Get the row of the grass of a column, counted from the top
+	unsigned int GetSurfaceRow(const unsigned int uiCol) const;
+
+	// Generate the tiles of a chunk into vTiles, one column after another, with the rows counted from the top
+	void GenerateChunk(const unsigned int uiChunk, std::vector<int>& vTiles) const;
+
+	// Get the world seed
+	unsigned int GetSeed(void) const;
+	// Get the number of rows of the chunks
+	unsigned int GetNumRows(void) const;
+
+protected:
+	// The world seed
+	unsigned int uiSeed;
+	// The number of rows of the chunks
+	unsigned int uiNumRows;
+	// The first column which is generated. The chests and enemies of the columns before it are not counted.
+	unsigned int uiFirstCol;
+	// The tile which is placed for an enemy
+	int iEnemyTile;
+	// If true, only the first enemy from uiFirstCol is placed
+	bool bSingleEnemy;
+	// The column and the row of the grass which the ground meets, if bAnchored is true
+	bool bAnchored;
+	unsigned int uiAnchorCol;
+	unsigned int uiAnchorRow;
+
+	// Get the value noise of a column, from -1 to 1, with a lattice point every iPeriod columns
+	float GetNoise(const unsigned int uiCol, const unsigned int uiPeriod, const unsigned int uiOctave) const;
+
+	// Get a random number of a column from 0 to iMax, drawn from the world seed, the column and a salt
+	int GetColumnRandom(const unsigned long long ullSalt, const unsigned int uiCol, const int iMax) const;
+	// Check if the random number of a column is 0 for any column from uiBeginCol to before uiEndCol
+	bool IsDrawnInColumns(const unsigned long long ullSalt, const int iMax,
+						  const unsigned int uiBeginCol, const unsigned int uiEndCol) const;
+
+	// Hash two numbers into a 64-bit number
+	static unsigned long long Hash(const unsigned long long ullA, const unsigned long long ullB);
+	// Get the next number of a random number stream
+	static unsigned long long NextRandom(unsigned long long& ullState);
+	// Get a random number of a stream from 0 to iMax
+	static int RandomInt(unsigned long long& ullState, const int iMax);
+};
@@ -0,0 +1,128 @@
+/**
+ TileTable
+ @brief The properties of the tiles of CMap2D, e.g. if a tile is solid, what a seed grows into and what a block drops.
+		Each tile is listed once in TILE_DEFINITIONS. A table indexed by the tile number is built from it at compile time,
+		so that checking a tile is a single load from the table, instead of comparing it with ranges of numbers.
+		The textures of CMap2D and the item names of CPlayer2D are taken from TILE_DEFINITIONS too.
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#pragma once
+
+// The flags of a tile
+enum TILE_FLAG
+{
+	// The player and the enemies cannot move into it
+	TILE_SOLID = 1 << 0,
+	// It drops an item when it is broken
+	TILE_HARVESTABLE = 1 << 1,
+	// It hurts the player who is beside it
+	TILE_DAMAGING = 1 << 2,
+	// The player picks it up by touching it
+	TILE_COLLECTABLE = 1 << 3,
+	// The player can open it
+	TILE_CHEST = 1 << 4,
+	// The player can buy a sword at it
+	TILE_SHOP = 1 << 5,
+	// The player can attack it, and is hurt beside it
+	TILE_ENEMY = 1 << 6,
+	// The paths of the enemies go around it
+	TILE_PATH_BLOCKING = 1 << 7,
+	// The player can break it with a right click. Every tile is, except Bedrock, the door and the markers.
+	TILE_BREAKABLE = 1 << 8
+};
+
+// The layer of the texture of a tile, in the order of CMap2D::BLOCK_TYPE
+enum TILE_LAYER
+{
+	TILE_LAYER_BLOCKS = 0,
+	TILE_LAYER_TREES,
+	TILE_LAYER_BACKGROUND,
+	TILE_LAYER_COLLECTABLES,
+	TILE_LAYER_NONE
+};
+
+// A structure storing the properties of a tile
+struct TileProperties
+{
+	// The name of the inventory item of the tile, or nullptr if it has none
+	const char* pName;
+	// The file of the texture of the tile, or nullptr if it is not drawn
+	const char* pTexture;
+	// The TILE_FLAGs of the tile
+	unsigned int uiFlags;
+	// The layer of the texture of the tile
+	TILE_LAYER eLayer;
+	// The tile which this seed grows into, and the time in seconds which it takes, or 0 if it does not grow
+	int iGrowsInto;
+	float fGrowTime;
+	// The tile whose item is dropped when this tile is broken, or 0 if it drops nothing
+	int iDropItem;
+};
+
+// A structure storing a tile number with its properties
+struct TileDefinition
+{
+	int iTile;
+	TileProperties sProperties;
+};
+
+// The tiles. The number of a tile is its value in the map files.
+constexpr TileDefinition TILE_DEFINITIONS[] = {
+	//default blocks
+	{ 1, { "Bedrock", "Image/Blocks/Bedrock.png", TILE_SOLID, TILE_LAYER_BLOCKS, 0, 0.0f, 0 } },
+	{ 2, { "GrassBlock", "Image/Blocks/GrassBlock.png", TILE_SOLID | TILE_HARVESTABLE | TILE_BREAKABLE, TILE_LAYER_BLOCKS, 0, 0.0f, 100 } },
+	{ 3, { "DirtBlock", "Image/Blocks/DirtBlock.png", TILE_SOLID | TILE_HARVESTABLE | TILE_BREAKABLE, TILE_LAYER_BLOCKS, 0, 0.0f, 102 } },
+	{ 4, { "Chest", "Image/Blocks/Chest.png", TILE_SOLID | TILE_CHEST | TILE_BREAKABLE, TILE_LAYER_BLOCKS, 0, 0.0f, 0 } },
+	{ 5, { "LavaBlock", "Image/Blocks/Lava.png", TILE_SOLID | TILE_DAMAGING | TILE_BREAKABLE, TILE_LAYER_BLOCKS, 0, 0.0f, 0 } },
+	{ 6, { nullptr, "Image/Blocks/Shop.png", TILE_SOLID | TILE_SHOP | TILE_BREAKABLE, TILE_LAYER_BLOCKS, 0, 0.0f, 0 } },
+	//trees & seeds
+	{ 100, { "GrassSeed", "Image/Trees/GrassTree.png", TILE_PATH_BLOCKING | TILE_BREAKABLE, TILE_LAYER_TREES, 101, 2.0f, 0 } },
+	{ 101, { "GrassTreeGrown", "Image/Trees/GrassTreeGrown.png", TILE_PATH_BLOCKING | TILE_HARVESTABLE | TILE_BREAKABLE, TILE_LAYER_TREES, 0, 0.0f, 2 } },
+	{ 102, { "DirtSeed", "Image/Trees/DirtTree.png", TILE_PATH_BLOCKING | TILE_BREAKABLE, TILE_LAYER_TREES, 103, 1.0f, 0 } },
+	{ 103, { "DirtTreeGrown", "Image/Trees/DirtTreeGrown.png", TILE_PATH_BLOCKING | TILE_HARVESTABLE | TILE_BREAKABLE, TILE_LAYER_TREES, 0, 0.0f, 3 } },
+	//background items
+	{ 201, { nullptr, "Image/Blocks/Door.png", 0, TILE_LAYER_BACKGROUND, 0, 0.0f, 0 } },
+	{ 202, { nullptr, "Image/UI/blockRange.png", 0, TILE_LAYER_BACKGROUND, 0, 0.0f, 0 } },
+	//enemies and drop items. 300, 301 and 302 also mark where the enemies start, see CEnemy2D::Init
+	{ 300, { nullptr, nullptr, TILE_ENEMY | TILE_BREAKABLE, TILE_LAYER_COLLECTABLES, 0, 0.0f, 0 } },
+	{ 301, { "Stone", "Image/Items/Stone.png", TILE_COLLECTABLE | TILE_ENEMY | TILE_BREAKABLE, TILE_LAYER_COLLECTABLES, 0, 0.0f, 0 } },
+	{ 302, { "Cheese", "Image/Items/Cheese.png", TILE_COLLECTABLE | TILE_BREAKABLE, TILE_LAYER_COLLECTABLES, 0, 0.0f, 0 } },
+	//Enemy
+	{ 401, { nullptr, "Image/Characters/Enemy.png", TILE_BREAKABLE, TILE_LAYER_NONE, 0, 0.0f, 0 } },
+};
+constexpr unsigned int NUM_TILE_DEFINITIONS = sizeof(TILE_DEFINITIONS) / sizeof(TILE_DEFINITIONS[0]);
+
+// The number of entries in the table. Every tile number must be less than this.
+constexpr unsigned int NUM_TILE_NUMBERS = 512;
+
+// A structure storing the properties of every tile number, indexed by the tile number
+struct TileTable
+{
+	TileProperties sTiles[NUM_TILE_NUMBERS];
+};
+
+/**
+ @brief Build the table of the tiles from TILE_DEFINITIONS. The tiles which are not defined have no flags and are not drawn.
+ */
+constexpr TileTable BuildTileTable(void)
+{
+	TileTable sTable = {};
+	for (unsigned int i = 0; i < NUM_TILE_NUMBERS; i++)
+		sTable.sTiles[i].eLayer = TILE_LAYER_NONE;
+	for (unsigned int i = 0; i < NUM_TILE_DEFINITIONS; i++)
+		sTable.sTiles[TILE_DEFINITIONS[i].iTile] = TILE_DEFINITIONS[i].sProperties;
+	return sTable;
+}
+
+// The table of the tiles, which is built when compiling
+constexpr TileTable TILE_TABLE = BuildTileTable();
+
+/**
+ @brief Get the properties of a tile. The numbers which are outside the table get the properties of an empty tile.
+ @param iTile The number of the tile
+ */
+inline const TileProperties& GetTileProperties(const int iTile)
+{
+	return TILE_TABLE.sTiles[((unsigned int)iTile < NUM_TILE_NUMBERS) ? iTile : 0];
+}
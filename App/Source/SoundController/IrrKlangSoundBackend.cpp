@@ -0,0 +1,332 @@
+/**
+ CIrrKlangSoundBackend
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#include "IrrKlangSoundBackend.h"
+
+#include <iostream>
+using namespace std;
+using namespace irrklang;
+
+/**
+ @brief Constructor
+ */
+CIrrKlangSoundBackend::CIrrKlangSoundBackend(void)
+	: cSoundEngine(NULL)
+	, uiLastHandle(0)
+	, vec3dfListenerPos(vec3df(0, 0, 0))
+	, vec3dfListenerDir(vec3df(0, 0, 1))
+{
+}
+
+/**
+ @brief Destructor
+ */
+CIrrKlangSoundBackend::~CIrrKlangSoundBackend(void)
+{
+	for (std::map<unsigned int, ISound*>::iterator it = mVoices.begin(); it != mVoices.end(); ++it)
+		it->second->drop();
+	mVoices.clear();
+
+	// The sound sources were dropped by the CSoundInfo which held them, so the sound engine is not dropped here
+}
+
+/**
+ @brief Initialise the sound engine with the default driver of this platform
+ @return A bool value. true is this class instance was initialised, else false
+ */
+bool CIrrKlangSoundBackend::Init(void)
+{
+	cSoundEngine = createIrrKlangDevice(ESOD_AUTO_DETECT, ESEO_MULTI_THREADED);
+	if (cSoundEngine == NULL)
+	{
+		cout << "Unable to initialise the IrrKlang sound engine" << endl;
+		return false;
+	}
+	return true;
+}
+
+/**
+ @brief Get the name of this backend
+ */
+const char* CIrrKlangSoundBackend::GetName(void) const
+{
+	return "irrKlang";
+}
+
+/**
+ @brief Load a sound source from a file
+ @param filename The name of the file
+ @param bStream A bool which is true to stream the sound from the file instead of decoding it into memory
+ @param bPreload A bool which is true to decode the sound now instead of when it is first played
+ @return The handle of the sound source, or 0 if it could not be loaded
+ */
+unsigned int CIrrKlangSoundBackend::LoadSource(const std::string& filename, const bool bStream, const bool bPreload)
+{
+	// Share the sound source if this file was loaded already
+	ISoundSource* pSoundSource = cSoundEngine->getSoundSource(filename.c_str(), false);
+	if (pSoundSource != nullptr)
+		return AddSource(pSoundSource);
+
+	pSoundSource = cSoundEngine->addSoundSourceFromFile(filename.c_str(),
+														bStream ? E_STREAM_MODE::ESM_STREAMING : E_STREAM_MODE::ESM_NO_STREAMING,
+														bPreload && !bStream);
+	if (pSoundSource == nullptr)
+		return 0;
+
+	// Force the short sounds not to have any streaming
+	if (!bStream)
+		pSoundSource->setForcedStreamingThreshold(-1);
+
+	return AddSource(pSoundSource);
+}
+
+/**
+ @brief Load a sound source from the content of a file
+ @param vContent The content of the sound file
+ @param filename The name of the file which was read. Its extension tells irrKlang the format.
+ @return The handle of the sound source, or 0 if it could not be loaded
+ */
+unsigned int CIrrKlangSoundBackend::LoadSourceFromMemory(const std::vector<char>& vContent, const std::string& filename)
+{
+	// Share the sound source if this file was loaded already
+	ISoundSource* pSoundSource = cSoundEngine->getSoundSource(filename.c_str(), false);
+	if (pSoundSource != nullptr)
+		return AddSource(pSoundSource);
+
+	// irrKlang copies the content, so vContent can be freed after this
+	pSoundSource = cSoundEngine->addSoundSourceFromMemory((void*)&vContent[0],
+														  (ik_s32)vContent.size(),
+														  filename.c_str(),
+														  true);
+	if (pSoundSource == nullptr)
+		return 0;
+
+	// Force the sound source not to have any streaming
+	pSoundSource->setForcedStreamingThreshold(-1);
+
+	return AddSource(pSoundSource);
+}
+
+/**
+ @brief Release a sound source which was returned by LoadSource or LoadSourceFromMemory
+ */
+void CIrrKlangSoundBackend::ReleaseSource(const unsigned int uiSource)
+{
+	std::map<unsigned int, Source>::iterator it = mSources.find(uiSource);
+	if (it == mSources.end())
+		return;
+
+	it->second.pSoundSource->drop();
+	if (--it->second.uiRefCount == 0)
+	{
+		mSourceHandles.erase(it->second.pSoundSource);
+		mSources.erase(it);
+	}
+}
+
+/**
+ @brief Get the memory used by the decoded samples of a sound source in bytes
+ */
+unsigned int CIrrKlangSoundBackend::GetSourceMemory(const unsigned int uiSource)
+{
+	ISoundSource* pSoundSource = GetSource(uiSource);
+	if (pSoundSource == nullptr)
+		return 0;
+	return pSoundSource->getAudioFormat().getSampleDataSize();
+}
+
+/**
+ @brief Get the volume of a sound source
+ */
+float CIrrKlangSoundBackend::GetSourceVolume(const unsigned int uiSource)
+{
+	ISoundSource* pSoundSource = GetSource(uiSource);
+	if (pSoundSource == nullptr)
+		return 0.0f;
+	return pSoundSource->getDefaultVolume();
+}
+
+/**
+ @brief Set the volume of a sound source
+ */
+void CIrrKlangSoundBackend::SetSourceVolume(const unsigned int uiSource, const float fVolume)
+{
+	ISoundSource* pSoundSource = GetSource(uiSource);
+	if (pSoundSource != nullptr)
+		pSoundSource->setDefaultVolume(fVolume);
+}
+
+/**
+ @brief Play a sound source
+ @return The handle of the voice, or 0 if it could not be played
+ */
+unsigned int CIrrKlangSoundBackend::Play2D(const unsigned int uiSource, const bool bIsLooped)
+{
+	ISoundSource* pSoundSource = GetSource(uiSource);
+	if (pSoundSource == nullptr)
+		return 0;
+	return AddVoice(cSoundEngine->play2D(pSoundSource, bIsLooped, false, true));
+}
+
+/**
+ @brief Play a sound source at a position
+ @return The handle of the voice, or 0 if it could not be played
+ */
+unsigned int CIrrKlangSoundBackend::Play3D(const unsigned int uiSource, const glm::vec3& vec3Position, const bool bIsLooped)
+{
+	ISoundSource* pSoundSource = GetSource(uiSource);
+	if (pSoundSource == nullptr)
+		return 0;
+	cSoundEngine->setListenerPosition(vec3dfListenerPos, vec3dfListenerDir);
+	return AddVoice(cSoundEngine->play3D(pSoundSource,
+										 vec3df(vec3Position.x, vec3Position.y, vec3Position.z),
+										 bIsLooped, false, true));
+}
+
+/**
+ @brief Stop a voice
+ */
+void CIrrKlangSoundBackend::StopVoice(const unsigned int uiVoice)
+{
+	ISound* pVoice = GetVoice(uiVoice);
+	if (pVoice != nullptr)
+		pVoice->stop();
+}
+
+/**
+ @brief Check if a voice has finished playing
+ */
+bool CIrrKlangSoundBackend::IsVoiceFinished(const unsigned int uiVoice)
+{
+	ISound* pVoice = GetVoice(uiVoice);
+	return (pVoice == nullptr) || (pVoice->isFinished());
+}
+
+/**
+ @brief Get the sound source of a voice
+ @return The handle of the sound source, or 0 if the voice is not found
+ */
+unsigned int CIrrKlangSoundBackend::GetVoiceSource(const unsigned int uiVoice)
+{
+	ISound* pVoice = GetVoice(uiVoice);
+	if (pVoice == nullptr)
+		return 0;
+	std::map<ISoundSource*, unsigned int>::const_iterator it = mSourceHandles.find(pVoice->getSoundSource());
+	return (it != mSourceHandles.end() ? it->second : 0);
+}
+
+/**
+ @brief Release a voice which was returned by Play2D or Play3D
+ */
+void CIrrKlangSoundBackend::ReleaseVoice(const unsigned int uiVoice)
+{
+	std::map<unsigned int, ISound*>::iterator it = mVoices.find(uiVoice);
+	if (it == mVoices.end())
+		return;
+	it->second->drop();
+	mVoices.erase(it);
+}
+
+/**
+ @brief Stop all the voices
+ */
+void CIrrKlangSoundBackend::StopAll(void)
+{
+	cSoundEngine->stopAllSounds();
+}
+
+/**
+ @brief Get the master volume
+ */
+float CIrrKlangSoundBackend::GetMasterVolume(void)
+{
+	return cSoundEngine->getSoundVolume();
+}
+
+/**
+ @brief Set the master volume
+ */
+void CIrrKlangSoundBackend::SetMasterVolume(const float fVolume)
+{
+	cSoundEngine->setSoundVolume(fVolume);
+}
+
+/**
+ @brief Set the position and view direction of the listener of the 3D sounds
+ */
+void CIrrKlangSoundBackend::SetListener(const glm::vec3& vec3Position, const glm::vec3& vec3Direction)
+{
+	vec3dfListenerPos.set(vec3Position.x, vec3Position.y, vec3Position.z);
+	vec3dfListenerDir.set(vec3Direction.x, vec3Direction.y, vec3Direction.z);
+}
+
+/**
+ @brief irrKlang mixes the sounds on its own thread, so there is nothing to do here
+ */
+void CIrrKlangSoundBackend::Update(const double dElapsedTime)
+{
+}
+
+/**
+ @brief Print out details about this class instance in the console window
+ */
+void CIrrKlangSoundBackend::PrintSelf(void) const
+{
+	cout << "CIrrKlangSoundBackend::PrintSelf()" << endl;
+	if (cSoundEngine)
+		cout << "Driver: " << cSoundEngine->getDriverName() << endl;
+	cout << "Sound sources: " << mSources.size() << ", voices: " << mVoices.size() << endl;
+}
+
+/**
+ @brief Get the handle of a sound source and add a reference to it, giving it a new handle if it does not have one
+ */
+unsigned int CIrrKlangSoundBackend::AddSource(ISoundSource* pSoundSource)
+{
+	std::map<ISoundSource*, unsigned int>::iterator it = mSourceHandles.find(pSoundSource);
+	if (it != mSourceHandles.end())
+	{
+		// Each CSoundInfo drops its sound source, so a shared one is grabbed for it
+		pSoundSource->grab();
+		mSources[it->second].uiRefCount++;
+		return it->second;
+	}
+
+	Source sSource;
+	sSource.pSoundSource = pSoundSource;
+	sSource.uiRefCount = 1;
+	mSources[++uiLastHandle] = sSource;
+	mSourceHandles[pSoundSource] = uiLastHandle;
+	return uiLastHandle;
+}
+
+/**
+ @brief Get the handle of a voice, or 0 if pVoice is nullptr
+ */
+unsigned int CIrrKlangSoundBackend::AddVoice(ISound* pVoice)
+{
+	if (pVoice == nullptr)
+		return 0;
+	mVoices[++uiLastHandle] = pVoice;
+	return uiLastHandle;
+}
+
+/**
+ @brief Get a sound source by its handle
+ */
+ISoundSource* CIrrKlangSoundBackend::GetSource(const unsigned int uiSource) const
+{
+	std::map<unsigned int, Source>::const_iterator it = mSources.find(uiSource);
+	return (it != mSources.end() ? it->second.pSoundSource : nullptr);
+}
+
+/**
+ @brief Get a voice by its handle
+ */
+ISound* CIrrKlangSoundBackend::GetVoice(const unsigned int uiVoice) const
+{
+	std::map<unsigned int, ISound*>::const_iterator it = mVoices.find(uiVoice);
+	return (it != mVoices.end() ? it->second : nullptr);
+}
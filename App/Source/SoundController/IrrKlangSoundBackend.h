@@ -0,0 +1,82 @@
+/**
+ CIrrKlangSoundBackend
+ @brief The CSoundBackend which plays the sounds on an audio device with irrKlang
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#pragma once
+
+// Include CSoundBackend
+#include "SoundBackend.h"
+
+// Include IrrKlang
+#include <includes/irrKlang.h>
+#pragma comment(lib, "irrKlang.lib") // link with irrKlang.dll
+
+#include <map>
+
+class CIrrKlangSoundBackend : public CSoundBackend
+{
+public:
+	// Constructor
+	CIrrKlangSoundBackend(void);
+	// Destructor
+	virtual ~CIrrKlangSoundBackend(void);
+
+	virtual bool Init(void);
+	virtual const char* GetName(void) const;
+
+	virtual unsigned int LoadSource(const std::string& filename, const bool bStream, const bool bPreload);
+	virtual unsigned int LoadSourceFromMemory(const std::vector<char>& vContent, const std::string& filename);
+	virtual void ReleaseSource(const unsigned int uiSource);
+	virtual unsigned int GetSourceMemory(const unsigned int uiSource);
+	virtual float GetSourceVolume(const unsigned int uiSource);
+	virtual void SetSourceVolume(const unsigned int uiSource, const float fVolume);
+
+	virtual unsigned int Play2D(const unsigned int uiSource, const bool bIsLooped);
+	virtual unsigned int Play3D(const unsigned int uiSource, const glm::vec3& vec3Position, const bool bIsLooped);
+	virtual void StopVoice(const unsigned int uiVoice);
+	virtual bool IsVoiceFinished(const unsigned int uiVoice);
+	virtual unsigned int GetVoiceSource(const unsigned int uiVoice);
+	virtual void ReleaseVoice(const unsigned int uiVoice);
+	virtual void StopAll(void);
+
+	virtual float GetMasterVolume(void);
+	virtual void SetMasterVolume(const float fVolume);
+	virtual void SetListener(const glm::vec3& vec3Position, const glm::vec3& vec3Direction);
+
+	virtual void Update(const double dElapsedTime);
+
+	virtual void PrintSelf(void) const;
+
+protected:
+	// Get the handle of a sound source and add a reference to it, giving it a new handle if it does not have one
+	unsigned int AddSource(irrklang::ISoundSource* pSoundSource);
+	// Get the handle of a voice, or 0 if pVoice is nullptr
+	unsigned int AddVoice(irrklang::ISound* pVoice);
+	// Get a sound source or a voice by its handle
+	irrklang::ISoundSource* GetSource(const unsigned int uiSource) const;
+	irrklang::ISound* GetVoice(const unsigned int uiVoice) const;
+
+	// The handler to the irrklang Sound Engine
+	irrklang::ISoundEngine* cSoundEngine;
+
+	// A sound source and the number of CSoundInfo which hold it
+	struct Source
+	{
+		irrklang::ISoundSource* pSoundSource;
+		unsigned int uiRefCount;
+	};
+
+	// The sound sources by their handles, and the handles by their sound sources
+	std::map<unsigned int, Source> mSources;
+	std::map<irrklang::ISoundSource*, unsigned int> mSourceHandles;
+	// The voices by their handles
+	std::map<unsigned int, irrklang::ISound*> mVoices;
+	// The last handle given out for sound sources and voices
+	unsigned int uiLastHandle;
+
+	// The position and view direction of the listener
+	irrklang::vec3df vec3dfListenerPos;
+	irrklang::vec3df vec3dfListenerDir;
+};
@@ -0,0 +1,531 @@
+/**
+ COfflineSoundBackend
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#include "OfflineSoundBackend.h"
+
+// Include CStopWatch to measure the cost of mixing
+#include <TimeControl\StopWatch.h>
+
+#include <fstream>
+#include <iostream>
+#include <cstring>
+#include <algorithm>
+using namespace std;
+
+/**
+ @brief Constructor
+ */
+COfflineSoundBackend::COfflineSoundBackend(void)
+	: uiLastHandle(0)
+	, fMasterVolume(1.0f)
+	, dFrameRemainder(0.0)
+	, bCaptureOutput(false)
+	, ullNumMixedFrames(0)
+	, dMixTime(0.0)
+{
+}
+
+/**
+ @brief Destructor
+ */
+COfflineSoundBackend::~COfflineSoundBackend(void)
+{
+}
+
+/**
+ @brief There is no audio device to open, so this always succeeds
+ */
+bool COfflineSoundBackend::Init(void)
+{
+	return true;
+}
+
+/**
+ @brief Get the name of this backend
+ */
+const char* COfflineSoundBackend::GetName(void) const
+{
+	return "Offline mixer";
+}
+
+/**
+ @brief Load a sound source from a file. The whole file is decoded, even if bStream is true.
+ @param filename The name of the file
+ @return The handle of the sound source, or 0 if it could not be loaded
+ */
+unsigned int COfflineSoundBackend::LoadSource(const std::string& filename, const bool bStream, const bool bPreload)
+{
+	unsigned int uiSource = FindSource(filename);
+	if (uiSource != 0)
+		return uiSource;
+
+	std::ifstream file(filename.c_str(), std::ios::binary | std::ios::ate);
+	if (!file.is_open())
+		return 0;
+	std::vector<char> vContent((size_t)file.tellg());
+	file.seekg(0, std::ios::beg);
+	if (!vContent.empty())
+		file.read(&vContent[0], vContent.size());
+
+	return LoadSourceFromMemory(vContent, filename);
+}
+
+/**
+ @brief Load a sound source from the content of a file
+ @param vContent The content of the sound file
+ @param filename The name of the file which was read
+ @return The handle of the sound source, or 0 if it could not be decoded
+ */
+unsigned int COfflineSoundBackend::LoadSourceFromMemory(const std::vector<char>& vContent, const std::string& filename)
+{
+	unsigned int uiSource = FindSource(filename);
+	if (uiSource != 0)
+		return uiSource;
+
+	Source sSource;
+	sSource.sName = filename;
+	sSource.uiNumFrames = 0;
+	sSource.fVolume = 1.0f;
+	sSource.uiRefCount = 1;
+	if (!DecodeWAV(vContent, sSource))
+	{
+		cout << "COfflineSoundBackend: Only PCM WAV files can be decoded: " << filename << endl;
+		return 0;
+	}
+
+	mSources[++uiLastHandle] = sSource;
+	return uiLastHandle;
+}
+
+/**
+ @brief Release a sound source which was returned by LoadSource or LoadSourceFromMemory
+ */
+void COfflineSoundBackend::ReleaseSource(const unsigned int uiSource)
+{
+	std::map<unsigned int, Source>::iterator it = mSources.find(uiSource);
+	if (it == mSources.end())
+		return;
+
+	if (--it->second.uiRefCount > 0)
+		return;
+
+	// Stop the voices which play this source
+	for (std::map<unsigned int, Voice>::iterator itVoice = mVoices.begin(); itVoice != mVoices.end(); ++itVoice)
+	{
+		if (itVoice->second.uiSource == uiSource)
+			itVoice->second.bIsFinished = true;
+	}
+	mSources.erase(it);
+}
+
+/**
+ @brief Get the memory used by the decoded samples of a sound source in bytes
+ */
+unsigned int COfflineSoundBackend::GetSourceMemory(const unsigned int uiSource)
+{
+	std::map<unsigned int, Source>::const_iterator it = mSources.find(uiSource);
+	if (it == mSources.end())
+		return 0;
+	return (unsigned int)(it->second.vSamples.size() * sizeof(float));
+}
+
+/**
+ @brief Get the volume of a sound source
+ */
+float COfflineSoundBackend::GetSourceVolume(const unsigned int uiSource)
+{
+	std::map<unsigned int, Source>::const_iterator it = mSources.find(uiSource);
+	return (it != mSources.end() ? it->second.fVolume : 0.0f);
+}
+
+/**
+ @brief Set the volume of a sound source
+ */
+void COfflineSoundBackend::SetSourceVolume(const unsigned int uiSource, const float fVolume)
+{
+	std::map<unsigned int, Source>::iterator it = mSources.find(uiSource);
+	if (it != mSources.end())
+		it->second.fVolume = fVolume;
+}
+
+/**
+ @brief Play a sound source
+ @return The handle of the voice, or 0 if the sound source is not found
+ */
+unsigned int COfflineSoundBackend::Play2D(const unsigned int uiSource, const bool bIsLooped)
+{
+	if (mSources.count(uiSource) == 0)
+		return 0;
+
+	Voice sVoice;
+	sVoice.uiSource = uiSource;
+	sVoice.uiFrame = 0;
+	sVoice.bIsLooped = bIsLooped;
+	sVoice.bIsFinished = false;
+	mVoices[++uiLastHandle] = sVoice;
+	return uiLastHandle;
+}
+
+/**
+ @brief Play a sound source. The position is ignored, so it is mixed as a 2D sound.
+ @return The handle of the voice, or 0 if the sound source is not found
+ */
+unsigned int COfflineSoundBackend::Play3D(const unsigned int uiSource, const glm::vec3& vec3Position, const bool bIsLooped)
+{
+	return Play2D(uiSource, bIsLooped);
+}
+
+/**
+ @brief Stop a voice
+ */
+void COfflineSoundBackend::StopVoice(const unsigned int uiVoice)
+{
+	std::map<unsigned int, Voice>::iterator it = mVoices.find(uiVoice);
+	if (it != mVoices.end())
+		it->second.bIsFinished = true;
+}
+
+/**
+ @brief Check if a voice has finished playing
+ */
+bool COfflineSoundBackend::IsVoiceFinished(const unsigned int uiVoice)
+{
+	std::map<unsigned int, Voice>::const_iterator it = mVoices.find(uiVoice);
+	return (it == mVoices.end()) || (it->second.bIsFinished);
+}
+
+/**
+ @brief Get the sound source of a voice
+ @return The handle of the sound source, or 0 if the voice is not found
+ */
+unsigned int COfflineSoundBackend::GetVoiceSource(const unsigned int uiVoice)
+{
+	std::map<unsigned int, Voice>::const_iterator it = mVoices.find(uiVoice);
+	return (it != mVoices.end() ? it->second.uiSource : 0);
+}
+
+/**
+ @brief Release a voice which was returned by Play2D or Play3D
+ */
+void COfflineSoundBackend::ReleaseVoice(const unsigned int uiVoice)
+{
+	mVoices.erase(uiVoice);
+}
+
+/**
+ @brief Stop all the voices
+ */
+void COfflineSoundBackend::StopAll(void)
+{
+	for (std::map<unsigned int, Voice>::iterator it = mVoices.begin(); it != mVoices.end(); ++it)
+		it->second.bIsFinished = true;
+}
+
+/**
+ @brief Get the master volume
+ */
+float COfflineSoundBackend::GetMasterVolume(void)
+{
+	return fMasterVolume;
+}
+
+/**
+ @brief Set the master volume
+ */
+void COfflineSoundBackend::SetMasterVolume(const float fVolume)
+{
+	fMasterVolume = fVolume;
+}
+
+/**
+ @brief The 3D sounds are mixed as 2D sounds, so the listener is not used
+ */
+void COfflineSoundBackend::SetListener(const glm::vec3& vec3Position, const glm::vec3& vec3Direction)
+{
+}
+
+/**
+ @brief Mix the frames which play in dElapsedTime seconds
+ @param dElapsedTime The time since the last Update in seconds
+ */
+void COfflineSoundBackend::Update(const double dElapsedTime)
+{
+	// Carry the fraction of a frame over, so that the mix keeps pace with the game time
+	const double dNumFrames = dElapsedTime * SAMPLE_RATE + dFrameRemainder;
+	const unsigned int uiNumFrames = (unsigned int)dNumFrames;
+	dFrameRemainder = dNumFrames - uiNumFrames;
+	if (uiNumFrames == 0)
+		return;
+
+	vUpdateBuffer.resize(uiNumFrames * NUM_CHANNELS);
+	Mix(&vUpdateBuffer[0], uiNumFrames);
+
+	if (bCaptureOutput)
+		vOutput.insert(vOutput.end(), vUpdateBuffer.begin(), vUpdateBuffer.end());
+}
+
+/**
+ @brief Mix a number of frames of the playing voices
+ @param pBuffer The buffer to write to, which holds NUM_CHANNELS samples per frame
+ @param uiNumFrames The number of frames to mix
+ */
+void COfflineSoundBackend::Mix(short* pBuffer, const unsigned int uiNumFrames)
+{
+	CStopWatch cMixTimer;
+	cMixTimer.StartTimer();
+
+	const unsigned int uiNumSamples = uiNumFrames * NUM_CHANNELS;
+	vMixBuffer.assign(uiNumSamples, 0.0f);
+
+	for (std::map<unsigned int, Voice>::iterator it = mVoices.begin(); it != mVoices.end(); ++it)
+	{
+		Voice& sVoice = it->second;
+		if (sVoice.bIsFinished)
+			continue;
+		const Source& sSource = mSources[sVoice.uiSource];
+		if (sSource.uiNumFrames == 0)
+		{
+			sVoice.bIsFinished = true;
+			continue;
+		}
+
+		// Copy the voice in runs which end at the end of the mix or the end of the source
+		unsigned int uiFrame = 0;
+		while (uiFrame < uiNumFrames)
+		{
+			const unsigned int uiRun = std::min(uiNumFrames - uiFrame, sSource.uiNumFrames - sVoice.uiFrame);
+			const float* pSrc = &sSource.vSamples[sVoice.uiFrame * NUM_CHANNELS];
+			float* pDst = &vMixBuffer[uiFrame * NUM_CHANNELS];
+			for (unsigned int i = 0; i < uiRun * NUM_CHANNELS; i++)
+				pDst[i] += pSrc[i] * sSource.fVolume;
+
+			uiFrame += uiRun;
+			sVoice.uiFrame += uiRun;
+			if (sVoice.uiFrame == sSource.uiNumFrames)
+			{
+				sVoice.uiFrame = 0;
+				if (!sVoice.bIsLooped)
+				{
+					sVoice.bIsFinished = true;
+					break;
+				}
+			}
+		}
+	}
+
+	// Convert the mix to 16-bit samples, clipping the peaks
+	for (unsigned int i = 0; i < uiNumSamples; i++)
+	{
+		const float fSample = std::max(-1.0f, std::min(1.0f, vMixBuffer[i] * fMasterVolume));
+		pBuffer[i] = (short)(fSample * 32767.0f);
+	}
+
+	ullNumMixedFrames += uiNumFrames;
+	dMixTime += cMixTimer.GetElapsedTime() * 1000.0;
+}
+
+/**
+ @brief Set whether the frames mixed by Update are kept, so that they can be read or written to a WAV file
+ */
+void COfflineSoundBackend::SetCaptureOutput(const bool bCaptureOutput)
+{
+	this->bCaptureOutput = bCaptureOutput;
+}
+
+/**
+ @brief Get the frames mixed by Update since the capture was cleared
+ */
+const std::vector<short>& COfflineSoundBackend::GetOutput(void) const
+{
+	return vOutput;
+}
+
+/**
+ @brief Clear the captured frames
+ */
+void COfflineSoundBackend::ClearOutput(void)
+{
+	vOutput.clear();
+}
+
+/**
+ @brief Write the captured frames to a 16-bit PCM WAV file
+ @param filename The name of the file to write to
+ @return true if the file was written, else false
+ */
+bool COfflineSoundBackend::WriteWAV(const std::string& filename) const
+{
+	std::ofstream file(filename.c_str(), std::ios::binary);
+	if (!file.is_open())
+	{
+		cout << "COfflineSoundBackend: Unable to write " << filename << endl;
+		return false;
+	}
+
+	const unsigned int uiDataSize = (unsigned int)(vOutput.size() * sizeof(short));
+	const unsigned int uiRiffSize = 36 + uiDataSize;
+	const unsigned int uiFmtSize = 16;
+	const unsigned short usFormat = 1;
+	const unsigned short usChannels = NUM_CHANNELS;
+	const unsigned int uiSampleRate = SAMPLE_RATE;
+	const unsigned int uiByteRate = SAMPLE_RATE * NUM_CHANNELS * sizeof(short);
+	const unsigned short usBlockAlign = NUM_CHANNELS * sizeof(short);
+	const unsigned short usBitsPerSample = 16;
+
+	file.write("RIFF", 4);
+	file.write((const char*)&uiRiffSize, 4);
+	file.write("WAVEfmt ", 8);
+	file.write((const char*)&uiFmtSize, 4);
+	file.write((const char*)&usFormat, 2);
+	file.write((const char*)&usChannels, 2);
+	file.write((const char*)&uiSampleRate, 4);
+	file.write((const char*)&uiByteRate, 4);
+	file.write((const char*)&usBlockAlign, 2);
+	file.write((const char*)&usBitsPerSample, 2);
+	file.write("data", 4);
+	file.write((const char*)&uiDataSize, 4);
+	if (!vOutput.empty())
+		file.write((const char*)&vOutput[0], uiDataSize);
+
+	return file.good();
+}
+
+/**
+ @brief Get the number of frames mixed
+ */
+unsigned long long COfflineSoundBackend::GetNumMixedFrames(void) const
+{
+	return ullNumMixedFrames;
+}
+
+/**
+ @brief Get the time taken to mix the frames in milliseconds
+ */
+double COfflineSoundBackend::GetMixTime(void) const
+{
+	return dMixTime;
+}
+
+/**
+ @brief Print out details about this class instance in the console window
+ */
+void COfflineSoundBackend::PrintSelf(void) const
+{
+	cout << "COfflineSoundBackend::PrintSelf()" << endl;
+	cout << "Sound sources: " << mSources.size() << ", voices: " << mVoices.size() << endl;
+	cout << "Mixed " << ullNumMixedFrames << " frames in " << dMixTime << " ms";
+	if (dMixTime > 0.0)
+		cout << " (" << (ullNumMixedFrames / (double)SAMPLE_RATE) / (dMixTime / 1000.0) << "x real time)";
+	cout << endl;
+}
+
+/**
+ @brief Decode the content of a PCM WAV file, converting it to NUM_CHANNELS channels at SAMPLE_RATE
+ @param vContent The content of the file
+ @param sSource The source to decode into
+ @return true if the file was decoded, else false
+ */
+bool COfflineSoundBackend::DecodeWAV(const std::vector<char>& vContent, Source& sSource) const
+{
+	if ((vContent.size() < 12) || (memcmp(&vContent[0], "RIFF", 4) != 0) || (memcmp(&vContent[8], "WAVE", 4) != 0))
+		return false;
+
+	unsigned short usFormat = 0, usChannels = 0, usBitsPerSample = 0;
+	unsigned int uiSampleRate = 0;
+	const char* pData = nullptr;
+	unsigned int uiDataSize = 0;
+
+	// Find the fmt and data chunks
+	size_t uiOffset = 12;
+	while (uiOffset + 8 <= vContent.size())
+	{
+		unsigned int uiChunkSize = 0;
+		memcpy(&uiChunkSize, &vContent[uiOffset + 4], 4);
+		const size_t uiChunkStart = uiOffset + 8;
+		const size_t uiChunkEnd = std::min(vContent.size(), uiChunkStart + uiChunkSize);
+
+		if ((memcmp(&vContent[uiOffset], "fmt ", 4) == 0) && (uiChunkEnd - uiChunkStart >= 16))
+		{
+			memcpy(&usFormat, &vContent[uiChunkStart], 2);
+			memcpy(&usChannels, &vContent[uiChunkStart + 2], 2);
+			memcpy(&uiSampleRate, &vContent[uiChunkStart + 4], 4);
+			memcpy(&usBitsPerSample, &vContent[uiChunkStart + 14], 2);
+		}
+		else if (memcmp(&vContent[uiOffset], "data", 4) == 0)
+		{
+			pData = &vContent[uiChunkStart];
+			uiDataSize = (unsigned int)(uiChunkEnd - uiChunkStart);
+		}
+
+		// The chunks are padded to an even size
+		uiOffset = uiChunkStart + uiChunkSize + (uiChunkSize & 1);
+	}
+
+	// 1 is integer PCM, 3 is float PCM and 0xFFFE is WAVE_FORMAT_EXTENSIBLE, which is read by its bits per sample
+	const bool bIsFloat = (usFormat == 3);
+	if ((pData == nullptr) || (usChannels == 0) || (uiSampleRate == 0) ||
+		((usFormat != 1) && (usFormat != 3) && (usFormat != 0xFFFE)) ||
+		((bIsFloat) && (usBitsPerSample != 32)) ||
+		((!bIsFloat) && (usBitsPerSample != 8) && (usBitsPerSample != 16)))
+		return false;
+
+	const unsigned int uiBytesPerSample = usBitsPerSample / 8;
+	const unsigned int uiNumSrcFrames = uiDataSize / (uiBytesPerSample * usChannels);
+	if (uiNumSrcFrames == 0)
+		return false;
+
+	// Read a sample of a source frame as a float from -1 to 1
+	auto ReadSample = [&](const unsigned int uiFrame, const unsigned int uiChannel) -> float
+	{
+		const char* pSample = pData + (uiFrame * usChannels + std::min(uiChannel, (unsigned int)usChannels - 1)) * uiBytesPerSample;
+		if (bIsFloat)
+		{
+			float fSample;
+			memcpy(&fSample, pSample, 4);
+			return fSample;
+		}
+		if (usBitsPerSample == 8)
+			return ((unsigned char)*pSample - 128) / 128.0f;
+		short sSample;
+		memcpy(&sSample, pSample, 2);
+		return sSample / 32768.0f;
+	};
+
+	// Resample to SAMPLE_RATE with linear interpolation
+	const double dStep = (double)uiSampleRate / SAMPLE_RATE;
+	sSource.uiNumFrames = (unsigned int)((uiNumSrcFrames - 1) / dStep) + 1;
+	sSource.vSamples.resize(sSource.uiNumFrames * NUM_CHANNELS);
+	for (unsigned int i = 0; i < sSource.uiNumFrames; i++)
+	{
+		const double dPos = i * dStep;
+		const unsigned int uiFrame0 = (unsigned int)dPos;
+		const unsigned int uiFrame1 = std::min(uiFrame0 + 1, uiNumSrcFrames - 1);
+		const float fWeight = (float)(dPos - uiFrame0);
+		for (unsigned int uiChannel = 0; uiChannel < NUM_CHANNELS; uiChannel++)
+		{
+			const float fSample0 = ReadSample(uiFrame0, uiChannel);
+			const float fSample1 = ReadSample(uiFrame1, uiChannel);
+			sSource.vSamples[i * NUM_CHANNELS + uiChannel] = fSample0 + (fSample1 - fSample0) * fWeight;
+		}
+	}
+	return true;
+}
+
+/**
+ @brief Get the handle of a loaded source by its name and add a reference to it
+ @return The handle of the source, or 0 if it is not loaded
+ */
+unsigned int COfflineSoundBackend::FindSource(const std::string& filename)
+{
+	for (std::map<unsigned int, Source>::iterator it = mSources.begin(); it != mSources.end(); ++it)
+	{
+		if (it->second.sName == filename)
+		{
+			it->second.uiRefCount++;
+			return it->first;
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,120 @@
+/**
+ COfflineSoundBackend
+ @brief A CSoundBackend which mixes the sounds in software instead of playing them on an audio device.
+		It is used to run the game on machines without an audio device, to measure the cost of
+		mixing, and to compare the mixed output against a WAV file which was written before.
+		Only PCM WAV files are decoded. The 3D sounds are mixed as 2D sounds.
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#pragma once
+
+// Include CSoundBackend
+#include "SoundBackend.h"
+
+#include <map>
+
+class COfflineSoundBackend : public CSoundBackend
+{
+public:
+	// The sample rate of the mixed output. It is stereo 16-bit PCM.
+	static const unsigned int SAMPLE_RATE = 44100;
+	static const unsigned int NUM_CHANNELS = 2;
+
+	// Constructor
+	COfflineSoundBackend(void);
+	// Destructor
+	virtual ~COfflineSoundBackend(void);
+
+	virtual bool Init(void);
+	virtual const char* GetName(void) const;
+
+	virtual unsigned int LoadSource(const std::string& filename, const bool bStream, const bool bPreload);
+	virtual unsigned int LoadSourceFromMemory(const std::vector<char>& vContent, const std::string& filename);
+	virtual void ReleaseSource(const unsigned int uiSource);
+	virtual unsigned int GetSourceMemory(const unsigned int uiSource);
+	virtual float GetSourceVolume(const unsigned int uiSource);
+	virtual void SetSourceVolume(const unsigned int uiSource, const float fVolume);
+
+	virtual unsigned int Play2D(const unsigned int uiSource, const bool bIsLooped);
+	virtual unsigned int Play3D(const unsigned int uiSource, const glm::vec3& vec3Position, const bool bIsLooped);
+	virtual void StopVoice(const unsigned int uiVoice);
+	virtual bool IsVoiceFinished(const unsigned int uiVoice);
+	virtual unsigned int GetVoiceSource(const unsigned int uiVoice);
+	virtual void ReleaseVoice(const unsigned int uiVoice);
+	virtual void StopAll(void);
+
+	virtual float GetMasterVolume(void);
+	virtual void SetMasterVolume(const float fVolume);
+	virtual void SetListener(const glm::vec3& vec3Position, const glm::vec3& vec3Direction);
+
+	// Mix the frames which play in dElapsedTime seconds
+	virtual void Update(const double dElapsedTime);
+
+	virtual void PrintSelf(void) const;
+
+	// Mix a number of frames of the playing voices into pBuffer, which holds NUM_CHANNELS samples per frame
+	void Mix(short* pBuffer, const unsigned int uiNumFrames);
+
+	// Set whether the frames mixed by Update are kept, so that they can be read or written to a WAV file
+	void SetCaptureOutput(const bool bCaptureOutput);
+	// Get the frames mixed by Update since the capture was cleared
+	const std::vector<short>& GetOutput(void) const;
+	// Clear the captured frames
+	void ClearOutput(void);
+	// Write the captured frames to a WAV file
+	bool WriteWAV(const std::string& filename) const;
+
+	// Get the number of frames mixed, and the time taken to mix them in milliseconds
+	unsigned long long GetNumMixedFrames(void) const;
+	double GetMixTime(void) const;
+
+protected:
+	// A decoded sound
+	struct Source
+	{
+		std::string sName;
+		// The samples, converted to NUM_CHANNELS channels at SAMPLE_RATE
+		std::vector<float> vSamples;
+		unsigned int uiNumFrames;
+		float fVolume;
+		unsigned int uiRefCount;
+	};
+
+	// A sound which is playing
+	struct Voice
+	{
+		unsigned int uiSource;
+		// The next frame of the source to mix
+		unsigned int uiFrame;
+		bool bIsLooped;
+		bool bIsFinished;
+	};
+
+	// Decode the content of a PCM WAV file into a source
+	bool DecodeWAV(const std::vector<char>& vContent, Source& sSource) const;
+	// Get the handle of a loaded source by its name and add a reference to it, or return 0 if it is not loaded
+	unsigned int FindSource(const std::string& filename);
+
+	// The sources and voices by their handles
+	std::map<unsigned int, Source> mSources;
+	std::map<unsigned int, Voice> mVoices;
+	// The last handle given out for sources and voices
+	unsigned int uiLastHandle;
+
+	float fMasterVolume;
+
+	// The mix of the voices before it is converted to 16-bit samples
+	std::vector<float> vMixBuffer;
+	// The frames mixed by Update for the current frame, and the fraction of a frame which was left over
+	std::vector<short> vUpdateBuffer;
+	double dFrameRemainder;
+
+	// A bool which is true if the frames mixed by Update are kept in vOutput
+	bool bCaptureOutput;
+	std::vector<short> vOutput;
+
+	// The number of frames mixed, and the time taken to mix them in milliseconds
+	unsigned long long ullNumMixedFrames;
+	double dMixTime;
+};
@@ -0,0 +1,38 @@
+/**
+ CSoundBackend
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#include "SoundBackend.h"
+
+// Include the backends
+#include "IrrKlangSoundBackend.h"
+#include "OfflineSoundBackend.h"
+
+// Include CSettings
+#include <GameControl\Settings.h>
+
+/**
+ @brief Constructor
+ */
+CSoundBackend::CSoundBackend(void)
+{
+}
+
+/**
+ @brief Destructor
+ */
+CSoundBackend::~CSoundBackend(void)
+{
+}
+
+/**
+ @brief Create the backend chosen by CSettings: irrKlang, or the offline mixer if bOfflineAudio is set
+ @return The new backend, which belongs to the caller
+ */
+CSoundBackend* CSoundBackend::Create(void)
+{
+	if (CSettings::GetInstance()->bOfflineAudio)
+		return new COfflineSoundBackend();
+	return new CIrrKlangSoundBackend();
+}
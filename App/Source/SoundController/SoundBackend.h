@@ -0,0 +1,70 @@
+/**
+ CSoundBackend
+ @brief An interface between CSoundController and the audio library.
+		Sound sources and voices are referred to by handles, where 0 is not a valid handle,
+		so that CSoundController and CSoundInfo do not depend on the audio library.
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#pragma once
+
+// Include GLM
+#include <includes/glm.hpp>
+
+#include <string>
+#include <vector>
+
+class CSoundBackend
+{
+public:
+	// Constructor
+	CSoundBackend(void);
+	// Destructor
+	virtual ~CSoundBackend(void);
+
+	// Create the backend chosen by CSettings: irrKlang, or the offline mixer if bOfflineAudio is set
+	static CSoundBackend* Create(void);
+
+	// Initialise the audio library
+	virtual bool Init(void) = 0;
+	// Get the name of this backend
+	virtual const char* GetName(void) const = 0;
+
+	// Load a sound source from a file. A file which was loaded already shares its sound source.
+	virtual unsigned int LoadSource(const std::string& filename, const bool bStream, const bool bPreload) = 0;
+	// Load a sound source from the content of a file. The filename is used to share the sound source and to tell the format.
+	virtual unsigned int LoadSourceFromMemory(const std::vector<char>& vContent, const std::string& filename) = 0;
+	// Release a sound source which was returned by LoadSource or LoadSourceFromMemory
+	virtual void ReleaseSource(const unsigned int uiSource) = 0;
+	// Get the memory used by the decoded samples of a sound source in bytes
+	virtual unsigned int GetSourceMemory(const unsigned int uiSource) = 0;
+	// Get and set the volume of a sound source, from 0 to 1
+	virtual float GetSourceVolume(const unsigned int uiSource) = 0;
+	virtual void SetSourceVolume(const unsigned int uiSource, const float fVolume) = 0;
+
+	// Play a sound source, returning the handle of its voice
+	virtual unsigned int Play2D(const unsigned int uiSource, const bool bIsLooped) = 0;
+	virtual unsigned int Play3D(const unsigned int uiSource, const glm::vec3& vec3Position, const bool bIsLooped) = 0;
+	// Stop a voice
+	virtual void StopVoice(const unsigned int uiVoice) = 0;
+	// Check if a voice has finished playing
+	virtual bool IsVoiceFinished(const unsigned int uiVoice) = 0;
+	// Get the sound source of a voice
+	virtual unsigned int GetVoiceSource(const unsigned int uiVoice) = 0;
+	// Release a voice which was returned by Play2D or Play3D
+	virtual void ReleaseVoice(const unsigned int uiVoice) = 0;
+	// Stop all the voices
+	virtual void StopAll(void) = 0;
+
+	// Get and set the master volume, from 0 to 1
+	virtual float GetMasterVolume(void) = 0;
+	virtual void SetMasterVolume(const float fVolume) = 0;
+	// Set the position and view direction of the listener of the 3D sounds
+	virtual void SetListener(const glm::vec3& vec3Position, const glm::vec3& vec3Direction) = 0;
+
+	// Advance the playback by dElapsedTime seconds. A backend which mixes on its own thread does nothing here.
+	virtual void Update(const double dElapsedTime) = 0;
+
+	// Print out details about this class instance in the console window
+	virtual void PrintSelf(void) const = 0;
+};
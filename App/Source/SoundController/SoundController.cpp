@@ -1,5 +1,12 @@
 #include "SoundController.h"
 
+// Include CAssetLoader to read the sound files on its worker threads
+#include <System\AssetLoader.h>
+// Include FileSystem
+#include <System\filesystem.h>
+
+#include <set>
+#include <fstream>
 #include <iostream>
 using namespace std;
 
@@ -7,10 +14,18 @@ using namespace std;
  @brief Constructor
  */
 CSoundController::CSoundController(void)
-	: cSoundEngine(NULL)
-	, vec3dfListenerPos(vec3df(0, 0, 0))
-	, vec3dfListenerDir(vec3df(0, 0, 1))
+	: pBackend(NULL)
+	, vec3ListenerPos(glm::vec3(0, 0, 0))
+	, vec3ListenerDir(glm::vec3(0, 0, 1))
+	, uiNumVoiceSteals(0)
+	, uiNumPlays(0)
+	, dPlayTime(0.0)
 {
+	// One music track at a time, so a new track replaces the old one
+	uiVoiceCaps[CSoundInfo::MUSIC] = 1;
+	// Enough effects for a few rapid block breaks to overlap
+	uiVoiceCaps[CSoundInfo::EFFECT] = 8;
+	uiVoiceCaps[CSoundInfo::UI] = 2;
 }
 
 /**
@@ -18,6 +33,9 @@ CSoundController::CSoundController(void)
  */
 CSoundController::~CSoundController(void)
 {
+	// Drop the voices before the sound sources which they play
+	ReleaseAllVoices();
+
 	//// Iterate through the entityMap
 	//for (std::map<int, CSoundInfo*>::iterator it = soundMap.begin(); it != soundMap.end(); ++it)
 	//{
@@ -44,31 +62,61 @@ CSoundController::~CSoundController(void)
 	//soundMap.clear();
 	soundMapByName.clear();
 
-	// Since we have already dropped the ISoundSource, then we don't need to delete the cSoundEngine
-	//// Clear the sound engine
-	//if (cSoundEngine)
-	//{
-	//	cSoundEngine->drop();
-	//	cSoundEngine = NULL;
-	//}
+	// Delete the backend after the CSoundInfo, which release their sound sources to it
+	if (pBackend)
+	{
+		delete pBackend;
+		pBackend = NULL;
+	}
 }
 
 /**
  @brief Initialise this class instance
+ @param pBackend The backend which plays the sounds. nullptr keeps the current backend,
+		or creates the one chosen by CSettings if there is none.
  @return A bool value. true is this class instance was initialised, else false
  */
-bool CSoundController::Init(void)
+bool CSoundController::Init(CSoundBackend* pBackend)
 {
-	// Initialise the sound engine with default parameters
-	cSoundEngine = createIrrKlangDevice(ESOD_WIN_MM, ESEO_MULTI_THREADED);
-	if (cSoundEngine == NULL)
+	if ((pBackend == nullptr) && (this->pBackend != nullptr))
+		return true;
+
+	// The sounds and voices belong to the previous backend
+	if (this->pBackend != nullptr)
+	{
+		ReleaseAllVoices();
+		for (std::map<string, CSoundInfo*>::iterator it = soundMapByName.begin(); it != soundMapByName.end(); ++it)
+			delete it->second;
+		soundMapByName.clear();
+		delete this->pBackend;
+	}
+
+	this->pBackend = (pBackend != nullptr ? pBackend : CSoundBackend::Create());
+	if (this->pBackend->Init() == false)
 	{
-		cout << "Unable to initialise the IrrKlang sound engine" << endl;
+		cout << "Unable to initialise the " << this->pBackend->GetName() << " sound backend" << endl;
 		return false;
 	}
 	return true;
 }
 
+/**
+ @brief Get the backend which plays the sounds
+ */
+CSoundBackend* CSoundController::GetBackend(void) const
+{
+	return pBackend;
+}
+
+/**
+ @brief Advance the backend, which mixes the sounds if it does not have an audio device
+ @param dElapsedTime The time since the last Update in seconds
+ */
+void CSoundController::Update(const double dElapsedTime)
+{
+	pBackend->Update(dElapsedTime);
+}
+
 /**
  @brief Load a sound
  @param filename A string variable storing the name of the file to read from
@@ -76,7 +124,7 @@ bool CSoundController::Init(void)
  @param bPreload A const bool variable which indicates if this iSoundSource will be pre-loaded into memory now.
  @param bIsLooped A const bool variable which indicates if this iSoundSource will have loop playback.
  @param eSoundType A SOUNDTYPE enum variable which states the type of sound
- @param vec3dfSoundPos A vec3df variable which contains the 3D position of the sound
+ @param vec3SoundPos A glm::vec3 variable which contains the 3D position of the sound
  @return A bool value. True if the sound was loaded, else false.
  */
 bool CSoundController::LoadSound(	string filename,
@@ -84,38 +132,117 @@ bool CSoundController::LoadSound(	string filename,
 									const bool bPreload,
 									const bool bIsLooped,
 									CSoundInfo::SOUNDTYPE eSoundType,
-									vec3df vec3dfSoundPos)
+									glm::vec3 vec3SoundPos)
 {
+	// Long sounds, such as the background music, are streamed from the file instead of being decoded into memory
+	const bool bStream = ShouldStream(filename);
+
 	// Load the sound from the file
-	ISoundSource* pSoundSource = cSoundEngine->addSoundSourceFromFile(filename.c_str(),
-																	E_STREAM_MODE::ESM_NO_STREAMING, 
-																	bPreload);
+	const unsigned int uiSource = pBackend->LoadSource(filename, bStream, bPreload);
+
+	// Trivial Rejection : Invalid handle provided
+	if (uiSource == 0)
+	{
+		cout << "Unable to load sound " << filename.c_str() << endl;
+		return false;
+	}
+
+	AddSound(uiSource, name, bIsLooped, eSoundType, vec3SoundPos)->SetStreamed(bStream);
+
+	return true;
+}
+
+/**
+ @brief Load a sound from the content of a file which was read elsewhere, e.g. by CAssetLoader
+ @param vContent The content of the sound file
+ @param filename A string variable storing the name of the file which was read. Its extension tells the backend the format.
+ @param name The name of the sound in the map
+ @param bIsLooped A const bool variable which indicates if this iSoundSource will have loop playback.
+ @param eSoundType A SOUNDTYPE enum variable which states the type of sound
+ @param vec3SoundPos A glm::vec3 variable which contains the 3D position of the sound
+ @return A bool value. True if the sound was loaded, else false.
+ */
+bool CSoundController::LoadSoundFromMemory(	const std::vector<char>& vContent,
+											string filename,
+											const string name,
+											const bool bIsLooped,
+											CSoundInfo::SOUNDTYPE eSoundType,
+											glm::vec3 vec3SoundPos)
+{
+	if (vContent.empty())
+	{
+		cout << "Unable to load sound " << filename.c_str() << endl;
+		return false;
+	}
 
+	// The backend shares the sound source if this file was loaded already, and copies the content otherwise
+	const unsigned int uiSource = pBackend->LoadSourceFromMemory(vContent, filename);
 
-	// Trivial Rejection : Invalid pointer provided
-	if (pSoundSource == nullptr)
+	// Trivial Rejection : Invalid handle provided
+	if (uiSource == 0)
 	{
 		cout << "Unable to load sound " << filename.c_str() << endl;
 		return false;
 	}
 
-	// Force the sound source not to have any streaming
-	pSoundSource->setForcedStreamingThreshold(-1);
+	AddSound(uiSource, name, bIsLooped, eSoundType, vec3SoundPos);
 
+	return true;
+}
+
+/**
+ @brief Read a sound file on a worker thread of CAssetLoader, and load it when CAssetLoader runs its upload step
+ @param filename The name of the file, relative to the root directory of the assets
+ @param name The name of the sound in the map
+ @param bIsLooped A const bool variable which indicates if this iSoundSource will have loop playback.
+ */
+void CSoundController::PreloadSound(const string filename,
+									const string name,
+									const bool bIsLooped)
+{
+	// A long sound is streamed from its file, so there is nothing to read in advance
+	if (ShouldStream(FileSystem::getPath(filename)))
+	{
+		LoadSound(FileSystem::getPath(filename), name, false, bIsLooped);
+		return;
+	}
+
+	CAssetLoader::GetInstance()->PreloadFile(filename,
+		[this, filename, name, bIsLooped](const std::vector<char>& vContent)
+		{
+			LoadSoundFromMemory(vContent, FileSystem::getPath(filename), name, bIsLooped);
+		});
+}
+
+/**
+ @brief Add a loaded sound source to the map of sounds
+ @return The CSoundInfo of the sound
+ */
+CSoundInfo* CSoundController::AddSound(	const unsigned int uiSource,
+										const string name,
+										const bool bIsLooped,
+										CSoundInfo::SOUNDTYPE eSoundType,
+										glm::vec3 vec3SoundPos)
+{
 	// Clean up first if there is an existing Entity with the same name
 	RemoveSound(name);
 
 	// Add the entity now
 	CSoundInfo* cSoundInfo = new CSoundInfo();
 	if (eSoundType == CSoundInfo::SOUNDTYPE::_2D)
-		cSoundInfo->Init(name, pSoundSource, bIsLooped);
+		cSoundInfo->Init(name, pBackend, uiSource, bIsLooped);
 	else
-		cSoundInfo->Init(name, pSoundSource, bIsLooped, eSoundType, vec3dfSoundPos);
+		cSoundInfo->Init(name, pBackend, uiSource, bIsLooped, eSoundType, vec3SoundPos);
+
+	// Apply the category set by SetSoundCategory
+	std::map<string, CSoundInfo::SOUNDCATEGORY>::iterator it = mSoundCategories.find(name);
+	if (it != mSoundCategories.end())
+		cSoundInfo->SetCategory(it->second);
 
 	// Set to soundMap
 	soundMapByName[name] = cSoundInfo;
 
-	return true;
+	return cSoundInfo;
 }
 
 /**
@@ -150,6 +277,10 @@ bool CSoundController::LoadSound(	string filename,
 	}
 }*/
 
+/**
+ @brief Play a sound by its name. If its category is at its voice cap, the oldest sound of the category is stopped.
+ @param name The name of the sound
+ */
 void CSoundController::PlaySoundByName(const string name)
 {
 	CSoundInfo* pSoundInfo = GetSound(name);
@@ -158,24 +289,51 @@ void CSoundController::PlaySoundByName(const string name)
 		cout << "Sound #" << name << " is not playable." << endl;
 		return;
 	}
-	else if (cSoundEngine->isCurrentlyPlaying(pSoundInfo->GetSound()))
+
+	cPlayTimer.StartTimer();
+
+	const CSoundInfo::SOUNDCATEGORY eCategory = pSoundInfo->GetCategory();
+	ReleaseFinishedVoices(eCategory);
+
+	// A looped sound which is playing is not restarted
+	if (pSoundInfo->GetLoopStatus())
 	{
-		cout << "Sound #" << name << " is currently being played." << endl;
-		return;
+		for (unsigned int i = 0; i < dVoices[eCategory].size(); i++)
+		{
+			if (pBackend->GetVoiceSource(dVoices[eCategory][i]) == pSoundInfo->GetSound())
+				return;
+		}
 	}
 
+	// Steal the oldest voices of this category
+	while ((!dVoices[eCategory].empty()) && (dVoices[eCategory].size() >= uiVoiceCaps[eCategory]))
+	{
+		pBackend->StopVoice(dVoices[eCategory].front());
+		pBackend->ReleaseVoice(dVoices[eCategory].front());
+		dVoices[eCategory].pop_front();
+		uiNumVoiceSteals++;
+	}
+	if (uiVoiceCaps[eCategory] == 0)
+		return;
+
+	// Keep the handle of the new voice, so that it can be stolen later
+	unsigned int uiVoice = 0;
 	if (pSoundInfo->GetSoundType() == CSoundInfo::SOUNDTYPE::_2D)
 	{
-		cSoundEngine->play2D(pSoundInfo->GetSound(),
-			pSoundInfo->GetLoopStatus());
+		uiVoice = pBackend->Play2D(pSoundInfo->GetSound(), pSoundInfo->GetLoopStatus());
 	}
 	else if (pSoundInfo->GetSoundType() == CSoundInfo::SOUNDTYPE::_3D)
 	{
-		cSoundEngine->setListenerPosition(vec3dfListenerPos, vec3dfListenerDir);
-		cSoundEngine->play3D(pSoundInfo->GetSound(),
+		pBackend->SetListener(vec3ListenerPos, vec3ListenerDir);
+		uiVoice = pBackend->Play3D(pSoundInfo->GetSound(),
 			pSoundInfo->GetPosition(),
 			pSoundInfo->GetLoopStatus());
 	}
+	if (uiVoice != 0)
+		dVoices[eCategory].push_back(uiVoice);
+
+	uiNumPlays++;
+	dPlayTime += cPlayTimer.GetElapsedTime() * 1000.0;
 }
 
 /**
@@ -183,7 +341,100 @@ void CSoundController::PlaySoundByName(const string name)
  */
 void CSoundController::StopAllSound()
 {
-	cSoundEngine->stopAllSounds();
+	pBackend->StopAll();
+	ReleaseAllVoices();
+}
+
+/**
+ @brief Set the category of a sound, which decides its voice cap
+ @param name The name of the sound, which does not need to be loaded yet
+ @param eCategory The new category of the sound
+ */
+void CSoundController::SetSoundCategory(const string name, const CSoundInfo::SOUNDCATEGORY eCategory)
+{
+	mSoundCategories[name] = eCategory;
+
+	CSoundInfo* pSoundInfo = GetSound(name);
+	if (pSoundInfo)
+		pSoundInfo->SetCategory(eCategory);
+}
+
+/**
+ @brief Set the number of sounds of a category which can play at once
+ @param eCategory The category
+ @param uiVoiceCap The number of sounds. 0 mutes the category.
+ */
+void CSoundController::SetVoiceCap(const CSoundInfo::SOUNDCATEGORY eCategory, const unsigned int uiVoiceCap)
+{
+	uiVoiceCaps[eCategory] = uiVoiceCap;
+}
+
+/**
+ @brief Get the number of sounds which are playing
+ */
+unsigned int CSoundController::GetNumActiveVoices(void)
+{
+	unsigned int uiNumVoices = 0;
+	for (int i = 0; i < CSoundInfo::NUM_SOUNDCATEGORY; i++)
+	{
+		ReleaseFinishedVoices((CSoundInfo::SOUNDCATEGORY)i);
+		uiNumVoices += (unsigned int)dVoices[i].size();
+	}
+	return uiNumVoices;
+}
+
+/**
+ @brief Get the number of voices which were stopped to play a new sound
+ */
+unsigned int CSoundController::GetNumVoiceSteals(void) const
+{
+	return uiNumVoiceSteals;
+}
+
+/**
+ @brief Get the memory used by the sounds which are decoded into memory, in bytes.
+		The streamed sounds only use a small buffer, which is not counted.
+ */
+unsigned int CSoundController::GetAudioMemory(void) const
+{
+	// A sound source may be shared by several names
+	std::set<unsigned int> setSources;
+	unsigned int uiNumBytes = 0;
+	for (std::map<string, CSoundInfo*>::const_iterator it = soundMapByName.begin(); it != soundMapByName.end(); ++it)
+	{
+		if ((it->second->GetStreamed()) || (setSources.insert(it->second->GetSound()).second == false))
+			continue;
+		uiNumBytes += pBackend->GetSourceMemory(it->second->GetSound());
+	}
+	return uiNumBytes;
+}
+
+/**
+ @brief Get the average time taken by PlaySoundByName in milliseconds
+ */
+double CSoundController::GetAveragePlayTime(void) const
+{
+	return (uiNumPlays > 0 ? dPlayTime / uiNumPlays : 0.0);
+}
+
+/**
+ @brief Print out details about this class instance in the console window
+ */
+void CSoundController::PrintSelf(void)
+{
+	unsigned int uiNumStreamed = 0;
+	for (std::map<string, CSoundInfo*>::const_iterator it = soundMapByName.begin(); it != soundMapByName.end(); ++it)
+	{
+		if (it->second->GetStreamed())
+			uiNumStreamed++;
+	}
+
+	cout << "CSoundController::PrintSelf()" << endl;
+	cout << "Backend: " << pBackend->GetName() << endl;
+	cout << "Sounds: " << soundMapByName.size() << " (" << uiNumStreamed << " streamed), audio memory: "
+		 << GetAudioMemory() / 1024 << " KB" << endl;
+	cout << "Voices: " << GetNumActiveVoices() << ", voice steals: " << uiNumVoiceSteals << endl;
+	cout << "Sounds played: " << uiNumPlays << ", average PlaySoundByName time: " << GetAveragePlayTime() << " ms" << endl;
 }
 
 /**
@@ -193,14 +444,14 @@ void CSoundController::StopAllSound()
 bool CSoundController::MasterVolumeIncrease(void)
 {
 	// Get the current volume
-	float fCurrentVolume = cSoundEngine->getSoundVolume();
+	float fCurrentVolume = pBackend->GetMasterVolume();
 
 	// Check if the maximum volume has been reached
 	if (fCurrentVolume == 1.0f)
 		return false;
 
 	// Increase the volume by 10%
-	cSoundEngine->setSoundVolume(fCurrentVolume + 0.1f);
+	pBackend->SetMasterVolume(fCurrentVolume + 0.1f);
 
 	return true;
 }
@@ -212,77 +463,49 @@ bool CSoundController::MasterVolumeIncrease(void)
 bool CSoundController::MasterVolumeDecrease(void)
 {
 	// Get the current volume
-	float fCurrentVolume = cSoundEngine->getSoundVolume();
+	float fCurrentVolume = pBackend->GetMasterVolume();
 
 	// Check if the minimum volume has been reached
 	if (fCurrentVolume == 0.0f)
 		return false;
 
 	// Decrease the volume by 10%
-	cSoundEngine->setSoundVolume(fCurrentVolume - 0.1f);
+	pBackend->SetMasterVolume(fCurrentVolume - 0.1f);
 
 	return true;
 }
 
 
 /**
- @brief Increase volume of a ISoundSource
- @param ID A const int variable which contains the ID of the iSoundSource in the map
- @return true if successfully decreased volume, else false
+ @brief Increase volume of a sound
+ @param name The name of the sound
+ @return true if successfully increased volume, else false
  */
 bool CSoundController::VolumeIncrease(const string name)
 {
-	// Get the ISoundSource
-	ISoundSource* pISoundSource = GetSound(name)->GetSound();
-	if (pISoundSource != nullptr)
-	{
-		return false;
-	}
-
-	// Get the current volume
-	float fCurrentVolume = pISoundSource->getDefaultVolume();
-
-	// Check if the maximum volume has been reached
-	if (fCurrentVolume >= 1.0f)
+	CSoundInfo* pSoundInfo = GetSound(name);
+	if (pSoundInfo == nullptr)
 	{
-		pISoundSource->setDefaultVolume(1.0f);
 		return false;
 	}
 
-	// Increase the volume by 10%
-	pISoundSource->setDefaultVolume(fCurrentVolume + 0.1f);
-
-	return true;
+	return pSoundInfo->VolumeIncrease();
 }
 
 /**
- @brief Decrease volume of a ISoundSource
- @param ID A const int variable which contains the ID of the iSoundSource in the map
+ @brief Decrease volume of a sound
+ @param name The name of the sound
  @return true if successfully decreased volume, else false
  */
 bool CSoundController::VolumeDecrease(const string name)
 {
-	// Get the ISoundSource
-	ISoundSource* pISoundSource = GetSound(name)->GetSound();
-	if (pISoundSource != nullptr)
-	{
-		return false;
-	}
-
-	// Get the current volume
-	float fCurrentVolume = pISoundSource->getDefaultVolume();
-
-	// Check if the minimum volume has been reached
-	if (fCurrentVolume <= 0.0f)
+	CSoundInfo* pSoundInfo = GetSound(name);
+	if (pSoundInfo == nullptr)
 	{
-		pISoundSource->setDefaultVolume(0.0f);
 		return false;
 	}
 
-	// Decrease the volume by 10%
-	pISoundSource->setDefaultVolume(fCurrentVolume - 0.1f);
-
-	return true;
+	return pSoundInfo->VolumeDecrease();
 }
 
 // For 3D sounds only
@@ -294,7 +517,7 @@ bool CSoundController::VolumeDecrease(const string name)
  */
 void CSoundController::SetListenerPosition(const float x, const float y, const float z)
 {
-	vec3dfListenerPos.set(x, y, z);
+	vec3ListenerPos = glm::vec3(x, y, z);
 }
 
 /**
@@ -305,7 +528,50 @@ void CSoundController::SetListenerPosition(const float x, const float y, const f
  */
 void CSoundController::SetListenerDirection(const float x, const float y, const float z)
 {
-	vec3dfListenerDir.set(x, y, z);
+	vec3ListenerDir = glm::vec3(x, y, z);
+}
+
+/**
+ @brief Check if a sound file should be streamed from disk, because it is at least STREAMING_THRESHOLD bytes
+ @param filename The full path of the sound file
+ */
+bool CSoundController::ShouldStream(const string filename)
+{
+	std::ifstream file(filename.c_str(), std::ios::binary | std::ios::ate);
+	if (!file.is_open())
+		return false;
+	return file.tellg() >= (std::streamoff)STREAMING_THRESHOLD;
+}
+
+/**
+ @brief Drop the voices of a category which have finished playing
+ */
+void CSoundController::ReleaseFinishedVoices(const CSoundInfo::SOUNDCATEGORY eCategory)
+{
+	std::deque<unsigned int>::iterator it = dVoices[eCategory].begin();
+	while (it != dVoices[eCategory].end())
+	{
+		if (pBackend->IsVoiceFinished(*it))
+		{
+			pBackend->ReleaseVoice(*it);
+			it = dVoices[eCategory].erase(it);
+		}
+		else
+			++it;
+	}
+}
+
+/**
+ @brief Drop all the voices
+ */
+void CSoundController::ReleaseAllVoices(void)
+{
+	for (int i = 0; i < CSoundInfo::NUM_SOUNDCATEGORY; i++)
+	{
+		for (unsigned int j = 0; j < dVoices[i].size(); j++)
+			pBackend->ReleaseVoice(dVoices[i][j]);
+		dVoices[i].clear();
+	}
 }
 
 /**
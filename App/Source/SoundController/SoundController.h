@@ -8,26 +8,39 @@
 // Include SingletonTemplate
 #include <DesignPatterns\SingletonTemplate.h>
 
-// Include GLEW
-#include <includes/irrKlang.h>
-using namespace irrklang;
-#pragma comment(lib, "irrKlang.lib") // link with irrKlang.dll
+// Include CSoundBackend, which plays the sounds with irrKlang or mixes them offline
+#include "SoundBackend.h"
 
 // Include string
 #include <string>
 // Include map storage
 #include <map>
+// Include vector
+#include <vector>
+// Include deque
+#include <deque>
 using namespace std;
 
 // Include SoundInfo class; it stores the sound and other information
 #include "SoundInfo.h"
 
+// Include CStopWatch to measure the cost of playing sounds
+#include <TimeControl\StopWatch.h>
+
 class CSoundController : public CSingletonTemplate<CSoundController>
 {
 	friend CSingletonTemplate<CSoundController>;
 public:
-	// Initialise this class instance
-	bool Init(void);
+	// Sound files of this size in bytes or larger are streamed from disk instead of being decoded into memory
+	static const unsigned int STREAMING_THRESHOLD = 256 * 1024;
+
+	// Initialise this class instance with a backend, which belongs to this class instance after this
+	bool Init(CSoundBackend* pBackend = nullptr);
+	// Get the backend which plays the sounds
+	CSoundBackend* GetBackend(void) const;
+
+	// Advance the backend, which mixes the sounds if it does not have an audio device
+	void Update(const double dElapsedTime);
 
 	// Load a sound
 	bool LoadSound(	string filename, 
@@ -35,7 +48,18 @@ public:
 					const bool bPreload = true,
 					const bool bIsLooped = false,
 					CSoundInfo::SOUNDTYPE eSoundType = CSoundInfo::SOUNDTYPE::_2D,
-					vec3df vec3dfSoundPos = vec3df(0.0f, 0.0f, 0.0f));
+					glm::vec3 vec3SoundPos = glm::vec3(0.0f, 0.0f, 0.0f));
+	// Load a sound from the content of a file which was read elsewhere, e.g. by CAssetLoader
+	bool LoadSoundFromMemory(	const std::vector<char>& vContent,
+								string filename,
+								const string name,
+								const bool bIsLooped = false,
+								CSoundInfo::SOUNDTYPE eSoundType = CSoundInfo::SOUNDTYPE::_2D,
+								glm::vec3 vec3SoundPos = glm::vec3(0.0f, 0.0f, 0.0f));
+	// Read a sound file on a worker thread of CAssetLoader, and load it when CAssetLoader runs its upload step
+	void PreloadSound(	const string filename,
+						const string name,
+						const bool bIsLooped = false);
 
 	// Play a sound by its ID
 	void PlaySoundByID(const int ID);
@@ -46,14 +70,31 @@ public:
 	// Stop all active sounds
 	void StopAllSound();
 
+	// Set the category of a sound, which decides its voice cap. It is kept if the sound is loaded again.
+	void SetSoundCategory(const string name, const CSoundInfo::SOUNDCATEGORY eCategory);
+	// Set the number of sounds of a category which can play at once
+	void SetVoiceCap(const CSoundInfo::SOUNDCATEGORY eCategory, const unsigned int uiVoiceCap);
+
+	// Get the number of sounds which are playing
+	unsigned int GetNumActiveVoices(void);
+	// Get the number of voices which were stopped to play a new sound
+	unsigned int GetNumVoiceSteals(void) const;
+	// Get the memory used by the sounds which are decoded into memory, in bytes
+	unsigned int GetAudioMemory(void) const;
+	// Get the average time taken by PlaySoundByName in milliseconds
+	double GetAveragePlayTime(void) const;
+
+	// Print out details about this class instance in the console window
+	void PrintSelf(void);
+
 	// Increase Master volume
 	bool MasterVolumeIncrease(void);
 	// Decrease Master volume
 	bool MasterVolumeDecrease(void);
 
-	// Increase volume of a ISoundSource
+	// Increase volume of a sound
 	bool VolumeIncrease(const string ID);
-	// Decrease volume of a ISoundSource
+	// Decrease volume of a sound
 	bool VolumeDecrease(const string ID);
 
 	// For 3D sounds only
@@ -75,9 +116,23 @@ protected:
 	bool RemoveSound(const string ID);
 	// Get the number of sounds in this map
 	int GetNumOfSounds(void) const;
+	// Check if a sound file should be streamed from disk
+	static bool ShouldStream(const string filename);
+
+	// Drop the voices of a category which have finished playing
+	void ReleaseFinishedVoices(const CSoundInfo::SOUNDCATEGORY eCategory);
+	// Drop all the voices
+	void ReleaseAllVoices(void);
+
+	// Add a loaded sound source to the map of sounds
+	CSoundInfo* AddSound(	const unsigned int uiSource,
+							const string name,
+							const bool bIsLooped,
+							CSoundInfo::SOUNDTYPE eSoundType,
+							glm::vec3 vec3SoundPos);
 
-	// The handler to the irrklang Sound Engine
-	ISoundEngine* cSoundEngine;
+	// The backend which plays the sounds
+	CSoundBackend* pBackend;
 
 	// The map of all the entity created
 	std::map<int, CSoundInfo*> soundMap;
@@ -86,8 +141,22 @@ protected:
 	std::map<string, CSoundInfo*> soundMapByName;
 
 	// For 3D sound only: Listener position
-	vec3df vec3dfListenerPos;
+	glm::vec3 vec3ListenerPos;
 	// For 3D sound only: Listender view direction
-	vec3df vec3dfListenerDir;
+	glm::vec3 vec3ListenerDir;
+
+	// The sounds which are playing in each category, from the oldest to the newest
+	std::deque<unsigned int> dVoices[CSoundInfo::NUM_SOUNDCATEGORY];
+	// The categories set by SetSoundCategory, keyed by the name of the sound
+	std::map<string, CSoundInfo::SOUNDCATEGORY> mSoundCategories;
+	// The number of sounds of each category which can play at once
+	unsigned int uiVoiceCaps[CSoundInfo::NUM_SOUNDCATEGORY];
+	// The number of voices which were stopped to play a new sound
+	unsigned int uiNumVoiceSteals;
+
+	// The number of sounds played, and the time taken by PlaySoundByName in milliseconds
+	unsigned int uiNumPlays;
+	double dPlayTime;
+	CStopWatch cPlayTimer;
 };
 
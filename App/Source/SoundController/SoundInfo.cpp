@@ -8,10 +8,13 @@ using namespace std;
  */
 CSoundInfo::CSoundInfo(void)
 	: ID(-1)
-	, pSoundSource(NULL)
+	, pBackend(NULL)
+	, uiSource(0)
 	, bIsLooped(false)
 	, eSoundType(_2D)
-	, vec3dfSoundPos(vec3df(0.0, 0.0, 0.0))
+	, eCategory(EFFECT)
+	, bIsStreamed(false)
+	, vec3SoundPos(glm::vec3(0.0f, 0.0f, 0.0f))
 {
 }
 
@@ -21,45 +24,50 @@ CSoundInfo::CSoundInfo(void)
 CSoundInfo::~CSoundInfo(void)
 {
 	// Clear the memory before destroying this class instance
-	if (pSoundSource != NULL)
+	if ((pBackend != NULL) && (uiSource != 0))
 	{
-		pSoundSource->drop();
-		pSoundSource = NULL;
+		pBackend->ReleaseSource(uiSource);
+		uiSource = 0;
 	}
 }
 
 /**
  @brief Initialise this class instance
  @param ID A const int variable which will be the ID of the iSoundSource in the map
- @param pSoundSource A ISoundSource* variable which contains the iSoundSource
+ @param pBackend The CSoundBackend which holds the sound source
+ @param uiSource The handle of the sound source in pBackend
  @param bIsLooped A const bool variable which indicates if this iSoundSource will have loop playback.
  @param eSoundType A SOUNDTYPE enum variable which states the type of sound
- @param vec3dfSoundPos A vec3df variable which contains the 3D position of the sound
+ @param vec3SoundPos A glm::vec3 variable which contains the 3D position of the sound
  @return A bool value. true is this class instance was initialised, else false
  */
 bool CSoundInfo::Init(	const std::string name,
-						ISoundSource* pSoundSource,
+						CSoundBackend* pBackend,
+						const unsigned int uiSource,
 						const bool bIsLooped,
 						SOUNDTYPE eSoundType,
-						vec3df vec3dfSoundPos)
+						glm::vec3 vec3SoundPos)
 {
 	//this->ID = ID;
 	this->name = name;
-	this->pSoundSource = pSoundSource;
+	this->pBackend = pBackend;
+	this->uiSource = uiSource;
 	this->bIsLooped = bIsLooped;
 	this->eSoundType = eSoundType;
-	this->vec3dfSoundPos = vec3dfSoundPos;
+	this->vec3SoundPos = vec3SoundPos;
+	// Looped sounds are background music, unless they are changed with SetCategory
+	this->eCategory = (bIsLooped ? MUSIC : EFFECT);
 	
 	return true;
 }
 
 /**
  @brief Get an sound from this class
- @return The iSoundSource stored in this class instance
+ @return The handle of the sound source stored in this class instance
  */
-ISoundSource* CSoundInfo::GetSound(void) const
+unsigned int CSoundInfo::GetSound(void) const
 {
-	return pSoundSource;
+	return uiSource;
 }
 
 /**
@@ -80,6 +88,41 @@ CSoundInfo::SOUNDTYPE CSoundInfo::GetSoundType(void) const
 	return eSoundType;
 }
 
+/**
+ @brief Set sound category
+ @param eCategory The category which this sound is capped with
+ */
+void CSoundInfo::SetCategory(const SOUNDCATEGORY eCategory)
+{
+	this->eCategory = eCategory;
+}
+
+/**
+ @brief Get sound category
+ @return CSoundInfo::SOUNDCATEGORY value
+ */
+CSoundInfo::SOUNDCATEGORY CSoundInfo::GetCategory(void) const
+{
+	return eCategory;
+}
+
+/**
+ @brief Set if this sound is streamed from its file instead of being decoded into memory
+ */
+void CSoundInfo::SetStreamed(const bool bIsStreamed)
+{
+	this->bIsStreamed = bIsStreamed;
+}
+
+/**
+ @brief Get if this sound is streamed from its file
+ @return bIsStreamed value
+ */
+bool CSoundInfo::GetStreamed(void) const
+{
+	return bIsStreamed;
+}
+
 /**
  @brief Increase volume of a ISoundSource
  @return true if successfully decreased volume, else false
@@ -87,17 +130,17 @@ CSoundInfo::SOUNDTYPE CSoundInfo::GetSoundType(void) const
 bool CSoundInfo::VolumeIncrease(void)
 {
 	// Get the current volume
-	float fCurrentVolume = pSoundSource->getDefaultVolume();
+	float fCurrentVolume = pBackend->GetSourceVolume(uiSource);
 
 	// Check if the maximum volume has been reached
 	if (fCurrentVolume >= 1.0f)
 	{
-		pSoundSource->setDefaultVolume(1.0f);
+		pBackend->SetSourceVolume(uiSource, 1.0f);
 		return false;
 	}
 
 	// Increase the volume by 10%
-	pSoundSource->setDefaultVolume(fCurrentVolume + 0.1f);
+	pBackend->SetSourceVolume(uiSource, fCurrentVolume + 0.1f);
 
 	return true;
 }
@@ -109,17 +152,17 @@ bool CSoundInfo::VolumeIncrease(void)
 bool CSoundInfo::VolumeDecrease(void)
 {
 	// Get the current volume
-	float fCurrentVolume = pSoundSource->getDefaultVolume();
+	float fCurrentVolume = pBackend->GetSourceVolume(uiSource);
 
 	// Check if the minimum volume has been reached
 	if (fCurrentVolume <= 0.0f)
 	{
-		pSoundSource->setDefaultVolume(0.0f);
+		pBackend->SetSourceVolume(uiSource, 0.0f);
 		return false;
 	}
 
 	// Decrease the volume by 10%
-	pSoundSource->setDefaultVolume(fCurrentVolume - 0.1f);
+	pBackend->SetSourceVolume(uiSource, fCurrentVolume - 0.1f);
 
 	return true;
 }
@@ -133,14 +176,14 @@ bool CSoundInfo::VolumeDecrease(void)
  */
 void CSoundInfo::SetPosition(const float x, const float y, const float z)
 {
-	vec3dfSoundPos.set(x, y, z);
+	vec3SoundPos = glm::vec3(x, y, z);
 }
 
 /**
  @brief Get position of the 3D sound
  @return The position of the 3D sound
  */
-vec3df CSoundInfo::GetPosition(void) const
+glm::vec3 CSoundInfo::GetPosition(void) const
 {
-	return vec3dfSoundPos;
+	return vec3SoundPos;
 }
\ No newline at end of file
@@ -6,10 +6,11 @@
 #pragma once
 #include <iostream>
 
-// Include IrrKlang
-#include <includes/irrKlang.h>
-using namespace irrklang;
-#pragma comment(lib, "irrKlang.lib") // link with irrKlang.dll
+// Include GLM
+#include <includes/glm.hpp>
+
+// Include CSoundBackend, which holds the sound source
+#include "SoundBackend.h"
 
 class CSoundInfo
 {
@@ -21,6 +22,15 @@ public:
 		NUM_SOUNDTYPE
 	};
 
+	// The categories of sounds. Each category has its own voice cap in CSoundController.
+	enum SOUNDCATEGORY
+	{
+		MUSIC = 0,
+		EFFECT,
+		UI,
+		NUM_SOUNDCATEGORY
+	};
+
 	// Constructor
 	CSoundInfo(void);
 
@@ -29,13 +39,14 @@ public:
 
 	// Initialise this class instance
 	bool Init(	const std::string name, 
-				ISoundSource* pSoundSource, 
+				CSoundBackend* pBackend,
+				const unsigned int uiSource, 
 				const bool bIsLooped = false, 
 				SOUNDTYPE eSoundType = _2D,
-				vec3df vec3dfSoundPos = vec3df(0.0f, 0.0f, 0.0f));
+				glm::vec3 vec3SoundPos = glm::vec3(0.0f, 0.0f, 0.0f));
 
-	// Get an sound from this map
-	ISoundSource* GetSound(void) const;
+	// Get the handle of the sound source in the CSoundBackend
+	unsigned int GetSound(void) const;
 
 	// Get loop status
 	bool GetLoopStatus(void) const;
@@ -43,6 +54,16 @@ public:
 	// Get sound type
 	SOUNDTYPE GetSoundType(void) const;
 
+	// Set sound category
+	void SetCategory(const SOUNDCATEGORY eCategory);
+	// Get sound category
+	SOUNDCATEGORY GetCategory(void) const;
+
+	// Set if this sound is streamed from its file instead of being decoded into memory
+	void SetStreamed(const bool bIsStreamed);
+	// Get if this sound is streamed from its file
+	bool GetStreamed(void) const;
+
 	// Increase volume of a ISoundSource
 	bool VolumeIncrease(void);
 	// Decrease volume of a ISoundSource
@@ -53,7 +74,7 @@ public:
 	void SetPosition(const float x, const float y, const float z);
 
 	// Get position
-	vec3df GetPosition(void) const;
+	glm::vec3 GetPosition(void) const;
 
 protected:
 	// ID for this sound
@@ -62,8 +83,9 @@ protected:
 	// name for this sound
 	std::string name;
 
-	// The handler to the irrklang Sound Engine
-	ISoundSource* pSoundSource;
+	// The backend which holds the sound source, and the handle of the sound source
+	CSoundBackend* pBackend;
+	unsigned int uiSource;
 
 	// Indicate if this sound will be looped during playback
 	bool bIsLooped;
@@ -71,7 +93,13 @@ protected:
 	// Sound type
 	SOUNDTYPE eSoundType;
 
+	// Sound category
+	SOUNDCATEGORY eCategory;
+
+	// Indicate if this sound is streamed from its file
+	bool bIsStreamed;
+
 	// For 3D sound only: Sound position
-	vec3df vec3dfSoundPos;
+	glm::vec3 vec3SoundPos;
 };
 
@@ -3,6 +3,10 @@
  @brief This file contains the main function for this project
  */
 #include "Application.h"
+// Include CHeadlessDriver to run the game without a window
+#include "Scene2D/HeadlessDriver.h"
+
+#include <cstring>
 
 /**
  Boolean macro to determine if the program is in debug mode
@@ -19,10 +23,14 @@ Boolean macro to determine if the program is in 3D or 2D mode
 
 /**
  @brief This function is the main function which is called by the operating system when you run the executables
+		Run it with --headless to run the game without a window, e.g. App.exe --headless --ticks 600 --world START
  @return This function returns the error codes
  */
-int main(void)
+int main(int argc, char* argv[])
 {
+	if ((argc > 1) && (strcmp(argv[1], "--headless") == 0))
+		return CHeadlessDriver::RunFromCommandLine(argc, argv);
+
 	Application* pApp = Application::GetInstance();
 	// if the application is initialised properly, then run it
 	if (pApp->Init() == true)
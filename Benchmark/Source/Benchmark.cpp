@@ -0,0 +1,250 @@
+/**
+ CBenchmark
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#include "Benchmark.h"
+
+// Include CStopWatch to time the iterations
+#include "TimeControl\StopWatch.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+using namespace std;
+
+const volatile void* volatile CBenchmark::vSink = NULL;
+
+/**
+ @brief Constructor
+ */
+CBenchmark::CBenchmark(void)
+	: dMinTime(0.2)
+	, dMaxTime(5.0)
+	, uiMinIterations(5)
+	, uiMaxIterations(100000)
+{
+}
+
+/**
+ @brief Destructor
+ */
+CBenchmark::~CBenchmark(void)
+{
+}
+
+/**
+ @brief Add a benchmark
+ @param sName The name of the benchmark, e.g. CMap2D::PathFind
+ @param sFixture The name of the fixture which the benchmark runs on, e.g. Small
+ @param body The work which is timed in each iteration
+ @param setup The work which is done before each iteration without being timed, or nullptr
+ @param uiNumItems The number of items which each iteration processes, e.g. columns, or 0 if the items per second are not reported
+ */
+void CBenchmark::Add(	const std::string& sName,
+						const std::string& sFixture,
+						const std::function<void(void)>& body,
+						const std::function<void(void)>& setup,
+						const unsigned int uiNumItems)
+{
+	Entry sEntry;
+	sEntry.sName = sName;
+	sEntry.sFixture = sFixture;
+	sEntry.body = body;
+	sEntry.setup = setup;
+	sEntry.uiNumItems = uiNumItems;
+	vEntries.push_back(sEntry);
+}
+
+/**
+ @brief Set the least time which each benchmark is timed for
+ @param dMinTime The time in seconds
+ */
+void CBenchmark::SetMinTime(const double dMinTime)
+{
+	this->dMinTime = dMinTime;
+}
+
+/**
+ @brief Set the most time which each benchmark runs for, including its setup, once it has run the least number of iterations
+ @param dMaxTime The time in seconds
+ */
+void CBenchmark::SetMaxTime(const double dMaxTime)
+{
+	this->dMaxTime = dMaxTime;
+}
+
+/**
+ @brief Set the number of iterations which each benchmark is timed for
+ @param uiMinIterations The least number of iterations, even if they take longer than the least time
+ @param uiMaxIterations The most number of iterations, even if they take less than the least time
+ */
+void CBenchmark::SetIterations(const unsigned int uiMinIterations, const unsigned int uiMaxIterations)
+{
+	this->uiMinIterations = uiMinIterations;
+	this->uiMaxIterations = max(uiMinIterations, uiMaxIterations);
+}
+
+/**
+ @brief Run the benchmarks
+ @param sFilter A part of the names of the benchmarks to run, or an empty string to run all of them
+ */
+void CBenchmark::Run(const std::string& sFilter)
+{
+	for (unsigned int i = 0; i < vEntries.size(); i++)
+	{
+		if ((sFilter.empty()) || (vEntries[i].sName.find(sFilter) != string::npos))
+			RunEntry(vEntries[i]);
+	}
+}
+
+/**
+ @brief Get the results of the benchmarks which were run
+ */
+const std::vector<CBenchmark::Result>& CBenchmark::GetResults(void) const
+{
+	return vResults;
+}
+
+/**
+ @brief Print out the results in CSV format
+ */
+void CBenchmark::PrintResults(void) const
+{
+	WriteResults(cout);
+}
+
+/**
+ @brief Write the results to a CSV file
+ @param filename The name of the CSV file
+ @return A bool value. true if the file was written, else false
+ */
+bool CBenchmark::WriteCSV(const std::string& filename) const
+{
+	ofstream outFile(filename.c_str());
+	if (!outFile.is_open())
+	{
+		cout << "Unable to write the benchmark results to " << filename << endl;
+		return false;
+	}
+	WriteResults(outFile);
+	return true;
+}
+
+/**
+ @brief Compare the median times with a CSV file written by WriteCSV.
+		The benchmarks which are not in the baseline are skipped.
+ @param filename The name of the baseline CSV file
+ @param dTolerance The fraction by which a median time may be slower than the baseline, e.g. 0.1 for 10%
+ @return The number of benchmarks which are slower than the baseline by more than the tolerance, or -1 if the file cannot be read
+ */
+int CBenchmark::CompareWithBaseline(const std::string& filename, const double dTolerance) const
+{
+	ifstream inFile(filename.c_str());
+	if (!inFile.is_open())
+	{
+		cout << "Unable to open the baseline " << filename << endl;
+		return -1;
+	}
+
+	int iNumRegressions = 0;
+	string line;
+	// Skip the header
+	getline(inFile, line);
+	while (getline(inFile, line))
+	{
+		// benchmark,fixture,iterations,min_us,median_us,mean_us,max_us[,items_per_s]
+		vector<string> vFields;
+		stringstream ss(line);
+		string field;
+		while (getline(ss, field, ','))
+			vFields.push_back(field);
+		if (vFields.size() < 5)
+			continue;
+
+		const double dBaseline = atof(vFields[4].c_str());
+		for (unsigned int i = 0; i < vResults.size(); i++)
+		{
+			if ((vResults[i].sName != vFields[0]) || (vResults[i].sFixture != vFields[1]))
+				continue;
+
+			if (vResults[i].dMedian > dBaseline * (1.0 + dTolerance))
+			{
+				cout << "REGRESSION," << vResults[i].sName << "," << vResults[i].sFixture
+					 << "," << dBaseline << "," << vResults[i].dMedian << endl;
+				iNumRegressions++;
+			}
+			break;
+		}
+	}
+	return iNumRegressions;
+}
+
+/**
+ @brief Run a benchmark and store its result. The first iteration warms up the caches, and is not timed.
+ @param sEntry The benchmark to run
+ */
+void CBenchmark::RunEntry(const Entry& sEntry)
+{
+	CStopWatch cStopWatch;
+	vector<double> vTimes;
+	double dTotalTime = 0.0;
+	// The time taken by the iterations and their setup
+	double dWallTime = 0.0;
+
+	if (sEntry.setup)
+		sEntry.setup();
+	sEntry.body();
+
+	while ((vTimes.size() < uiMaxIterations) &&
+		((vTimes.size() < uiMinIterations) || ((dTotalTime < dMinTime) && (dWallTime < dMaxTime))))
+	{
+		cStopWatch.StartTimer();
+		if (sEntry.setup)
+			sEntry.setup();
+		const double dSetupTime = cStopWatch.GetElapsedTime();
+
+		sEntry.body();
+		const double dTime = cStopWatch.GetElapsedTime();
+
+		vTimes.push_back(dTime * 1000000.0);
+		dTotalTime += dTime;
+		dWallTime += dSetupTime + dTime;
+	}
+
+	Result sResult;
+	sResult.sName = sEntry.sName;
+	sResult.sFixture = sEntry.sFixture;
+	sResult.uiIterations = (unsigned int)vTimes.size();
+	sResult.dMean = dTotalTime * 1000000.0 / vTimes.size();
+	sort(vTimes.begin(), vTimes.end());
+	sResult.dMin = vTimes.front();
+	sResult.dMedian = vTimes[vTimes.size() / 2];
+	sResult.dMax = vTimes.back();
+	sResult.dItemsPerSecond = (sResult.dMedian > 0.0) ? sEntry.uiNumItems * 1000000.0 / sResult.dMedian : 0.0;
+	vResults.push_back(sResult);
+
+	cout << "Ran " << sResult.sName << " on " << sResult.sFixture << ": "
+		 << sResult.dMedian << " us median over " << sResult.uiIterations << " iterations";
+	if (sEntry.uiNumItems > 0)
+		cout << ", " << sResult.dItemsPerSecond << " items/s";
+	cout << endl;
+}
+
+/**
+ @brief Write the results in CSV format
+ @param os The stream to write to
+ */
+void CBenchmark::WriteResults(std::ostream& os) const
+{
+	os << "benchmark,fixture,iterations,min_us,median_us,mean_us,max_us,items_per_s" << endl;
+	for (unsigned int i = 0; i < vResults.size(); i++)
+	{
+		const Result& sResult = vResults[i];
+		os << sResult.sName << "," << sResult.sFixture << "," << sResult.uiIterations << ","
+		   << sResult.dMin << "," << sResult.dMedian << "," << sResult.dMean << "," << sResult.dMax << ","
+		   << sResult.dItemsPerSecond << endl;
+	}
+}
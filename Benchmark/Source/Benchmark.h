@@ -0,0 +1,102 @@
+/**
+ CBenchmark
+ @brief A class which runs microbenchmarks and reports their times in a machine-readable CSV format.
+		Each benchmark is run until it has taken a minimum time, and an optional setup function
+		is run before each iteration without being timed, so that a benchmark can restore its fixture.
+		The results can be compared with a baseline CSV file to catch a regression.
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#pragma once
+
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+class CBenchmark
+{
+public:
+	// The time of a benchmark in microseconds per iteration
+	struct Result
+	{
+		std::string sName;
+		std::string sFixture;
+		unsigned int uiIterations;
+		double dMin;
+		double dMedian;
+		double dMean;
+		double dMax;
+		// The number of items which the benchmark processes per second at the median time, or 0 if it has no items
+		double dItemsPerSecond;
+	};
+
+	// Constructor
+	CBenchmark(void);
+	// Destructor
+	~CBenchmark(void);
+
+	// Add a benchmark. setup is called before each iteration, and is not timed.
+	// uiNumItems is the number of items, e.g. columns, which each iteration processes, to report the items per second.
+	void Add(	const std::string& sName,
+				const std::string& sFixture,
+				const std::function<void(void)>& body,
+				const std::function<void(void)>& setup = nullptr,
+				const unsigned int uiNumItems = 0);
+
+	// Set the least time in seconds and the number of iterations which each benchmark is timed for
+	void SetMinTime(const double dMinTime);
+	// Set the most time in seconds which each benchmark runs for, including its setup
+	void SetMaxTime(const double dMaxTime);
+	void SetIterations(const unsigned int uiMinIterations, const unsigned int uiMaxIterations);
+
+	// Run the benchmarks whose names contain sFilter, or all of them if it is empty
+	void Run(const std::string& sFilter = "");
+
+	// Get the results of the benchmarks which were run
+	const std::vector<Result>& GetResults(void) const;
+
+	// Print out the results in CSV format
+	void PrintResults(void) const;
+	// Write the results to a CSV file
+	bool WriteCSV(const std::string& filename) const;
+	// Compare the median times with a CSV file written by WriteCSV. Return the number of regressions.
+	int CompareWithBaseline(const std::string& filename, const double dTolerance) const;
+
+	// Keep a value alive, so that the compiler does not optimise away the work which computed it
+	template<typename T>
+	static void DoNotOptimise(const T& value)
+	{
+		vSink = (const volatile void*)&value;
+	}
+
+protected:
+	// A benchmark which was added
+	struct Entry
+	{
+		std::string sName;
+		std::string sFixture;
+		std::function<void(void)> body;
+		std::function<void(void)> setup;
+		unsigned int uiNumItems;
+	};
+
+	// Run a benchmark and store its result
+	void RunEntry(const Entry& sEntry);
+	// Write the results in CSV format to a stream
+	void WriteResults(std::ostream& os) const;
+
+	std::vector<Entry> vEntries;
+	std::vector<Result> vResults;
+
+	// The least time in seconds which each benchmark is timed for
+	double dMinTime;
+	// The most time in seconds which each benchmark runs for, including its setup, after its least number of iterations
+	double dMaxTime;
+	// The least and most number of iterations of each benchmark
+	unsigned int uiMinIterations;
+	unsigned int uiMaxIterations;
+
+	// The address which DoNotOptimise writes to
+	static const volatile void* volatile vSink;
+};
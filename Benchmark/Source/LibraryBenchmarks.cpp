@@ -0,0 +1,163 @@
+/**
+ CLibraryBenchmarks
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#include "LibraryBenchmarks.h"
+
+#include "Benchmark.h"
+#include "WorldFixture.h"
+
+// Include the Library classes which are benchmarked
+#include "Primitives\MeshBuilder.h"
+#include "Primitives\SpriteAnimation.h"
+#include "Scripting\ScriptManager.h"
+#include "System\CSVReader.h"
+#include "System\filesystem.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+using namespace std;
+
+// The Lua scripts which CScriptManager reads from and writes with
+static const char* const SCRIPT_FILENAME = "Benchmark_Config.lua";
+static const char* const WRITE_SCRIPT_FILENAME = "Benchmark_Write.lua";
+// The number of tables in the Lua script, each with a float, an int and a string
+static const unsigned int NUM_SCRIPT_TABLES = 32;
+
+/**
+ @brief Constructor
+ */
+CLibraryBenchmarks::CLibraryBenchmarks(void)
+	: pSprite(NULL)
+{
+}
+
+/**
+ @brief Destructor
+ */
+CLibraryBenchmarks::~CLibraryBenchmarks(void)
+{
+	Destroy();
+}
+
+/**
+ @brief Create the sprite, and write and load the Lua script
+ @param vFixtures The world fixtures, which must have been written
+ @return A bool value. true if the benchmarks are ready to run, else false
+ */
+bool CLibraryBenchmarks::Init(const std::vector<CWorldFixture*>& vFixtures)
+{
+	this->vFixtures = vFixtures;
+
+	// The sprite sheet and the animations of CPlayer2D
+	pSprite = CMeshBuilder::GenerateSpriteAnimation(4, 3);
+	pSprite->AddAnimation("idleright", 0, 2);
+	pSprite->AddAnimation("idleleft", 9, 11);
+	pSprite->AddAnimation("right", 3, 5);
+	pSprite->AddAnimation("left", 6, 8);
+	pSprite->PlayAnimation("right", -1, 1.0f);
+
+	if (WriteScripts() == false)
+		return false;
+	if (CScriptManager::GetInstance()->Init(SCRIPT_FILENAME, WRITE_SCRIPT_FILENAME) == false)
+	{
+		cout << "Failed to load the Lua script for the benchmarks" << endl;
+		return false;
+	}
+	return true;
+}
+
+/**
+ @brief Delete the sprite and the Lua script
+ */
+void CLibraryBenchmarks::Destroy(void)
+{
+	if (pSprite)
+	{
+		delete pSprite;
+		pSprite = NULL;
+	}
+
+	if (!vFloatKeys.empty())
+	{
+		CScriptManager::GetInstance()->Destroy();
+		remove(SCRIPT_FILENAME);
+		remove(WRITE_SCRIPT_FILENAME);
+		vFloatKeys.clear();
+		vIntKeys.clear();
+		vStringKeys.clear();
+	}
+}
+
+/**
+ @brief Add the benchmarks
+ @param cBenchmark The benchmarks to add to
+ */
+void CLibraryBenchmarks::Register(CBenchmark& cBenchmark)
+{
+	// A minute of updates at 60 frames per second
+	cBenchmark.Add("CSpriteAnimation::Update", "Player",
+		[this]() {
+			for (unsigned int i = 0; i < 3600; i++)
+				pSprite->Update(1.0 / 60.0);
+		});
+
+	for (unsigned int i = 0; i < vFixtures.size(); i++)
+	{
+		const CWorldFixture* pFixture = vFixtures[i];
+		cBenchmark.Add("CCSVReader::read_csv", pFixture->GetName(),
+			[pFixture]() {
+				CCSVReader cCSVReader;
+				CBenchmark::DoNotOptimise(cCSVReader.read_csv(FileSystem::getPath(pFixture->GetMapPath()),
+					pFixture->GetNumCols(), pFixture->GetNumRows()).size());
+			});
+	}
+
+	// Every key of the script, as the game reads its settings
+	cBenchmark.Add("CScriptManager::get", "Config",
+		[this]() {
+			CScriptManager* cScriptManager = CScriptManager::GetInstance();
+			for (unsigned int i = 0; i < NUM_SCRIPT_TABLES; i++)
+			{
+				CBenchmark::DoNotOptimise(cScriptManager->get<float>(vFloatKeys[i]));
+				CBenchmark::DoNotOptimise(cScriptManager->get<int>(vIntKeys[i]));
+				CBenchmark::DoNotOptimise(cScriptManager->get<std::string>(vStringKeys[i]));
+			}
+		});
+}
+
+/**
+ @brief Write the Lua script which CScriptManager reads from, with nested tables of settings,
+		and the one which it writes with, which only needs a SetToLuaFile function
+ @return A bool value. true if the scripts were written, else false
+ */
+bool CLibraryBenchmarks::WriteScripts(void)
+{
+	ofstream scriptFile(SCRIPT_FILENAME);
+	ofstream writeScriptFile(WRITE_SCRIPT_FILENAME);
+	if ((!scriptFile.is_open()) || (!writeScriptFile.is_open()))
+	{
+		cout << "Unable to write the Lua scripts for the benchmarks" << endl;
+		return false;
+	}
+
+	scriptFile << "Config = {" << endl;
+	for (unsigned int i = 0; i < NUM_SCRIPT_TABLES; i++)
+	{
+		stringstream ss;
+		ss << "Config.Entity" << i << ".";
+		scriptFile << "\tEntity" << i << " = { speed = " << i * 0.5f << ", health = " << 100 + i
+				   << ", texture = \"Image/Entity" << i << ".png\" }," << endl;
+		vFloatKeys.push_back(ss.str() + "speed");
+		vIntKeys.push_back(ss.str() + "health");
+		vStringKeys.push_back(ss.str() + "texture");
+	}
+	scriptFile << "}" << endl;
+
+	writeScriptFile << "function SetToLuaFile(sKeyAndValue, iOverwrite, sOldKeyAndValue)" << endl;
+	writeScriptFile << "end" << endl;
+	return true;
+}
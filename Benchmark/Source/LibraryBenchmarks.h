@@ -0,0 +1,45 @@
+/**
+ CLibraryBenchmarks
+ @brief The benchmarks of the hot paths in the Library: CSpriteAnimation::Update,
+		CCSVReader on the world fixtures, and CScriptManager::get on a generated Lua script.
+		They need a render device for the sprite mesh, so CScene2DBenchmarks must be initialised first.
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#pragma once
+
+#include <string>
+#include <vector>
+
+class CBenchmark;
+class CWorldFixture;
+class CSpriteAnimation;
+
+class CLibraryBenchmarks
+{
+public:
+	// Constructor
+	CLibraryBenchmarks(void);
+	// Destructor
+	~CLibraryBenchmarks(void);
+
+	// Create the sprite, and write and load the Lua script
+	bool Init(const std::vector<CWorldFixture*>& vFixtures);
+	// Delete the sprite and the Lua script
+	void Destroy(void);
+
+	// Add the benchmarks
+	void Register(CBenchmark& cBenchmark);
+
+protected:
+	// Write the Lua script which CScriptManager reads from, and the one which it writes with
+	bool WriteScripts(void);
+
+	std::vector<CWorldFixture*> vFixtures;
+	// A sprite with the animations of the player
+	CSpriteAnimation* pSprite;
+	// The keys in the Lua script, which are read in turn
+	std::vector<std::string> vFloatKeys;
+	std::vector<std::string> vIntKeys;
+	std::vector<std::string> vStringKeys;
+};
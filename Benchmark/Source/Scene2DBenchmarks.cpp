@@ -0,0 +1,580 @@
+/**
+ CScene2DBenchmarks
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#include "Scene2DBenchmarks.h"
+
+#include "Benchmark.h"
+#include "WorldFixture.h"
+
+// Include CMap2D, CPlayer2D and CEnemy2D
+#include "Scene2D\Map2D.h"
+#include "Scene2D\Player2D.h"
+#include "Scene2D\Enemy2D.h"
+#include "Scene2D\PhysicsWorld2D.h"
+#include "Scene2D\TerrainGenerator.h"
+// Include CSoundController, which the player plays its sounds with
+#include "SoundController\SoundController.h"
+
+// Include the render devices
+#include "RenderControl\RenderDevice.h"
+#include "RenderControl\RecordingRenderDevice.h"
+// Include CAssetLoader and CTexturePack to load the textures as the Application does
+#include "System\AssetLoader.h"
+#include "System\TexturePack.h"
+// Include CJobSystem, which the enemies are updated on
+#include "System\JobSystem.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <thread>
+using namespace std;
+
+// The enemy counts and the number of fixed time steps which the enemy update benchmarks run
+static const unsigned int ENEMY_COUNTS[] = { 128, 1024 };
+static const unsigned int NUM_ENEMY_STEPS = 10;
+// The numbers of bodies and the number of fixed time steps which the physics benchmarks run
+static const unsigned int BODY_COUNTS[] = { 1024, 16384 };
+static const unsigned int NUM_BODY_STEPS = 10;
+// The number of chunks which the terrain generator benchmark generates
+static const unsigned int NUM_TERRAIN_CHUNKS = 4096;
+
+/**
+ @brief Get the position which an enemy starts at. Every other enemy is next to the door, where the player is,
+		so that it attacks and finds a path to the player, and the others patrol the ground across the fixture.
+ @param pFixture The fixture
+ @param uiIndex The index of the enemy
+ */
+static glm::i32vec2 GetEnemyStartPos(const CWorldFixture* pFixture, const unsigned int uiIndex)
+{
+	unsigned int uiCol = pFixture->GetStartPos().x - 1 + (uiIndex / 2) % 3;
+	if (uiIndex % 2 == 1)
+	{
+		uiCol = 4 + (uiIndex * 7) % (pFixture->GetNumCols() - 8);
+		// The walls of trees are in the 8th column of every 16
+		if (uiCol % 16 == 8)
+			uiCol++;
+	}
+	return pFixture->GetGroundPos(uiCol);
+}
+
+/**
+ @brief Constructor
+ */
+CScene2DBenchmarks::CScene2DBenchmarks(void)
+	: pLoadedFixture(NULL)
+	, uiSeed(0)
+	, cMap2D(NULL)
+	, cPlayer2D(NULL)
+	, pRenderDevice(NULL)
+	, pBodies(NULL)
+	, uiNumBodies(0)
+{
+}
+
+/**
+ @brief Destructor
+ */
+CScene2DBenchmarks::~CScene2DBenchmarks(void)
+{
+	Destroy();
+}
+
+/**
+ @brief Initialise CMap2D and CPlayer2D without a window
+ @param vFixtures The world fixtures, which must have been written
+ @param uiSeed The world seed of the benchmarks which generate columns
+ @return A bool value. true if CMap2D and CPlayer2D were initialised, else false
+ */
+bool CScene2DBenchmarks::Init(const std::vector<CWorldFixture*>& vFixtures, const unsigned int uiSeed)
+{
+	if (vFixtures.empty())
+		return false;
+	this->vFixtures = vFixtures;
+	this->uiSeed = uiSeed;
+
+	CSettings* cSettings = CSettings::GetInstance();
+	cSettings->bHeadless = true;
+	cSettings->bOfflineAudio = true;
+
+	// Record the calls to the renderer, without storing them, as there is no GL context
+	pRenderDevice = new CRecordingRenderDevice();
+	pRenderDevice->SetRecordCommands(false);
+	CRenderDevice::SetActive(pRenderDevice);
+
+	CAssetLoader::GetInstance()->Init();
+	if (cSettings->bUseTexturePack == true)
+		CTexturePack::GetInstance()->Open("Image\\Textures.pack");
+	CSoundController::GetInstance()->Init();
+
+	// CMap2D::ProceduralGeneration adds 10 columns to the map, so leave room for them
+	unsigned int uiMaxRows = 0, uiMaxCols = 0;
+	for (unsigned int i = 0; i < vFixtures.size(); i++)
+	{
+		uiMaxRows = max(uiMaxRows, vFixtures[i]->GetNumRows());
+		uiMaxCols = max(uiMaxCols, vFixtures[i]->GetNumCols());
+	}
+	cMap2D = CMap2D::GetInstance();
+	if (cMap2D->Init(1, uiMaxRows, uiMaxCols + 10) == false)
+	{
+		cout << "Failed to initialise CMap2D for the benchmarks" << endl;
+		return false;
+	}
+
+	// The player starts at the door of the fixture
+	UseFixture(vFixtures[0]);
+	cPlayer2D = CPlayer2D::GetInstance();
+	if (cPlayer2D->Init() == false)
+	{
+		cout << "Failed to initialise CPlayer2D for the benchmarks" << endl;
+		return false;
+	}
+	return true;
+}
+
+/**
+ @brief Destroy CMap2D, CPlayer2D and the enemies, stop CJobSystem, and restore the OpenGL render device
+ */
+void CScene2DBenchmarks::Destroy(void)
+{
+	if (cMap2D)
+	{
+		// CMap2D frees the rows of the loaded map, so load the tallest fixture to free every row
+		const CWorldFixture* pTallestFixture = vFixtures[0];
+		for (unsigned int i = 1; i < vFixtures.size(); i++)
+		{
+			if (vFixtures[i]->GetNumRows() > pTallestFixture->GetNumRows())
+				pTallestFixture = vFixtures[i];
+		}
+		UseFixture(pTallestFixture);
+
+		DeleteEnemies();
+		DeleteBodies();
+		CJobSystem::Destroy();
+		if (cPlayer2D)
+		{
+			CPlayer2D::Destroy();
+			cPlayer2D = NULL;
+		}
+		CMap2D::Destroy();
+		cMap2D = NULL;
+	}
+
+	if (pRenderDevice)
+	{
+		CRenderDevice::SetActive(nullptr);
+		delete pRenderDevice;
+		pRenderDevice = NULL;
+	}
+	pLoadedFixture = NULL;
+}
+
+/**
+ @brief Add the benchmarks for each fixture
+ @param cBenchmark The benchmarks to add to
+ */
+void CScene2DBenchmarks::Register(CBenchmark& cBenchmark)
+{
+	for (unsigned int i = 0; i < vFixtures.size(); i++)
+	{
+		const CWorldFixture* pFixture = vFixtures[i];
+		const string& sFixture = pFixture->GetName();
+
+		// LoadMap replaces the tiles, so the next benchmark has to load its fixture again
+		cBenchmark.Add("CMap2D::LoadMap", sFixture,
+			[this, pFixture]() { cMap2D->LoadMap(pFixture->GetMapPath()); },
+			[this]() { pLoadedFixture = NULL; });
+
+		cBenchmark.Add("CMap2D::SaveMap", sFixture,
+			[this]() { cMap2D->SaveMap("Maps/Benchmark_Scratch.csv"); },
+			[this, pFixture]() { UseFixture(pFixture); });
+
+		// The columns per second of the generation are reported as the items per second
+		cBenchmark.Add("CMap2D::GenerateRandomMap", sFixture,
+			[this]() { cMap2D->GenerateRandomMap(); },
+			[this, pFixture]() { ResetFixture(pFixture); cMap2D->SetWorldSeed(uiSeed); },
+			pFixture->GetNumCols() - 3);
+
+		// ProceduralGeneration saves the active world, so point it at a scratch file
+		cBenchmark.Add("CMap2D::ProceduralGeneration", sFixture,
+			[this]() { cMap2D->ProceduralGeneration(); },
+			[this, pFixture]() { ResetFixture(pFixture); CMap2D::activeWorld = "Benchmark_Scratch"; cMap2D->SetWorldSeed(uiSeed); },
+			10);
+
+		// The shop is at the bottom right, so this scans almost every tile
+		cBenchmark.Add("CMap2D::FindValue", sFixture,
+			[this]() {
+				unsigned int uiRow = 0, uiCol = 0;
+				CBenchmark::DoNotOptimise(cMap2D->FindValue(6, uiRow, uiCol));
+			},
+			[this, pFixture]() { UseFixture(pFixture); });
+
+		// The seeds take 1 and 2 seconds, or 60 and 120 updates, to grow.
+		// Reload the fixture every 50 updates, so that every iteration scans the same seeds.
+		unsigned int uiNumSeedUpdates = 0;
+		cBenchmark.Add("CMap2D::UpdateSeed", sFixture,
+			[this]() {
+				cMap2D->UpdateSeed("GrassTree", 1.0 / 60.0, 100, 2);
+				cMap2D->UpdateSeed("DirtTree", 1.0 / 60.0, 102, 1);
+			},
+			[this, pFixture, uiNumSeedUpdates]() mutable {
+				if (uiNumSeedUpdates++ % 50 == 0)
+					ResetFixture(pFixture);
+			});
+
+		// The same, with seeds in every empty tile of the 4 rows above the ground, e.g. thousands on the large fixture
+		unsigned int uiNumSeedFieldUpdates = 0;
+		cBenchmark.Add("CMap2D::UpdateSeed (seed field)", sFixture,
+			[this]() {
+				cMap2D->UpdateSeed("GrassTree", 1.0 / 60.0, 100, 2);
+				cMap2D->UpdateSeed("DirtTree", 1.0 / 60.0, 102, 1);
+			},
+			[this, pFixture, uiNumSeedFieldUpdates]() mutable {
+				if (uiNumSeedFieldUpdates++ % 50 == 0)
+				{
+					ResetFixture(pFixture);
+					PlantSeedField(pFixture);
+				}
+			});
+
+		cBenchmark.Add("CMap2D::PathFind", sFixture,
+			[this, pFixture]() {
+				CBenchmark::DoNotOptimise(cMap2D->PathFind(pFixture->GetStartPos(), pFixture->GetTargetPos(), heuristic::manhattan, 1).size());
+			},
+			[this, pFixture]() { UseFixture(pFixture); });
+
+		cBenchmark.Add("CPlayer2D::Collision", sFixture,
+			[this, pFixture]() { CBenchmark::DoNotOptimise(CheckCollisions(pFixture)); },
+			[this, pFixture]() { UseFixture(pFixture); });
+
+		cBenchmark.Add("CMap2D::SweepRows", sFixture,
+			[this, pFixture]() { CBenchmark::DoNotOptimise(SweepColumns(pFixture)); },
+			[this, pFixture]() { UseFixture(pFixture); });
+	}
+
+	// The enemy updates with 1, 2, 4 and 8 threads, up to the number of cores, and with every core
+	vector<unsigned int> vNumThreads;
+	const unsigned int uiNumCores = max(std::thread::hardware_concurrency(), 1u);
+	for (unsigned int uiNumThreads = 1; uiNumThreads <= min(uiNumCores, 8u); uiNumThreads *= 2)
+		vNumThreads.push_back(uiNumThreads);
+	if (vNumThreads.back() != uiNumCores)
+		vNumThreads.push_back(uiNumCores);
+
+	// On the fixture which is the size of the worlds of the game
+	const CWorldFixture* pFixture = vFixtures[0];
+	for (unsigned int i = 0; i < sizeof(ENEMY_COUNTS) / sizeof(ENEMY_COUNTS[0]); i++)
+	{
+		for (unsigned int j = 0; j < vNumThreads.size(); j++)
+		{
+			const unsigned int uiNumEnemies = ENEMY_COUNTS[i];
+			const unsigned int uiNumThreads = vNumThreads[j];
+			stringstream ss;
+			ss << pFixture->GetName() << "/" << uiNumEnemies << " enemies/" << uiNumThreads << " threads";
+			cBenchmark.Add("CEnemy2D::UpdateAll", ss.str(),
+				[this]() {
+					vector<glm::i32vec2> vSpawnPositions;
+					for (unsigned int uiStep = 0; uiStep < NUM_ENEMY_STEPS; uiStep++)
+					{
+						CPhysicsWorld2D::GetInstance()->Step(1.0f / 60.0f);
+						CEnemy2D::UpdateAll(vEnemies, 1.0 / 60.0, vSpawnPositions);
+					}
+					CBenchmark::DoNotOptimise(vSpawnPositions.size());
+				},
+				[this, pFixture, uiNumEnemies, uiNumThreads]() { UseEnemies(pFixture, uiNumEnemies, uiNumThreads); });
+		}
+	}
+
+	// The chunks of the terrain, generated one after another on one thread, with the columns per second as the items per second
+	{
+		stringstream ss;
+		ss << NUM_TERRAIN_CHUNKS * CTerrainGenerator::NUM_CHUNK_COLS << " columns";
+		cBenchmark.Add("CTerrainGenerator::GenerateChunk", ss.str(),
+			[this]() {
+				CTerrainGenerator cTerrainGenerator;
+				cTerrainGenerator.Init(uiSeed, 24, 3, 302, true);
+				vector<int> vTiles;
+				unsigned int uiNumTiles = 0;
+				for (unsigned int uiChunk = 0; uiChunk < NUM_TERRAIN_CHUNKS; uiChunk++)
+				{
+					cTerrainGenerator.GenerateChunk(uiChunk, vTiles);
+					uiNumTiles += (unsigned int)vTiles.size();
+				}
+				CBenchmark::DoNotOptimise(uiNumTiles);
+			},
+			nullptr,
+			NUM_TERRAIN_CHUNKS * CTerrainGenerator::NUM_CHUNK_COLS);
+	}
+
+	// The whole map of the widest fixture generated with each number of threads
+	const CWorldFixture* pLargestFixture = vFixtures[0];
+	for (unsigned int i = 1; i < vFixtures.size(); i++)
+	{
+		if (vFixtures[i]->GetNumCols() > pLargestFixture->GetNumCols())
+			pLargestFixture = vFixtures[i];
+	}
+	for (unsigned int i = 0; i < vNumThreads.size(); i++)
+	{
+		const unsigned int uiNumThreads = vNumThreads[i];
+		stringstream ss;
+		ss << pLargestFixture->GetName() << "/" << uiNumThreads << " threads";
+		cBenchmark.Add("CMap2D::GenerateRandomMap", ss.str(),
+			[this]() { cMap2D->GenerateRandomMap(); },
+			[this, pLargestFixture, uiNumThreads]() {
+				ResetFixture(pLargestFixture);
+				UseThreads(uiNumThreads);
+				cMap2D->SetWorldSeed(uiSeed);
+			},
+			pLargestFixture->GetNumCols() - 3);
+	}
+
+	// The falling bodies, integrated together by CPhysicsWorld2D, and one at a time by CPhysics2D::Update
+	for (unsigned int i = 0; i < sizeof(BODY_COUNTS) / sizeof(BODY_COUNTS[0]); i++)
+	{
+		const unsigned int uiNumBodies = BODY_COUNTS[i];
+		stringstream ss;
+		ss << uiNumBodies << " bodies";
+		cBenchmark.Add("CPhysicsWorld2D::Step", ss.str(),
+			[this]() { CBenchmark::DoNotOptimise(UpdateBodies(true)); },
+			[this, uiNumBodies]() { UseBodies(uiNumBodies); });
+		cBenchmark.Add("CPhysics2D::Update", ss.str(),
+			[this]() { CBenchmark::DoNotOptimise(UpdateBodies(false)); },
+			[this, uiNumBodies]() { UseBodies(uiNumBodies); });
+	}
+}
+
+/**
+ @brief Load a fixture into CMap2D, unless it is loaded already
+ @param pFixture The fixture
+ */
+void CScene2DBenchmarks::UseFixture(const CWorldFixture* pFixture)
+{
+	if (pLoadedFixture == pFixture)
+		return;
+	cMap2D->LoadMap(pFixture->GetMapPath());
+	CMap2D::activeWorld = pFixture->GetWorldName();
+	pLoadedFixture = pFixture;
+}
+
+/**
+ @brief Load a fixture into CMap2D for a benchmark which changes its tiles,
+		so that the next benchmark loads its fixture again
+ @param pFixture The fixture
+ */
+void CScene2DBenchmarks::ResetFixture(const CWorldFixture* pFixture)
+{
+	UseFixture(pFixture);
+	pLoadedFixture = NULL;
+}
+
+/**
+ @brief Plant seeds in the empty tiles of the 4 rows above the ground of a fixture which is loaded,
+		so that CMap2D::UpdateSeed has thousands of seeds to grow on the large fixture
+ @param pFixture The fixture
+ @return The number of seeds which were planted
+ */
+unsigned int CScene2DBenchmarks::PlantSeedField(const CWorldFixture* pFixture)
+{
+	unsigned int uiNumSeeds = 0;
+	for (unsigned int uiCol = 0; uiCol < pFixture->GetNumCols(); uiCol++)
+	{
+		const glm::i32vec2 i32vec2GroundPos = pFixture->GetGroundPos(uiCol);
+		for (int iRow = i32vec2GroundPos.y; (iRow < i32vec2GroundPos.y + 4) && (iRow < (int)pFixture->GetNumRows()); iRow++)
+		{
+			if (cMap2D->GetMapInfo(iRow, uiCol) != 0)
+				continue;
+			cMap2D->SetMapInfo(iRow, uiCol, (uiNumSeeds % 2 == 0) ? 100 : 102);
+			uiNumSeeds++;
+		}
+	}
+	return uiNumSeeds;
+}
+
+/**
+ @brief Run the collision checks which CPlayer2D::Update runs, with the player on the ground of every column
+ @param pFixture The fixture which is loaded
+ @return The number of checks which found a collision
+ */
+unsigned int CScene2DBenchmarks::CheckCollisions(const CWorldFixture* pFixture)
+{
+	const glm::i32vec2 i32vec2OldIndex = cPlayer2D->i32vec2Index;
+	const glm::i32vec2 i32vec2OldMicroSteps = cPlayer2D->i32vec2NumMicroSteps;
+
+	unsigned int uiNumCollisions = 0;
+	for (unsigned int uiCol = 1; uiCol + 1 < pFixture->GetNumCols(); uiCol++)
+	{
+		cPlayer2D->i32vec2Index = pFixture->GetGroundPos(uiCol);
+		cPlayer2D->i32vec2NumMicroSteps = glm::i32vec2(0, 0);
+		for (int iDirection = CPlayer2D::LEFT; iDirection < CPlayer2D::NUM_DIRECTIONS; iDirection++)
+		{
+			const CPlayer2D::DIRECTION eDirection = (CPlayer2D::DIRECTION)iDirection;
+			if (cPlayer2D->CheckPosition(eDirection, TILE_SOLID) == false)
+				uiNumCollisions++;
+			if (cPlayer2D->Collision(eDirection, TILE_SOLID) == true)
+				uiNumCollisions++;
+		}
+		if (cPlayer2D->IsMidAir() == true)
+			uiNumCollisions++;
+	}
+
+	cPlayer2D->i32vec2Index = i32vec2OldIndex;
+	cPlayer2D->i32vec2NumMicroSteps = i32vec2OldMicroSteps;
+	return uiNumCollisions;
+}
+
+/**
+ @brief Drop an entity which is between 2 columns from the top row of every column, as a fall which is not stopped
+		by the frame rate would, and jump it back up from where it lands
+ @param pFixture The fixture which is loaded
+ @return The sum of the rows where the sweeps were blocked
+ */
+unsigned int CScene2DBenchmarks::SweepColumns(const CWorldFixture* pFixture)
+{
+	const glm::i32vec2 i32vec2NumMicroSteps(1, 0);
+	const int iTopRow = (int)pFixture->GetNumRows() - 1;
+
+	unsigned int uiSum = 0;
+	for (unsigned int uiCol = 0; uiCol + 1 < pFixture->GetNumCols(); uiCol++)
+	{
+		int iBlockedRow = 0;
+		if (cMap2D->SweepRows(glm::i32vec2(uiCol, iTopRow), i32vec2NumMicroSteps, -1, 0, TILE_SOLID, iBlockedRow) == false)
+			continue;
+		uiSum += iBlockedRow;
+		if (cMap2D->SweepRows(glm::i32vec2(uiCol, iBlockedRow + 1), i32vec2NumMicroSteps, 1, iTopRow, TILE_SOLID, iBlockedRow) == true)
+			uiSum += iBlockedRow;
+	}
+	return uiSum;
+}
+
+/**
+ @brief Set the number of threads of CJobSystem, unless it has that many already
+ @param uiNumThreads The number of threads, including the thread which waits for the jobs
+ */
+void CScene2DBenchmarks::UseThreads(const unsigned int uiNumThreads)
+{
+	CJobSystem* cJobSystem = CJobSystem::GetInstance();
+	if (cJobSystem->GetNumThreads() != uiNumThreads)
+	{
+		CSettings::GetInstance()->bParallelJobs = true;
+		cJobSystem->Init(uiNumThreads);
+	}
+}
+
+/**
+ @brief Create the enemies on a fixture if there is not that many, set the number of threads of CJobSystem,
+		and put the enemies and the player back to where they started, so that every iteration runs the same updates
+ @param pFixture The fixture
+ @param uiNumEnemies The number of enemies
+ @param uiNumThreads The number of threads which update the enemies
+ */
+void CScene2DBenchmarks::UseEnemies(const CWorldFixture* pFixture, const unsigned int uiNumEnemies, const unsigned int uiNumThreads)
+{
+	UseFixture(pFixture);
+	UseThreads(uiNumThreads);
+
+	// The player stands at the door. Out of survival mode, the enemies do not hurt the player,
+	// so that the player's health does not change between iterations.
+	cPlayer2D->i32vec2Index = pFixture->GetStartPos();
+	cPlayer2D->i32vec2NumMicroSteps = glm::i32vec2(0, 0);
+	cPlayer2D->isSurvival = false;
+
+	if (vEnemies.size() != uiNumEnemies)
+	{
+		DeleteEnemies();
+		for (unsigned int i = 0; i < uiNumEnemies; i++)
+		{
+			// CEnemy2D::Init finds its tile in the map and erases it
+			const glm::i32vec2 i32vec2StartPos = GetEnemyStartPos(pFixture, i);
+			cMap2D->SetMapInfo(i32vec2StartPos.y, i32vec2StartPos.x, 301);
+			CEnemy2D* cEnemy2D = new CEnemy2D();
+			if (cEnemy2D->Init() == false)
+			{
+				delete cEnemy2D;
+				cout << "Failed to initialise CEnemy2D for the benchmarks" << endl;
+				break;
+			}
+			vEnemies.push_back(cEnemy2D);
+		}
+	}
+
+	for (unsigned int i = 0; i < vEnemies.size(); i++)
+	{
+		CEnemy2D* cEnemy2D = vEnemies[i];
+		cEnemy2D->i32vec2Index = GetEnemyStartPos(pFixture, i);
+		cEnemy2D->i32vec2NumMicroSteps = glm::i32vec2(0, 0);
+		cEnemy2D->sCurrentFSM = CEnemy2D::PATROL;
+		cEnemy2D->iFSMCounter = 0;
+		cEnemy2D->health = cEnemy2D->maxHealth;
+		cEnemy2D->bIsActive = true;
+		cEnemy2D->cPhysics2D.Init();
+		cEnemy2D->cPhysics2D.SetStatus(CPhysics2D::STATUS::FALL);
+		cEnemy2D->cRandom.seed(i + 1);
+		// Set the player again to reset the direction of the enemy
+		cEnemy2D->SetPlayer2D(cPlayer2D);
+	}
+}
+
+/**
+ @brief Delete the enemies
+ */
+void CScene2DBenchmarks::DeleteEnemies(void)
+{
+	for (unsigned int i = 0; i < vEnemies.size(); i++)
+		delete vEnemies[i];
+	vEnemies.clear();
+}
+
+/**
+ @brief Create the bodies if there is not that many, and make each of them start falling with a different velocity
+ @param uiNumBodies The number of bodies
+ */
+void CScene2DBenchmarks::UseBodies(const unsigned int uiNumBodies)
+{
+	if (this->uiNumBodies != uiNumBodies)
+	{
+		DeleteBodies();
+		pBodies = new CPhysics2D[uiNumBodies];
+		this->uiNumBodies = uiNumBodies;
+	}
+
+	for (unsigned int i = 0; i < uiNumBodies; i++)
+	{
+		pBodies[i].SetStatus(CPhysics2D::STATUS::IDLE);
+		pBodies[i].SetStatus(CPhysics2D::STATUS::FALL);
+		pBodies[i].SetInitialVelocity(glm::vec2(0.0f, (float)(i % 8)));
+	}
+}
+
+/**
+ @brief Run the bodies for NUM_BODY_STEPS fixed time steps, as the entities do in CScene2D::FixedUpdate
+ @param bStep true if CPhysicsWorld2D::Step integrates the bodies at the start of each step,
+		else each body is integrated by its CPhysics2D::Update
+ @return The sum of the displacements, so that the updates are not optimised away
+ */
+float CScene2DBenchmarks::UpdateBodies(const bool bStep)
+{
+	float fDisplacement = 0.0f;
+	for (unsigned int uiStep = 0; uiStep < NUM_BODY_STEPS; uiStep++)
+	{
+		if (bStep)
+			CPhysicsWorld2D::GetInstance()->Step(1.0f / 60.0f);
+		for (unsigned int i = 0; i < uiNumBodies; i++)
+		{
+			pBodies[i].SetTime(1.0f / 60.0f);
+			pBodies[i].Update();
+			fDisplacement += pBodies[i].GetDisplacement().y;
+		}
+	}
+	return fDisplacement;
+}
+
+/**
+ @brief Delete the bodies
+ */
+void CScene2DBenchmarks::DeleteBodies(void)
+{
+	delete[] pBodies;
+	pBodies = NULL;
+	uiNumBodies = 0;
+}
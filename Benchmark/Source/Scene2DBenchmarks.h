@@ -0,0 +1,84 @@
+/**
+ CScene2DBenchmarks
+ @brief The benchmarks of the hot paths of CMap2D, CPlayer2D and CEnemy2D, run on the world fixtures.
+		CMap2D and CPlayer2D are initialised without a window, as CHeadlessDriver does,
+		and the map is sized for the largest fixture, so that every fixture fits in it.
+		The enemy updates are run with several numbers of threads, to show how they scale with the cores.
+		The falling bodies are run with and without CPhysicsWorld2D::Step, to compare it with CPhysics2D::Update.
+		The map generation reports the columns which it generates per second as its items per second.
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#pragma once
+
+#include <vector>
+
+class CBenchmark;
+class CWorldFixture;
+class CMap2D;
+class CPlayer2D;
+class CEnemy2D;
+class CPhysics2D;
+class CRecordingRenderDevice;
+
+class CScene2DBenchmarks
+{
+public:
+	// Constructor
+	CScene2DBenchmarks(void);
+	// Destructor
+	~CScene2DBenchmarks(void);
+
+	// Initialise CMap2D and CPlayer2D without a window. The fixtures must have been written.
+	bool Init(const std::vector<CWorldFixture*>& vFixtures, const unsigned int uiSeed);
+	// Destroy CMap2D, CPlayer2D and the enemies, stop CJobSystem, and restore the OpenGL render device
+	void Destroy(void);
+
+	// Add the benchmarks for each fixture
+	void Register(CBenchmark& cBenchmark);
+
+protected:
+	// Load a fixture into CMap2D, unless it is loaded already
+	void UseFixture(const CWorldFixture* pFixture);
+	// Load a fixture into CMap2D for a benchmark which changes its tiles
+	void ResetFixture(const CWorldFixture* pFixture);
+
+	// Plant seeds in the empty tiles above the ground of a fixture which is loaded
+	unsigned int PlantSeedField(const CWorldFixture* pFixture);
+
+	// Run the collision checks of the player on the ground of every column of a fixture
+	unsigned int CheckCollisions(const CWorldFixture* pFixture);
+	// Sweep an entity down from the top of every column of a fixture to the ground, and back up
+	unsigned int SweepColumns(const CWorldFixture* pFixture);
+
+	// Set the number of threads of CJobSystem, unless it has that many already
+	void UseThreads(const unsigned int uiNumThreads);
+	// Create the enemies on a fixture if there is not that many, set the number of threads of CJobSystem,
+	// and put the enemies and the player back to where they started
+	void UseEnemies(const CWorldFixture* pFixture, const unsigned int uiNumEnemies, const unsigned int uiNumThreads);
+	// Delete the enemies
+	void DeleteEnemies(void);
+
+	// Create the bodies if there is not that many, and make each of them start falling
+	void UseBodies(const unsigned int uiNumBodies);
+	// Run the bodies for NUM_BODY_STEPS fixed time steps, with or without CPhysicsWorld2D::Step
+	float UpdateBodies(const bool bStep);
+	// Delete the bodies
+	void DeleteBodies(void);
+
+	std::vector<CWorldFixture*> vFixtures;
+	// The fixture whose tiles are in CMap2D, or NULL if a benchmark has changed them
+	const CWorldFixture* pLoadedFixture;
+	// The world seed of the benchmarks which generate columns
+	unsigned int uiSeed;
+
+	CMap2D* cMap2D;
+	CPlayer2D* cPlayer2D;
+	// The enemies of the enemy update benchmarks
+	std::vector<CEnemy2D*> vEnemies;
+	// The render device which records the calls instead of sending them to a GPU
+	CRecordingRenderDevice* pRenderDevice;
+	// The bodies of the physics benchmarks
+	CPhysics2D* pBodies;
+	unsigned int uiNumBodies;
+};
@@ -0,0 +1,203 @@
+/**
+ CWorldFixture
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#include "WorldFixture.h"
+
+// Include FileSystem to find the Maps folder as CMap2D does
+#include "System\filesystem.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <random>
+using namespace std;
+
+/**
+ @brief Constructor
+ @param sName The name of the fixture, e.g. Small
+ @param uiNumCols The number of columns of tiles
+ @param uiNumRows The number of rows of tiles. It should be at least 24, as CMap2D::GenerateRandomMap places the ground at rows 18 to 24.
+ @param uiSeed The seed which the tiles are generated from
+ */
+CWorldFixture::CWorldFixture(const std::string& sName, const unsigned int uiNumCols, const unsigned int uiNumRows, const unsigned int uiSeed)
+	: sName(sName)
+	, uiNumCols(uiNumCols)
+	, uiNumRows(uiNumRows)
+	, uiSeed(uiSeed)
+	, i32vec2StartPos(0, 0)
+	, i32vec2TargetPos(0, 0)
+{
+	Generate();
+}
+
+/**
+ @brief Destructor
+ */
+CWorldFixture::~CWorldFixture(void)
+{
+}
+
+/**
+ @brief Write the tiles to the Maps folder in the format of the map files, with a comment line for the column labels
+ @return A bool value. true if the file was written, else false
+ */
+bool CWorldFixture::Write(void)
+{
+	ofstream outFile(FileSystem::getPath(GetMapPath()).c_str());
+	if (!outFile.is_open())
+	{
+		cout << "Unable to write the world fixture " << GetMapPath() << endl;
+		return false;
+	}
+
+	outFile << "//";
+	for (unsigned int uiCol = 0; uiCol < uiNumCols; uiCol++)
+		outFile << (uiCol > 0 ? "," : "") << uiCol + 1;
+	outFile << endl;
+
+	for (unsigned int uiRow = 0; uiRow < uiNumRows; uiRow++)
+	{
+		for (unsigned int uiCol = 0; uiCol < uiNumCols; uiCol++)
+			outFile << (uiCol > 0 ? "," : "") << vTiles[uiRow * uiNumCols + uiCol];
+		outFile << endl;
+	}
+	return true;
+}
+
+/**
+ @brief Delete the file which was written
+ */
+void CWorldFixture::Remove(void)
+{
+	remove(FileSystem::getPath(GetMapPath()).c_str());
+}
+
+/**
+ @brief Get the name of the fixture
+ */
+const std::string& CWorldFixture::GetName(void) const
+{
+	return sName;
+}
+
+/**
+ @brief Get the name of the world, which CMap2D::activeWorld can be set to
+ */
+std::string CWorldFixture::GetWorldName(void) const
+{
+	return "Benchmark_" + sName;
+}
+
+/**
+ @brief Get the path of the map file
+ */
+std::string CWorldFixture::GetMapPath(void) const
+{
+	return "Maps/" + GetWorldName() + ".csv";
+}
+
+/**
+ @brief Get the number of columns of tiles
+ */
+unsigned int CWorldFixture::GetNumCols(void) const
+{
+	return uiNumCols;
+}
+
+/**
+ @brief Get the number of rows of tiles
+ */
+unsigned int CWorldFixture::GetNumRows(void) const
+{
+	return uiNumRows;
+}
+
+/**
+ @brief Get the position of the door, where the player starts
+ */
+glm::i32vec2 CWorldFixture::GetStartPos(void) const
+{
+	return i32vec2StartPos;
+}
+
+/**
+ @brief Get the position of the far corner of the sky, which a path from the door has to go around the walls of trees to
+ */
+glm::i32vec2 CWorldFixture::GetTargetPos(void) const
+{
+	return i32vec2TargetPos;
+}
+
+/**
+ @brief Get the position which a player standing on the ground of a column is at
+ @param uiCol The column
+ */
+glm::i32vec2 CWorldFixture::GetGroundPos(const unsigned int uiCol) const
+{
+	return glm::i32vec2(uiCol, uiNumRows - vGroundRows[uiCol]);
+}
+
+/**
+ @brief Generate the tiles from the seed, using the tile codes of CMap2D
+ */
+void CWorldFixture::Generate(void)
+{
+	// A generator of our own, so that the fixture does not depend on the state of rand()
+	mt19937 cRandom(uiSeed);
+	uniform_int_distribution<int> cStep(-1, 1);
+	uniform_int_distribution<int> cChance(0, 99);
+
+	vTiles.assign(uiNumCols * uiNumRows, 0);
+	vGroundRows.assign(uiNumCols, 0);
+
+	// The ground walks up and down between the middle and the bottom of the world
+	const int iMinGroundRow = (int)uiNumRows / 2;
+	const int iMaxGroundRow = (int)uiNumRows - 4;
+	int iGroundRow = (iMinGroundRow + iMaxGroundRow) / 2;
+	for (unsigned int uiCol = 0; uiCol < uiNumCols; uiCol++)
+	{
+		if (uiCol > 4)
+			iGroundRow = max(iMinGroundRow, min(iMaxGroundRow, iGroundRow + cStep(cRandom)));
+		vGroundRows[uiCol] = iGroundRow;
+
+		int* pColumn = &vTiles[uiCol];
+		// Grass on the ground, dirt below it with some lava, and bedrock at the bottom
+		pColumn[iGroundRow * uiNumCols] = 2;
+		for (int iRow = iGroundRow + 1; iRow < (int)uiNumRows - 1; iRow++)
+			pColumn[iRow * uiNumCols] = ((iRow == iGroundRow + 1) && (cChance(cRandom) < 10)) ? 5 : 3;
+		pColumn[(uiNumRows - 1) * uiNumCols] = 1;
+
+		// Walls of trees every 16 columns, with a gap at the ground or at the top, in turn
+		if ((uiCol % 16 == 8) && (uiCol + 4 < uiNumCols))
+		{
+			const bool bGapAtGround = ((uiCol / 16) % 2 == 0);
+			const int iFirstRow = bGapAtGround ? 0 : 3;
+			const int iLastRow = bGapAtGround ? iGroundRow - 4 : iGroundRow - 1;
+			for (int iRow = iFirstRow; iRow <= iLastRow; iRow++)
+				pColumn[iRow * uiNumCols] = 100;
+			continue;
+		}
+
+		// Seeds, which CMap2D::UpdateSeed grows, and chests on the ground
+		const int iChance = cChance(cRandom);
+		if (iChance < 8)
+			pColumn[(iGroundRow - 1) * uiNumCols] = (iChance < 4) ? 100 : 102;
+		else if (iChance < 13)
+			pColumn[(iGroundRow - 1) * uiNumCols] = 4;
+	}
+
+	// The door which the player starts at
+	vTiles[(vGroundRows[2] - 1) * uiNumCols + 2] = 201;
+	i32vec2StartPos = glm::i32vec2(2, uiNumRows - vGroundRows[2]);
+
+	// The shop at the bottom right, so that CMap2D::FindValue scans almost every tile to find it
+	vTiles[(uiNumRows - 2) * uiNumCols + uiNumCols - 2] = 6;
+
+	// The target of the path is in the top row, in the last column without a tree
+	unsigned int uiTargetCol = uiNumCols - 1;
+	while ((uiTargetCol > 0) && (vTiles[uiTargetCol] != 0))
+		uiTargetCol--;
+	i32vec2TargetPos = glm::i32vec2(uiTargetCol, uiNumRows - 1);
+}
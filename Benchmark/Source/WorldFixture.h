@@ -0,0 +1,64 @@
+/**
+ CWorldFixture
+ @brief A world of a given size which is generated from a seed, so that every benchmark run
+		loads the same tiles. It has terrain with seeds, chests and lava, and walls of trees
+		in the air, which CMap2D::PathFind treats as blocked, so that a path across the world
+		has to go around them. The player starts at a door near the left edge.
+		The world is written to the Maps folder, as CMap2D only loads maps from there.
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#pragma once
+
+// Include GLM
+#include <includes/glm.hpp>
+
+#include <string>
+#include <vector>
+
+class CWorldFixture
+{
+public:
+	// Constructor
+	CWorldFixture(const std::string& sName, const unsigned int uiNumCols, const unsigned int uiNumRows, const unsigned int uiSeed);
+	// Destructor
+	~CWorldFixture(void);
+
+	// Generate the tiles and write them to the Maps folder
+	bool Write(void);
+	// Delete the file which was written
+	void Remove(void);
+
+	// Get the name of the fixture, e.g. Small
+	const std::string& GetName(void) const;
+	// Get the name of the world, which CMap2D::activeWorld can be set to
+	std::string GetWorldName(void) const;
+	// Get the path of the map file, which CMap2D::LoadMap can load
+	std::string GetMapPath(void) const;
+
+	unsigned int GetNumCols(void) const;
+	unsigned int GetNumRows(void) const;
+
+	// Get the position of the door and of the far corner of the sky, with rows counted from the bottom as in CMap2D::PathFind
+	glm::i32vec2 GetStartPos(void) const;
+	glm::i32vec2 GetTargetPos(void) const;
+	// Get the position which a player standing on the ground of a column is at, with rows counted from the bottom
+	glm::i32vec2 GetGroundPos(const unsigned int uiCol) const;
+
+protected:
+	// Generate the tiles from the seed
+	void Generate(void);
+
+	std::string sName;
+	unsigned int uiNumCols;
+	unsigned int uiNumRows;
+	unsigned int uiSeed;
+
+	// The tiles, with rows counted from the top as in the map file
+	std::vector<int> vTiles;
+	// The row of the ground in each column, counted from the top
+	std::vector<unsigned int> vGroundRows;
+
+	glm::i32vec2 i32vec2StartPos;
+	glm::i32vec2 i32vec2TargetPos;
+};
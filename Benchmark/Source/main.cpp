@@ -0,0 +1,129 @@
+/**
+ main.cpp
+ @brief This file contains the main function of the Benchmark tool, which times the hot paths
+		of the Library and of Scene2D on generated worlds of several sizes, without a window.
+		The results are printed in CSV format, and can be written to a file and compared
+		with a baseline, so that a regression is caught before it ships.
+		It must run in the App folder, as it loads the assets of the game.
+
+		Usage: Benchmark [--assets <dir>] [--filter <name>] [--min-time <seconds>] [--seed <number>]
+						 [--csv <file>] [--baseline <file>] [--tolerance <percent>]
+		e.g.   Benchmark --assets App --csv Benchmark.csv
+			   Benchmark --assets App --baseline Benchmark.csv --tolerance 10
+ */
+#include "Benchmark.h"
+#include "WorldFixture.h"
+#include "Scene2DBenchmarks.h"
+#include "LibraryBenchmarks.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+using namespace std;
+
+#ifdef _WIN32
+	#include <direct.h>
+	#define ChangeDir _chdir
+#else
+	#include <unistd.h>
+	#define ChangeDir chdir
+#endif
+
+/**
+ @brief This function is the main function which is called by the operating system when you run the executables
+ @return This function returns the error codes. 0 if the benchmarks ran, 2 if there were regressions, else 1
+ */
+int main(int argc, char* argv[])
+{
+	string sAssets, sFilter, sCSV, sBaseline;
+	double dMinTime = 0.2;
+	double dTolerance = 10.0;
+	unsigned int uiSeed = 0;
+	for (int i = 1; i < argc; i++)
+	{
+		const string sOption = argv[i];
+		const bool bHasValue = (i + 1 < argc);
+		if ((sOption == "--assets") && (bHasValue))
+			sAssets = argv[++i];
+		else if ((sOption == "--filter") && (bHasValue))
+			sFilter = argv[++i];
+		else if ((sOption == "--min-time") && (bHasValue))
+			dMinTime = atof(argv[++i]);
+		else if ((sOption == "--seed") && (bHasValue))
+			uiSeed = (unsigned int)atoi(argv[++i]);
+		else if ((sOption == "--csv") && (bHasValue))
+			sCSV = argv[++i];
+		else if ((sOption == "--baseline") && (bHasValue))
+			sBaseline = argv[++i];
+		else if ((sOption == "--tolerance") && (bHasValue))
+			dTolerance = atof(argv[++i]);
+		else
+		{
+			cout << "Unknown option " << sOption << endl;
+			cout << "Usage: Benchmark [--assets <dir>] [--filter <name>] [--min-time <seconds>] [--seed <number>]"
+				 << " [--csv <file>] [--baseline <file>] [--tolerance <percent>]" << endl;
+			return 1;
+		}
+	}
+
+	if ((!sAssets.empty()) && (ChangeDir(sAssets.c_str()) != 0))
+	{
+		cout << "Unable to change to the asset directory " << sAssets << endl;
+		return 1;
+	}
+
+	// The size of the worlds of the game, and worlds which are 4 and 16 times as large
+	vector<CWorldFixture*> vFixtures;
+	vFixtures.push_back(new CWorldFixture("Small", 100, 24, uiSeed));
+	vFixtures.push_back(new CWorldFixture("Medium", 400, 32, uiSeed));
+	vFixtures.push_back(new CWorldFixture("Large", 1600, 48, uiSeed));
+
+	int iExitCode = 0;
+	bool bFixturesWritten = true;
+	for (unsigned int i = 0; i < vFixtures.size(); i++)
+		bFixturesWritten = (vFixtures[i]->Write() && bFixturesWritten);
+
+	CScene2DBenchmarks cScene2DBenchmarks;
+	CLibraryBenchmarks cLibraryBenchmarks;
+	if ((!bFixturesWritten) ||
+		(!cScene2DBenchmarks.Init(vFixtures, uiSeed)) ||
+		(!cLibraryBenchmarks.Init(vFixtures)))
+	{
+		iExitCode = 1;
+	}
+	else
+	{
+		CBenchmark cBenchmark;
+		cBenchmark.SetMinTime(dMinTime);
+		cScene2DBenchmarks.Register(cBenchmark);
+		cLibraryBenchmarks.Register(cBenchmark);
+		cBenchmark.Run(sFilter);
+
+		cout << endl;
+		cBenchmark.PrintResults();
+		if ((!sCSV.empty()) && (!cBenchmark.WriteCSV(sCSV)))
+			iExitCode = 1;
+		if (!sBaseline.empty())
+		{
+			const int iNumRegressions = cBenchmark.CompareWithBaseline(sBaseline, dTolerance / 100.0);
+			if (iNumRegressions < 0)
+				iExitCode = 1;
+			else if (iNumRegressions > 0)
+				iExitCode = 2;
+		}
+	}
+
+	// The sprite uses the render device of the Scene2D benchmarks, so destroy it first
+	cLibraryBenchmarks.Destroy();
+	cScene2DBenchmarks.Destroy();
+	for (unsigned int i = 0; i < vFixtures.size(); i++)
+	{
+		vFixtures[i]->Remove();
+		delete vFixtures[i];
+	}
+	remove("Maps/Benchmark_Scratch.csv");
+
+	return iExitCode;
+}
@@ -10,6 +10,8 @@
 
 // Include ImageLoader
 #include "..\System\ImageLoader.h"
+// Include CProfiler
+#include "../TimeControl/Profiler.h"
 
 #include <iostream>
 using namespace std;
@@ -77,6 +79,8 @@ void CGUI::PreRender(void)
  */
 void CGUI::Render(string actWorld)
 {
+	PROFILE_ZONE("CGUI::Render");
+
 	cTextRenderer->Render(worldInput, 40.f, 40.f, 1.f, glm::vec3(1.0f, 0.0f, 0.0f));
 	cTextRenderer->Render(actWorld, 600, 680, 1.f, glm::vec3(1.0f, 0.0f, 0.0f));
 }
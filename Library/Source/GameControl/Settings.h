@@ -46,9 +46,37 @@ public:
 	bool bDisableMousePointer = false;
 	bool bShowMousePointer = true;
 
+	// Asset loading
+	// Decode the assets on worker threads at startup. Set to false to load them one by one on the main thread.
+	bool bParallelAssetLoading = true;
+	// Upload the images in the texture pack written by TexturePacker, instead of decoding their image files
+	bool bUseTexturePack = true;
+	// Load the shader programs from the program binary cache next to the shaders, instead of compiling them
+	bool bUseProgramBinaryCache = true;
+
+	// Game work
+	// Run the per-frame game work, e.g. the enemy updates, on the worker threads of CJobSystem. Set to false to run it on the main thread.
+	bool bParallelJobs = true;
+	// Submit the OpenGL calls of each frame on a render thread, while the main thread runs the next frame. Set to false to render on the main thread.
+	bool bRenderThread = true;
+
+	// Audio
+	// Mix the sounds in software instead of playing them on an audio device, e.g. on machines without one
+	bool bOfflineAudio = false;
+
 	// Frame Rate Information
 	const unsigned char FPS = 60; // FPS of this game
 	const unsigned int frameTime = 1000 / FPS; // time for each frame
+	// Wait at the end of each frame so that the game runs at FPS. Turn it off to measure how fast the game can render.
+	bool bLimitFrameRate = true;
+
+	// Simulation Information
+	// The number of fixed time steps per second which the player, enemies and entities are updated with
+	unsigned int iTickRate = 60;
+	// The most fixed time steps to run in one frame to catch up. The time beyond them is dropped, so that a slow frame does not make the next one slower.
+	unsigned int iMaxTickSteps = 5;
+	// Run the simulation without a window, GL context, shaders or GUI, e.g. for benchmarks and soak tests on a build farm
+	bool bHeadless = false;
 
 	// Input control
 	//const bool bActivateMouseInput
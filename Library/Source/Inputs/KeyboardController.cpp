@@ -4,6 +4,7 @@
  @brief This Constructor is a protected access modified as this class instance will be a Singleton.
  */
 CKeyboardController::CKeyboardController(void)
+	: bInFixedUpdate(false)
 {
 }
 
@@ -32,6 +33,24 @@ void CKeyboardController::PostUpdate(void)
 	prevStatus = currStatus;
 }
 
+/**
+ @brief Start a fixed update step. A key which was pressed or released since the last fixed update step
+		is reported once, whether the frames run faster or slower than the fixed update steps.
+ */
+void CKeyboardController::BeginFixedUpdate(void)
+{
+	bInFixedUpdate = true;
+}
+
+/**
+ @brief End a fixed update step
+ */
+void CKeyboardController::EndFixedUpdate(void)
+{
+	prevFixedUpdateStatus = currStatus;
+	bInFixedUpdate = false;
+}
+
 /**
  @brief Perform update operation for a key
  */
@@ -70,6 +89,8 @@ bool CKeyboardController::IsKeyUp(const int key)
  */
 bool CKeyboardController::IsKeyPressed(const int key)
 {
+	if (bInFixedUpdate)
+		return IsKeyDown(key) && !prevFixedUpdateStatus.test(key);
 	return IsKeyDown(key) && !prevStatus.test(key);
 }
 
@@ -79,6 +100,8 @@ bool CKeyboardController::IsKeyPressed(const int key)
  */
 bool CKeyboardController::IsKeyReleased(const int key)
 {
+	if (bInFixedUpdate)
+		return IsKeyUp(key) && prevFixedUpdateStatus.test(key);
 	return IsKeyUp(key) && prevStatus.test(key);
 }
 
@@ -90,6 +113,7 @@ void CKeyboardController::ResetKey(const int key)
 {
 	currStatus[key] = false;
 	prevStatus[key] = false;
+	prevFixedUpdateStatus[key] = false;
 }
 
 /**
@@ -102,6 +126,7 @@ void CKeyboardController::Reset(void)
 	{
 		currStatus[key] = false;
 		prevStatus[key] = false;
+		prevFixedUpdateStatus[key] = false;
 	}
 }
 
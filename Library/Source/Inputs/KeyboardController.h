@@ -27,6 +27,11 @@ public:
 	void Update(const int key, const int action);
 	// Perform post-update operations
 	void PostUpdate(void);
+	// Start a fixed update step. Until EndFixedUpdate, IsKeyPressed and IsKeyReleased compare
+	// against the status at the end of the last fixed update step instead of the last frame.
+	void BeginFixedUpdate(void);
+	// End a fixed update step
+	void EndFixedUpdate(void);
 
 
 	// User Interface
@@ -51,4 +56,8 @@ protected:
 
 	// Bitset to store information about current and previous keypress statuses
 	std::bitset<MAX_KEYS> currStatus, prevStatus;
+	// Bitset to store the keypress statuses at the end of the last fixed update step
+	std::bitset<MAX_KEYS> prevFixedUpdateStatus;
+	// Boolean flag to indicate that a fixed update step is running
+	bool bInFixedUpdate;
 };
@@ -10,6 +10,7 @@ CMouseController::CMouseController()
 	, prev_posX(0.0), prev_posY(0.0)
 	, delta_posX(0.0), delta_posY(0.0)
 	, currBtnStatus(0), prevBtnStatus(0)
+	, prevFixedUpdateBtnStatus(0), bInFixedUpdate(false)
 	, WheelOffset_X(0), WheelOffset_Y(0)
 	, bKeepMouseCentered(true)
 	, bFirstUpdate(true)
@@ -105,6 +106,24 @@ void CMouseController::PostUpdate(void)
 	WheelOffset_Y = 0.0;
 }
 
+/**
+ @brief Start a fixed update step. A button which was pressed or released since the last fixed update step
+		is reported once, whether the frames run faster or slower than the fixed update steps.
+ */
+void CMouseController::BeginFixedUpdate(void)
+{
+	bInFixedUpdate = true;
+}
+
+/**
+ @brief End a fixed update step
+ */
+void CMouseController::EndFixedUpdate(void)
+{
+	prevFixedUpdateBtnStatus = currBtnStatus;
+	bInFixedUpdate = false;
+}
+
 /**
  @brief Check if a button is pressed down
  @param _slot A const int variable which stores the button ID
@@ -130,7 +149,8 @@ bool CMouseController::IsButtonUp(const unsigned char _slot)
 bool CMouseController::IsButtonPressed(const unsigned char _slot)
 {
 	// True if currently button is down, previously is up
-	return IsButtonDown(_slot) && !(prevBtnStatus & (1 << _slot));
+	const unsigned char prevStatus = (bInFixedUpdate ? prevFixedUpdateBtnStatus : prevBtnStatus);
+	return IsButtonDown(_slot) && !(prevStatus & (1 << _slot));
 }
 
 /**
@@ -140,7 +160,8 @@ bool CMouseController::IsButtonPressed(const unsigned char _slot)
 bool CMouseController::IsButtonReleased(const unsigned char _slot)
 {
 	// True if currently button is up, previously is down
-	return IsButtonUp(_slot) && (prevBtnStatus & (1 << _slot));
+	const unsigned char prevStatus = (bInFixedUpdate ? prevFixedUpdateBtnStatus : prevBtnStatus);
+	return IsButtonUp(_slot) && (prevStatus & (1 << _slot));
 }
 
 /**
@@ -35,6 +35,10 @@ public:
 	void UpdateMouseButtonReleased(const int _slot);
 	void UpdateMouseScroll(const double WheelOffset_X, const double WheelOffset_Y);
 	void PostUpdate(void);
+	// Start and end a fixed update step. During a fixed update step, IsButtonPressed and IsButtonReleased
+	// compare against the status at the end of the last fixed update step instead of the last frame.
+	void BeginFixedUpdate(void);
+	void EndFixedUpdate(void);
 
 	// Check the button and scroll wheel statuses
 	bool IsButtonDown(const unsigned char _slot);
@@ -67,6 +71,10 @@ protected:
 			prev_posX, prev_posY, 
 			delta_posX, delta_posY;
 	unsigned char currBtnStatus, prevBtnStatus;
+	// The button statuses at the end of the last fixed update step
+	unsigned char prevFixedUpdateBtnStatus;
+	// Boolean flag to indicate that a fixed update step is running
+	bool bInFixedUpdate;
 	double WheelOffset_X, WheelOffset_Y;
 
 	// Boolean flag to indicate if the mouse will be kept centered
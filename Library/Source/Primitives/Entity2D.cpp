@@ -7,9 +7,11 @@
 
  // Include Shader Manager
 #include "..\RenderControl\ShaderManager.h"
+// Include Render Device
+#include "..\RenderControl\RenderDevice.h"
 
-// Include ImageLoader
-#include "..\System\ImageLoader.h"
+// Include AssetManager
+#include "..\System\AssetManager.h"
 
 #include <iostream>
 using namespace std;
@@ -26,6 +28,8 @@ CEntity2D::CEntity2D(void)
 	, mesh(NULL)
 	, health(0)
 	, maxHealth(1)
+	, bHasPrevUVCoordinate(false)
+	, fRenderAlpha(1.0f)
 {
 	transform = glm::mat4(1.0f);	// make sure to initialize matrix to identity matrix first
 
@@ -37,6 +41,7 @@ CEntity2D::CEntity2D(void)
 
 	// Initialise vec2UVCoordinate
 	vec2UVCoordinate = glm::vec2(0.0f);
+	vec2PrevUVCoordinate = glm::vec2(0.0f);
 }
 
 /**
@@ -45,9 +50,12 @@ CEntity2D::CEntity2D(void)
 CEntity2D::~CEntity2D(void)
 {
 	// optional: de-allocate all resources once they've outlived their purpose:
-	glDeleteVertexArrays(1, &VAO);
-	glDeleteBuffers(1, &VBO);
-	glDeleteBuffers(1, &EBO);
+	CRenderDevice::GetActive()->DeleteVertexArray(VAO);
+	CRenderDevice::GetActive()->DeleteBuffer(VBO);
+	CRenderDevice::GetActive()->DeleteBuffer(EBO);
+
+	// Release the shared texture
+	CAssetManager::GetInstance()->ReleaseTexture(iTextureID);
 }
 
 /**
@@ -69,24 +77,23 @@ bool CEntity2D::Init(void)
 		1, 2, 3  // second triangle
 	};
 
-	glGenVertexArrays(1, &VAO);
-	glGenBuffers(1, &VBO);
-	glGenBuffers(1, &EBO);
+	CRenderDevice* cRenderDevice = CRenderDevice::GetActive();
+	VAO = cRenderDevice->CreateVertexArray();
+	VBO = cRenderDevice->CreateBuffer();
+	EBO = cRenderDevice->CreateBuffer();
 
-	glBindVertexArray(VAO);
+	cRenderDevice->BindVertexArray(VAO);
 
-	glBindBuffer(GL_ARRAY_BUFFER, VBO);
-	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+	cRenderDevice->UploadBuffer(GL_ARRAY_BUFFER, VBO, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+	cRenderDevice->UploadBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO, sizeof(indices), indices, GL_STATIC_DRAW);
 
 	// position attribute
-	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)0);
-	glEnableVertexAttribArray(0);
+	cRenderDevice->VertexAttribPointer(0, 3, 5 * sizeof(float), 0);
+	cRenderDevice->EnableVertexAttrib(0);
 	// texture coord attribute
-	glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
-	glEnableVertexAttribArray(1);
+	cRenderDevice->VertexAttribPointer(1, 2, 5 * sizeof(float), 3 * sizeof(float));
+	cRenderDevice->EnableVertexAttrib(1);
 
 	// Load the enemy2D texture
 	if (LoadTexture("Image/Scene2D_EnemyTile.tga") == false)
@@ -115,17 +122,45 @@ void CEntity2D::Update(const double dElapsedTime)
 {
 }
 
+/**
+ @brief Keep the UV coordinates before a fixed time step, so that the rendering can interpolate from them
+ */
+void CEntity2D::SavePreviousUVCoordinate(void)
+{
+	vec2PrevUVCoordinate = vec2UVCoordinate;
+	bHasPrevUVCoordinate = true;
+}
+
+/**
+ @brief Set the fraction of a fixed time step from the last fixed update to the frame which is rendered
+ @param fAlpha The fraction, from 0 to 1
+ */
+void CEntity2D::SetRenderAlpha(const float fAlpha)
+{
+	fRenderAlpha = fAlpha;
+}
+
+/**
+ @brief Get the UV coordinates to render at, between the previous and current UV coordinates
+ @return The current UV coordinates if there was no fixed time step yet
+ */
+glm::vec2 CEntity2D::GetRenderUVCoordinate(void) const
+{
+	if (!bHasPrevUVCoordinate)
+		return vec2UVCoordinate;
+	return glm::mix(vec2PrevUVCoordinate, vec2UVCoordinate, fRenderAlpha);
+}
+
 /**
  @brief Set up the OpenGL display environment before rendering
  */
 void CEntity2D::PreRender(void)
 {
 	// bind textures on corresponding texture units
-	glActiveTexture(GL_TEXTURE0);
+	CRenderDevice::GetActive()->ActiveTexture(GL_TEXTURE0);
 
 	// Activate blending mode
-	glEnable(GL_BLEND);
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	CRenderDevice::GetActive()->SetBlend(true);
 
 	// Activate the shader
 	CShaderManager::GetInstance()->Use("2DShader");
@@ -136,25 +171,25 @@ void CEntity2D::PreRender(void)
  */
 void CEntity2D::Render(void)
 {
-	// get matrix's uniform location and set matrix
-	unsigned int transformLoc = glGetUniformLocation(CShaderManager::GetInstance()->activeShader->ID, "transform");
-	glUniformMatrix4fv(transformLoc, 1, GL_FALSE, glm::value_ptr(transform));
+	CRenderDevice* cRenderDevice = CRenderDevice::GetActive();
+
+	// get matrix's uniform location
+	GLint transformLoc = cRenderDevice->GetUniformLocation(CShaderManager::GetInstance()->activeShader->ID, "transform");
 
 	transform = glm::mat4(1.0f); // make sure to initialize matrix to identity matrix first
 	transform = glm::translate(transform, glm::vec3(vec2UVCoordinate.x,
 													vec2UVCoordinate.y,
 													0.0f));
 	// Update the shaders with the latest transform
-	glUniformMatrix4fv(transformLoc, 1, GL_FALSE, glm::value_ptr(transform));
+	cRenderDevice->SetUniformMatrix4(transformLoc, glm::value_ptr(transform));
 
 	// Get the texture to be rendered
-	glBindTexture(GL_TEXTURE_2D, iTextureID);
+	cRenderDevice->BindTexture(iTextureID);
 
-	glBindVertexArray(VAO);
+	cRenderDevice->BindVertexArray(VAO);
 	// Render the tile
-	//glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
 	mesh->Render();
-	glBindVertexArray(0);
+	cRenderDevice->BindVertexArray(0);
 
 }
 
@@ -164,7 +199,7 @@ void CEntity2D::Render(void)
 void CEntity2D::PostRender(void)
 {
 	// Disable blending
-	glDisable(GL_BLEND);
+	CRenderDevice::GetActive()->SetBlend(false);
 }
 
 glm::vec2 CEntity2D::GetRelativeCenter()
@@ -181,38 +216,12 @@ glm::vec2 CEntity2D::GetRelativeCenter()
 */
 bool CEntity2D::LoadTexture(const char* filename)
 {
-	// Variables used in loading the texture
-	int width, height, nrChannels;
-	
-	// texture 1
-	// ---------
-	glGenTextures(1, &iTextureID);
-	glBindTexture(GL_TEXTURE_2D, iTextureID);
-	// set the texture wrapping parameters
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-	// set texture filtering parameters
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-	CImageLoader* cImageLoader = CImageLoader::GetInstance();
-	unsigned char *data = cImageLoader->Load(filename, width, height, nrChannels, true);
-	if (data)
-	{
-		if (nrChannels == 3)
-			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, data);
-		else if (nrChannels == 4)
-			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
-
-		// Generate mipmaps
-		glGenerateMipmap(GL_TEXTURE_2D);
-	}
-	else
-	{
+	// Get the shared texture, and release the one which was loaded before
+	GLuint uiNewTextureID = CAssetManager::GetInstance()->AcquireTexture(filename);
+	if (uiNewTextureID == 0)
 		return false;
-	}
-	// Free up the memory of the file data read in
-	free(data);
+	CAssetManager::GetInstance()->ReleaseTexture(iTextureID);
+	iTextureID = uiNewTextureID;
 
 	return true;
 }
@@ -60,6 +60,13 @@ public:
 	// The vec2 variable which stores the UV coordinates to render the enemy2D
 	glm::vec2 vec2UVCoordinate;
 
+	// Keep the UV coordinates before a fixed time step, so that the rendering can interpolate from them
+	void SavePreviousUVCoordinate(void);
+	// Set the fraction of a fixed time step from the last fixed update to the frame which is rendered
+	void SetRenderAlpha(const float fAlpha);
+	// Get the UV coordinates to render at, between the previous and current UV coordinates
+	glm::vec2 GetRenderUVCoordinate(void) const;
+
 
 	//stuffs
 	glm::vec3 vec3Scale;
@@ -108,4 +115,10 @@ protected:
 
 	// Settings
 	CSettings* cSettings;
+
+	// The UV coordinates before the last fixed time step, and whether they were saved yet
+	glm::vec2 vec2PrevUVCoordinate;
+	bool bHasPrevUVCoordinate;
+	// The fraction of a fixed time step to interpolate from vec2PrevUVCoordinate to vec2UVCoordinate
+	float fRenderAlpha;
 };
@@ -6,39 +6,44 @@
 #define GLEW_STATIC
 #endif
 
+// Include Render Device
+#include "../RenderControl/RenderDevice.h"
+
 CMesh::CMesh(): mode(DRAW_TRIANGLES)
 {
-	glGenBuffers(1, &vertexBuffer);
-	glGenBuffers(1, &indexBuffer);
+	vertexBuffer = CRenderDevice::GetActive()->CreateBuffer();
+	indexBuffer = CRenderDevice::GetActive()->CreateBuffer();
 }
 
 CMesh::~CMesh()
 {
-	glDeleteBuffers(1, &vertexBuffer);
-	glDeleteBuffers(1, &indexBuffer);
+	CRenderDevice::GetActive()->DeleteBuffer(vertexBuffer);
+	CRenderDevice::GetActive()->DeleteBuffer(indexBuffer);
 }
 
 void CMesh::Render()
 {
-	glEnableVertexAttribArray(0);
-	glEnableVertexAttribArray(1);
-	glEnableVertexAttribArray(2);
-
-	glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
-	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)0);
-	glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)sizeof(glm::vec3));
-	glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)(sizeof(glm::vec3) + sizeof(glm::vec4)));
+	CRenderDevice* cRenderDevice = CRenderDevice::GetActive();
+
+	cRenderDevice->EnableVertexAttrib(0);
+	cRenderDevice->EnableVertexAttrib(1);
+	cRenderDevice->EnableVertexAttrib(2);
+
+	cRenderDevice->BindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+	cRenderDevice->VertexAttribPointer(0, 3, sizeof(Vertex), 0);
+	cRenderDevice->VertexAttribPointer(1, 4, sizeof(Vertex), sizeof(glm::vec3));
+	cRenderDevice->VertexAttribPointer(2, 2, sizeof(Vertex), sizeof(glm::vec3) + sizeof(glm::vec4));
 	
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+	cRenderDevice->BindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
 
 	if (mode == DRAW_LINES)
-		glDrawElements(GL_LINES, indexSize, GL_UNSIGNED_INT, 0);
+		cRenderDevice->DrawElements(GL_LINES, indexSize, 0);
 	else if (mode == DRAW_TRIANGLE_STRIP)
-		glDrawElements(GL_TRIANGLE_STRIP, indexSize, GL_UNSIGNED_INT, 0);
+		cRenderDevice->DrawElements(GL_TRIANGLE_STRIP, indexSize, 0);
 	else
-		glDrawElements(GL_TRIANGLES, indexSize, GL_UNSIGNED_INT, 0);
+		cRenderDevice->DrawElements(GL_TRIANGLES, indexSize, 0);
 
-	glDisableVertexAttribArray(2);
-	glDisableVertexAttribArray(1);
-	glDisableVertexAttribArray(0);
+	cRenderDevice->DisableVertexAttrib(2);
+	cRenderDevice->DisableVertexAttrib(1);
+	cRenderDevice->DisableVertexAttrib(0);
 }
\ No newline at end of file
@@ -42,7 +42,7 @@ public:
 	};
 
 	CMesh();
-	~CMesh();
+	virtual ~CMesh();
 	virtual void Render();
 
 	unsigned vertexBuffer;
@@ -6,6 +6,9 @@
 #define GLEW_STATIC
 #endif
 
+// Include Render Device
+#include "../RenderControl/RenderDevice.h"
+
 #include <vector>
 
 CMesh* CMeshBuilder::GenerateQuad(glm::vec4 color, float width, float height)
@@ -43,10 +46,8 @@ CMesh* CMeshBuilder::GenerateQuad(glm::vec4 color, float width, float height)
 
 	CMesh* mesh = new CMesh();
 
-	glBindBuffer(GL_ARRAY_BUFFER, mesh->vertexBuffer);
-	glBufferData(GL_ARRAY_BUFFER, vertex_buffer_data.size() * sizeof(Vertex), &vertex_buffer_data[0], GL_STATIC_DRAW);
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh->indexBuffer);
-	glBufferData(GL_ELEMENT_ARRAY_BUFFER, index_buffer_data.size() * sizeof(GLuint), &index_buffer_data[0], GL_STATIC_DRAW);
+	CRenderDevice::GetActive()->UploadBuffer(GL_ARRAY_BUFFER, mesh->vertexBuffer, vertex_buffer_data.size() * sizeof(Vertex), &vertex_buffer_data[0], GL_STATIC_DRAW);
+	CRenderDevice::GetActive()->UploadBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh->indexBuffer, index_buffer_data.size() * sizeof(GLuint), &index_buffer_data[0], GL_STATIC_DRAW);
 
 	mesh->indexSize = index_buffer_data.size();
 	mesh->mode = CMesh::DRAW_TRIANGLES;
@@ -97,10 +98,8 @@ CSpriteAnimation* CMeshBuilder::GenerateSpriteAnimation(unsigned numRow, unsigne
 
 	CSpriteAnimation* mesh = new CSpriteAnimation(numRow, numCol);
 
-	glBindBuffer(GL_ARRAY_BUFFER, mesh->vertexBuffer);
-	glBufferData(GL_ARRAY_BUFFER, vertex_buffer_data.size() * sizeof(Vertex), &vertex_buffer_data[0], GL_STATIC_DRAW);
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh->indexBuffer);
-	glBufferData(GL_ELEMENT_ARRAY_BUFFER, index_buffer_data.size() * sizeof(GLuint), &index_buffer_data[0], GL_STATIC_DRAW);
+	CRenderDevice::GetActive()->UploadBuffer(GL_ARRAY_BUFFER, mesh->vertexBuffer, vertex_buffer_data.size() * sizeof(Vertex), &vertex_buffer_data[0], GL_STATIC_DRAW);
+	CRenderDevice::GetActive()->UploadBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh->indexBuffer, index_buffer_data.size() * sizeof(GLuint), &index_buffer_data[0], GL_STATIC_DRAW);
 
 	mesh->indexSize = index_buffer_data.size();
 	mesh->mode = CMesh::DRAW_TRIANGLES;
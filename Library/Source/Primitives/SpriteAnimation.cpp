@@ -15,6 +15,9 @@ Sprite Animation
 #define GLEW_STATIC
 #endif
 
+// Include Render Device
+#include "../RenderControl/RenderDevice.h"
+
 /******************************************************************************/
 /*!
 \brief
@@ -121,28 +124,30 @@ param None
 /******************************************************************************/
 void CSpriteAnimation::Render()
 {
-	glEnableVertexAttribArray(0);
-	glEnableVertexAttribArray(1);
-	glEnableVertexAttribArray(2);
+	CRenderDevice* cRenderDevice = CRenderDevice::GetActive();
+
+	cRenderDevice->EnableVertexAttrib(0);
+	cRenderDevice->EnableVertexAttrib(1);
+	cRenderDevice->EnableVertexAttrib(2);
 
-	glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
-	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)0);
-	glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)sizeof(glm::vec3));
-	glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)(sizeof(glm::vec3) + sizeof(glm::vec4)));
+	cRenderDevice->BindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+	cRenderDevice->VertexAttribPointer(0, 3, sizeof(Vertex), 0);
+	cRenderDevice->VertexAttribPointer(1, 4, sizeof(Vertex), sizeof(glm::vec3));
+	cRenderDevice->VertexAttribPointer(2, 2, sizeof(Vertex), sizeof(glm::vec3) + sizeof(glm::vec4));
 
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+	cRenderDevice->BindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
 
 	//Draw based on the current frame
 	if (mode == DRAW_LINES)
-		glDrawElements(GL_LINES, 6, GL_UNSIGNED_INT, (void*)(currentFrame * 6 * sizeof(GLuint)));
+		cRenderDevice->DrawElements(GL_LINES, 6, currentFrame * 6 * sizeof(GLuint));
 	else if (mode == DRAW_TRIANGLE_STRIP)
-		glDrawElements(GL_TRIANGLE_STRIP, 6, GL_UNSIGNED_INT, (void*)(currentFrame * 6 * sizeof(GLuint)));
+		cRenderDevice->DrawElements(GL_TRIANGLE_STRIP, 6, currentFrame * 6 * sizeof(GLuint));
 	else
-		glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, (void*)(currentFrame * 6 * sizeof(GLuint)));
+		cRenderDevice->DrawElements(GL_TRIANGLES, 6, currentFrame * 6 * sizeof(GLuint));
 
-	glDisableVertexAttribArray(2);
-	glDisableVertexAttribArray(1);
-	glDisableVertexAttribArray(0);
+	cRenderDevice->DisableVertexAttrib(2);
+	cRenderDevice->DisableVertexAttrib(1);
+	cRenderDevice->DisableVertexAttrib(0);
 }
 
 /******************************************************************************/
@@ -67,7 +67,7 @@ class CSpriteAnimation : public CMesh
 {
 public:
 	CSpriteAnimation(int row, int col);
-	~CSpriteAnimation();
+	virtual ~CSpriteAnimation();
 
 	//Update the animated sprite
 	void Update(double dt);
@@ -0,0 +1,263 @@
+/**
+ CGLRenderDevice
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#include "GLRenderDevice.h"
+
+// Include the Dear ImGui renderer for OpenGL 3
+#include "../GUI/imgui.h"
+#include "../GUI/backends/imgui_impl_opengl3.h"
+
+/**
+ @brief Constructor This constructor has protected access modifier as this class will be a Singleton
+ */
+CGLRenderDevice::CGLRenderDevice(void)
+{
+}
+
+/**
+ @brief Destructor This destructor has protected access modifier as this class will be a Singleton
+ */
+CGLRenderDevice::~CGLRenderDevice(void)
+{
+}
+
+GLuint CGLRenderDevice::DoCreateBuffer(void)
+{
+	GLuint uiBuffer = 0;
+	glGenBuffers(1, &uiBuffer);
+	return uiBuffer;
+}
+
+void CGLRenderDevice::DoDeleteBuffer(const GLuint uiBuffer)
+{
+	glDeleteBuffers(1, &uiBuffer);
+}
+
+GLuint CGLRenderDevice::DoCreateVertexArray(void)
+{
+	GLuint uiVertexArray = 0;
+	glGenVertexArrays(1, &uiVertexArray);
+	return uiVertexArray;
+}
+
+void CGLRenderDevice::DoDeleteVertexArray(const GLuint uiVertexArray)
+{
+	glDeleteVertexArrays(1, &uiVertexArray);
+}
+
+void CGLRenderDevice::DoBindVertexArray(const GLuint uiVertexArray)
+{
+	glBindVertexArray(uiVertexArray);
+}
+
+void CGLRenderDevice::DoBindBuffer(const GLenum eTarget, const GLuint uiBuffer)
+{
+	glBindBuffer(eTarget, uiBuffer);
+}
+
+void CGLRenderDevice::DoUploadBuffer(const GLenum eTarget, const GLuint uiBuffer, const size_t uiSize, const void* pData, const GLenum eUsage)
+{
+	glBindBuffer(eTarget, uiBuffer);
+	glBufferData(eTarget, uiSize, pData, eUsage);
+}
+
+void CGLRenderDevice::DoUpdateBuffer(const GLenum eTarget, const GLuint uiBuffer, const size_t uiOffset, const size_t uiSize, const void* pData)
+{
+	glBindBuffer(eTarget, uiBuffer);
+	glBufferSubData(eTarget, uiOffset, uiSize, pData);
+}
+
+void CGLRenderDevice::DoEnableVertexAttrib(const GLuint uiIndex, const bool bEnable)
+{
+	if (bEnable)
+		glEnableVertexAttribArray(uiIndex);
+	else
+		glDisableVertexAttribArray(uiIndex);
+}
+
+void CGLRenderDevice::DoVertexAttribPointer(const GLuint uiIndex, const GLint iSize, const GLsizei iStride, const size_t uiOffset)
+{
+	glVertexAttribPointer(uiIndex, iSize, GL_FLOAT, GL_FALSE, iStride, (void*)uiOffset);
+}
+
+void CGLRenderDevice::DoDrawElements(const GLenum eMode, const GLsizei iCount, const size_t uiOffset)
+{
+	glDrawElements(eMode, iCount, GL_UNSIGNED_INT, (void*)uiOffset);
+}
+
+void CGLRenderDevice::DoDrawArrays(const GLenum eMode, const GLint iFirst, const GLsizei iCount)
+{
+	glDrawArrays(eMode, iFirst, iCount);
+}
+
+void CGLRenderDevice::DoClear(const float fRed, const float fGreen, const float fBlue, const float fAlpha)
+{
+	glClearColor(fRed, fGreen, fBlue, fAlpha);
+	glClear(GL_COLOR_BUFFER_BIT);
+}
+
+void CGLRenderDevice::DoSetViewport(const int iX, const int iY, const int iWidth, const int iHeight)
+{
+	glViewport(iX, iY, iWidth, iHeight);
+}
+
+void CGLRenderDevice::DoUseProgram(const GLuint uiProgram)
+{
+	glUseProgram(uiProgram);
+}
+
+void CGLRenderDevice::DoSetBlend(const bool bEnable)
+{
+	if (bEnable)
+	{
+		glEnable(GL_BLEND);
+		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	}
+	else
+		glDisable(GL_BLEND);
+}
+
+void CGLRenderDevice::DoActiveTexture(const GLenum eUnit)
+{
+	glActiveTexture(eUnit);
+}
+
+void CGLRenderDevice::DoBindTexture(const GLuint uiTexture)
+{
+	glBindTexture(GL_TEXTURE_2D, uiTexture);
+}
+
+GLuint CGLRenderDevice::DoCreateTexture(const int iWidth, const int iHeight, const int iChannels, const void* pData,
+										const bool bGenerateMipmap, const bool bClampToEdge)
+{
+	GLuint uiTexture = 0;
+	glGenTextures(1, &uiTexture);
+	glBindTexture(GL_TEXTURE_2D, uiTexture);
+	// set the texture wrapping parameters
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, bClampToEdge ? GL_CLAMP_TO_EDGE : GL_REPEAT);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, bClampToEdge ? GL_CLAMP_TO_EDGE : GL_REPEAT);
+	// set texture filtering parameters
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+	if (iChannels == 1)
+	{
+		// Single channel rows, such as font glyphs, are not 4-byte aligned
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, iWidth, iHeight, 0, GL_RED, GL_UNSIGNED_BYTE, pData);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	}
+	else if (iChannels == 3)
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, iWidth, iHeight, 0, GL_RGB, GL_UNSIGNED_BYTE, pData);
+	else if (iChannels == 4)
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, iWidth, iHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, pData);
+
+	// Generate mipmaps
+	if (bGenerateMipmap)
+		glGenerateMipmap(GL_TEXTURE_2D);
+
+	return uiTexture;
+}
+
+void CGLRenderDevice::DoUpdateTexture(const GLuint uiTexture, const int iX, const int iY, const int iWidth, const int iHeight,
+									  const int iChannels, const void* pData)
+{
+	glBindTexture(GL_TEXTURE_2D, uiTexture);
+	if (iChannels == 1)
+	{
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+		glTexSubImage2D(GL_TEXTURE_2D, 0, iX, iY, iWidth, iHeight, GL_RED, GL_UNSIGNED_BYTE, pData);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	}
+	else if (iChannels == 3)
+		glTexSubImage2D(GL_TEXTURE_2D, 0, iX, iY, iWidth, iHeight, GL_RGB, GL_UNSIGNED_BYTE, pData);
+	else if (iChannels == 4)
+		glTexSubImage2D(GL_TEXTURE_2D, 0, iX, iY, iWidth, iHeight, GL_RGBA, GL_UNSIGNED_BYTE, pData);
+}
+
+void CGLRenderDevice::DoUploadTextureLevel(const GLuint uiTexture, const int iLevel, const int iWidth, const int iHeight,
+										   const int iChannels, const void* pData)
+{
+	glBindTexture(GL_TEXTURE_2D, uiTexture);
+	// The rows of the smaller levels are not 4-byte aligned
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	if (iChannels == 1)
+		glTexImage2D(GL_TEXTURE_2D, iLevel, GL_RED, iWidth, iHeight, 0, GL_RED, GL_UNSIGNED_BYTE, pData);
+	else if (iChannels == 3)
+		glTexImage2D(GL_TEXTURE_2D, iLevel, GL_RGB, iWidth, iHeight, 0, GL_RGB, GL_UNSIGNED_BYTE, pData);
+	else if (iChannels == 4)
+		glTexImage2D(GL_TEXTURE_2D, iLevel, GL_RGBA, iWidth, iHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, pData);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+}
+
+void CGLRenderDevice::DoDeleteTexture(const GLuint uiTexture)
+{
+	glDeleteTextures(1, &uiTexture);
+}
+
+GLint CGLRenderDevice::DoGetUniformLocation(const GLuint uiProgram, const char* pName)
+{
+	return glGetUniformLocation(uiProgram, pName);
+}
+
+void CGLRenderDevice::DoSetUniformMatrix4(const GLint iLocation, const float* pValue)
+{
+	glUniformMatrix4fv(iLocation, 1, GL_FALSE, pValue);
+}
+
+void CGLRenderDevice::DoSetUniform4(const GLint iLocation, const float* pValue)
+{
+	glUniform4fv(iLocation, 1, pValue);
+}
+
+void CGLRenderDevice::DoSetUniform3(const GLint iLocation, const float fX, const float fY, const float fZ)
+{
+	glUniform3f(iLocation, fX, fY, fZ);
+}
+
+void CGLRenderDevice::DoSetUniform1i(const GLint iLocation, const int iValue)
+{
+	glUniform1i(iLocation, iValue);
+}
+
+void CGLRenderDevice::DoSetUniformMatrix3(const GLint iLocation, const float* pValue)
+{
+	glUniformMatrix3fv(iLocation, 1, GL_FALSE, pValue);
+}
+
+void CGLRenderDevice::DoSetUniformMatrix2(const GLint iLocation, const float* pValue)
+{
+	glUniformMatrix2fv(iLocation, 1, GL_FALSE, pValue);
+}
+
+void CGLRenderDevice::DoSetUniform2(const GLint iLocation, const float fX, const float fY)
+{
+	glUniform2f(iLocation, fX, fY);
+}
+
+void CGLRenderDevice::DoSetUniform1f(const GLint iLocation, const float fValue)
+{
+	glUniform1f(iLocation, fValue);
+}
+
+bool CGLRenderDevice::DoInitGUI(const char* pGLSLVersion)
+{
+	return ImGui_ImplOpenGL3_Init(pGLSLVersion);
+}
+
+void CGLRenderDevice::DoNewGUIFrame(void)
+{
+	ImGui_ImplOpenGL3_NewFrame();
+}
+
+void CGLRenderDevice::DoRenderGUI(ImDrawData* pDrawData)
+{
+	ImGui_ImplOpenGL3_RenderDrawData(pDrawData);
+}
+
+void CGLRenderDevice::DoShutdownGUI(void)
+{
+	ImGui_ImplOpenGL3_Shutdown();
+}
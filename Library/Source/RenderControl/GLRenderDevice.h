@@ -0,0 +1,63 @@
+/**
+ CGLRenderDevice
+ @brief The CRenderDevice which sends the calls to OpenGL
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#pragma once
+
+// Include SingletonTemplate
+#include "..\DesignPatterns\SingletonTemplate.h"
+
+// Include CRenderDevice
+#include "RenderDevice.h"
+
+class CGLRenderDevice : public CSingletonTemplate<CGLRenderDevice>, public CRenderDevice
+{
+	friend CSingletonTemplate<CGLRenderDevice>;
+
+protected:
+	// Constructor
+	CGLRenderDevice(void);
+	// Destructor
+	virtual ~CGLRenderDevice(void);
+
+	virtual GLuint DoCreateBuffer(void);
+	virtual void DoDeleteBuffer(const GLuint uiBuffer);
+	virtual GLuint DoCreateVertexArray(void);
+	virtual void DoDeleteVertexArray(const GLuint uiVertexArray);
+	virtual void DoBindVertexArray(const GLuint uiVertexArray);
+	virtual void DoBindBuffer(const GLenum eTarget, const GLuint uiBuffer);
+	virtual void DoUploadBuffer(const GLenum eTarget, const GLuint uiBuffer, const size_t uiSize, const void* pData, const GLenum eUsage);
+	virtual void DoUpdateBuffer(const GLenum eTarget, const GLuint uiBuffer, const size_t uiOffset, const size_t uiSize, const void* pData);
+	virtual void DoEnableVertexAttrib(const GLuint uiIndex, const bool bEnable);
+	virtual void DoVertexAttribPointer(const GLuint uiIndex, const GLint iSize, const GLsizei iStride, const size_t uiOffset);
+	virtual void DoDrawElements(const GLenum eMode, const GLsizei iCount, const size_t uiOffset);
+	virtual void DoDrawArrays(const GLenum eMode, const GLint iFirst, const GLsizei iCount);
+	virtual void DoClear(const float fRed, const float fGreen, const float fBlue, const float fAlpha);
+	virtual void DoSetViewport(const int iX, const int iY, const int iWidth, const int iHeight);
+	virtual void DoUseProgram(const GLuint uiProgram);
+	virtual void DoSetBlend(const bool bEnable);
+	virtual void DoActiveTexture(const GLenum eUnit);
+	virtual void DoBindTexture(const GLuint uiTexture);
+	virtual GLuint DoCreateTexture(const int iWidth, const int iHeight, const int iChannels, const void* pData,
+								   const bool bGenerateMipmap, const bool bClampToEdge);
+	virtual void DoUpdateTexture(const GLuint uiTexture, const int iX, const int iY, const int iWidth, const int iHeight,
+								 const int iChannels, const void* pData);
+	virtual void DoUploadTextureLevel(const GLuint uiTexture, const int iLevel, const int iWidth, const int iHeight,
+									  const int iChannels, const void* pData);
+	virtual void DoDeleteTexture(const GLuint uiTexture);
+	virtual GLint DoGetUniformLocation(const GLuint uiProgram, const char* pName);
+	virtual void DoSetUniformMatrix4(const GLint iLocation, const float* pValue);
+	virtual void DoSetUniform4(const GLint iLocation, const float* pValue);
+	virtual void DoSetUniform3(const GLint iLocation, const float fX, const float fY, const float fZ);
+	virtual void DoSetUniform1i(const GLint iLocation, const int iValue);
+	virtual void DoSetUniformMatrix3(const GLint iLocation, const float* pValue);
+	virtual void DoSetUniformMatrix2(const GLint iLocation, const float* pValue);
+	virtual void DoSetUniform2(const GLint iLocation, const float fX, const float fY);
+	virtual void DoSetUniform1f(const GLint iLocation, const float fValue);
+	virtual bool DoInitGUI(const char* pGLSLVersion);
+	virtual void DoNewGUIFrame(void);
+	virtual void DoRenderGUI(ImDrawData* pDrawData);
+	virtual void DoShutdownGUI(void);
+};
@@ -0,0 +1,272 @@
+/**
+ CRecordingRenderDevice
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#include "RecordingRenderDevice.h"
+
+#include <iostream>
+using namespace std;
+
+/**
+ @brief Constructor
+ */
+CRecordingRenderDevice::CRecordingRenderDevice(void)
+	: bRecordCommands(true)
+	, uiLastHandle(0)
+{
+}
+
+/**
+ @brief Destructor
+ */
+CRecordingRenderDevice::~CRecordingRenderDevice(void)
+{
+	vCommands.clear();
+}
+
+/**
+ @brief Get the calls recorded since the last ResetStats
+ */
+const std::vector<RenderCommand>& CRecordingRenderDevice::GetCommands(void) const
+{
+	return vCommands;
+}
+
+/**
+ @brief Reset the counters and the recorded calls
+ */
+void CRecordingRenderDevice::ResetStats(void)
+{
+	CRenderDevice::ResetStats();
+	vCommands.clear();
+}
+
+/**
+ @brief Check the counters against a budget, printing the counters which are over it
+ @param sBudget The maximum value for each counter
+ @return true if all the counters are within the budget
+ */
+bool CRecordingRenderDevice::CheckBudget(const RenderDeviceStats& sBudget) const
+{
+	bool bWithinBudget = true;
+	if (sStats.uiNumDrawCalls > sBudget.uiNumDrawCalls)
+	{
+		cout << "Draw calls over budget: " << sStats.uiNumDrawCalls << " > " << sBudget.uiNumDrawCalls << endl;
+		bWithinBudget = false;
+	}
+	if (sStats.uiNumStateChanges > sBudget.uiNumStateChanges)
+	{
+		cout << "State changes over budget: " << sStats.uiNumStateChanges << " > " << sBudget.uiNumStateChanges << endl;
+		bWithinBudget = false;
+	}
+	if (sStats.uiNumBufferUploads > sBudget.uiNumBufferUploads)
+	{
+		cout << "Buffer uploads over budget: " << sStats.uiNumBufferUploads << " > " << sBudget.uiNumBufferUploads << endl;
+		bWithinBudget = false;
+	}
+	if (sStats.uiNumBytesUploaded > sBudget.uiNumBytesUploaded)
+	{
+		cout << "Bytes uploaded over budget: " << sStats.uiNumBytesUploaded << " > " << sBudget.uiNumBytesUploaded << endl;
+		bWithinBudget = false;
+	}
+	if (sStats.uiNumTextureBinds > sBudget.uiNumTextureBinds)
+	{
+		cout << "Texture binds over budget: " << sStats.uiNumTextureBinds << " > " << sBudget.uiNumTextureBinds << endl;
+		bWithinBudget = false;
+	}
+	if (sStats.uiNumTextureUploads > sBudget.uiNumTextureUploads)
+	{
+		cout << "Texture uploads over budget: " << sStats.uiNumTextureUploads << " > " << sBudget.uiNumTextureUploads << endl;
+		bWithinBudget = false;
+	}
+	return bWithinBudget;
+}
+
+/**
+ @brief Set whether the calls are stored, or only counted
+ */
+void CRecordingRenderDevice::SetRecordCommands(const bool bRecordCommands)
+{
+	this->bRecordCommands = bRecordCommands;
+}
+
+/**
+ @brief Add a call to vCommands
+ */
+void CRecordingRenderDevice::Record(const RenderCommand::COMMAND_TYPE eType,
+									const unsigned int uiArg0,
+									const unsigned int uiArg1,
+									const unsigned int uiArg2)
+{
+	if (!bRecordCommands)
+		return;
+
+	RenderCommand sCommand;
+	sCommand.eType = eType;
+	sCommand.uiArg0 = uiArg0;
+	sCommand.uiArg1 = uiArg1;
+	sCommand.uiArg2 = uiArg2;
+	vCommands.push_back(sCommand);
+}
+
+GLuint CRecordingRenderDevice::DoCreateBuffer(void)
+{
+	return ++uiLastHandle;
+}
+
+void CRecordingRenderDevice::DoDeleteBuffer(const GLuint uiBuffer)
+{
+}
+
+GLuint CRecordingRenderDevice::DoCreateVertexArray(void)
+{
+	return ++uiLastHandle;
+}
+
+void CRecordingRenderDevice::DoDeleteVertexArray(const GLuint uiVertexArray)
+{
+}
+
+void CRecordingRenderDevice::DoBindVertexArray(const GLuint uiVertexArray)
+{
+}
+
+void CRecordingRenderDevice::DoBindBuffer(const GLenum eTarget, const GLuint uiBuffer)
+{
+}
+
+void CRecordingRenderDevice::DoUploadBuffer(const GLenum eTarget, const GLuint uiBuffer, const size_t uiSize, const void* pData, const GLenum eUsage)
+{
+	Record(RenderCommand::UPLOAD_BUFFER, uiBuffer, (unsigned int)uiSize);
+}
+
+void CRecordingRenderDevice::DoUpdateBuffer(const GLenum eTarget, const GLuint uiBuffer, const size_t uiOffset, const size_t uiSize, const void* pData)
+{
+	Record(RenderCommand::UPDATE_BUFFER, uiBuffer, (unsigned int)uiSize, (unsigned int)uiOffset);
+}
+
+void CRecordingRenderDevice::DoEnableVertexAttrib(const GLuint uiIndex, const bool bEnable)
+{
+}
+
+void CRecordingRenderDevice::DoVertexAttribPointer(const GLuint uiIndex, const GLint iSize, const GLsizei iStride, const size_t uiOffset)
+{
+}
+
+void CRecordingRenderDevice::DoDrawElements(const GLenum eMode, const GLsizei iCount, const size_t uiOffset)
+{
+	Record(RenderCommand::DRAW_ELEMENTS, eMode, iCount, (unsigned int)uiOffset);
+}
+
+void CRecordingRenderDevice::DoDrawArrays(const GLenum eMode, const GLint iFirst, const GLsizei iCount)
+{
+	Record(RenderCommand::DRAW_ARRAYS, eMode, iCount, iFirst);
+}
+
+void CRecordingRenderDevice::DoClear(const float fRed, const float fGreen, const float fBlue, const float fAlpha)
+{
+	Record(RenderCommand::CLEAR);
+}
+
+void CRecordingRenderDevice::DoSetViewport(const int iX, const int iY, const int iWidth, const int iHeight)
+{
+}
+
+void CRecordingRenderDevice::DoUseProgram(const GLuint uiProgram)
+{
+	Record(RenderCommand::USE_PROGRAM, uiProgram);
+}
+
+void CRecordingRenderDevice::DoSetBlend(const bool bEnable)
+{
+	Record(RenderCommand::SET_BLEND, bEnable ? 1 : 0);
+}
+
+void CRecordingRenderDevice::DoActiveTexture(const GLenum eUnit)
+{
+}
+
+void CRecordingRenderDevice::DoBindTexture(const GLuint uiTexture)
+{
+	Record(RenderCommand::BIND_TEXTURE, uiTexture);
+}
+
+GLuint CRecordingRenderDevice::DoCreateTexture(const int iWidth, const int iHeight, const int iChannels, const void* pData,
+											   const bool bGenerateMipmap, const bool bClampToEdge)
+{
+	++uiLastHandle;
+	Record(RenderCommand::CREATE_TEXTURE, uiLastHandle, iWidth * iHeight * iChannels);
+	return uiLastHandle;
+}
+
+void CRecordingRenderDevice::DoUpdateTexture(const GLuint uiTexture, const int iX, const int iY, const int iWidth, const int iHeight,
+											 const int iChannels, const void* pData)
+{
+	Record(RenderCommand::UPDATE_TEXTURE, uiTexture, iWidth * iHeight * iChannels);
+}
+
+void CRecordingRenderDevice::DoUploadTextureLevel(const GLuint uiTexture, const int iLevel, const int iWidth, const int iHeight,
+												  const int iChannels, const void* pData)
+{
+	Record(RenderCommand::UPLOAD_TEXTURE_LEVEL, uiTexture, iWidth * iHeight * iChannels, iLevel);
+}
+
+void CRecordingRenderDevice::DoDeleteTexture(const GLuint uiTexture)
+{
+}
+
+GLint CRecordingRenderDevice::DoGetUniformLocation(const GLuint uiProgram, const char* pName)
+{
+	// Any valid location will do, since the uniforms are not stored
+	return 0;
+}
+
+void CRecordingRenderDevice::DoSetUniformMatrix4(const GLint iLocation, const float* pValue)
+{
+}
+
+void CRecordingRenderDevice::DoSetUniform4(const GLint iLocation, const float* pValue)
+{
+}
+
+void CRecordingRenderDevice::DoSetUniform3(const GLint iLocation, const float fX, const float fY, const float fZ)
+{
+}
+
+void CRecordingRenderDevice::DoSetUniform1i(const GLint iLocation, const int iValue)
+{
+}
+
+void CRecordingRenderDevice::DoSetUniformMatrix3(const GLint iLocation, const float* pValue)
+{
+}
+
+void CRecordingRenderDevice::DoSetUniformMatrix2(const GLint iLocation, const float* pValue)
+{
+}
+
+void CRecordingRenderDevice::DoSetUniform2(const GLint iLocation, const float fX, const float fY)
+{
+}
+
+void CRecordingRenderDevice::DoSetUniform1f(const GLint iLocation, const float fValue)
+{
+}
+
+bool CRecordingRenderDevice::DoInitGUI(const char* pGLSLVersion)
+{
+	return true;
+}
+
+void CRecordingRenderDevice::DoNewGUIFrame(void)
+{
+}
+
+void CRecordingRenderDevice::DoRenderGUI(ImDrawData* pDrawData)
+{
+}
+
+void CRecordingRenderDevice::DoShutdownGUI(void)
+{
+}
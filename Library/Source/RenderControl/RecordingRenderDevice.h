@@ -0,0 +1,114 @@
+/**
+ CRecordingRenderDevice
+ @brief A CRenderDevice which records the calls instead of sending them to a GPU.
+		It is used to render scenes on machines without a window or GL context,
+		and to compare the command stream and counters against a budget.
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#pragma once
+
+// Include CRenderDevice
+#include "RenderDevice.h"
+
+#include <vector>
+
+// A structure storing one recorded call
+struct RenderCommand
+{
+	enum COMMAND_TYPE
+	{
+		UPLOAD_BUFFER = 0,
+		UPDATE_BUFFER,
+		DRAW_ELEMENTS,
+		DRAW_ARRAYS,
+		CLEAR,
+		USE_PROGRAM,
+		SET_BLEND,
+		BIND_TEXTURE,
+		CREATE_TEXTURE,
+		UPDATE_TEXTURE,
+		UPLOAD_TEXTURE_LEVEL,
+		NUM_COMMAND_TYPES
+	};
+
+	COMMAND_TYPE eType;
+	// The arguments of the call, e.g. the buffer and size, or the mode and count
+	unsigned int uiArg0;
+	unsigned int uiArg1;
+	unsigned int uiArg2;
+};
+
+class CRecordingRenderDevice : public CRenderDevice
+{
+public:
+	// Constructor
+	CRecordingRenderDevice(void);
+	// Destructor
+	virtual ~CRecordingRenderDevice(void);
+
+	// Get the calls recorded since the last ResetStats
+	const std::vector<RenderCommand>& GetCommands(void) const;
+
+	// Reset the counters and the recorded calls
+	virtual void ResetStats(void);
+
+	// Check the counters against a budget, printing the counters which are over it
+	bool CheckBudget(const RenderDeviceStats& sBudget) const;
+
+	// Set whether the calls are stored, or only counted
+	void SetRecordCommands(const bool bRecordCommands);
+
+protected:
+	virtual GLuint DoCreateBuffer(void);
+	virtual void DoDeleteBuffer(const GLuint uiBuffer);
+	virtual GLuint DoCreateVertexArray(void);
+	virtual void DoDeleteVertexArray(const GLuint uiVertexArray);
+	virtual void DoBindVertexArray(const GLuint uiVertexArray);
+	virtual void DoBindBuffer(const GLenum eTarget, const GLuint uiBuffer);
+	virtual void DoUploadBuffer(const GLenum eTarget, const GLuint uiBuffer, const size_t uiSize, const void* pData, const GLenum eUsage);
+	virtual void DoUpdateBuffer(const GLenum eTarget, const GLuint uiBuffer, const size_t uiOffset, const size_t uiSize, const void* pData);
+	virtual void DoEnableVertexAttrib(const GLuint uiIndex, const bool bEnable);
+	virtual void DoVertexAttribPointer(const GLuint uiIndex, const GLint iSize, const GLsizei iStride, const size_t uiOffset);
+	virtual void DoDrawElements(const GLenum eMode, const GLsizei iCount, const size_t uiOffset);
+	virtual void DoDrawArrays(const GLenum eMode, const GLint iFirst, const GLsizei iCount);
+	virtual void DoClear(const float fRed, const float fGreen, const float fBlue, const float fAlpha);
+	virtual void DoSetViewport(const int iX, const int iY, const int iWidth, const int iHeight);
+	virtual void DoUseProgram(const GLuint uiProgram);
+	virtual void DoSetBlend(const bool bEnable);
+	virtual void DoActiveTexture(const GLenum eUnit);
+	virtual void DoBindTexture(const GLuint uiTexture);
+	virtual GLuint DoCreateTexture(const int iWidth, const int iHeight, const int iChannels, const void* pData,
+								   const bool bGenerateMipmap, const bool bClampToEdge);
+	virtual void DoUpdateTexture(const GLuint uiTexture, const int iX, const int iY, const int iWidth, const int iHeight,
+								 const int iChannels, const void* pData);
+	virtual void DoUploadTextureLevel(const GLuint uiTexture, const int iLevel, const int iWidth, const int iHeight,
+									  const int iChannels, const void* pData);
+	virtual void DoDeleteTexture(const GLuint uiTexture);
+	virtual GLint DoGetUniformLocation(const GLuint uiProgram, const char* pName);
+	virtual void DoSetUniformMatrix4(const GLint iLocation, const float* pValue);
+	virtual void DoSetUniform4(const GLint iLocation, const float* pValue);
+	virtual void DoSetUniform3(const GLint iLocation, const float fX, const float fY, const float fZ);
+	virtual void DoSetUniform1i(const GLint iLocation, const int iValue);
+	virtual void DoSetUniformMatrix3(const GLint iLocation, const float* pValue);
+	virtual void DoSetUniformMatrix2(const GLint iLocation, const float* pValue);
+	virtual void DoSetUniform2(const GLint iLocation, const float fX, const float fY);
+	virtual void DoSetUniform1f(const GLint iLocation, const float fValue);
+	virtual bool DoInitGUI(const char* pGLSLVersion);
+	virtual void DoNewGUIFrame(void);
+	virtual void DoRenderGUI(ImDrawData* pDrawData);
+	virtual void DoShutdownGUI(void);
+
+	// Add a call to vCommands
+	void Record(const RenderCommand::COMMAND_TYPE eType,
+				const unsigned int uiArg0 = 0,
+				const unsigned int uiArg1 = 0,
+				const unsigned int uiArg2 = 0);
+
+	// The calls recorded since the last ResetStats
+	std::vector<RenderCommand> vCommands;
+	// A bool which is true if the calls are stored
+	bool bRecordCommands;
+	// The last handle given out for buffers, vertex arrays and textures
+	GLuint uiLastHandle;
+};
@@ -0,0 +1,143 @@
+/**
+ CRenderCommandList
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#include "RenderCommandList.h"
+
+// Include ImGui, to copy its draw data
+#include "../GUI/imgui.h"
+
+#include <cstring>
+
+// The copies in vData are aligned, so that the floats of the uniforms can be read in place
+static const size_t DATA_ALIGNMENT = 16;
+
+/**
+ @brief A copy of the Dear ImGui draw data, with its own draw lists
+ */
+struct CRenderCommandList::GUIDrawData
+{
+	ImDrawData sDrawData;
+	std::vector<ImDrawList*> vDrawLists;
+};
+
+/**
+ @brief Constructor
+ */
+CRenderCommandList::CRenderCommandList(void)
+{
+}
+
+/**
+ @brief Destructor
+ */
+CRenderCommandList::~CRenderCommandList(void)
+{
+	Clear();
+}
+
+/**
+ @brief Add a call, and return it so that its arguments can be set
+ @param eType The type of the call
+ */
+RenderListCommand& CRenderCommandList::Add(const RenderListCommand::COMMAND_TYPE eType)
+{
+	RenderListCommand sCommand;
+	memset(&sCommand, 0, sizeof(sCommand));
+	sCommand.eType = eType;
+	sCommand.uiDataOffset = RenderListCommand::NO_DATA;
+	vCommands.push_back(sCommand);
+	return vCommands.back();
+}
+
+/**
+ @brief Copy the data of the last call into this list
+ @param pData The data, or NULL if the call has none
+ @param uiSize The number of bytes in pData
+ */
+void CRenderCommandList::AddData(const void* pData, const size_t uiSize)
+{
+	if ((vCommands.empty()) || (pData == NULL))
+		return;
+
+	const size_t uiOffset = (vData.size() + DATA_ALIGNMENT - 1) / DATA_ALIGNMENT * DATA_ALIGNMENT;
+	vData.resize(uiOffset + uiSize);
+	if (uiSize > 0)
+		memcpy(&vData[uiOffset], pData, uiSize);
+	vCommands.back().uiDataOffset = uiOffset;
+}
+
+/**
+ @brief Copy the Dear ImGui draw data into this list, as a RENDER_GUI call.
+		The draw lists are cloned, as ImGui reuses them in the next frame.
+ @param pDrawData The draw data of ImGui::Render
+ */
+void CRenderCommandList::AddGUIDrawData(const ImDrawData* pDrawData)
+{
+	GUIDrawData* pCopy = new GUIDrawData();
+	pCopy->sDrawData = *pDrawData;
+	for (int i = 0; i < pDrawData->CmdListsCount; i++)
+		pCopy->vDrawLists.push_back(pDrawData->CmdLists[i]->CloneOutput());
+	pCopy->sDrawData.CmdLists = (pCopy->vDrawLists.empty() ? NULL : &pCopy->vDrawLists[0]);
+
+	RenderListCommand& sCommand = Add(RenderListCommand::RENDER_GUI);
+	sCommand.iArgs[0] = (int)vGUIDrawData.size();
+	vGUIDrawData.push_back(pCopy);
+}
+
+/**
+ @brief Get the calls
+ */
+std::vector<RenderListCommand>& CRenderCommandList::GetCommands(void)
+{
+	return vCommands;
+}
+
+/**
+ @brief Get the copy of the data of a call
+ @return The data, or NULL if the call has none
+ */
+const void* CRenderCommandList::GetData(const RenderListCommand& sCommand) const
+{
+	if (sCommand.uiDataOffset == RenderListCommand::NO_DATA)
+		return NULL;
+	// A call with 0 bytes of data may be at the end of vData
+	if (sCommand.uiDataOffset >= vData.size())
+		return vData.data();
+	return &vData[sCommand.uiDataOffset];
+}
+
+/**
+ @brief Get the copy of the Dear ImGui draw data of a RENDER_GUI call
+ */
+ImDrawData* CRenderCommandList::GetGUIDrawData(const RenderListCommand& sCommand)
+{
+	if ((sCommand.iArgs[0] < 0) || (sCommand.iArgs[0] >= (int)vGUIDrawData.size()))
+		return NULL;
+	return &vGUIDrawData[sCommand.iArgs[0]]->sDrawData;
+}
+
+/**
+ @brief Remove the calls, keeping the memory for the next frame
+ */
+void CRenderCommandList::Clear(void)
+{
+	vCommands.clear();
+	vData.clear();
+	for (unsigned int i = 0; i < vGUIDrawData.size(); i++)
+	{
+		for (unsigned int j = 0; j < vGUIDrawData[i]->vDrawLists.size(); j++)
+			IM_DELETE(vGUIDrawData[i]->vDrawLists[j]);
+		delete vGUIDrawData[i];
+	}
+	vGUIDrawData.clear();
+}
+
+/**
+ @brief Get the number of bytes which were copied into this list
+ */
+size_t CRenderCommandList::GetDataSize(void) const
+{
+	return vData.size();
+}
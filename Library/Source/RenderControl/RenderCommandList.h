@@ -0,0 +1,117 @@
+/**
+ CRenderCommandList
+ @brief The render packet of a frame: the CRenderDevice calls which the game made to render it,
+		with copies of their data, e.g. the vertices, pixels and uniforms, and of the Dear ImGui draw data.
+		It does not point to the game's data, so the game can change its entities, map and GUI
+		while the list is being submitted to OpenGL on another thread.
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#pragma once
+
+// Include GLEW
+#ifndef GLEW_STATIC
+#include <GL/glew.h>
+#define GLEW_STATIC
+#endif
+
+#include <vector>
+
+struct ImDrawData;
+struct ImDrawList;
+
+// A structure storing one CRenderDevice call in a CRenderCommandList
+struct RenderListCommand
+{
+	enum COMMAND_TYPE
+	{
+		CREATE_BUFFER = 0,
+		DELETE_BUFFER,
+		CREATE_VERTEX_ARRAY,
+		DELETE_VERTEX_ARRAY,
+		BIND_VERTEX_ARRAY,
+		BIND_BUFFER,
+		UPLOAD_BUFFER,
+		UPDATE_BUFFER,
+		ENABLE_VERTEX_ATTRIB,
+		VERTEX_ATTRIB_POINTER,
+		DRAW_ELEMENTS,
+		DRAW_ARRAYS,
+		CLEAR,
+		SET_VIEWPORT,
+		USE_PROGRAM,
+		SET_BLEND,
+		ACTIVE_TEXTURE,
+		BIND_TEXTURE,
+		CREATE_TEXTURE,
+		UPDATE_TEXTURE,
+		UPLOAD_TEXTURE_LEVEL,
+		DELETE_TEXTURE,
+		SET_UNIFORM_MATRIX4,
+		SET_UNIFORM_MATRIX3,
+		SET_UNIFORM_MATRIX2,
+		SET_UNIFORM4,
+		SET_UNIFORM3,
+		SET_UNIFORM2,
+		SET_UNIFORM1F,
+		SET_UNIFORM1I,
+		RENDER_GUI,
+		NUM_COMMAND_TYPES
+	};
+
+	COMMAND_TYPE eType;
+	// The buffer, vertex array, texture or program of the call
+	GLuint uiHandle;
+	// The target, mode, unit or usage of the call
+	GLenum eEnum;
+	// The integer arguments, e.g. the size of a texture, the count of a draw or the location of a uniform
+	int iArgs[6];
+	// The offset and size arguments, e.g. of a buffer update
+	size_t uiOffset;
+	size_t uiSize;
+	// The float arguments, e.g. the clear colour or the value of a uniform
+	float fArgs[4];
+	// The copy of the data of the call in the list, or NO_DATA
+	size_t uiDataOffset;
+
+	static const size_t NO_DATA = (size_t)-1;
+};
+
+class CRenderCommandList
+{
+public:
+	// Constructor
+	CRenderCommandList(void);
+	// Destructor
+	~CRenderCommandList(void);
+
+	// Add a call, and return it so that its arguments can be set
+	RenderListCommand& Add(const RenderListCommand::COMMAND_TYPE eType);
+	// Copy the data of the last call into this list
+	void AddData(const void* pData, const size_t uiSize);
+	// Copy the Dear ImGui draw data into this list, as the last call
+	void AddGUIDrawData(const ImDrawData* pDrawData);
+
+	// Get the calls
+	std::vector<RenderListCommand>& GetCommands(void);
+	// Get the copy of the data of a call, or NULL if it has none
+	const void* GetData(const RenderListCommand& sCommand) const;
+	// Get the copy of the Dear ImGui draw data of a RENDER_GUI call
+	ImDrawData* GetGUIDrawData(const RenderListCommand& sCommand);
+
+	// Remove the calls, keeping the memory for the next frame
+	void Clear(void);
+
+	// Get the number of bytes which were copied into this list
+	size_t GetDataSize(void) const;
+
+protected:
+	// A copy of the Dear ImGui draw data, with its own draw lists
+	struct GUIDrawData;
+
+	std::vector<RenderListCommand> vCommands;
+	// The copies of the data of the calls
+	std::vector<unsigned char> vData;
+	// The copies of the Dear ImGui draw data
+	std::vector<GUIDrawData*> vGUIDrawData;
+};
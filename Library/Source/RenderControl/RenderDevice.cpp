@@ -0,0 +1,349 @@
+/**
+ CRenderDevice
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#include "RenderDevice.h"
+
+// Include the OpenGL render device, which is the default
+#include "GLRenderDevice.h"
+
+// Include ImGui, for the draw commands of its draw data
+#include "../GUI/imgui.h"
+
+#include <iostream>
+using namespace std;
+
+CRenderDevice* CRenderDevice::pActiveDevice = nullptr;
+
+/**
+ @brief Constructor
+ */
+CRenderDevice::CRenderDevice(void)
+{
+}
+
+/**
+ @brief Destructor
+ */
+CRenderDevice::~CRenderDevice(void)
+{
+	if (pActiveDevice == this)
+		pActiveDevice = nullptr;
+}
+
+/**
+ @brief Get the render device used by the renderers
+ */
+CRenderDevice* CRenderDevice::GetActive(void)
+{
+	if (pActiveDevice == nullptr)
+		pActiveDevice = CGLRenderDevice::GetInstance();
+	return pActiveDevice;
+}
+
+/**
+ @brief Set the render device used by the renderers
+ @param pDevice The render device to use, or nullptr to restore the OpenGL device
+ */
+void CRenderDevice::SetActive(CRenderDevice* pDevice)
+{
+	pActiveDevice = pDevice;
+}
+
+GLuint CRenderDevice::CreateBuffer(void)
+{
+	return DoCreateBuffer();
+}
+
+void CRenderDevice::DeleteBuffer(const GLuint uiBuffer)
+{
+	DoDeleteBuffer(uiBuffer);
+}
+
+GLuint CRenderDevice::CreateVertexArray(void)
+{
+	return DoCreateVertexArray();
+}
+
+void CRenderDevice::DeleteVertexArray(const GLuint uiVertexArray)
+{
+	DoDeleteVertexArray(uiVertexArray);
+}
+
+void CRenderDevice::BindVertexArray(const GLuint uiVertexArray)
+{
+	DoBindVertexArray(uiVertexArray);
+}
+
+void CRenderDevice::BindBuffer(const GLenum eTarget, const GLuint uiBuffer)
+{
+	DoBindBuffer(eTarget, uiBuffer);
+}
+
+/**
+ @brief Bind a buffer and replace its content
+ @param eTarget GL_ARRAY_BUFFER or GL_ELEMENT_ARRAY_BUFFER
+ @param uiBuffer The buffer to upload to
+ @param uiSize The number of bytes in pData
+ @param pData The data to upload. nullptr only allocates the buffer.
+ @param eUsage GL_STATIC_DRAW or GL_DYNAMIC_DRAW
+ */
+void CRenderDevice::UploadBuffer(const GLenum eTarget, const GLuint uiBuffer, const size_t uiSize, const void* pData, const GLenum eUsage)
+{
+	sStats.uiNumBufferUploads++;
+	if (pData)
+		sStats.uiNumBytesUploaded += (unsigned int)uiSize;
+	DoUploadBuffer(eTarget, uiBuffer, uiSize, pData, eUsage);
+}
+
+/**
+ @brief Bind a buffer and update part of its content
+ */
+void CRenderDevice::UpdateBuffer(const GLenum eTarget, const GLuint uiBuffer, const size_t uiOffset, const size_t uiSize, const void* pData)
+{
+	sStats.uiNumBufferUploads++;
+	sStats.uiNumBytesUploaded += (unsigned int)uiSize;
+	DoUpdateBuffer(eTarget, uiBuffer, uiOffset, uiSize, pData);
+}
+
+void CRenderDevice::EnableVertexAttrib(const GLuint uiIndex)
+{
+	DoEnableVertexAttrib(uiIndex, true);
+}
+
+void CRenderDevice::DisableVertexAttrib(const GLuint uiIndex)
+{
+	DoEnableVertexAttrib(uiIndex, false);
+}
+
+/**
+ @brief Set the layout of a float vertex attribute in the bound GL_ARRAY_BUFFER
+ @param uiIndex The attribute index
+ @param iSize The number of floats in this attribute
+ @param iStride The size of one vertex in bytes
+ @param uiOffset The offset of this attribute in a vertex in bytes
+ */
+void CRenderDevice::VertexAttribPointer(const GLuint uiIndex, const GLint iSize, const GLsizei iStride, const size_t uiOffset)
+{
+	DoVertexAttribPointer(uiIndex, iSize, iStride, uiOffset);
+}
+
+void CRenderDevice::DrawElements(const GLenum eMode, const GLsizei iCount, const size_t uiOffset)
+{
+	sStats.uiNumDrawCalls++;
+	DoDrawElements(eMode, iCount, uiOffset);
+}
+
+void CRenderDevice::DrawArrays(const GLenum eMode, const GLint iFirst, const GLsizei iCount)
+{
+	sStats.uiNumDrawCalls++;
+	DoDrawArrays(eMode, iFirst, iCount);
+}
+
+void CRenderDevice::Clear(const float fRed, const float fGreen, const float fBlue, const float fAlpha)
+{
+	DoClear(fRed, fGreen, fBlue, fAlpha);
+}
+
+/**
+ @brief Set the area of the window which is rendered to, e.g. after the window is resized
+ */
+void CRenderDevice::SetViewport(const int iX, const int iY, const int iWidth, const int iHeight)
+{
+	DoSetViewport(iX, iY, iWidth, iHeight);
+}
+
+void CRenderDevice::UseProgram(const GLuint uiProgram)
+{
+	sStats.uiNumStateChanges++;
+	DoUseProgram(uiProgram);
+}
+
+/**
+ @brief Enable or disable alpha blending with GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA
+ */
+void CRenderDevice::SetBlend(const bool bEnable)
+{
+	sStats.uiNumStateChanges++;
+	DoSetBlend(bEnable);
+}
+
+void CRenderDevice::ActiveTexture(const GLenum eUnit)
+{
+	DoActiveTexture(eUnit);
+}
+
+void CRenderDevice::BindTexture(const GLuint uiTexture)
+{
+	sStats.uiNumTextureBinds++;
+	DoBindTexture(uiTexture);
+}
+
+/**
+ @brief Create a 2D texture and upload its pixels
+ @param iWidth The width of the image
+ @param iHeight The height of the image
+ @param iChannels 1 for GL_RED, 3 for GL_RGB or 4 for GL_RGBA
+ @param pData The pixels of the image
+ @param bGenerateMipmap A bool which is true if mipmaps should be generated
+ @param bClampToEdge A bool which is true to clamp the texture instead of repeating it
+ */
+GLuint CRenderDevice::CreateTexture(const int iWidth, const int iHeight, const int iChannels, const void* pData,
+									const bool bGenerateMipmap, const bool bClampToEdge)
+{
+	sStats.uiNumTextureUploads++;
+	return DoCreateTexture(iWidth, iHeight, iChannels, pData, bGenerateMipmap, bClampToEdge);
+}
+
+/**
+ @brief Replace a rectangle of pixels in a texture
+ @param uiTexture The texture to update
+ @param iX The left of the rectangle
+ @param iY The top of the rectangle
+ @param iWidth The width of the rectangle
+ @param iHeight The height of the rectangle
+ @param iChannels 1 for GL_RED, 3 for GL_RGB or 4 for GL_RGBA
+ @param pData The pixels of the rectangle
+ */
+void CRenderDevice::UpdateTexture(const GLuint uiTexture, const int iX, const int iY, const int iWidth, const int iHeight,
+								  const int iChannels, const void* pData)
+{
+	sStats.uiNumTextureUploads++;
+	DoUpdateTexture(uiTexture, iX, iY, iWidth, iHeight, iChannels, pData);
+}
+
+/**
+ @brief Upload a mipmap level of a texture, e.g. one which was precomputed by the texture packer
+ @param uiTexture The texture to upload to
+ @param iLevel The mipmap level, where 0 is the full size image
+ @param iWidth The width of this level
+ @param iHeight The height of this level
+ @param iChannels 1 for GL_RED, 3 for GL_RGB or 4 for GL_RGBA
+ @param pData The pixels of this level
+ */
+void CRenderDevice::UploadTextureLevel(const GLuint uiTexture, const int iLevel, const int iWidth, const int iHeight,
+									   const int iChannels, const void* pData)
+{
+	sStats.uiNumTextureUploads++;
+	DoUploadTextureLevel(uiTexture, iLevel, iWidth, iHeight, iChannels, pData);
+}
+
+void CRenderDevice::DeleteTexture(const GLuint uiTexture)
+{
+	DoDeleteTexture(uiTexture);
+}
+
+GLint CRenderDevice::GetUniformLocation(const GLuint uiProgram, const char* pName)
+{
+	return DoGetUniformLocation(uiProgram, pName);
+}
+
+void CRenderDevice::SetUniformMatrix4(const GLint iLocation, const float* pValue)
+{
+	DoSetUniformMatrix4(iLocation, pValue);
+}
+
+void CRenderDevice::SetUniform4(const GLint iLocation, const float* pValue)
+{
+	DoSetUniform4(iLocation, pValue);
+}
+
+void CRenderDevice::SetUniform3(const GLint iLocation, const float fX, const float fY, const float fZ)
+{
+	DoSetUniform3(iLocation, fX, fY, fZ);
+}
+
+void CRenderDevice::SetUniform1i(const GLint iLocation, const int iValue)
+{
+	DoSetUniform1i(iLocation, iValue);
+}
+
+void CRenderDevice::SetUniformMatrix3(const GLint iLocation, const float* pValue)
+{
+	DoSetUniformMatrix3(iLocation, pValue);
+}
+
+void CRenderDevice::SetUniformMatrix2(const GLint iLocation, const float* pValue)
+{
+	DoSetUniformMatrix2(iLocation, pValue);
+}
+
+void CRenderDevice::SetUniform2(const GLint iLocation, const float fX, const float fY)
+{
+	DoSetUniform2(iLocation, fX, fY);
+}
+
+void CRenderDevice::SetUniform1f(const GLint iLocation, const float fValue)
+{
+	DoSetUniform1f(iLocation, fValue);
+}
+
+/**
+ @brief Set up the Dear ImGui renderer for the current ImGui context
+ @param pGLSLVersion The GLSL version of the shaders of the renderer, e.g. "#version 330"
+ */
+bool CRenderDevice::InitGUI(const char* pGLSLVersion)
+{
+	return DoInitGUI(pGLSLVersion);
+}
+
+/**
+ @brief Start a Dear ImGui frame. This creates the shader and font texture of the renderer the first time.
+ */
+void CRenderDevice::NewGUIFrame(void)
+{
+	DoNewGUIFrame();
+}
+
+/**
+ @brief Render the draw data of ImGui::Render
+ @param pDrawData The draw data, which is only valid until the next ImGui::NewFrame
+ */
+void CRenderDevice::RenderGUI(ImDrawData* pDrawData)
+{
+	if (pDrawData == NULL)
+		return;
+
+	for (int i = 0; i < pDrawData->CmdListsCount; i++)
+		sStats.uiNumDrawCalls += (unsigned int)pDrawData->CmdLists[i]->CmdBuffer.Size;
+	DoRenderGUI(pDrawData);
+}
+
+/**
+ @brief Release the shader and font texture of the Dear ImGui renderer
+ */
+void CRenderDevice::ShutdownGUI(void)
+{
+	DoShutdownGUI();
+}
+
+/**
+ @brief Get the counters since the last ResetStats
+ */
+const RenderDeviceStats& CRenderDevice::GetStats(void) const
+{
+	return sStats;
+}
+
+/**
+ @brief Reset the counters
+ */
+void CRenderDevice::ResetStats(void)
+{
+	sStats = RenderDeviceStats();
+}
+
+/**
+ @brief Print out details about this class instance in the console window
+ */
+void CRenderDevice::PrintSelf(void) const
+{
+	cout << "CRenderDevice::PrintSelf()" << endl;
+	cout << "Draw calls: " << sStats.uiNumDrawCalls << endl;
+	cout << "State changes: " << sStats.uiNumStateChanges << endl;
+	cout << "Buffer uploads: " << sStats.uiNumBufferUploads
+		<< " (" << sStats.uiNumBytesUploaded << " bytes)" << endl;
+	cout << "Texture binds: " << sStats.uiNumTextureBinds << endl;
+	cout << "Texture uploads: " << sStats.uiNumTextureUploads << endl;
+}
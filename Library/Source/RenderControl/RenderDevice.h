@@ -0,0 +1,171 @@
+/**
+ CRenderDevice
+ @brief An interface between the renderers and the graphics API.
+		All the OpenGL calls made by CMesh, CSpriteAnimation, CTextRenderer,
+		CRenderQueue and the entity renderers go through the active CRenderDevice,
+		which also counts the draws, state changes, buffer uploads and texture binds.
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#pragma once
+
+// Include GLEW
+#ifndef GLEW_STATIC
+#include <GL/glew.h>
+#define GLEW_STATIC
+#endif
+
+#include <string>
+
+struct ImDrawData;
+
+// A structure storing the counters of a CRenderDevice
+struct RenderDeviceStats
+{
+	// The number of glDrawElements and glDrawArrays calls
+	unsigned int uiNumDrawCalls;
+	// The number of shader and blend changes
+	unsigned int uiNumStateChanges;
+	// The number of vertex and index buffer uploads, and the total bytes uploaded
+	unsigned int uiNumBufferUploads;
+	unsigned int uiNumBytesUploaded;
+	// The number of texture binds
+	unsigned int uiNumTextureBinds;
+	// The number of textures created and uploaded
+	unsigned int uiNumTextureUploads;
+
+	RenderDeviceStats(void)
+		: uiNumDrawCalls(0)
+		, uiNumStateChanges(0)
+		, uiNumBufferUploads(0)
+		, uiNumBytesUploaded(0)
+		, uiNumTextureBinds(0)
+		, uiNumTextureUploads(0)
+	{
+	}
+};
+
+class CRenderDevice
+{
+public:
+	// Constructor
+	CRenderDevice(void);
+	// Destructor
+	virtual ~CRenderDevice(void);
+
+	// Get the render device used by the renderers
+	static CRenderDevice* GetActive(void);
+	// Set the render device used by the renderers. nullptr restores the OpenGL device.
+	static void SetActive(CRenderDevice* pDevice);
+
+	// Buffers and vertex arrays
+	GLuint CreateBuffer(void);
+	void DeleteBuffer(const GLuint uiBuffer);
+	GLuint CreateVertexArray(void);
+	void DeleteVertexArray(const GLuint uiVertexArray);
+	void BindVertexArray(const GLuint uiVertexArray);
+	void BindBuffer(const GLenum eTarget, const GLuint uiBuffer);
+	void UploadBuffer(const GLenum eTarget, const GLuint uiBuffer, const size_t uiSize, const void* pData, const GLenum eUsage);
+	void UpdateBuffer(const GLenum eTarget, const GLuint uiBuffer, const size_t uiOffset, const size_t uiSize, const void* pData);
+
+	// Vertex attributes
+	void EnableVertexAttrib(const GLuint uiIndex);
+	void DisableVertexAttrib(const GLuint uiIndex);
+	void VertexAttribPointer(const GLuint uiIndex, const GLint iSize, const GLsizei iStride, const size_t uiOffset);
+
+	// Draw calls
+	void DrawElements(const GLenum eMode, const GLsizei iCount, const size_t uiOffset);
+	void DrawArrays(const GLenum eMode, const GLint iFirst, const GLsizei iCount);
+
+	// Clear the colour buffer
+	void Clear(const float fRed, const float fGreen, const float fBlue, const float fAlpha);
+	// Set the area of the window which is rendered to
+	void SetViewport(const int iX, const int iY, const int iWidth, const int iHeight);
+
+	// Render states
+	void UseProgram(const GLuint uiProgram);
+	void SetBlend(const bool bEnable);
+	void ActiveTexture(const GLenum eUnit);
+	void BindTexture(const GLuint uiTexture);
+
+	// Textures
+	GLuint CreateTexture(const int iWidth, const int iHeight, const int iChannels, const void* pData,
+						 const bool bGenerateMipmap = true, const bool bClampToEdge = false);
+	void UpdateTexture(const GLuint uiTexture, const int iX, const int iY, const int iWidth, const int iHeight,
+					   const int iChannels, const void* pData);
+	void UploadTextureLevel(const GLuint uiTexture, const int iLevel, const int iWidth, const int iHeight,
+							const int iChannels, const void* pData);
+	void DeleteTexture(const GLuint uiTexture);
+
+	// Uniforms
+	GLint GetUniformLocation(const GLuint uiProgram, const char* pName);
+	void SetUniformMatrix4(const GLint iLocation, const float* pValue);
+	void SetUniform4(const GLint iLocation, const float* pValue);
+	void SetUniform3(const GLint iLocation, const float fX, const float fY, const float fZ);
+	void SetUniform1i(const GLint iLocation, const int iValue);
+	void SetUniformMatrix3(const GLint iLocation, const float* pValue);
+	void SetUniformMatrix2(const GLint iLocation, const float* pValue);
+	void SetUniform2(const GLint iLocation, const float fX, const float fY);
+	void SetUniform1f(const GLint iLocation, const float fValue);
+
+	// The Dear ImGui renderer, which is set up for each ImGui context
+	bool InitGUI(const char* pGLSLVersion);
+	void NewGUIFrame(void);
+	void RenderGUI(ImDrawData* pDrawData);
+	void ShutdownGUI(void);
+
+	// Get the counters since the last ResetStats
+	const RenderDeviceStats& GetStats(void) const;
+	// Reset the counters, e.g. at the start of a frame
+	virtual void ResetStats(void);
+
+	// Print out details about this class instance in the console window
+	void PrintSelf(void) const;
+
+protected:
+	// The backend implementation of the calls above
+	virtual GLuint DoCreateBuffer(void) = 0;
+	virtual void DoDeleteBuffer(const GLuint uiBuffer) = 0;
+	virtual GLuint DoCreateVertexArray(void) = 0;
+	virtual void DoDeleteVertexArray(const GLuint uiVertexArray) = 0;
+	virtual void DoBindVertexArray(const GLuint uiVertexArray) = 0;
+	virtual void DoBindBuffer(const GLenum eTarget, const GLuint uiBuffer) = 0;
+	virtual void DoUploadBuffer(const GLenum eTarget, const GLuint uiBuffer, const size_t uiSize, const void* pData, const GLenum eUsage) = 0;
+	virtual void DoUpdateBuffer(const GLenum eTarget, const GLuint uiBuffer, const size_t uiOffset, const size_t uiSize, const void* pData) = 0;
+	virtual void DoEnableVertexAttrib(const GLuint uiIndex, const bool bEnable) = 0;
+	virtual void DoVertexAttribPointer(const GLuint uiIndex, const GLint iSize, const GLsizei iStride, const size_t uiOffset) = 0;
+	virtual void DoDrawElements(const GLenum eMode, const GLsizei iCount, const size_t uiOffset) = 0;
+	virtual void DoDrawArrays(const GLenum eMode, const GLint iFirst, const GLsizei iCount) = 0;
+	virtual void DoClear(const float fRed, const float fGreen, const float fBlue, const float fAlpha) = 0;
+	virtual void DoSetViewport(const int iX, const int iY, const int iWidth, const int iHeight) = 0;
+	virtual void DoUseProgram(const GLuint uiProgram) = 0;
+	virtual void DoSetBlend(const bool bEnable) = 0;
+	virtual void DoActiveTexture(const GLenum eUnit) = 0;
+	virtual void DoBindTexture(const GLuint uiTexture) = 0;
+	virtual GLuint DoCreateTexture(const int iWidth, const int iHeight, const int iChannels, const void* pData,
+								   const bool bGenerateMipmap, const bool bClampToEdge) = 0;
+	virtual void DoUpdateTexture(const GLuint uiTexture, const int iX, const int iY, const int iWidth, const int iHeight,
+								 const int iChannels, const void* pData) = 0;
+	virtual void DoUploadTextureLevel(const GLuint uiTexture, const int iLevel, const int iWidth, const int iHeight,
+									  const int iChannels, const void* pData) = 0;
+	virtual void DoDeleteTexture(const GLuint uiTexture) = 0;
+	virtual GLint DoGetUniformLocation(const GLuint uiProgram, const char* pName) = 0;
+	virtual void DoSetUniformMatrix4(const GLint iLocation, const float* pValue) = 0;
+	virtual void DoSetUniform4(const GLint iLocation, const float* pValue) = 0;
+	virtual void DoSetUniform3(const GLint iLocation, const float fX, const float fY, const float fZ) = 0;
+	virtual void DoSetUniform1i(const GLint iLocation, const int iValue) = 0;
+	virtual void DoSetUniformMatrix3(const GLint iLocation, const float* pValue) = 0;
+	virtual void DoSetUniformMatrix2(const GLint iLocation, const float* pValue) = 0;
+	virtual void DoSetUniform2(const GLint iLocation, const float fX, const float fY) = 0;
+	virtual void DoSetUniform1f(const GLint iLocation, const float fValue) = 0;
+	virtual bool DoInitGUI(const char* pGLSLVersion) = 0;
+	virtual void DoNewGUIFrame(void) = 0;
+	virtual void DoRenderGUI(ImDrawData* pDrawData) = 0;
+	virtual void DoShutdownGUI(void) = 0;
+
+	// The counters since the last ResetStats
+	RenderDeviceStats sStats;
+
+	// The render device used by the renderers
+	static CRenderDevice* pActiveDevice;
+};
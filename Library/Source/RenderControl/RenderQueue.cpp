@@ -0,0 +1,259 @@
+/**
+ CRenderQueue
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#include "RenderQueue.h"
+
+// Include GLM
+#include <includes/gtc/type_ptr.hpp>
+
+// Include Shader Manager
+#include "ShaderManager.h"
+
+// Include Render Device
+#include "RenderDevice.h"
+
+// Include Mesh
+#include "..\Primitives\Mesh.h"
+
+#include <algorithm>
+#include <iostream>
+using namespace std;
+
+/**
+ @brief Constructor This constructor has protected access modifier as this class will be a Singleton
+ */
+CRenderQueue::CRenderQueue(void)
+	: VAO(0)
+{
+}
+
+/**
+ @brief Destructor This destructor has protected access modifier as this class will be a Singleton
+ */
+CRenderQueue::~CRenderQueue(void)
+{
+	if (VAO != 0)
+		CRenderDevice::GetActive()->DeleteVertexArray(VAO);
+
+	vRenderItems.clear();
+	vShaderNames.clear();
+}
+
+/**
+ @brief Init this class instance
+ */
+bool CRenderQueue::Init(void)
+{
+	if (VAO == 0)
+		VAO = CRenderDevice::GetActive()->CreateVertexArray();
+
+	// Reserve enough space for a full screen of tiles and the entities
+	vRenderItems.reserve(4096);
+
+	return true;
+}
+
+/**
+ @brief Build the sort key for a draw item.
+		Bits 63-56 are the layer, bit 55 is the blend flag, bits 54-48 the shader,
+		bits 47-32 the texture and bits 31-0 the depth.
+ @param eLayer The layer of the draw item
+ @param bBlend A bool which is true if the draw item needs blending
+ @param uiShaderIndex The index of the shader in vShaderNames
+ @param iTextureID The OpenGL texture ID
+ @param uiDepth The depth of the draw item within its layer
+ */
+unsigned long long CRenderQueue::MakeSortKey(	const LAYER eLayer,
+												const bool bBlend,
+												const unsigned int uiShaderIndex,
+												const GLuint iTextureID,
+												const unsigned int uiDepth)
+{
+	return	((unsigned long long)(eLayer & 0xFF) << 56) |
+			((unsigned long long)(bBlend ? 1 : 0) << 55) |
+			((unsigned long long)(uiShaderIndex & 0x7F) << 48) |
+			((unsigned long long)(iTextureID & 0xFFFF) << 32) |
+			(unsigned long long)uiDepth;
+}
+
+/**
+ @brief Get the index of a shader, registering it if it is new
+ @param sShaderName The name of the shader in CShaderManager
+ */
+unsigned int CRenderQueue::GetShaderIndex(const std::string& sShaderName)
+{
+	for (unsigned int i = 0; i < vShaderNames.size(); i++)
+	{
+		if (vShaderNames[i] == sShaderName)
+			return i;
+	}
+	vShaderNames.push_back(sShaderName);
+	return (unsigned int)vShaderNames.size() - 1;
+}
+
+/**
+ @brief Add a draw item to this frame's queue
+ @param eLayer The layer to render the draw item in
+ @param sShaderName The name of the shader in CShaderManager
+ @param iTextureID The OpenGL texture ID to bind to texture unit 0
+ @param pMesh The mesh to render
+ @param transform The value for the "transform" uniform
+ @param bBlend A bool which is true if the draw item needs blending
+ @param uiDepth The depth of the draw item within its layer
+ */
+void CRenderQueue::Submit(	const LAYER eLayer,
+							const std::string& sShaderName,
+							const GLuint iTextureID,
+							CMesh* pMesh,
+							const glm::mat4& transform,
+							const bool bBlend,
+							const unsigned int uiDepth)
+{
+	RenderItem sItem;
+	sItem.uiShaderIndex = GetShaderIndex(sShaderName);
+	sItem.iTextureID = iTextureID;
+	sItem.bBlend = bBlend;
+	sItem.pMesh = pMesh;
+	sItem.transform = transform;
+	sItem.bHasColour = false;
+	sItem.colour = glm::vec4(1.0f);
+	sItem.ullSortKey = MakeSortKey(eLayer, bBlend, sItem.uiShaderIndex, iTextureID, uiDepth);
+	vRenderItems.push_back(sItem);
+}
+
+/**
+ @brief Add a draw item with a runtime colour to this frame's queue
+ @param colour The value for the "runtime_color" uniform
+ */
+void CRenderQueue::Submit(	const LAYER eLayer,
+							const std::string& sShaderName,
+							const GLuint iTextureID,
+							CMesh* pMesh,
+							const glm::mat4& transform,
+							const glm::vec4& colour,
+							const bool bBlend,
+							const unsigned int uiDepth)
+{
+	Submit(eLayer, sShaderName, iTextureID, pMesh, transform, bBlend, uiDepth);
+	vRenderItems.back().bHasColour = true;
+	vRenderItems.back().colour = colour;
+}
+
+/**
+ @brief Sort the queue and render the draw items of the layers up to a layer, then remove them from the queue.
+		The draw items of the later layers are kept for the next Flush, so that other things,
+		e.g. the GUI, can be drawn between the layers. The counters are added up over the frame,
+		which ends with the Flush of the last layer.
+ @param eLastLayer The last layer to render
+ */
+void CRenderQueue::Flush(const LAYER eLastLayer)
+{
+	// Items with the same key keep their submission order
+	std::stable_sort(vRenderItems.begin(), vRenderItems.end(),
+		[](const RenderItem& a, const RenderItem& b) { return a.ullSortKey < b.ullSortKey; });
+
+	// The items of the later layers have a larger key than any item of the layers up to eLastLayer
+	const unsigned long long ullEndKey = MakeSortKey((LAYER)(eLastLayer + 1), false, 0, 0, 0);
+	const unsigned int uiNumItems = (unsigned int)(std::lower_bound(vRenderItems.begin(), vRenderItems.end(), ullEndKey,
+		[](const RenderItem& a, const unsigned long long ullKey) { return a.ullSortKey < ullKey; }) - vRenderItems.begin());
+
+	if (uiNumItems > 0)
+		RenderItems(uiNumItems);
+	vRenderItems.erase(vRenderItems.begin(), vRenderItems.begin() + uiNumItems);
+
+	// The frame is done once the last layer was flushed
+	if (eLastLayer >= LAYER_OVERLAY)
+	{
+		sStats = sFrameStats;
+		sFrameStats = RenderQueueStats();
+	}
+}
+
+/**
+ @brief Render the first draw items of the queue, which is sorted, and add up their counters
+ @param uiNumItems The number of draw items to render
+ */
+void CRenderQueue::RenderItems(const unsigned int uiNumItems)
+{
+	CRenderDevice* cRenderDevice = CRenderDevice::GetActive();
+	cRenderDevice->BindVertexArray(VAO);
+	cRenderDevice->ActiveTexture(GL_TEXTURE0);
+
+	// The states which were last sent to the render device
+	int iCurrentShader = -1;
+	int iCurrentBlend = -1;
+	GLuint iCurrentTexture = 0;
+	bool bTextureBound = false;
+	int transformLoc = -1;
+	int colourLoc = -1;
+
+	for (unsigned int i = 0; i < uiNumItems; i++)
+	{
+		const RenderItem& sItem = vRenderItems[i];
+
+		if (iCurrentBlend != (sItem.bBlend ? 1 : 0))
+		{
+			cRenderDevice->SetBlend(sItem.bBlend);
+			iCurrentBlend = (sItem.bBlend ? 1 : 0);
+			sFrameStats.uiNumBlendChanges++;
+		}
+		else
+			sFrameStats.uiNumStateChangesSaved++;
+
+		if (iCurrentShader != (int)sItem.uiShaderIndex)
+		{
+			CShaderManager::GetInstance()->Use(vShaderNames[sItem.uiShaderIndex]);
+			unsigned int uiProgram = CShaderManager::GetInstance()->activeShader->ID;
+			transformLoc = cRenderDevice->GetUniformLocation(uiProgram, "transform");
+			colourLoc = cRenderDevice->GetUniformLocation(uiProgram, "runtime_color");
+			iCurrentShader = (int)sItem.uiShaderIndex;
+			sFrameStats.uiNumShaderChanges++;
+		}
+		else
+			sFrameStats.uiNumStateChangesSaved++;
+
+		if ((!bTextureBound) || (iCurrentTexture != sItem.iTextureID))
+		{
+			cRenderDevice->BindTexture(sItem.iTextureID);
+			iCurrentTexture = sItem.iTextureID;
+			bTextureBound = true;
+			sFrameStats.uiNumTextureBinds++;
+		}
+		else
+			sFrameStats.uiNumStateChangesSaved++;
+
+		cRenderDevice->SetUniformMatrix4(transformLoc, glm::value_ptr(sItem.transform));
+		if ((sItem.bHasColour) && (colourLoc >= 0))
+			cRenderDevice->SetUniform4(colourLoc, glm::value_ptr(sItem.colour));
+
+		sItem.pMesh->Render();
+		sFrameStats.uiNumDrawCalls++;
+	}
+
+	// Restore the default states which the PostRender methods leave behind
+	cRenderDevice->SetBlend(false);
+	cRenderDevice->BindVertexArray(0);
+}
+
+/**
+ @brief Get the counters of the last frame which was flushed
+ */
+const RenderQueueStats& CRenderQueue::GetStats(void) const
+{
+	return sStats;
+}
+
+/**
+ @brief Print out details about this class instance in the console window
+ */
+void CRenderQueue::PrintSelf(void) const
+{
+	cout << "CRenderQueue::PrintSelf()" << endl;
+	cout << "Draw calls: " << sStats.uiNumDrawCalls << endl;
+	cout << "Shader changes: " << sStats.uiNumShaderChanges
+		<< ", Texture binds: " << sStats.uiNumTextureBinds
+		<< ", Blend changes: " << sStats.uiNumBlendChanges << endl;
+	cout << "State changes saved: " << sStats.uiNumStateChangesSaved << endl;
+}
@@ -0,0 +1,141 @@
+/**
+ CRenderQueue
+ @brief A class which collects draw items for a frame, sorts them by a 64-bit key and
+		submits them with redundant shader, texture and blend changes filtered out.
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#pragma once
+
+// Include SingletonTemplate
+#include "..\DesignPatterns\SingletonTemplate.h"
+
+// Include GLEW
+#ifndef GLEW_STATIC
+#include <GL/glew.h>
+#define GLEW_STATIC
+#endif
+
+// Include GLM
+#include <includes/glm.hpp>
+
+#include <string>
+#include <vector>
+
+class CMesh;
+
+// A structure storing the counters for one frame of the render queue
+struct RenderQueueStats
+{
+	// The number of draw items submitted
+	unsigned int uiNumDrawCalls;
+	// The number of shader, texture and blend changes sent to OpenGL
+	unsigned int uiNumShaderChanges;
+	unsigned int uiNumTextureBinds;
+	unsigned int uiNumBlendChanges;
+	// The number of state changes which were filtered out as redundant
+	unsigned int uiNumStateChangesSaved;
+
+	RenderQueueStats(void)
+		: uiNumDrawCalls(0)
+		, uiNumShaderChanges(0)
+		, uiNumTextureBinds(0)
+		, uiNumBlendChanges(0)
+		, uiNumStateChangesSaved(0)
+	{
+	}
+};
+
+// A structure storing one draw item in the render queue
+struct RenderItem
+{
+	// The sort key: layer | blend | shader | texture | depth
+	unsigned long long ullSortKey;
+	// The index of the shader in CRenderQueue's shader list
+	unsigned int uiShaderIndex;
+	GLuint iTextureID;
+	bool bBlend;
+	CMesh* pMesh;
+	glm::mat4 transform;
+	// The optional colour for shaders with a runtime_color uniform
+	bool bHasColour;
+	glm::vec4 colour;
+};
+
+class CRenderQueue : public CSingletonTemplate<CRenderQueue>
+{
+	friend CSingletonTemplate<CRenderQueue>;
+public:
+	// The layers which are rendered in this order
+	enum LAYER
+	{
+		LAYER_TILES = 0,
+		LAYER_TILE_MARKERS,
+		LAYER_ENTITIES,
+		LAYER_PLAYER,
+		LAYER_OVERLAY,
+		NUM_LAYERS
+	};
+
+	// Init this class instance
+	bool Init(void);
+
+	// Add a draw item to this frame's queue
+	void Submit(const LAYER eLayer,
+				const std::string& sShaderName,
+				const GLuint iTextureID,
+				CMesh* pMesh,
+				const glm::mat4& transform,
+				const bool bBlend = true,
+				const unsigned int uiDepth = 0);
+	// Add a draw item with a runtime colour to this frame's queue
+	void Submit(const LAYER eLayer,
+				const std::string& sShaderName,
+				const GLuint iTextureID,
+				CMesh* pMesh,
+				const glm::mat4& transform,
+				const glm::vec4& colour,
+				const bool bBlend = true,
+				const unsigned int uiDepth = 0);
+
+	// Sort the queue and render the draw items of the layers up to eLastLayer, keeping the later layers for the next Flush
+	void Flush(const LAYER eLastLayer = LAYER_OVERLAY);
+
+	// Get the counters of the last frame which was flushed
+	const RenderQueueStats& GetStats(void) const;
+
+	// Print out details about this class instance in the console window
+	void PrintSelf(void) const;
+
+protected:
+	// Constructor
+	CRenderQueue(void);
+
+	// Destructor
+	virtual ~CRenderQueue(void);
+
+	// Build the sort key for a draw item
+	static unsigned long long MakeSortKey(const LAYER eLayer,
+										  const bool bBlend,
+										  const unsigned int uiShaderIndex,
+										  const GLuint iTextureID,
+										  const unsigned int uiDepth);
+
+	// Render the first draw items of the sorted queue
+	void RenderItems(const unsigned int uiNumItems);
+
+	// Get the index of a shader, registering it if it is new
+	unsigned int GetShaderIndex(const std::string& sShaderName);
+
+	// The draw items for this frame
+	std::vector<RenderItem> vRenderItems;
+	// The names of the shaders used by the draw items
+	std::vector<std::string> vShaderNames;
+
+	// The VAO which is bound while flushing the queue
+	unsigned int VAO;
+
+	// The counters of the last frame, and of the frame which is being flushed
+	RenderQueueStats sStats;
+	RenderQueueStats sFrameStats;
+};
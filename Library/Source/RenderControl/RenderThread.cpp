@@ -0,0 +1,827 @@
+/**
+ CRenderThread
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#include "RenderThread.h"
+
+// Include CGLRenderDevice, which the render packets are replayed on
+#include "GLRenderDevice.h"
+// Include ImGui, for the textures of its draw commands and its font atlas
+#include "../GUI/imgui.h"
+// Include CSettings
+#include "../GameControl/Settings.h"
+// Include CProfiler
+#include "../TimeControl/Profiler.h"
+
+// Include GLFW
+#include <GLFW/glfw3.h>
+
+#include <algorithm>
+#include <iostream>
+using namespace std;
+
+// The value of a uniform location in vResolvedLocations which has not been looked up on the render thread yet
+static const GLint UNRESOLVED_LOCATION = -2;
+
+/**
+ @brief Add up the busy time of the intervals before a time, and remove it from them
+ @param vIntervals The intervals, in order
+ @param dCutoff The time up to which the busy time is counted
+ @return The busy time before dCutoff
+ */
+static double CountBusyTime(std::vector<std::pair<double, double>>& vIntervals, const double dCutoff)
+{
+	double dBusy = 0.0;
+	unsigned int uiNumCounted = 0;
+	for (unsigned int i = 0; i < vIntervals.size(); i++)
+	{
+		if (vIntervals[i].first >= dCutoff)
+			break;
+		dBusy += min(vIntervals[i].second, dCutoff) - vIntervals[i].first;
+		if (vIntervals[i].second <= dCutoff)
+			uiNumCounted++;
+		else
+			vIntervals[i].first = dCutoff;
+	}
+	vIntervals.erase(vIntervals.begin(), vIntervals.begin() + uiNumCounted);
+	return dBusy;
+}
+
+/**
+ @brief Constructor This constructor has protected access modifier as this class will be a Singleton
+ */
+CRenderThread::CRenderThread(void)
+	: pWindow(NULL)
+	, bStop(false)
+	, uiRecordIndex(0)
+	, uiLastHandle(FIRST_HANDLE)
+	, dSimStart(0.0)
+	, dStatsStart(0.0)
+	, dStatsEnd(0.0)
+	, dSimBusy(0.0)
+	, dRenderBusy(0.0)
+	, dOverlap(0.0)
+	, dSimWait(0.0)
+	, uiNumFrames(0)
+	, uiNumBytesRecorded(0)
+{
+	bInFlight[0] = false;
+	bInFlight[1] = false;
+	cClockStart = std::chrono::steady_clock::now();
+}
+
+/**
+ @brief Destructor This destructor has protected access modifier as this class will be a Singleton
+ */
+CRenderThread::~CRenderThread(void)
+{
+	Stop();
+}
+
+/**
+ @brief Init Initialise this instance. The OpenGL context of the window must be current on the calling thread,
+		and it is made current on the render thread instead. Then this becomes the active CRenderDevice.
+ @param pWindow The window whose OpenGL context is used to render
+ @return A bool value. true if the render thread was started, else false
+ */
+bool CRenderThread::Init(GLFWwindow* pWindow)
+{
+	if (IsRunning())
+		return true;
+	if (pWindow == NULL)
+		return false;
+	this->pWindow = pWindow;
+
+	// Create the singletons used by the render thread here, as CSingletonTemplate::GetInstance is not thread-safe
+	CGLRenderDevice::GetInstance();
+	CSettings::GetInstance();
+#ifdef ENABLE_PROFILER
+	CProfiler::GetInstance();
+#endif
+
+	bStop = false;
+	uiRecordIndex = 0;
+	bInFlight[0] = false;
+	bInFlight[1] = false;
+	dStatsStart = GetTime();
+	dStatsEnd = dStatsStart;
+	dSimStart = dStatsStart;
+
+	// Hand the OpenGL context to the render thread
+	glfwMakeContextCurrent(NULL);
+	cThread = std::thread(&CRenderThread::RenderLoop, this);
+
+	SetActive(this);
+	return true;
+}
+
+/**
+ @brief Mark the start of the work of a frame on the main thread, for the overlap counters
+ */
+void CRenderThread::BeginFrame(void)
+{
+	dSimStart = GetTime();
+}
+
+/**
+ @brief Hand the recorded frame to the render thread, which replays it and swaps the buffers.
+		Then wait until the render thread is done with the frame before, and start recording into its list.
+ */
+void CRenderThread::Submit(void)
+{
+	PROFILE_ZONE("CRenderThread::Submit");
+
+	if (!IsRunning())
+		return;
+
+	const double dSubmitTime = GetTime();
+	{
+		std::lock_guard<std::mutex> lock(mStatsMutex);
+		AddInterval(vSimIntervals, dSimStart, dSubmitTime);
+		// Keep the lists of intervals short
+		if (vSimIntervals.size() + vRenderIntervals.size() > 256)
+			CountIntervals();
+	}
+	uiNumFrames++;
+	uiNumBytesRecorded += cLists[uiRecordIndex].GetDataSize();
+
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		bInFlight[uiRecordIndex] = true;
+		Task sTask;
+		sTask.pList = &cLists[uiRecordIndex];
+		sTask.bSwapBuffers = true;
+		sTask.pDone = NULL;
+		dTasks.push_back(sTask);
+	}
+	cvTaskQueued.notify_one();
+
+	uiRecordIndex = 1 - uiRecordIndex;
+	{
+		PROFILE_ZONE("CRenderThread::WaitForRenderThread");
+		std::unique_lock<std::mutex> lock(mMutex);
+		cvTaskDone.wait(lock, [this]() { return bInFlight[uiRecordIndex] == false; });
+	}
+	// The list is cleared on this thread, as the copies of the ImGui draw lists were allocated on it
+	cLists[uiRecordIndex].Clear();
+
+	dSimWait += GetTime() - dSubmitTime;
+}
+
+/**
+ @brief Run a function on the render thread with the OpenGL context, and wait for it.
+		It runs after the frames which were submitted, but before the frame which is being recorded.
+		If the render thread is not running, the function is run on the calling thread.
+ @param fnCall The function
+ */
+void CRenderThread::RunOnRenderThread(const std::function<void()>& fnCall)
+{
+	if (!IsRunning())
+	{
+		fnCall();
+		return;
+	}
+
+	bool bDone = false;
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		Task sTask;
+		sTask.pList = NULL;
+		sTask.bSwapBuffers = false;
+		sTask.fnCall = fnCall;
+		sTask.pDone = &bDone;
+		dTasks.push_back(sTask);
+	}
+	cvTaskQueued.notify_one();
+
+	std::unique_lock<std::mutex> lock(mMutex);
+	cvTaskDone.wait(lock, [&bDone]() { return bDone; });
+}
+
+/**
+ @brief Check if the render thread is running
+ */
+bool CRenderThread::IsRunning(void) const
+{
+	return cThread.joinable();
+}
+
+/**
+ @brief Print out details about this class instance in the console window
+ */
+void CRenderThread::PrintSelf(void)
+{
+	std::lock_guard<std::mutex> lock(mStatsMutex);
+	CountIntervals();
+
+	cout << "CRenderThread::PrintSelf()" << endl;
+	cout << "Frames: " << uiNumFrames;
+	if (uiNumFrames > 0)
+		cout << ", " << uiNumBytesRecorded / uiNumFrames << " bytes copied into each render packet";
+	cout << endl;
+
+	const double dTime = dStatsEnd - dStatsStart;
+	if ((uiNumFrames == 0) || (dTime <= 0.0))
+		return;
+	cout << "Main thread busy: " << dSimBusy * 1000.0 / uiNumFrames << " ms per frame ("
+		 << dSimBusy * 100.0 / dTime << "% of the time)" << endl;
+	cout << "Render thread busy: " << dRenderBusy * 1000.0 / uiNumFrames << " ms per frame ("
+		 << dRenderBusy * 100.0 / dTime << "% of the time)" << endl;
+	// The overlap is the time which is saved over rendering on the main thread
+	const double dShorterBusy = min(dSimBusy, dRenderBusy);
+	cout << "Both threads busy: " << dOverlap * 1000.0 / uiNumFrames << " ms per frame ("
+		 << (dShorterBusy > 0.0 ? dOverlap * 100.0 / dShorterBusy : 0.0) << "% of the shorter stage overlapped)" << endl;
+	cout << "Main thread waited for the render thread: " << dSimWait * 1000.0 / uiNumFrames << " ms per frame" << endl;
+}
+
+/**
+ @brief The loop of the render thread. It runs the tasks in the order they were submitted until it is stopped.
+ */
+void CRenderThread::RenderLoop(void)
+{
+	PROFILE_THREAD_NAME("Render");
+	glfwMakeContextCurrent(pWindow);
+
+	while (true)
+	{
+		Task sTask;
+		{
+			std::unique_lock<std::mutex> lock(mMutex);
+			cvTaskQueued.wait(lock, [this]() { return bStop || !dTasks.empty(); });
+			if (dTasks.empty())
+				break;
+			sTask = dTasks.front();
+			dTasks.pop_front();
+		}
+
+		const double dStart = GetTime();
+		if (sTask.pList)
+		{
+			Replay(*sTask.pList);
+			if (sTask.bSwapBuffers)
+			{
+				PROFILE_ZONE("glfwSwapBuffers");
+				glfwSwapBuffers(pWindow);
+			}
+		}
+		else if (sTask.fnCall)
+		{
+			sTask.fnCall();
+		}
+		const double dEnd = GetTime();
+
+		{
+			std::lock_guard<std::mutex> lock(mStatsMutex);
+			AddInterval(vRenderIntervals, dStart, dEnd);
+		}
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			if (sTask.pList)
+				bInFlight[sTask.pList - cLists] = false;
+			if (sTask.pDone)
+				*sTask.pDone = true;
+		}
+		cvTaskDone.notify_all();
+	}
+
+	glfwMakeContextCurrent(NULL);
+}
+
+/**
+ @brief Replay a render packet on CGLRenderDevice
+ @param cList The render packet
+ */
+void CRenderThread::Replay(CRenderCommandList& cList)
+{
+	PROFILE_ZONE("CRenderThread::Replay");
+
+	CRenderDevice* cGLRenderDevice = CGLRenderDevice::GetInstance();
+	std::vector<RenderListCommand>& vCommands = cList.GetCommands();
+	for (unsigned int i = 0; i < vCommands.size(); i++)
+	{
+		const RenderListCommand& sCommand = vCommands[i];
+		const void* pData = cList.GetData(sCommand);
+		switch (sCommand.eType)
+		{
+		case RenderListCommand::CREATE_BUFFER:
+			mHandles[sCommand.uiHandle] = cGLRenderDevice->CreateBuffer();
+			break;
+		case RenderListCommand::DELETE_BUFFER:
+			cGLRenderDevice->DeleteBuffer(GetGLObject(sCommand.uiHandle));
+			mHandles.erase(sCommand.uiHandle);
+			break;
+		case RenderListCommand::CREATE_VERTEX_ARRAY:
+			mHandles[sCommand.uiHandle] = cGLRenderDevice->CreateVertexArray();
+			break;
+		case RenderListCommand::DELETE_VERTEX_ARRAY:
+			cGLRenderDevice->DeleteVertexArray(GetGLObject(sCommand.uiHandle));
+			mHandles.erase(sCommand.uiHandle);
+			break;
+		case RenderListCommand::BIND_VERTEX_ARRAY:
+			cGLRenderDevice->BindVertexArray(GetGLObject(sCommand.uiHandle));
+			break;
+		case RenderListCommand::BIND_BUFFER:
+			cGLRenderDevice->BindBuffer(sCommand.eEnum, GetGLObject(sCommand.uiHandle));
+			break;
+		case RenderListCommand::UPLOAD_BUFFER:
+			cGLRenderDevice->UploadBuffer(sCommand.eEnum, GetGLObject(sCommand.uiHandle), sCommand.uiSize, pData,
+										  (GLenum)sCommand.iArgs[0]);
+			break;
+		case RenderListCommand::UPDATE_BUFFER:
+			cGLRenderDevice->UpdateBuffer(sCommand.eEnum, GetGLObject(sCommand.uiHandle), sCommand.uiOffset, sCommand.uiSize, pData);
+			break;
+		case RenderListCommand::ENABLE_VERTEX_ATTRIB:
+			if (sCommand.iArgs[1] != 0)
+				cGLRenderDevice->EnableVertexAttrib(sCommand.iArgs[0]);
+			else
+				cGLRenderDevice->DisableVertexAttrib(sCommand.iArgs[0]);
+			break;
+		case RenderListCommand::VERTEX_ATTRIB_POINTER:
+			cGLRenderDevice->VertexAttribPointer(sCommand.iArgs[0], sCommand.iArgs[1], sCommand.iArgs[2], sCommand.uiOffset);
+			break;
+		case RenderListCommand::DRAW_ELEMENTS:
+			cGLRenderDevice->DrawElements(sCommand.eEnum, sCommand.iArgs[0], sCommand.uiOffset);
+			break;
+		case RenderListCommand::DRAW_ARRAYS:
+			cGLRenderDevice->DrawArrays(sCommand.eEnum, sCommand.iArgs[0], sCommand.iArgs[1]);
+			break;
+		case RenderListCommand::CLEAR:
+			cGLRenderDevice->Clear(sCommand.fArgs[0], sCommand.fArgs[1], sCommand.fArgs[2], sCommand.fArgs[3]);
+			break;
+		case RenderListCommand::SET_VIEWPORT:
+			cGLRenderDevice->SetViewport(sCommand.iArgs[0], sCommand.iArgs[1], sCommand.iArgs[2], sCommand.iArgs[3]);
+			break;
+		case RenderListCommand::USE_PROGRAM:
+			cGLRenderDevice->UseProgram(sCommand.uiHandle);
+			break;
+		case RenderListCommand::SET_BLEND:
+			cGLRenderDevice->SetBlend(sCommand.iArgs[0] != 0);
+			break;
+		case RenderListCommand::ACTIVE_TEXTURE:
+			cGLRenderDevice->ActiveTexture(sCommand.eEnum);
+			break;
+		case RenderListCommand::BIND_TEXTURE:
+			cGLRenderDevice->BindTexture(GetGLObject(sCommand.uiHandle));
+			break;
+		case RenderListCommand::CREATE_TEXTURE:
+			mHandles[sCommand.uiHandle] = cGLRenderDevice->CreateTexture(sCommand.iArgs[0], sCommand.iArgs[1], sCommand.iArgs[2], pData,
+																		 sCommand.iArgs[3] != 0, sCommand.iArgs[4] != 0);
+			break;
+		case RenderListCommand::UPDATE_TEXTURE:
+			cGLRenderDevice->UpdateTexture(GetGLObject(sCommand.uiHandle), sCommand.iArgs[0], sCommand.iArgs[1],
+										   sCommand.iArgs[2], sCommand.iArgs[3], sCommand.iArgs[4], pData);
+			break;
+		case RenderListCommand::UPLOAD_TEXTURE_LEVEL:
+			cGLRenderDevice->UploadTextureLevel(GetGLObject(sCommand.uiHandle), sCommand.iArgs[0], sCommand.iArgs[1],
+												sCommand.iArgs[2], sCommand.iArgs[3], pData);
+			break;
+		case RenderListCommand::DELETE_TEXTURE:
+			cGLRenderDevice->DeleteTexture(GetGLObject(sCommand.uiHandle));
+			mHandles.erase(sCommand.uiHandle);
+			break;
+		case RenderListCommand::SET_UNIFORM_MATRIX4:
+			cGLRenderDevice->SetUniformMatrix4(GetLocation(sCommand.iArgs[0]), (const float*)pData);
+			break;
+		case RenderListCommand::SET_UNIFORM_MATRIX3:
+			cGLRenderDevice->SetUniformMatrix3(GetLocation(sCommand.iArgs[0]), (const float*)pData);
+			break;
+		case RenderListCommand::SET_UNIFORM_MATRIX2:
+			cGLRenderDevice->SetUniformMatrix2(GetLocation(sCommand.iArgs[0]), (const float*)pData);
+			break;
+		case RenderListCommand::SET_UNIFORM4:
+			cGLRenderDevice->SetUniform4(GetLocation(sCommand.iArgs[0]), sCommand.fArgs);
+			break;
+		case RenderListCommand::SET_UNIFORM3:
+			cGLRenderDevice->SetUniform3(GetLocation(sCommand.iArgs[0]), sCommand.fArgs[0], sCommand.fArgs[1], sCommand.fArgs[2]);
+			break;
+		case RenderListCommand::SET_UNIFORM2:
+			cGLRenderDevice->SetUniform2(GetLocation(sCommand.iArgs[0]), sCommand.fArgs[0], sCommand.fArgs[1]);
+			break;
+		case RenderListCommand::SET_UNIFORM1F:
+			cGLRenderDevice->SetUniform1f(GetLocation(sCommand.iArgs[0]), sCommand.fArgs[0]);
+			break;
+		case RenderListCommand::SET_UNIFORM1I:
+			cGLRenderDevice->SetUniform1i(GetLocation(sCommand.iArgs[0]), sCommand.iArgs[1]);
+			break;
+		case RenderListCommand::RENDER_GUI:
+		{
+			ImDrawData* pDrawData = cList.GetGUIDrawData(sCommand);
+			if (pDrawData == NULL)
+				break;
+			// The images in the GUI, e.g. the buttons, use the textures which were created while recording
+			for (int j = 0; j < pDrawData->CmdListsCount; j++)
+			{
+				ImVector<ImDrawCmd>& vDrawCmds = pDrawData->CmdLists[j]->CmdBuffer;
+				for (int k = 0; k < vDrawCmds.Size; k++)
+					vDrawCmds[k].TextureId = (ImTextureID)(intptr_t)GetGLObject((GLuint)(intptr_t)vDrawCmds[k].TextureId);
+			}
+			cGLRenderDevice->RenderGUI(pDrawData);
+			break;
+		}
+		default:
+			break;
+		}
+	}
+}
+
+/**
+ @brief Get the OpenGL object of a handle
+ @param uiHandle A handle which was given out while recording, or the name of an OpenGL object which was created before Init
+ */
+GLuint CRenderThread::GetGLObject(const GLuint uiHandle) const
+{
+	if (uiHandle <= FIRST_HANDLE)
+		return uiHandle;
+
+	std::unordered_map<GLuint, GLuint>::const_iterator it = mHandles.find(uiHandle);
+	return (it != mHandles.end() ? it->second : 0);
+}
+
+/**
+ @brief Get the OpenGL location of a uniform location which was given out while recording.
+		It is looked up the first time it is used on the render thread.
+ @param iLocation The uniform location which was given out
+ @return The OpenGL location, or -1 if the program does not have the uniform
+ */
+GLint CRenderThread::GetLocation(const GLint iLocation)
+{
+	if (iLocation < 0)
+		return -1;
+
+	if ((size_t)iLocation >= vResolvedLocations.size())
+		vResolvedLocations.resize(iLocation + 1, UNRESOLVED_LOCATION);
+	if (vResolvedLocations[iLocation] == UNRESOLVED_LOCATION)
+	{
+		std::pair<GLuint, std::string> sUniform;
+		{
+			std::lock_guard<std::mutex> lock(mUniformMutex);
+			sUniform = vUniforms[iLocation];
+		}
+		vResolvedLocations[iLocation] = CGLRenderDevice::GetInstance()->GetUniformLocation(GetGLObject(sUniform.first),
+																							  sUniform.second.c_str());
+	}
+	return vResolvedLocations[iLocation];
+}
+
+/**
+ @brief Get the current time in seconds
+ */
+double CRenderThread::GetTime(void) const
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - cClockStart).count();
+}
+
+/**
+ @brief Add a busy interval of a thread. mStatsMutex must be locked.
+ */
+void CRenderThread::AddInterval(std::vector<Interval>& vIntervals, const double dStart, const double dEnd)
+{
+	if (dEnd > dStart)
+		vIntervals.push_back(Interval(dStart, dEnd));
+}
+
+/**
+ @brief Count the busy time of each thread, and the time which both were busy, up to the last time
+		which both threads have reached, and remove it from the intervals. mStatsMutex must be locked.
+ */
+void CRenderThread::CountIntervals(void)
+{
+	if ((vSimIntervals.empty()) || (vRenderIntervals.empty()))
+		return;
+	const double dCutoff = min(vSimIntervals.back().second, vRenderIntervals.back().second);
+	if (dCutoff <= dStatsEnd)
+		return;
+
+	// Both lists are in order, so the overlapping intervals are found in one pass
+	unsigned int i = 0, j = 0;
+	while ((i < vSimIntervals.size()) && (j < vRenderIntervals.size()))
+	{
+		const double dStart = max(vSimIntervals[i].first, vRenderIntervals[j].first);
+		const double dEnd = min(min(vSimIntervals[i].second, vRenderIntervals[j].second), dCutoff);
+		if (dEnd > dStart)
+			dOverlap += dEnd - dStart;
+		if (vSimIntervals[i].second < vRenderIntervals[j].second)
+			i++;
+		else
+			j++;
+	}
+
+	dSimBusy += CountBusyTime(vSimIntervals, dCutoff);
+	dRenderBusy += CountBusyTime(vRenderIntervals, dCutoff);
+	dStatsEnd = dCutoff;
+}
+
+/**
+ @brief Stop the render thread and make the OpenGL context current on the calling thread again.
+		The calls which were recorded since the last Submit, e.g. to release the objects of the game states,
+		are replayed first, without swapping the buffers.
+ */
+void CRenderThread::Stop(void)
+{
+	if (!IsRunning())
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		bInFlight[uiRecordIndex] = true;
+		Task sTask;
+		sTask.pList = &cLists[uiRecordIndex];
+		sTask.bSwapBuffers = false;
+		sTask.pDone = NULL;
+		dTasks.push_back(sTask);
+		bStop = true;
+	}
+	cvTaskQueued.notify_one();
+	cThread.join();
+
+	cLists[0].Clear();
+	cLists[1].Clear();
+	if (pActiveDevice == this)
+		SetActive(NULL);
+	glfwMakeContextCurrent(pWindow);
+}
+
+GLuint CRenderThread::DoCreateBuffer(void)
+{
+	RenderListCommand& sCommand = cLists[uiRecordIndex].Add(RenderListCommand::CREATE_BUFFER);
+	sCommand.uiHandle = ++uiLastHandle;
+	return sCommand.uiHandle;
+}
+
+void CRenderThread::DoDeleteBuffer(const GLuint uiBuffer)
+{
+	cLists[uiRecordIndex].Add(RenderListCommand::DELETE_BUFFER).uiHandle = uiBuffer;
+}
+
+GLuint CRenderThread::DoCreateVertexArray(void)
+{
+	RenderListCommand& sCommand = cLists[uiRecordIndex].Add(RenderListCommand::CREATE_VERTEX_ARRAY);
+	sCommand.uiHandle = ++uiLastHandle;
+	return sCommand.uiHandle;
+}
+
+void CRenderThread::DoDeleteVertexArray(const GLuint uiVertexArray)
+{
+	cLists[uiRecordIndex].Add(RenderListCommand::DELETE_VERTEX_ARRAY).uiHandle = uiVertexArray;
+}
+
+void CRenderThread::DoBindVertexArray(const GLuint uiVertexArray)
+{
+	cLists[uiRecordIndex].Add(RenderListCommand::BIND_VERTEX_ARRAY).uiHandle = uiVertexArray;
+}
+
+void CRenderThread::DoBindBuffer(const GLenum eTarget, const GLuint uiBuffer)
+{
+	RenderListCommand& sCommand = cLists[uiRecordIndex].Add(RenderListCommand::BIND_BUFFER);
+	sCommand.eEnum = eTarget;
+	sCommand.uiHandle = uiBuffer;
+}
+
+void CRenderThread::DoUploadBuffer(const GLenum eTarget, const GLuint uiBuffer, const size_t uiSize, const void* pData, const GLenum eUsage)
+{
+	RenderListCommand& sCommand = cLists[uiRecordIndex].Add(RenderListCommand::UPLOAD_BUFFER);
+	sCommand.eEnum = eTarget;
+	sCommand.uiHandle = uiBuffer;
+	sCommand.uiSize = uiSize;
+	sCommand.iArgs[0] = (int)eUsage;
+	cLists[uiRecordIndex].AddData(pData, uiSize);
+}
+
+void CRenderThread::DoUpdateBuffer(const GLenum eTarget, const GLuint uiBuffer, const size_t uiOffset, const size_t uiSize, const void* pData)
+{
+	RenderListCommand& sCommand = cLists[uiRecordIndex].Add(RenderListCommand::UPDATE_BUFFER);
+	sCommand.eEnum = eTarget;
+	sCommand.uiHandle = uiBuffer;
+	sCommand.uiOffset = uiOffset;
+	sCommand.uiSize = uiSize;
+	cLists[uiRecordIndex].AddData(pData, uiSize);
+}
+
+void CRenderThread::DoEnableVertexAttrib(const GLuint uiIndex, const bool bEnable)
+{
+	RenderListCommand& sCommand = cLists[uiRecordIndex].Add(RenderListCommand::ENABLE_VERTEX_ATTRIB);
+	sCommand.iArgs[0] = (int)uiIndex;
+	sCommand.iArgs[1] = (bEnable ? 1 : 0);
+}
+
+void CRenderThread::DoVertexAttribPointer(const GLuint uiIndex, const GLint iSize, const GLsizei iStride, const size_t uiOffset)
+{
+	RenderListCommand& sCommand = cLists[uiRecordIndex].Add(RenderListCommand::VERTEX_ATTRIB_POINTER);
+	sCommand.iArgs[0] = (int)uiIndex;
+	sCommand.iArgs[1] = iSize;
+	sCommand.iArgs[2] = iStride;
+	sCommand.uiOffset = uiOffset;
+}
+
+void CRenderThread::DoDrawElements(const GLenum eMode, const GLsizei iCount, const size_t uiOffset)
+{
+	RenderListCommand& sCommand = cLists[uiRecordIndex].Add(RenderListCommand::DRAW_ELEMENTS);
+	sCommand.eEnum = eMode;
+	sCommand.iArgs[0] = iCount;
+	sCommand.uiOffset = uiOffset;
+}
+
+void CRenderThread::DoDrawArrays(const GLenum eMode, const GLint iFirst, const GLsizei iCount)
+{
+	RenderListCommand& sCommand = cLists[uiRecordIndex].Add(RenderListCommand::DRAW_ARRAYS);
+	sCommand.eEnum = eMode;
+	sCommand.iArgs[0] = iFirst;
+	sCommand.iArgs[1] = iCount;
+}
+
+void CRenderThread::DoClear(const float fRed, const float fGreen, const float fBlue, const float fAlpha)
+{
+	RenderListCommand& sCommand = cLists[uiRecordIndex].Add(RenderListCommand::CLEAR);
+	sCommand.fArgs[0] = fRed;
+	sCommand.fArgs[1] = fGreen;
+	sCommand.fArgs[2] = fBlue;
+	sCommand.fArgs[3] = fAlpha;
+}
+
+void CRenderThread::DoSetViewport(const int iX, const int iY, const int iWidth, const int iHeight)
+{
+	RenderListCommand& sCommand = cLists[uiRecordIndex].Add(RenderListCommand::SET_VIEWPORT);
+	sCommand.iArgs[0] = iX;
+	sCommand.iArgs[1] = iY;
+	sCommand.iArgs[2] = iWidth;
+	sCommand.iArgs[3] = iHeight;
+}
+
+void CRenderThread::DoUseProgram(const GLuint uiProgram)
+{
+	cLists[uiRecordIndex].Add(RenderListCommand::USE_PROGRAM).uiHandle = uiProgram;
+}
+
+void CRenderThread::DoSetBlend(const bool bEnable)
+{
+	cLists[uiRecordIndex].Add(RenderListCommand::SET_BLEND).iArgs[0] = (bEnable ? 1 : 0);
+}
+
+void CRenderThread::DoActiveTexture(const GLenum eUnit)
+{
+	cLists[uiRecordIndex].Add(RenderListCommand::ACTIVE_TEXTURE).eEnum = eUnit;
+}
+
+void CRenderThread::DoBindTexture(const GLuint uiTexture)
+{
+	cLists[uiRecordIndex].Add(RenderListCommand::BIND_TEXTURE).uiHandle = uiTexture;
+}
+
+GLuint CRenderThread::DoCreateTexture(const int iWidth, const int iHeight, const int iChannels, const void* pData,
+									  const bool bGenerateMipmap, const bool bClampToEdge)
+{
+	RenderListCommand& sCommand = cLists[uiRecordIndex].Add(RenderListCommand::CREATE_TEXTURE);
+	sCommand.uiHandle = ++uiLastHandle;
+	sCommand.iArgs[0] = iWidth;
+	sCommand.iArgs[1] = iHeight;
+	sCommand.iArgs[2] = iChannels;
+	sCommand.iArgs[3] = (bGenerateMipmap ? 1 : 0);
+	sCommand.iArgs[4] = (bClampToEdge ? 1 : 0);
+	cLists[uiRecordIndex].AddData(pData, (size_t)iWidth * iHeight * iChannels);
+	return uiLastHandle;
+}
+
+void CRenderThread::DoUpdateTexture(const GLuint uiTexture, const int iX, const int iY, const int iWidth, const int iHeight,
+									const int iChannels, const void* pData)
+{
+	RenderListCommand& sCommand = cLists[uiRecordIndex].Add(RenderListCommand::UPDATE_TEXTURE);
+	sCommand.uiHandle = uiTexture;
+	sCommand.iArgs[0] = iX;
+	sCommand.iArgs[1] = iY;
+	sCommand.iArgs[2] = iWidth;
+	sCommand.iArgs[3] = iHeight;
+	sCommand.iArgs[4] = iChannels;
+	cLists[uiRecordIndex].AddData(pData, (size_t)iWidth * iHeight * iChannels);
+}
+
+void CRenderThread::DoUploadTextureLevel(const GLuint uiTexture, const int iLevel, const int iWidth, const int iHeight,
+										 const int iChannels, const void* pData)
+{
+	RenderListCommand& sCommand = cLists[uiRecordIndex].Add(RenderListCommand::UPLOAD_TEXTURE_LEVEL);
+	sCommand.uiHandle = uiTexture;
+	sCommand.iArgs[0] = iLevel;
+	sCommand.iArgs[1] = iWidth;
+	sCommand.iArgs[2] = iHeight;
+	sCommand.iArgs[3] = iChannels;
+	cLists[uiRecordIndex].AddData(pData, (size_t)iWidth * iHeight * iChannels);
+}
+
+void CRenderThread::DoDeleteTexture(const GLuint uiTexture)
+{
+	cLists[uiRecordIndex].Add(RenderListCommand::DELETE_TEXTURE).uiHandle = uiTexture;
+}
+
+/**
+ @brief Give out a location for a uniform, which the render thread looks up in OpenGL when it is used.
+		The same program and name always get the same location.
+ */
+GLint CRenderThread::DoGetUniformLocation(const GLuint uiProgram, const char* pName)
+{
+	const std::pair<GLuint, std::string> sUniform(uiProgram, pName);
+	std::map<std::pair<GLuint, std::string>, GLint>::const_iterator it = mUniformLocations.find(sUniform);
+	if (it != mUniformLocations.end())
+		return it->second;
+
+	GLint iLocation = 0;
+	{
+		std::lock_guard<std::mutex> lock(mUniformMutex);
+		iLocation = (GLint)vUniforms.size();
+		vUniforms.push_back(sUniform);
+	}
+	mUniformLocations[sUniform] = iLocation;
+	return iLocation;
+}
+
+void CRenderThread::DoSetUniformMatrix4(const GLint iLocation, const float* pValue)
+{
+	cLists[uiRecordIndex].Add(RenderListCommand::SET_UNIFORM_MATRIX4).iArgs[0] = iLocation;
+	cLists[uiRecordIndex].AddData(pValue, 16 * sizeof(float));
+}
+
+void CRenderThread::DoSetUniform4(const GLint iLocation, const float* pValue)
+{
+	RenderListCommand& sCommand = cLists[uiRecordIndex].Add(RenderListCommand::SET_UNIFORM4);
+	sCommand.iArgs[0] = iLocation;
+	for (unsigned int i = 0; i < 4; i++)
+		sCommand.fArgs[i] = pValue[i];
+}
+
+void CRenderThread::DoSetUniform3(const GLint iLocation, const float fX, const float fY, const float fZ)
+{
+	RenderListCommand& sCommand = cLists[uiRecordIndex].Add(RenderListCommand::SET_UNIFORM3);
+	sCommand.iArgs[0] = iLocation;
+	sCommand.fArgs[0] = fX;
+	sCommand.fArgs[1] = fY;
+	sCommand.fArgs[2] = fZ;
+}
+
+void CRenderThread::DoSetUniform1i(const GLint iLocation, const int iValue)
+{
+	RenderListCommand& sCommand = cLists[uiRecordIndex].Add(RenderListCommand::SET_UNIFORM1I);
+	sCommand.iArgs[0] = iLocation;
+	sCommand.iArgs[1] = iValue;
+}
+
+void CRenderThread::DoSetUniformMatrix3(const GLint iLocation, const float* pValue)
+{
+	cLists[uiRecordIndex].Add(RenderListCommand::SET_UNIFORM_MATRIX3).iArgs[0] = iLocation;
+	cLists[uiRecordIndex].AddData(pValue, 9 * sizeof(float));
+}
+
+void CRenderThread::DoSetUniformMatrix2(const GLint iLocation, const float* pValue)
+{
+	cLists[uiRecordIndex].Add(RenderListCommand::SET_UNIFORM_MATRIX2).iArgs[0] = iLocation;
+	cLists[uiRecordIndex].AddData(pValue, 4 * sizeof(float));
+}
+
+void CRenderThread::DoSetUniform2(const GLint iLocation, const float fX, const float fY)
+{
+	RenderListCommand& sCommand = cLists[uiRecordIndex].Add(RenderListCommand::SET_UNIFORM2);
+	sCommand.iArgs[0] = iLocation;
+	sCommand.fArgs[0] = fX;
+	sCommand.fArgs[1] = fY;
+}
+
+void CRenderThread::DoSetUniform1f(const GLint iLocation, const float fValue)
+{
+	RenderListCommand& sCommand = cLists[uiRecordIndex].Add(RenderListCommand::SET_UNIFORM1F);
+	sCommand.iArgs[0] = iLocation;
+	sCommand.fArgs[0] = fValue;
+}
+
+/**
+ @brief Set up the Dear ImGui renderer on the render thread, while the main thread waits
+ */
+bool CRenderThread::DoInitGUI(const char* pGLSLVersion)
+{
+	bool bResult = false;
+	RunOnRenderThread([&bResult, pGLSLVersion]() { bResult = CGLRenderDevice::GetInstance()->InitGUI(pGLSLVersion); });
+	return bResult;
+}
+
+/**
+ @brief Create the shader and font texture of the Dear ImGui renderer on the render thread, while the main thread waits.
+		They are only created once for each ImGui context, which is when its font atlas has no texture yet.
+ */
+void CRenderThread::DoNewGUIFrame(void)
+{
+	if (ImGui::GetIO().Fonts->TexID == NULL)
+		RunOnRenderThread([]() { CGLRenderDevice::GetInstance()->NewGUIFrame(); });
+}
+
+/**
+ @brief Copy the Dear ImGui draw data into the render packet, as ImGui reuses it in the next frame
+ */
+void CRenderThread::DoRenderGUI(ImDrawData* pDrawData)
+{
+	cLists[uiRecordIndex].AddGUIDrawData(pDrawData);
+}
+
+/**
+ @brief Release the Dear ImGui renderer on the render thread, after the frames which use it, while the main thread waits
+ */
+void CRenderThread::DoShutdownGUI(void)
+{
+	RunOnRenderThread([]() { CGLRenderDevice::GetInstance()->ShutdownGUI(); });
+}
@@ -0,0 +1,194 @@
+/**
+ CRenderThread
+ @brief The CRenderDevice which lets the game render its next frame while OpenGL renders the last one.
+		The OpenGL context is made current on a render thread. The calls which the game makes on the main thread
+		are recorded into one of two CRenderCommandLists, the render packet of the frame. Submit hands the
+		packet to the render thread, which replays it on CGLRenderDevice and swaps the buffers, while
+		the main thread records the next frame into the other list. It only waits if the render thread is
+		still busy with the frame before, so a slow submission or swap no longer stalls the simulation.
+		The buffers, vertex arrays and textures which are created while recording get handles
+		which the render thread maps to the OpenGL objects, and so do the uniform locations.
+		The time which both threads are busy is measured, to show how much of the work overlaps.
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#pragma once
+
+// Include SingletonTemplate
+#include "..\DesignPatterns\SingletonTemplate.h"
+
+// Include CRenderDevice
+#include "RenderDevice.h"
+// Include CRenderCommandList
+#include "RenderCommandList.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+struct GLFWwindow;
+
+class CRenderThread : public CSingletonTemplate<CRenderThread>, public CRenderDevice
+{
+	friend CSingletonTemplate<CRenderThread>;
+public:
+	// Init
+	bool Init(GLFWwindow* pWindow);
+
+	// Mark the start of the work of a frame on the main thread
+	void BeginFrame(void);
+	// Hand the recorded frame to the render thread, and start recording the next frame
+	void Submit(void);
+
+	// Run a function on the render thread with the OpenGL context, after the frames which were submitted, and wait for it
+	void RunOnRenderThread(const std::function<void()>& fnCall);
+
+	// Check if the render thread is running
+	bool IsRunning(void) const;
+
+	// Print out details about this class instance in the console window
+	void PrintSelf(void);
+
+protected:
+	// A frame to replay, or a function to run, on the render thread
+	struct Task {
+		CRenderCommandList* pList;
+		bool bSwapBuffers;
+		std::function<void()> fnCall;
+		bool* pDone;
+	};
+
+	// A time interval in seconds, when a thread was busy
+	typedef std::pair<double, double> Interval;
+
+	// The first handle given out for the buffers, vertex arrays and textures created while recording.
+	// The OpenGL objects which were created before Init keep their own names, which are smaller.
+	static const GLuint FIRST_HANDLE = 0x40000000;
+
+	// The window whose OpenGL context is used by the render thread
+	GLFWwindow* pWindow;
+	// The render thread
+	std::thread cThread;
+	bool bStop;
+
+	// The render packets. One is recorded on the main thread, while the other is replayed on the render thread.
+	CRenderCommandList cLists[2];
+	// A bool for each list, which is true while it is waiting for or being replayed on the render thread
+	bool bInFlight[2];
+	// The index of the list which is being recorded
+	unsigned int uiRecordIndex;
+
+	// The frames and functions for the render thread, in the order they were submitted
+	std::deque<Task> dTasks;
+	std::mutex mMutex;
+	// Notifies the render thread of a task, and the main thread of a finished task
+	std::condition_variable cvTaskQueued;
+	std::condition_variable cvTaskDone;
+
+	// The last handle given out while recording
+	GLuint uiLastHandle;
+	// The OpenGL object of each handle, which is only used on the render thread
+	std::unordered_map<GLuint, GLuint> mHandles;
+
+	// The program and name of each uniform location given out while recording, guarded by mUniformMutex
+	std::vector<std::pair<GLuint, std::string>> vUniforms;
+	std::map<std::pair<GLuint, std::string>, GLint> mUniformLocations;
+	std::mutex mUniformMutex;
+	// The OpenGL location of each uniform location given out, or UNRESOLVED_LOCATION, which is only used on the render thread
+	std::vector<GLint> vResolvedLocations;
+
+	// The busy intervals of the main and render threads which are not counted yet, guarded by mStatsMutex
+	std::vector<Interval> vSimIntervals;
+	std::vector<Interval> vRenderIntervals;
+	std::mutex mStatsMutex;
+	// The start of the current frame on the main thread
+	double dSimStart;
+	// The time when the counting started, and the time up to which the intervals were counted
+	double dStatsStart;
+	double dStatsEnd;
+	// The busy time of each thread, and the time which both were busy
+	double dSimBusy;
+	double dRenderBusy;
+	double dOverlap;
+	// The time the main thread waited for the render thread
+	double dSimWait;
+	// The number of frames submitted
+	unsigned int uiNumFrames;
+	// The number of bytes copied into the render packets
+	size_t uiNumBytesRecorded;
+
+	// The clock of the intervals
+	std::chrono::steady_clock::time_point cClockStart;
+
+	// Constructor
+	CRenderThread(void);
+	// Destructor
+	virtual ~CRenderThread(void);
+
+	// The loop of the render thread
+	void RenderLoop(void);
+	// Replay a render packet on CGLRenderDevice
+	void Replay(CRenderCommandList& cList);
+
+	// Get the OpenGL object of a handle
+	GLuint GetGLObject(const GLuint uiHandle) const;
+	// Get the OpenGL location of a uniform location which was given out while recording
+	GLint GetLocation(const GLint iLocation);
+
+	// Get the current time in seconds
+	double GetTime(void) const;
+	// Add a busy interval of a thread
+	void AddInterval(std::vector<Interval>& vIntervals, const double dStart, const double dEnd);
+	// Count the busy time and overlap of the intervals up to the last time which both threads have reached
+	void CountIntervals(void);
+
+	// Stop the render thread and make the OpenGL context current on the calling thread again
+	void Stop(void);
+
+	virtual GLuint DoCreateBuffer(void);
+	virtual void DoDeleteBuffer(const GLuint uiBuffer);
+	virtual GLuint DoCreateVertexArray(void);
+	virtual void DoDeleteVertexArray(const GLuint uiVertexArray);
+	virtual void DoBindVertexArray(const GLuint uiVertexArray);
+	virtual void DoBindBuffer(const GLenum eTarget, const GLuint uiBuffer);
+	virtual void DoUploadBuffer(const GLenum eTarget, const GLuint uiBuffer, const size_t uiSize, const void* pData, const GLenum eUsage);
+	virtual void DoUpdateBuffer(const GLenum eTarget, const GLuint uiBuffer, const size_t uiOffset, const size_t uiSize, const void* pData);
+	virtual void DoEnableVertexAttrib(const GLuint uiIndex, const bool bEnable);
+	virtual void DoVertexAttribPointer(const GLuint uiIndex, const GLint iSize, const GLsizei iStride, const size_t uiOffset);
+	virtual void DoDrawElements(const GLenum eMode, const GLsizei iCount, const size_t uiOffset);
+	virtual void DoDrawArrays(const GLenum eMode, const GLint iFirst, const GLsizei iCount);
+	virtual void DoClear(const float fRed, const float fGreen, const float fBlue, const float fAlpha);
+	virtual void DoSetViewport(const int iX, const int iY, const int iWidth, const int iHeight);
+	virtual void DoUseProgram(const GLuint uiProgram);
+	virtual void DoSetBlend(const bool bEnable);
+	virtual void DoActiveTexture(const GLenum eUnit);
+	virtual void DoBindTexture(const GLuint uiTexture);
+	virtual GLuint DoCreateTexture(const int iWidth, const int iHeight, const int iChannels, const void* pData,
+								   const bool bGenerateMipmap, const bool bClampToEdge);
+	virtual void DoUpdateTexture(const GLuint uiTexture, const int iX, const int iY, const int iWidth, const int iHeight,
+								 const int iChannels, const void* pData);
+	virtual void DoUploadTextureLevel(const GLuint uiTexture, const int iLevel, const int iWidth, const int iHeight,
+									  const int iChannels, const void* pData);
+	virtual void DoDeleteTexture(const GLuint uiTexture);
+	virtual GLint DoGetUniformLocation(const GLuint uiProgram, const char* pName);
+	virtual void DoSetUniformMatrix4(const GLint iLocation, const float* pValue);
+	virtual void DoSetUniform4(const GLint iLocation, const float* pValue);
+	virtual void DoSetUniform3(const GLint iLocation, const float fX, const float fY, const float fZ);
+	virtual void DoSetUniform1i(const GLint iLocation, const int iValue);
+	virtual void DoSetUniformMatrix3(const GLint iLocation, const float* pValue);
+	virtual void DoSetUniformMatrix2(const GLint iLocation, const float* pValue);
+	virtual void DoSetUniform2(const GLint iLocation, const float fX, const float fY);
+	virtual void DoSetUniform1f(const GLint iLocation, const float fValue);
+	virtual bool DoInitGUI(const char* pGLSLVersion);
+	virtual void DoNewGUIFrame(void);
+	virtual void DoRenderGUI(ImDrawData* pDrawData);
+	virtual void DoShutdownGUI(void);
+};
@@ -11,6 +11,9 @@
 #include <includes/gtc/matrix_transform.hpp>
 #include <includes/gtc/type_ptr.hpp>
 
+// Include CRenderDevice
+#include "RenderDevice.h"
+
 #include <string>
 #include <fstream>
 #include <sstream>
@@ -20,9 +23,16 @@ class CShader
 {
 public:
     unsigned int ID;
+    // constructor wraps a program which was linked elsewhere, e.g. loaded from a program binary
+    // ------------------------------------------------------------------------
+    explicit CShader(unsigned int programID)
+        : ID(programID)
+    {
+    }
     // constructor generates the shader on the fly
+    // set retrievableBinary to read the linked program back with glGetProgramBinary
     // ------------------------------------------------------------------------
-    CShader(const char* vertexPath, const char* fragmentPath, const char* geometryPath = nullptr)
+    CShader(const char* vertexPath, const char* fragmentPath, const char* geometryPath = nullptr, bool retrievableBinary = false)
     {
         // 1. retrieve the vertex/fragment source code from filePath
         std::string vertexCode;
@@ -94,6 +104,8 @@ public:
         glAttachShader(ID, fragment);
         if(geometryPath != nullptr)
             glAttachShader(ID, geometry);
+        if(retrievableBinary)
+            glProgramParameteri(ID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
         glLinkProgram(ID);
         checkCompileErrors(ID, "PROGRAM");
         // delete the shaders as they're linked into our program now and no longer necessery
@@ -107,68 +119,75 @@ public:
     // ------------------------------------------------------------------------
     void use() 
     { 
-        glUseProgram(ID); 
+        CRenderDevice::GetActive()->UseProgram(ID); 
     }
-    // utility uniform functions
+    // utility uniform functions, which go through the active CRenderDevice
     // ------------------------------------------------------------------------
     void setBool(const std::string &name, bool value) const
     {         
-        glUniform1i(glGetUniformLocation(ID, name.c_str()), (int)value); 
+        CRenderDevice::GetActive()->SetUniform1i(getLocation(name), (int)value); 
     }
     // ------------------------------------------------------------------------
     void setInt(const std::string &name, int value) const
     { 
-        glUniform1i(glGetUniformLocation(ID, name.c_str()), value); 
+        CRenderDevice::GetActive()->SetUniform1i(getLocation(name), value); 
     }
     // ------------------------------------------------------------------------
     void setFloat(const std::string &name, float value) const
     { 
-        glUniform1f(glGetUniformLocation(ID, name.c_str()), value); 
+        CRenderDevice::GetActive()->SetUniform1f(getLocation(name), value); 
     }
     // ------------------------------------------------------------------------
     void setVec2(const std::string &name, const glm::vec2 &value) const
     { 
-        glUniform2fv(glGetUniformLocation(ID, name.c_str()), 1, &value[0]); 
+        CRenderDevice::GetActive()->SetUniform2(getLocation(name), value.x, value.y); 
     }
     void setVec2(const std::string &name, float x, float y) const
     { 
-        glUniform2f(glGetUniformLocation(ID, name.c_str()), x, y); 
+        CRenderDevice::GetActive()->SetUniform2(getLocation(name), x, y); 
     }
     // ------------------------------------------------------------------------
     void setVec3(const std::string &name, const glm::vec3 &value) const
     { 
-        glUniform3fv(glGetUniformLocation(ID, name.c_str()), 1, &value[0]); 
+        CRenderDevice::GetActive()->SetUniform3(getLocation(name), value.x, value.y, value.z); 
     }
     void setVec3(const std::string &name, float x, float y, float z) const
     { 
-        glUniform3f(glGetUniformLocation(ID, name.c_str()), x, y, z); 
+        CRenderDevice::GetActive()->SetUniform3(getLocation(name), x, y, z); 
     }
     // ------------------------------------------------------------------------
     void setVec4(const std::string &name, const glm::vec4 &value) const
     { 
-        glUniform4fv(glGetUniformLocation(ID, name.c_str()), 1, &value[0]); 
+        CRenderDevice::GetActive()->SetUniform4(getLocation(name), &value[0]); 
     }
     void setVec4(const std::string &name, float x, float y, float z, float w) 
     { 
-        glUniform4f(glGetUniformLocation(ID, name.c_str()), x, y, z, w); 
+        const glm::vec4 value(x, y, z, w);
+        CRenderDevice::GetActive()->SetUniform4(getLocation(name), &value[0]); 
     }
     // ------------------------------------------------------------------------
     void setMat2(const std::string &name, const glm::mat2 &mat) const
     {
-        glUniformMatrix2fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, &mat[0][0]);
+        CRenderDevice::GetActive()->SetUniformMatrix2(getLocation(name), &mat[0][0]);
     }
     // ------------------------------------------------------------------------
     void setMat3(const std::string &name, const glm::mat3 &mat) const
     {
-        glUniformMatrix3fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, &mat[0][0]);
+        CRenderDevice::GetActive()->SetUniformMatrix3(getLocation(name), &mat[0][0]);
     }
     // ------------------------------------------------------------------------
     void setMat4(const std::string &name, const glm::mat4 &mat) const
     {
-        glUniformMatrix4fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, &mat[0][0]);
+        CRenderDevice::GetActive()->SetUniformMatrix4(getLocation(name), &mat[0][0]);
     }
 
 private:
+    // utility function for getting the location of a uniform from the active CRenderDevice
+    // ------------------------------------------------------------------------
+    GLint getLocation(const std::string &name) const
+    {
+        return CRenderDevice::GetActive()->GetUniformLocation(ID, name.c_str());
+    }
     // utility function for checking shader compilation/linking errors.
     // ------------------------------------------------------------------------
     void checkCompileErrors(GLuint shader, std::string type)
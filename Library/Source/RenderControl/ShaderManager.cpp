@@ -1,11 +1,32 @@
 #include "ShaderManager.h"
+
+// Include Render Device
+#include "RenderDevice.h"
+// Include CSettings
+#include "../GameControl/Settings.h"
+// Include CStopWatch to time the compiling of shaders
+#include "../TimeControl/StopWatch.h"
 #include <stdexcept>      // std::invalid_argument
+#include <cstring>
+#include <vector>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+using namespace std;
+
+// The first 4 bytes of a program binary cache file
+#define PROGRAM_BINARY_MAGIC "NPBC"
+// Incremented whenever the layout of a program binary cache file changes
+const unsigned int PROGRAM_BINARY_VERSION = 1;
 
 /**
 @brief Constructor
 */
 CShaderManager::CShaderManager(void) 
 	: activeShader(nullptr)
+	, dLoadTime(0.0)
+	, uiNumCacheHits(0)
+	, uiNumCompiles(0)
 {
 }
 
@@ -107,10 +128,48 @@ void CShaderManager::Add(	const std::string& _name,
 		return;
 	}
 
-	CShader* cNewShader = new CShader(vertexPath, fragmentPath);
+	CStopWatch cStopWatch;
+	cStopWatch.StartTimer();
+
+	// The cache is keyed by the sources, so they are read even when the cache is used
+	std::string vertexCode, fragmentCode, geometryCode;
+	const bool bSourcesRead = (ReadSource(vertexPath, vertexCode)) &&
+							  (ReadSource(fragmentPath, fragmentCode)) &&
+							  ((geometryPath == nullptr) || (ReadSource(geometryPath, geometryCode)));
+	const bool bUseCache = (bSourcesRead) &&
+						   (CSettings::GetInstance()->bUseProgramBinaryCache) &&
+						   (IsProgramBinarySupported());
+	const std::string separator(1, '\0');
+	const unsigned long long sourceHash = Hash(vertexCode + separator + fragmentCode + separator + geometryCode);
+	const std::string cacheFilename = GetCacheFilename(vertexPath, _name);
+
+	CShader* cNewShader = nullptr;
+	if (bUseCache)
+	{
+		GLuint programID = LoadProgramBinary(cacheFilename, sourceHash);
+		if (programID != 0)
+		{
+			cNewShader = new CShader(programID);
+			uiNumCacheHits++;
+		}
+	}
+
+	const bool bCompiled = (cNewShader == nullptr);
+	if (bCompiled)
+	{
+		cNewShader = new CShader(vertexPath, fragmentPath, geometryPath, bUseCache);
+		uiNumCompiles++;
+		if (bUseCache)
+			SaveProgramBinary(cacheFilename, sourceHash, cNewShader->ID);
+	}
 
 	// Nothing wrong, add the scene to our map
 	shaderMap[_name] = cNewShader;
+
+	const double dTime = cStopWatch.GetElapsedTime() * 1000.0;
+	dLoadTime += dTime;
+	cout << "CShaderManager: " << _name << (bCompiled ? " compiled from source" : " loaded from the program binary cache")
+		 << " in " << dTime << " ms" << endl;
 }
 
 /**
@@ -146,7 +205,7 @@ void CShaderManager::Use(const std::string& _name)
 
 	// if Shader exist, set the activeShader pointer to that Shader
 	activeShader = shaderMap[_name];
-	activeShader->use();
+	CRenderDevice::GetActive()->UseProgram(activeShader->ID);
 }
 
 /**
@@ -155,4 +214,187 @@ void CShaderManager::Use(const std::string& _name)
 bool CShaderManager::Check(const std::string& _name)
 {
 	return shaderMap.count(_name) != 0;
+}
+
+/**
+@brief Get the time spent by Add in milliseconds. Compare a cold start, without the cache files, with a warm start.
+*/
+double CShaderManager::GetLoadTime(void) const
+{
+	return dLoadTime;
+}
+
+/**
+@brief Get the number of shaders which were loaded from the program binary cache
+*/
+unsigned int CShaderManager::GetNumCacheHits(void) const
+{
+	return uiNumCacheHits;
+}
+
+/**
+@brief Print out details about this class instance in the console window
+*/
+void CShaderManager::PrintSelf(void) const
+{
+	cout << "CShaderManager::PrintSelf()" << endl;
+	cout << "Shaders: " << shaderMap.size() << " (" << uiNumCacheHits << " from the program binary cache, "
+		 << uiNumCompiles << " compiled from source)" << endl;
+	cout << "Load time: " << dLoadTime << " ms" << endl;
+}
+
+/**
+@brief Read a shader source file
+@param filePath The file name of the source
+@param source The content of the file
+@return false if the file could not be read
+*/
+bool CShaderManager::ReadSource(const char* filePath, std::string& source)
+{
+	std::ifstream file(filePath, std::ios::binary);
+	if (!file.is_open())
+		return false;
+	std::stringstream stream;
+	stream << file.rdbuf();
+	source = stream.str();
+	return true;
+}
+
+/**
+@brief Hash a string with 64-bit FNV-1a
+@param data The string to hash
+@param hash The hash to continue from
+*/
+unsigned long long CShaderManager::Hash(const std::string& data, unsigned long long hash)
+{
+	for (size_t i = 0; i < data.size(); i++)
+	{
+		hash ^= (unsigned char)data[i];
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+/**
+@brief Get the hash of the driver, as a program binary only works with the driver which created it
+*/
+unsigned long long CShaderManager::GetDriverHash(void)
+{
+	const GLenum eNames[] = { GL_VENDOR, GL_RENDERER, GL_VERSION };
+	unsigned long long hash = Hash("");
+	for (int i = 0; i < 3; i++)
+	{
+		const GLubyte* pString = glGetString(eNames[i]);
+		if (pString)
+			hash = Hash((const char*)pString, hash);
+		hash = Hash("|", hash);
+	}
+	return hash;
+}
+
+/**
+@brief Check if the driver can save and load program binaries. It needs OpenGL 4.1 or ARB_get_program_binary.
+*/
+bool CShaderManager::IsProgramBinarySupported(void)
+{
+	if ((!GLEW_VERSION_4_1) && (!GLEW_ARB_get_program_binary))
+		return false;
+	GLint iNumFormats = 0;
+	glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &iNumFormats);
+	return iNumFormats > 0;
+}
+
+/**
+@brief Get the file name of the program binary cache of a shader, which is next to its vertex shader
+*/
+std::string CShaderManager::GetCacheFilename(const char* vertexPath, const std::string& _name)
+{
+	const std::string path = vertexPath;
+	const size_t slash = path.find_last_of("/\\");
+	const std::string directory = (slash == std::string::npos) ? "" : path.substr(0, slash + 1);
+	return directory + _name + ".programbinary";
+}
+
+/**
+@brief Load a program from the program binary cache
+@param cacheFilename The file name of the cache
+@param sourceHash The hash of the current shader sources
+@return The program ID, or 0 if the cache is missing, stale or rejected by the driver
+*/
+GLuint CShaderManager::LoadProgramBinary(const std::string& cacheFilename, const unsigned long long sourceHash)
+{
+	std::ifstream file(cacheFilename.c_str(), std::ios::binary);
+	if (!file.is_open())
+		return 0;
+
+	ProgramBinaryHeader sHeader;
+	if ((!file.read((char*)&sHeader, sizeof(sHeader))) ||
+		(memcmp(sHeader.acMagic, PROGRAM_BINARY_MAGIC, 4) != 0) ||
+		(sHeader.uiVersion != PROGRAM_BINARY_VERSION) ||
+		(sHeader.ullSourceHash != sourceHash) ||
+		(sHeader.ullDriverHash != GetDriverHash()) ||
+		(sHeader.uiLength == 0))
+		return 0;
+
+	std::vector<char> vBinary(sHeader.uiLength);
+	if (!file.read(&vBinary[0], sHeader.uiLength))
+		return 0;
+
+	GLuint programID = glCreateProgram();
+	glProgramBinary(programID, sHeader.uiFormat, &vBinary[0], sHeader.uiLength);
+
+	// The driver may still reject the binary, e.g. after an update which kept its version string
+	GLint success = 0;
+	glGetProgramiv(programID, GL_LINK_STATUS, &success);
+	if (!success)
+	{
+		glDeleteProgram(programID);
+		return 0;
+	}
+	return programID;
+}
+
+/**
+@brief Save a linked program into the program binary cache
+@param cacheFilename The file name of the cache
+@param sourceHash The hash of the shader sources
+@param programID The linked program
+@return false if the program could not be saved
+*/
+bool CShaderManager::SaveProgramBinary(const std::string& cacheFilename, const unsigned long long sourceHash, const GLuint programID)
+{
+	GLint success = 0;
+	glGetProgramiv(programID, GL_LINK_STATUS, &success);
+	if (!success)
+		return false;
+
+	GLint iLength = 0;
+	glGetProgramiv(programID, GL_PROGRAM_BINARY_LENGTH, &iLength);
+	if (iLength <= 0)
+		return false;
+
+	std::vector<char> vBinary(iLength);
+	GLsizei iWritten = 0;
+	GLenum eFormat = 0;
+	glGetProgramBinary(programID, iLength, &iWritten, &eFormat, &vBinary[0]);
+	if (iWritten <= 0)
+		return false;
+
+	ProgramBinaryHeader sHeader;
+	memcpy(sHeader.acMagic, PROGRAM_BINARY_MAGIC, 4);
+	sHeader.uiVersion = PROGRAM_BINARY_VERSION;
+	sHeader.ullSourceHash = sourceHash;
+	sHeader.ullDriverHash = GetDriverHash();
+	sHeader.uiFormat = eFormat;
+	sHeader.uiLength = iWritten;
+
+	std::ofstream file(cacheFilename.c_str(), std::ios::binary | std::ios::trunc);
+	if (!file.is_open())
+	{
+		cout << "CShaderManager: Unable to write " << cacheFilename << endl;
+		return false;
+	}
+	file.write((const char*)&sHeader, sizeof(sHeader));
+	file.write(&vBinary[0], iWritten);
+	return file.good();
 }
\ No newline at end of file
@@ -26,15 +26,54 @@ public:
 	void Exit(void);
 
 	// User Interface
+	// Add a shader, loading it from the program binary cache if its sources and the driver have not changed
 	void Add(const std::string& _name, const char* vertexPath, const char* fragmentPath, const char* geometryPath = nullptr);
 	void Remove(const std::string& _name);
 	void Use(const std::string& _name);
 	bool Check(const std::string& _name);
 
+	// Get the time spent by Add in milliseconds
+	double GetLoadTime(void) const;
+	// Get the number of shaders which were loaded from the program binary cache
+	unsigned int GetNumCacheHits(void) const;
+
+	// Print out details about this class instance in the console window
+	void PrintSelf(void) const;
+
 	// The current active shader
 	CShader* activeShader;
 
 protected:
+	// The header of a program binary cache file
+	struct ProgramBinaryHeader
+	{
+		char acMagic[4];
+		unsigned int uiVersion;
+		// The hash of the shader sources
+		unsigned long long ullSourceHash;
+		// The hash of the GL_VENDOR, GL_RENDERER and GL_VERSION strings
+		unsigned long long ullDriverHash;
+		// The format and the length of the program binary which follows this header
+		unsigned int uiFormat;
+		unsigned int uiLength;
+	};
+
+	// Read a shader source file. Returns false if it could not be read.
+	static bool ReadSource(const char* filePath, std::string& source);
+	// Hash a string with 64-bit FNV-1a, continuing from a previous hash
+	static unsigned long long Hash(const std::string& data, unsigned long long hash = 14695981039346656037ULL);
+	// Get the hash of the driver, as a program binary only works with the driver which created it
+	static unsigned long long GetDriverHash(void);
+	// Check if the driver can save and load program binaries
+	static bool IsProgramBinarySupported(void);
+	// Get the file name of the program binary cache of a shader
+	static std::string GetCacheFilename(const char* vertexPath, const std::string& _name);
+
+	// Load a program from the program binary cache. Returns 0 if the cache is missing or stale.
+	GLuint LoadProgramBinary(const std::string& cacheFilename, const unsigned long long sourceHash);
+	// Save a linked program into the program binary cache
+	bool SaveProgramBinary(const std::string& cacheFilename, const unsigned long long sourceHash, const GLuint programID);
+
 	// Constructor
 	CShaderManager(void);
 
@@ -43,4 +82,10 @@ protected:
 
 	// The map containing all the shaders loaded
 	std::map<std::string, CShader*> shaderMap;
+
+	// The time spent by Add in milliseconds
+	double dLoadTime;
+	// The number of shaders which were loaded from the program binary cache, and compiled from source
+	unsigned int uiNumCacheHits;
+	unsigned int uiNumCompiles;
 };
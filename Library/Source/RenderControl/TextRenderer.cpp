@@ -7,20 +7,83 @@
 
  // Include Shader Manager
 #include "..\RenderControl\ShaderManager.h"
+// Include Render Device
+#include "..\RenderControl\RenderDevice.h"
 
+#include <algorithm>
 #include <iostream>
 using namespace std;
 
 #include "../System/filesystem.h"
 
+// Include CStopWatch to time Init
+#include "../TimeControl/StopWatch.h"
+// Include CProfiler
+#include "../TimeControl/Profiler.h"
+
 // FreeType
 #include <ft2build.h>
 #include FT_FREETYPE_H
 
+/**
+ @brief Decode the next code point of a UTF-8 string
+ @param text The UTF-8 string
+ @param i The index of the first byte of the code point, which is moved to the next code point
+ */
+static unsigned int DecodeUTF8(const std::string& text, size_t& i)
+{
+	const unsigned char ucByte = (unsigned char)text[i++];
+	if (ucByte < 0x80)
+		return ucByte;
+
+	int iNumExtraBytes = 0;
+	unsigned int uiCodePoint = 0;
+	if ((ucByte & 0xE0) == 0xC0)
+	{
+		iNumExtraBytes = 1;
+		uiCodePoint = ucByte & 0x1F;
+	}
+	else if ((ucByte & 0xF0) == 0xE0)
+	{
+		iNumExtraBytes = 2;
+		uiCodePoint = ucByte & 0x0F;
+	}
+	else if ((ucByte & 0xF8) == 0xF0)
+	{
+		iNumExtraBytes = 3;
+		uiCodePoint = ucByte & 0x07;
+	}
+	else
+		return 0xFFFD;	// The replacement character
+
+	for (; iNumExtraBytes > 0; iNumExtraBytes--)
+	{
+		if ((i >= text.size()) || (((unsigned char)text[i] & 0xC0) != 0x80))
+			return 0xFFFD;
+		uiCodePoint = (uiCodePoint << 6) | ((unsigned char)text[i++] & 0x3F);
+	}
+	return uiCodePoint;
+}
+
 /**
  @brief Constructor This constructor has protected access modifier as this class will be a Singleton
  */
 CTextRenderer::CTextRenderer(void)
+	: pFTLibrary(NULL)
+	, pFTFace(NULL)
+	, uiFacePixelSize(0)
+	, sFontName("Fonts//cour.ttf")
+	, uiAtlasBudget(512 * 512)
+	, iAtlasSize(0)
+	, iNextShelfY(0)
+	, uiAtlasGeneration(0)
+	, uiNumEvictions(0)
+	, uiFrame(1)
+	, dInitTime(0.0)
+	, uiNumCacheLookups(0)
+	, uiNumCacheHits(0)
+	, bBatchDirty(true)
+	, uiBatchCapacity(0)
 {
 }
 
@@ -29,18 +92,29 @@ CTextRenderer::CTextRenderer(void)
  */
 CTextRenderer::~CTextRenderer(void)
 {
+	// Destroy FreeType
+	if (pFTFace)
+		FT_Done_Face(pFTFace);
+	if (pFTLibrary)
+		FT_Done_FreeType(pFTLibrary);
+
 	// optional: de-allocate all resources once they've outlived their purpose:
 	// ------------------------------------------------------------------------
-	glDeleteVertexArrays(1, &VAO);
-	glDeleteBuffers(1, &VBO);
-	glDeleteBuffers(1, &EBO);
+	CRenderDevice::GetActive()->DeleteVertexArray(VAO);
+	CRenderDevice::GetActive()->DeleteBuffer(VBO);
+	CRenderDevice::GetActive()->DeleteTexture(iTextureID);
+	// The atlas is not a shared texture, so CEntity2D must not release it
+	iTextureID = 0;
 }
 
 /**
-@brief Init Initialise this instance
+@brief Init Initialise this instance. The glyphs are rasterised when they are first rendered.
 */ 
 bool CTextRenderer::Init(void)
 {
+	CStopWatch cStopWatch;
+	cStopWatch.StartTimer();
+
 	// Get the handler to the CSettings instance
 	cSettings = CSettings::GetInstance();
 
@@ -51,76 +125,50 @@ bool CTextRenderer::Init(void)
 	CShaderManager::GetInstance()->activeShader->setInt("text", 0);
 
 	// FreeType
-	FT_Library ft;
 	// All functions return a value different than 0 whenever an error occurred
-	if (FT_Init_FreeType(&ft))
+	if (FT_Init_FreeType(&pFTLibrary))
+	{
 		std::cout << "ERROR::FREETYPE: Could not init FreeType Library" << std::endl;
+		pFTLibrary = NULL;
+		return false;
+	}
 
 	// Load font as face
-	FT_Face face;
-	if (FT_New_Face(ft, "Fonts//cour.ttf", 0, &face))
+	if (FT_New_Face(pFTLibrary, sFontName.c_str(), 0, &pFTFace))
+	{
 		std::cout << "ERROR::FREETYPE: Failed to load font" << std::endl;
+		pFTFace = NULL;
+		return false;
+	}
 
-	// Set size to load glyphs as
-	FT_Set_Pixel_Sizes(face, 0, 40);
+	// Use the largest power of two atlas which fits in the memory budget, with 1 byte per pixel
+	iAtlasSize = 64;
+	while ((unsigned int)(iAtlasSize * 2) * (unsigned int)(iAtlasSize * 2) <= uiAtlasBudget)
+		iAtlasSize *= 2;
 
-	// Disable byte-alignment restriction
-	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	// Generate an empty single channel texture for the atlas, clamped to its edges and without mipmaps
+	CRenderDevice* cRenderDevice = CRenderDevice::GetActive();
+	std::vector<unsigned char> vAtlas(iAtlasSize * iAtlasSize, 0);
+	iTextureID = cRenderDevice->CreateTexture(iAtlasSize, iAtlasSize, 1, &vAtlas[0], false, true);
+	cRenderDevice->BindTexture(0);
 
-	// Load first 128 characters of ASCII set
-	for (GLubyte c = 0; c < 128; c++)
-	{
-		// Load character glyph 
-		if (FT_Load_Char(face, c, FT_LOAD_RENDER))
-		{
-			std::cout << "ERROR::FREETYTPE: Failed to load Glyph" << std::endl;
-			continue;
-		}
-		// Generate texture
-		GLuint texture;
-		glGenTextures(1, &texture);
-		glBindTexture(GL_TEXTURE_2D, texture);
-		glTexImage2D(
-			GL_TEXTURE_2D,
-			0,
-			GL_RED,
-			face->glyph->bitmap.width,
-			face->glyph->bitmap.rows,
-			0,
-			GL_RED,
-			GL_UNSIGNED_BYTE,
-			face->glyph->bitmap.buffer
-			);
-		// Set texture options
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-		// Now store character for later use
-		Character character = {
-			texture,
-			glm::ivec2(face->glyph->bitmap.width, face->glyph->bitmap.rows),
-			glm::ivec2(face->glyph->bitmap_left, face->glyph->bitmap_top),
-			(GLuint)face->glyph->advance.x
-		};
-		Characters.insert(std::pair<GLchar, Character>(c, character));
-	}
-	glBindTexture(GL_TEXTURE_2D, 0);
-	// Destroy FreeType once we're finished
-	FT_Done_Face(face);
-	FT_Done_FreeType(ft);
-
-
-	// Configure VAO/VBO for texture quads
-	glGenVertexArrays(1, &VAO);
-	glGenBuffers(1, &VBO);
-	glBindVertexArray(VAO);
-	glBindBuffer(GL_ARRAY_BUFFER, VBO);
-	glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * 6 * 4, NULL, GL_DYNAMIC_DRAW);
-	glEnableVertexAttribArray(0);
-	glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 4 * sizeof(GLfloat), 0);
-	glBindBuffer(GL_ARRAY_BUFFER, 0);
-	glBindVertexArray(0);
+	// Configure VAO/VBO for the text batch: vec4 (pos, tex) at location 0 and vec3 colour at location 1
+	uiBatchCapacity = 6 * 256;
+	vBatchVertices.reserve(uiBatchCapacity);
+	VAO = cRenderDevice->CreateVertexArray();
+	VBO = cRenderDevice->CreateBuffer();
+	cRenderDevice->BindVertexArray(VAO);
+	cRenderDevice->UploadBuffer(GL_ARRAY_BUFFER, VBO, sizeof(GlyphVertex) * uiBatchCapacity, NULL, GL_DYNAMIC_DRAW);
+	cRenderDevice->EnableVertexAttrib(0);
+	cRenderDevice->VertexAttribPointer(0, 4, sizeof(GlyphVertex), 0);
+	cRenderDevice->EnableVertexAttrib(1);
+	cRenderDevice->VertexAttribPointer(1, 3, sizeof(GlyphVertex), 4 * sizeof(GLfloat));
+	cRenderDevice->BindBuffer(GL_ARRAY_BUFFER, 0);
+	cRenderDevice->BindVertexArray(0);
+
+	dInitTime = cStopWatch.GetElapsedTime() * 1000.0;
+	cout << "CTextRenderer::Init took " << dInitTime << " ms, glyph atlas uses "
+		<< GetAtlasMemory() / 1024 << " KB" << endl;
 
 	return true;
 }
@@ -138,69 +186,414 @@ void CTextRenderer::Update(void)
 void CTextRenderer::PreRender(void)
 {
 	// bind textures on corresponding texture units
-	glActiveTexture(GL_TEXTURE0);
+	CRenderDevice::GetActive()->ActiveTexture(GL_TEXTURE0);
 
 	// Activate blending mode
-	glEnable(GL_BLEND);
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	CRenderDevice::GetActive()->SetBlend(true);
 
 	// Activate the shader
 	CShaderManager::GetInstance()->Use(sShaderName);
 }
 
 /**
- @brief Render Render this instance
+ @brief Compare 2 layout keys for the layout cache
+ */
+bool CTextRenderer::TextLayoutKey::operator<(const TextLayoutKey& rhs) const
+{
+	if (fScale != rhs.fScale)
+		return fScale < rhs.fScale;
+	if (uiPixelSize != rhs.uiPixelSize)
+		return uiPixelSize < rhs.uiPixelSize;
+	if (sFontName != rhs.sFontName)
+		return sFontName < rhs.sFontName;
+	return sText < rhs.sText;
+}
+
+/**
+ @brief Compare 2 batched strings to check if the VBO can be reused
+ */
+bool CTextRenderer::BatchString::operator==(const BatchString& rhs) const
+{
+	return (pLayout == rhs.pLayout) && (x == rhs.x) && (y == rhs.y) && (colour == rhs.colour);
+}
+
+/**
+ @brief AllocateCell Find a free cell in the atlas, evicting the least recently used glyph if needed.
+		Glyphs which were used in the current frame are not evicted.
+ @param iWidth The width of the glyph bitmap
+ @param iHeight The height of the glyph bitmap
+ @param iShelf The index of the shelf with the free cell
+ @param iCell The index of the free cell in the shelf
+ @return true if a cell was found
+ */
+bool CTextRenderer::AllocateCell(const int iWidth, const int iHeight, int& iShelf, int& iCell)
+{
+	// Leave 1 pixel between glyphs for filtering, and round the cells up so that they can be reused
+	const int iCellWidth = ((iWidth + 1 + CELL_ALIGNMENT - 1) / CELL_ALIGNMENT) * CELL_ALIGNMENT;
+	const int iCellHeight = ((iHeight + 1 + CELL_ALIGNMENT - 1) / CELL_ALIGNMENT) * CELL_ALIGNMENT;
+	if ((iCellWidth > iAtlasSize) || (iCellHeight > iAtlasSize))
+		return false;
+
+	// Look for a free cell in a shelf of this cell size
+	for (unsigned int i = 0; i < vShelves.size(); i++)
+	{
+		if ((vShelves[i].iCellWidth != iCellWidth) || (vShelves[i].iCellHeight != iCellHeight))
+			continue;
+		for (unsigned int j = 0; j < vShelves[i].vCells.size(); j++)
+		{
+			if (vShelves[i].vCells[j] == 0)
+			{
+				iShelf = i;
+				iCell = j;
+				return true;
+			}
+		}
+	}
+
+	// Add a new shelf below the last one
+	if (iNextShelfY + iCellHeight <= iAtlasSize)
+	{
+		Shelf sShelf;
+		sShelf.iY = iNextShelfY;
+		sShelf.iCellWidth = iCellWidth;
+		sShelf.iCellHeight = iCellHeight;
+		sShelf.vCells.assign(iAtlasSize / iCellWidth, 0);
+		vShelves.push_back(sShelf);
+		iNextShelfY += iCellHeight;
+
+		iShelf = (int)vShelves.size() - 1;
+		iCell = 0;
+		return true;
+	}
+
+	// The atlas is full, so evict the least recently used glyph of this cell size
+	unsigned int uiOldestFrame = uiFrame;
+	iShelf = -1;
+	for (unsigned int i = 0; i < vShelves.size(); i++)
+	{
+		if ((vShelves[i].iCellWidth != iCellWidth) || (vShelves[i].iCellHeight != iCellHeight))
+			continue;
+		for (unsigned int j = 0; j < vShelves[i].vCells.size(); j++)
+		{
+			const Glyph& sGlyph = mGlyphs[vShelves[i].vCells[j]];
+			if (sGlyph.uiLastUsedFrame < uiOldestFrame)
+			{
+				uiOldestFrame = sGlyph.uiLastUsedFrame;
+				iShelf = i;
+				iCell = j;
+			}
+		}
+	}
+	if (iShelf < 0)
+		return false;
+
+	mGlyphs.erase(vShelves[iShelf].vCells[iCell]);
+	vShelves[iShelf].vCells[iCell] = 0;
+	// The UVs in the cached layouts may now point to another glyph
+	uiAtlasGeneration++;
+	uiNumEvictions++;
+	return true;
+}
+
+/**
+ @brief GetGlyph Get a glyph, rasterising it into the atlas on first use
+ @param uiCodePoint The Unicode code point of the glyph
+ @param uiPixelSize The pixel size of the glyph
+ @return The glyph, or NULL if it could not be loaded or the atlas is full
  */
-void CTextRenderer::Render(std::string text, GLfloat x, GLfloat y, GLfloat scale, glm::vec3 colour)
+CTextRenderer::Glyph* CTextRenderer::GetGlyph(const unsigned int uiCodePoint, const unsigned int uiPixelSize)
 {
-	// Activate corresponding render state	
-	glUniform3f(glGetUniformLocation(CShaderManager::GetInstance()->activeShader->ID, "textColour"), 
-				colour.x, colour.y, colour.z);
-	glActiveTexture(GL_TEXTURE0);
-	glBindVertexArray(VAO);
+	const unsigned long long ullKey = ((unsigned long long)uiPixelSize << 32) | uiCodePoint;
+	std::map<unsigned long long, Glyph>::iterator it = mGlyphs.find(ullKey);
+	if (it != mGlyphs.end())
+	{
+		it->second.uiLastUsedFrame = uiFrame;
+		return &it->second;
+	}
+
+	if (pFTFace == NULL)
+		return NULL;
+
+	// Set size to load glyphs as
+	if (uiFacePixelSize != uiPixelSize)
+	{
+		FT_Set_Pixel_Sizes(pFTFace, 0, uiPixelSize);
+		uiFacePixelSize = uiPixelSize;
+	}
+
+	// Load character glyph 
+	if (FT_Load_Char(pFTFace, uiCodePoint, FT_LOAD_RENDER))
+	{
+		std::cout << "ERROR::FREETYTPE: Failed to load Glyph " << uiCodePoint << std::endl;
+		return NULL;
+	}
+	const FT_GlyphSlot pSlot = pFTFace->glyph;
+
+	Glyph sGlyph;
+	sGlyph.Size = glm::ivec2(pSlot->bitmap.width, pSlot->bitmap.rows);
+	sGlyph.Bearing = glm::ivec2(pSlot->bitmap_left, pSlot->bitmap_top);
+	sGlyph.Advance = (GLuint)pSlot->advance.x;
+	sGlyph.UVMin = glm::vec2(0.0f);
+	sGlyph.UVMax = glm::vec2(0.0f);
+	sGlyph.iShelf = -1;
+	sGlyph.iCell = -1;
+	sGlyph.uiLastUsedFrame = uiFrame;
 
-	// Iterate through all characters
-	std::string::const_iterator c;
-	for (c = text.begin(); c != text.end(); c++)
+	// Whitespaces have no bitmap, so they do not need a cell
+	if ((sGlyph.Size.x > 0) && (sGlyph.Size.y > 0) && (pSlot->bitmap.buffer))
 	{
-		Character ch = Characters[*c];
+		if (AllocateCell(sGlyph.Size.x, sGlyph.Size.y, sGlyph.iShelf, sGlyph.iCell) == false)
+		{
+			std::cout << "CTextRenderer: The glyph atlas is full, cannot add glyph " << uiCodePoint << std::endl;
+			return NULL;
+		}
+		Shelf& sShelf = vShelves[sGlyph.iShelf];
+		const int iX = sGlyph.iCell * sShelf.iCellWidth;
+		const int iY = sShelf.iY;
 
-		GLfloat xpos = x + ch.Bearing.x * scale;
-		GLfloat ypos = y - (ch.Size.y - ch.Bearing.y) * scale;
+		// Copy the bitmap into the whole cell, so that the padding clears the previous glyph
+		std::vector<unsigned char> vCellPixels(sShelf.iCellWidth * sShelf.iCellHeight, 0);
+		for (int iRow = 0; iRow < sGlyph.Size.y; iRow++)
+		{
+			const unsigned char* pRow = pSlot->bitmap.buffer + iRow * pSlot->bitmap.pitch;
+			std::copy(pRow, pRow + sGlyph.Size.x, vCellPixels.begin() + iRow * sShelf.iCellWidth);
+		}
+		CRenderDevice::GetActive()->UpdateTexture(iTextureID, iX, iY, sShelf.iCellWidth, sShelf.iCellHeight, 1, &vCellPixels[0]);
 
-		GLfloat w = ch.Size.x * scale;
-		GLfloat h = ch.Size.y * scale;
-		// Update VBO for each character
-		GLfloat vertices[6][4] = {
-			{ xpos, ypos + h, 0.0, 0.0 },
-			{ xpos, ypos, 0.0, 1.0 },
-			{ xpos + w, ypos, 1.0, 1.0 },
+		sGlyph.UVMin = glm::vec2((float)iX / iAtlasSize, (float)iY / iAtlasSize);
+		sGlyph.UVMax = glm::vec2((float)(iX + sGlyph.Size.x) / iAtlasSize, (float)(iY + sGlyph.Size.y) / iAtlasSize);
+		sShelf.vCells[sGlyph.iCell] = ullKey;
+	}
 
-			{ xpos, ypos + h, 0.0, 0.0 },
-			{ xpos + w, ypos, 1.0, 1.0 },
-			{ xpos + w, ypos + h, 1.0, 0.0 }
-		};
-		// Render glyph texture over quad
-		glBindTexture(GL_TEXTURE_2D, ch.TextureID);
-		// Update content of VBO memory
-		glBindBuffer(GL_ARRAY_BUFFER, VBO);
-		glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices); // Be sure to use glBufferSubData and not glBufferData
+	// Now store the glyph for later use
+	Glyph& sStoredGlyph = mGlyphs[ullKey];
+	sStoredGlyph = sGlyph;
+	return &sStoredGlyph;
+}
 
-		glBindBuffer(GL_ARRAY_BUFFER, 0);
-		// Render quad
-		glDrawArrays(GL_TRIANGLES, 0, 6);
+/**
+ @brief GetLayout Get the layout of a string from the cache, laying it out if it is not there
+ @param text The UTF-8 string to lay out
+ @param uiPixelSize The pixel size of the glyphs
+ @param scale The scale of the glyphs
+ */
+const CTextRenderer::TextLayout* CTextRenderer::GetLayout(const std::string& text, const unsigned int uiPixelSize, const GLfloat scale)
+{
+	TextLayoutKey sKey = { text, sFontName, uiPixelSize, scale };
+
+	uiNumCacheLookups++;
+	std::map<TextLayoutKey, TextLayout>::iterator it = mLayoutCache.find(sKey);
+	if ((it != mLayoutCache.end()) &&
+		(it->second.bComplete) &&
+		(it->second.uiAtlasGeneration == uiAtlasGeneration))
+	{
+		// Mark the glyphs as used so that they are not evicted
+		for (unsigned int i = 0; i < it->second.vGlyphs.size(); i++)
+			it->second.vGlyphs[i]->uiLastUsedFrame = uiFrame;
+		uiNumCacheHits++;
+		return &it->second;
+	}
+
+	TextLayout& sLayout = mLayoutCache[sKey];
+	sLayout.vVertices.clear();
+	sLayout.vGlyphs.clear();
+	sLayout.vVertices.reserve(text.size() * 6);
+	sLayout.bComplete = true;
+
+	// Iterate through all code points
+	GLfloat x = 0.0f;
+	size_t i = 0;
+	while (i < text.size())
+	{
+		Glyph* pGlyph = GetGlyph(DecodeUTF8(text, i), uiPixelSize);
+		if (pGlyph == NULL)
+		{
+			// Try again next frame, e.g. when the atlas has glyphs which can be evicted
+			sLayout.bComplete = false;
+			continue;
+		}
+		const Glyph& ch = *pGlyph;
+		sLayout.vGlyphs.push_back(pGlyph);
+
+		// Whitespaces have no quad, only an advance
+		if (ch.iShelf >= 0)
+		{
+			GLfloat xpos = x + ch.Bearing.x * scale;
+			GLfloat ypos = -(ch.Size.y - ch.Bearing.y) * scale;
+
+			GLfloat w = ch.Size.x * scale;
+			GLfloat h = ch.Size.y * scale;
+			// Add the 2 triangles of this character to the layout
+			glm::vec4 vertices[6] = {
+				glm::vec4(xpos, ypos + h, ch.UVMin.x, ch.UVMin.y),
+				glm::vec4(xpos, ypos, ch.UVMin.x, ch.UVMax.y),
+				glm::vec4(xpos + w, ypos, ch.UVMax.x, ch.UVMax.y),
+
+				glm::vec4(xpos, ypos + h, ch.UVMin.x, ch.UVMin.y),
+				glm::vec4(xpos + w, ypos, ch.UVMax.x, ch.UVMax.y),
+				glm::vec4(xpos + w, ypos + h, ch.UVMax.x, ch.UVMin.y)
+			};
+			sLayout.vVertices.insert(sLayout.vVertices.end(), vertices, vertices + 6);
+		}
 		// Now advance cursors for next glyph (note that advance is number of 1/64 pixels)
 		x += (ch.Advance >> 6) * scale; // Bitshift by 6 to get value in pixels (2^6 = 64 (divide amount of 1/64th pixels by 64 to get amount of pixels))
 	}
-	glBindVertexArray(0);
-	glBindTexture(GL_TEXTURE_2D, 0);
+	// The glyphs of this layout were used in this frame, so they were not evicted while it was built
+	sLayout.uiAtlasGeneration = uiAtlasGeneration;
+	bBatchDirty = true;
+	return &sLayout;
+}
+
+/**
+ @brief Render Add a UTF-8 string to the text batch. The batch is drawn by Flush or PostRender.
+ @param uiPixelSize The pixel size to rasterise the glyphs at
+ */
+void CTextRenderer::Render(std::string text, GLfloat x, GLfloat y, GLfloat scale, glm::vec3 colour, const unsigned int uiPixelSize)
+{
+	PROFILE_ZONE("CTextRenderer::Render");
+
+	BatchString sString = { GetLayout(text, uiPixelSize, scale), x, y, colour };
+	vBatchStrings.push_back(sString);
 }
 
 /**
- @brief PostRender Set up the OpenGL display environment after rendering.
+ @brief Flush Draw all the text added by Render since the last Flush with one draw call.
+		If the strings are the same as in the last Flush, the VBO is drawn without an upload.
+ */
+void CTextRenderer::Flush(void)
+{
+	if (vBatchStrings.empty())
+		return;
+
+	PROFILE_ZONE("CTextRenderer::Flush");
+
+	CRenderDevice* cRenderDevice = CRenderDevice::GetActive();
+	cRenderDevice->ActiveTexture(GL_TEXTURE0);
+	cRenderDevice->BindTexture(iTextureID);
+	cRenderDevice->BindVertexArray(VAO);
+
+	if ((bBatchDirty) || (vBatchStrings != vLastBatchStrings))
+	{
+		// Place the cached layouts at their positions
+		vBatchVertices.clear();
+		for (unsigned int i = 0; i < vBatchStrings.size(); i++)
+		{
+			const BatchString& sString = vBatchStrings[i];
+			const std::vector<glm::vec4>& vVertices = sString.pLayout->vVertices;
+			for (unsigned int j = 0; j < vVertices.size(); j++)
+			{
+				GlyphVertex sVertex = {	sString.x + vVertices[j].x, sString.y + vVertices[j].y,
+										vVertices[j].z, vVertices[j].w,
+										sString.colour.x, sString.colour.y, sString.colour.z };
+				vBatchVertices.push_back(sVertex);
+			}
+		}
+
+		// Grow the VBO if the batch does not fit, otherwise only update its content
+		if (vBatchVertices.size() > uiBatchCapacity)
+		{
+			while (uiBatchCapacity < vBatchVertices.size())
+				uiBatchCapacity *= 2;
+			cRenderDevice->UploadBuffer(GL_ARRAY_BUFFER, VBO, sizeof(GlyphVertex) * uiBatchCapacity, NULL, GL_DYNAMIC_DRAW);
+		}
+		if (!vBatchVertices.empty())
+			cRenderDevice->UpdateBuffer(GL_ARRAY_BUFFER, VBO, 0, sizeof(GlyphVertex) * vBatchVertices.size(), &vBatchVertices[0]);
+		cRenderDevice->BindBuffer(GL_ARRAY_BUFFER, 0);
+
+		vLastBatchStrings.swap(vBatchStrings);
+		bBatchDirty = false;
+	}
+
+	// Render all the quads
+	if (!vBatchVertices.empty())
+		cRenderDevice->DrawArrays(GL_TRIANGLES, 0, (GLsizei)vBatchVertices.size());
+
+	cRenderDevice->BindVertexArray(0);
+	cRenderDevice->BindTexture(0);
+
+	vBatchStrings.clear();
+	uiFrame++;
+
+	// Empty the cache if it grew too big, e.g. from a counter which changes every frame
+	if (mLayoutCache.size() > MAX_CACHED_LAYOUTS)
+	{
+		mLayoutCache.clear();
+		vLastBatchStrings.clear();
+		bBatchDirty = true;
+	}
+}
+
+/**
+ @brief GetCacheHitRate Get the ratio of Render calls which reused a cached layout
+ */
+float CTextRenderer::GetCacheHitRate(void) const
+{
+	if (uiNumCacheLookups == 0)
+		return 0.0f;
+	return (float)uiNumCacheHits / (float)uiNumCacheLookups;
+}
+
+/**
+ @brief ResetCacheStats Reset the cache hit counters
+ */
+void CTextRenderer::ResetCacheStats(void)
+{
+	uiNumCacheLookups = 0;
+	uiNumCacheHits = 0;
+}
+
+/**
+ @brief SetAtlasBudget Set the memory budget of the glyph atlas in bytes. This must be called before Init.
+ */
+void CTextRenderer::SetAtlasBudget(const unsigned int uiBytes)
+{
+	uiAtlasBudget = uiBytes;
+}
+
+/**
+ @brief GetAtlasMemory Get the memory used by the glyph atlas in bytes
+ */
+unsigned int CTextRenderer::GetAtlasMemory(void) const
+{
+	return (unsigned int)(iAtlasSize * iAtlasSize);
+}
+
+/**
+ @brief GetNumGlyphs Get the number of glyphs in the atlas
+ */
+unsigned int CTextRenderer::GetNumGlyphs(void) const
+{
+	return (unsigned int)mGlyphs.size();
+}
+
+/**
+ @brief GetInitTime Get the time taken by Init in milliseconds
+ */
+double CTextRenderer::GetInitTime(void) const
+{
+	return dInitTime;
+}
+
+/**
+ @brief PostRender Draw the text batch and set up the OpenGL display environment after rendering.
  */
 void CTextRenderer::PostRender(void)
 {
+	// Draw the text which was added since PreRender
+	Flush();
+
 	// Disable blending
-	glDisable(GL_BLEND);
+	CRenderDevice::GetActive()->SetBlend(false);
+}
+
+/**
+ @brief PrintSelf Print out details about this class instance in the console window
+ */
+void CTextRenderer::PrintSelf(void) const
+{
+	cout << "CTextRenderer::PrintSelf()" << endl;
+	cout << "Init time: " << dInitTime << " ms" << endl;
+	cout << "Glyph atlas: " << iAtlasSize << "x" << iAtlasSize << " (" << GetAtlasMemory() / 1024 << " KB), "
+		<< mGlyphs.size() << " glyphs, " << uiNumEvictions << " evictions" << endl;
+	cout << "Layout cache: " << mLayoutCache.size() << " layouts, hit rate " << GetCacheHitRate() * 100.0f << "%" << endl;
 }
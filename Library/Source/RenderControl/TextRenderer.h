@@ -23,21 +23,79 @@
 #include "../Primitives/Entity2D.h"
 
 #include <string>
+#include <vector>
 #include <map>
 
+// The FreeType handles are declared here so that only TextRenderer.cpp includes FreeType
+struct FT_LibraryRec_;
+struct FT_FaceRec_;
+
 class CTextRenderer : public CSingletonTemplate<CTextRenderer>, public CEntity2D
 {
 	friend CSingletonTemplate<CTextRenderer>;
 
-	// Holds all state information relevant to a character as loaded using FreeType
-	struct Character {
-		GLuint TextureID;   // ID handle of the glyph texture
+	// Holds all state information relevant to a glyph as loaded using FreeType
+	struct Glyph {
+		glm::vec2 UVMin;	// Top-left UV coordinate of the glyph in the atlas
+		glm::vec2 UVMax;	// Bottom-right UV coordinate of the glyph in the atlas
 		glm::ivec2 Size;    // Size of glyph
 		glm::ivec2 Bearing;  // Offset from baseline to left/top of glyph
 		GLuint Advance;    // Horizontal offset to advance to next glyph
+		int iShelf;			// The shelf of the atlas holding this glyph, or -1 if it has no bitmap
+		int iCell;			// The cell of the shelf holding this glyph
+		unsigned int uiLastUsedFrame;	// The frame in which this glyph was last drawn
+	};
+
+	// A row of cells of the same size in the atlas
+	struct Shelf {
+		int iY;
+		int iCellWidth;
+		int iCellHeight;
+		// The key of the glyph in each cell, or 0 if the cell is free
+		std::vector<unsigned long long> vCells;
+	};
+
+	// A vertex in the text batch
+	struct GlyphVertex {
+		GLfloat x, y;		// Position in screen space
+		GLfloat u, v;		// UV coordinate in the atlas
+		GLfloat r, g, b;	// Colour of the text
+	};
+
+	// The key of a cached text layout
+	struct TextLayoutKey {
+		std::string sText;
+		std::string sFontName;
+		unsigned int uiPixelSize;
+		GLfloat fScale;
+
+		bool operator<(const TextLayoutKey& rhs) const;
+	};
+
+	// The glyph quads of a string relative to its origin, as <vec2 pos, vec2 tex> per vertex
+	struct TextLayout {
+		std::vector<glm::vec4> vVertices;
+		// The glyphs used by this layout, which are marked as used when the layout is reused
+		std::vector<Glyph*> vGlyphs;
+		// The atlas generation when this layout was built. The UVs are stale after an eviction.
+		unsigned int uiAtlasGeneration;
+		// A bool which is false if a glyph could not be added to the atlas
+		bool bComplete;
+	};
+
+	// A string added to the batch by Render
+	struct BatchString {
+		const TextLayout* pLayout;
+		GLfloat x, y;
+		glm::vec3 colour;
+
+		bool operator==(const BatchString& rhs) const;
 	};
 
 public:
+	// The pixel size used when Render is not given one
+	static const unsigned int DEFAULT_PIXEL_SIZE = 40;
+
 	// Init
 	bool Init(void);
 
@@ -47,20 +105,93 @@ public:
 	// PreRender
 	void PreRender(void);
 
-	// Render
-	void Render(std::string text, GLfloat x, GLfloat y, GLfloat scale, glm::vec3 colour);
+	// Render a UTF-8 string
+	void Render(std::string text, GLfloat x, GLfloat y, GLfloat scale, glm::vec3 colour,
+				const unsigned int uiPixelSize = DEFAULT_PIXEL_SIZE);
+
+	// Draw all the text added by Render since the last Flush
+	void Flush(void);
 
 	// PostRender
 	void PostRender(void);
 
+	// Get the ratio of Render calls which reused a cached layout
+	float GetCacheHitRate(void) const;
+	// Reset the cache hit counters
+	void ResetCacheStats(void);
+
+	// Set the memory budget of the glyph atlas in bytes. This must be called before Init.
+	void SetAtlasBudget(const unsigned int uiBytes);
+	// Get the memory used by the glyph atlas in bytes
+	unsigned int GetAtlasMemory(void) const;
+	// Get the number of glyphs in the atlas
+	unsigned int GetNumGlyphs(void) const;
+	// Get the time taken by Init in milliseconds
+	double GetInitTime(void) const;
+
+	// Print out details about this class instance in the console window
+	void PrintSelf(void) const;
+
 protected:
-	// Map of characters
-	std::map<GLchar, Character> Characters;
+	// The number of layouts to cache before the cache is emptied
+	static const unsigned int MAX_CACHED_LAYOUTS = 256;
+	// The cells of the atlas are multiples of this size in pixels
+	static const int CELL_ALIGNMENT = 8;
+
+	// FreeType, which is kept open to rasterise glyphs on first use
+	FT_LibraryRec_* pFTLibrary;
+	FT_FaceRec_* pFTFace;
+	// The pixel size which the face is set to
+	unsigned int uiFacePixelSize;
+	// The name of the font file
+	std::string sFontName;
+
+	// The memory budget of the atlas in bytes, and the width and height of the atlas
+	unsigned int uiAtlasBudget;
+	int iAtlasSize;
+	// The glyphs in the atlas, keyed by pixel size and code point
+	std::map<unsigned long long, Glyph> mGlyphs;
+	// The shelves of the atlas, from top to bottom
+	std::vector<Shelf> vShelves;
+	// The top of the free space below the last shelf
+	int iNextShelfY;
+	// Incremented whenever a glyph is evicted from the atlas
+	unsigned int uiAtlasGeneration;
+	// The number of glyphs evicted from the atlas
+	unsigned int uiNumEvictions;
+	// Incremented by each Flush, to find the least recently used glyphs
+	unsigned int uiFrame;
+	// The time taken by Init in milliseconds
+	double dInitTime;
+
+	// The cached layouts. std::map keeps the addresses of its values stable.
+	std::map<TextLayoutKey, TextLayout> mLayoutCache;
+	// The number of Render calls, and how many of them found their layout in the cache
+	unsigned int uiNumCacheLookups;
+	unsigned int uiNumCacheHits;
+
+	// The strings added by Render since the last Flush
+	std::vector<BatchString> vBatchStrings;
+	// The strings which are in the VBO now
+	std::vector<BatchString> vLastBatchStrings;
+	// A bool which is true if a layout was rebuilt since the VBO was uploaded
+	bool bBatchDirty;
+
+	// The vertices of the strings in the VBO
+	std::vector<GlyphVertex> vBatchVertices;
+	// The number of vertices which the VBO can hold
+	unsigned int uiBatchCapacity;
 
 	// Constructor
 	CTextRenderer(void);
 
 	// Destructor
 	virtual ~CTextRenderer(void);
-};
 
+	// Get a glyph, rasterising it into the atlas on first use
+	Glyph* GetGlyph(const unsigned int uiCodePoint, const unsigned int uiPixelSize);
+	// Find a free cell in the atlas, evicting the least recently used glyph if needed
+	bool AllocateCell(const int iWidth, const int iHeight, int& iShelf, int& iCell);
+	// Get the layout of a string from the cache, laying it out if it is not there
+	const TextLayout* GetLayout(const std::string& text, const unsigned int uiPixelSize, const GLfloat scale);
+};
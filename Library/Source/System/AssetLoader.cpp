@@ -0,0 +1,355 @@
+/**
+ CAssetLoader
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#include "AssetLoader.h"
+
+#include <fstream>
+#include <memory>
+#include <iostream>
+using namespace std;
+
+// Include ImageLoader
+#include "ImageLoader.h"
+// Include AssetManager
+#include "AssetManager.h"
+// Include FileSystem
+#include "filesystem.h"
+// Include CSettings
+#include "../GameControl/Settings.h"
+// Include CStopWatch to keep ProcessUploads within its time budget
+#include "../TimeControl/StopWatch.h"
+// Include CProfiler
+#include "../TimeControl/Profiler.h"
+
+/**
+ @brief Constructor This constructor has protected access modifier as this class will be a Singleton
+ */
+CAssetLoader::CAssetLoader(void)
+	: uiNumPendingJobs(0)
+	, bStop(false)
+	, uiNumJobs(0)
+{
+}
+
+/**
+ @brief Destructor This destructor has protected access modifier as this class will be a Singleton
+ */
+CAssetLoader::~CAssetLoader(void)
+{
+	// Finish the queued jobs so that no decoded image is leaked
+	WaitForAll();
+	StopWorkers();
+	ReleasePreloaded();
+}
+
+/**
+ @brief Init Initialise this instance
+ @param uiNumWorkers The number of worker threads, or 0 to use one less than the number of cores
+ */
+bool CAssetLoader::Init(const unsigned int uiNumWorkers)
+{
+	StopWorkers();
+
+	// Create the singletons used by the worker threads here, as CSingletonTemplate::GetInstance is not thread-safe
+	CImageLoader::GetInstance();
+	CAssetManager::GetInstance();
+	CSettings::GetInstance();
+#ifdef ENABLE_PROFILER
+	CProfiler::GetInstance();
+#endif
+	// FileSystem::getPath initialises its root path on its first call
+	FileSystem::getPath("");
+
+	if (CSettings::GetInstance()->bParallelAssetLoading == false)
+		return true;
+
+	unsigned int uiNumThreads = uiNumWorkers;
+	if (uiNumThreads == 0)
+	{
+		// Leave one core for the main thread
+		uiNumThreads = std::thread::hardware_concurrency();
+		uiNumThreads = (uiNumThreads > 1 ? uiNumThreads - 1 : 1);
+	}
+
+	bStop = false;
+	for (unsigned int i = 0; i < uiNumThreads; i++)
+	{
+		vWorkers.push_back(std::thread(&CAssetLoader::WorkerLoop, this));
+	}
+
+	return true;
+}
+
+/**
+ @brief Queue a job. If there are no worker threads, the job is run now.
+ @param fnWork The work step, which runs on a worker thread. It must not make OpenGL calls.
+ @param fnUpload The upload step, which runs on the main thread in ProcessUploads or WaitForAll
+ */
+void CAssetLoader::QueueJob(std::function<void()> fnWork, std::function<void()> fnUpload)
+{
+	uiNumJobs++;
+
+	if (vWorkers.empty())
+	{
+		if (fnWork)
+			fnWork();
+		if (fnUpload)
+			fnUpload();
+		return;
+	}
+
+	Job sJob;
+	sJob.fnWork = fnWork;
+	sJob.fnUpload = fnUpload;
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		dJobs.push_back(sJob);
+		uiNumPendingJobs++;
+	}
+	cvJobQueued.notify_one();
+}
+
+/**
+ @brief Decode an image on a worker thread and create its texture on the main thread.
+		The texture is held until ReleasePreloaded, and is shared with CAssetManager::AcquireTexture.
+ @param sFilename The file name of the image
+ @param bInvert A bool which is true if the image is flipped vertically
+ @param bGenerateMipmap A bool which is true if mipmaps should be generated
+ @param bClampToEdge A bool which is true to clamp the texture instead of repeating it
+ */
+void CAssetLoader::PreloadTexture(	const std::string& sFilename,
+									const bool bInvert,
+									const bool bGenerateMipmap,
+									const bool bClampToEdge)
+{
+	// Hold the texture if it is loaded already, or if it can be uploaded from the texture pack without decoding
+	if ((CAssetManager::GetInstance()->HasTexture(sFilename, bInvert, bGenerateMipmap, bClampToEdge)) ||
+		(CAssetManager::GetInstance()->IsInTexturePack(sFilename, bInvert)))
+	{
+		vPreloadedTextures.push_back(
+			CAssetManager::GetInstance()->AcquireTexture(sFilename, bInvert, bGenerateMipmap, bClampToEdge));
+		return;
+	}
+
+	// The decoded image, which is passed from the work step to the upload step
+	struct DecodedImage {
+		int iWidth, iHeight, iNumChannels;
+		unsigned char* pData;
+	};
+	std::shared_ptr<DecodedImage> pImage(new DecodedImage());
+	pImage->pData = NULL;
+
+	QueueJob(
+		[pImage, sFilename, bInvert]()
+		{
+			pImage->pData = CImageLoader::GetInstance()->Load(sFilename.c_str(),
+															  pImage->iWidth, pImage->iHeight, pImage->iNumChannels,
+															  bInvert);
+		},
+		[this, pImage, sFilename, bInvert, bGenerateMipmap, bClampToEdge]()
+		{
+			if (pImage->pData == NULL)
+			{
+				cout << "CAssetLoader: Unable to load " << sFilename << endl;
+				return;
+			}
+			vPreloadedTextures.push_back(
+				CAssetManager::GetInstance()->AddTexture(sFilename, bInvert, bGenerateMipmap, bClampToEdge,
+														 pImage->iWidth, pImage->iHeight, pImage->iNumChannels,
+														 pImage->pData));
+			// Free up the memory of the file data read in
+			free(pImage->pData);
+			pImage->pData = NULL;
+		});
+}
+
+/**
+ @brief Read a file on a worker thread and pass its content to fnUpload on the main thread
+ @param sFilename The file name, relative to the root directory of the assets
+ @param fnUpload The upload step. It is given an empty vector if the file could not be read.
+ */
+void CAssetLoader::PreloadFile(	const std::string& sFilename,
+								std::function<void(const std::vector<char>&)> fnUpload)
+{
+	std::shared_ptr<std::vector<char>> pContent(new std::vector<char>());
+
+	QueueJob(
+		[pContent, sFilename]()
+		{
+			std::ifstream file(FileSystem::getPath(sFilename).c_str(), std::ios::binary | std::ios::ate);
+			if (!file.is_open())
+				return;
+			std::streamsize iSize = file.tellg();
+			if (iSize <= 0)
+				return;
+			file.seekg(0, std::ios::beg);
+			pContent->resize((size_t)iSize);
+			if (!file.read(&(*pContent)[0], iSize))
+				pContent->clear();
+		},
+		[pContent, sFilename, fnUpload]()
+		{
+			if (pContent->empty())
+				cout << "CAssetLoader: Unable to read " << sFilename << endl;
+			fnUpload(*pContent);
+		});
+}
+
+/**
+ @brief Run the upload steps of the finished jobs, e.g. once per frame behind a loading screen
+ @param dTimeBudget The time in milliseconds after which no more upload steps are started, or 0 for no limit
+ @return The number of upload steps run
+ */
+unsigned int CAssetLoader::ProcessUploads(const double dTimeBudget)
+{
+	CStopWatch cStopWatch;
+	cStopWatch.StartTimer();
+	double dElapsedTime = 0.0;
+
+	unsigned int uiNumUploads = 0;
+	while (true)
+	{
+		std::function<void()> fnUpload;
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			if (dUploads.empty())
+				break;
+			fnUpload = dUploads.front();
+			dUploads.pop_front();
+		}
+
+		if (fnUpload)
+			fnUpload();
+		uiNumUploads++;
+
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			uiNumPendingJobs--;
+		}
+
+		if (dTimeBudget > 0.0)
+		{
+			dElapsedTime += cStopWatch.GetElapsedTime() * 1000.0;
+			if (dElapsedTime >= dTimeBudget)
+				break;
+		}
+	}
+	return uiNumUploads;
+}
+
+/**
+ @brief Wait for all the queued jobs, running their upload steps as the worker threads finish them
+ */
+void CAssetLoader::WaitForAll(void)
+{
+	while (true)
+	{
+		ProcessUploads();
+
+		std::unique_lock<std::mutex> lock(mMutex);
+		if (uiNumPendingJobs == 0)
+			break;
+		cvUploadQueued.wait(lock, [this]() { return !dUploads.empty(); });
+	}
+}
+
+/**
+ @brief Check if all the queued jobs are done
+ */
+bool CAssetLoader::IsIdle(void)
+{
+	return GetNumPendingJobs() == 0;
+}
+
+/**
+ @brief Get the number of jobs which are not done
+ */
+unsigned int CAssetLoader::GetNumPendingJobs(void)
+{
+	std::lock_guard<std::mutex> lock(mMutex);
+	return uiNumPendingJobs;
+}
+
+/**
+ @brief Release the textures held by PreloadTexture
+ */
+void CAssetLoader::ReleasePreloaded(void)
+{
+	for (unsigned int i = 0; i < vPreloadedTextures.size(); i++)
+	{
+		CAssetManager::GetInstance()->ReleaseTexture(vPreloadedTextures[i]);
+	}
+	vPreloadedTextures.clear();
+}
+
+/**
+ @brief Get the number of worker threads
+ */
+unsigned int CAssetLoader::GetNumWorkers(void) const
+{
+	return (unsigned int)vWorkers.size();
+}
+
+/**
+ @brief Print out details about this class instance in the console window
+ */
+void CAssetLoader::PrintSelf(void)
+{
+	cout << "CAssetLoader::PrintSelf()" << endl;
+	cout << "Worker threads: " << vWorkers.size() << endl;
+	cout << "Jobs run: " << uiNumJobs << ", pending: " << GetNumPendingJobs() << endl;
+	cout << "Preloaded textures: " << vPreloadedTextures.size() << endl;
+}
+
+/**
+ @brief The loop of a worker thread
+ */
+void CAssetLoader::WorkerLoop(void)
+{
+	PROFILE_THREAD_NAME("Asset loader");
+
+	while (true)
+	{
+		Job sJob;
+		{
+			std::unique_lock<std::mutex> lock(mMutex);
+			cvJobQueued.wait(lock, [this]() { return bStop || !dJobs.empty(); });
+			if (bStop && dJobs.empty())
+				return;
+			sJob = dJobs.front();
+			dJobs.pop_front();
+		}
+
+		if (sJob.fnWork)
+		{
+			PROFILE_ZONE("CAssetLoader::Work");
+			sJob.fnWork();
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			dUploads.push_back(sJob.fnUpload);
+		}
+		cvUploadQueued.notify_one();
+	}
+}
+
+/**
+ @brief Stop and join the worker threads
+ */
+void CAssetLoader::StopWorkers(void)
+{
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		bStop = true;
+	}
+	cvJobQueued.notify_all();
+	for (unsigned int i = 0; i < vWorkers.size(); i++)
+	{
+		if (vWorkers[i].joinable())
+			vWorkers[i].join();
+	}
+	vWorkers.clear();
+}
@@ -0,0 +1,111 @@
+/**
+ CAssetLoader
+ @brief A class which loads assets on a pool of worker threads.
+		A job has a work step which runs on a worker thread, e.g. decoding an image,
+		and an upload step which runs on the main thread, e.g. creating the OpenGL texture,
+		because the OpenGL context belongs to the main thread.
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#pragma once
+
+// Include SingletonTemplate
+#include "../DesignPatterns/SingletonTemplate.h"
+
+// Include GLEW
+#ifndef GLEW_STATIC
+#include <GL/glew.h>
+#define GLEW_STATIC
+#endif
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+class CAssetLoader : public CSingletonTemplate<CAssetLoader>
+{
+	friend CSingletonTemplate<CAssetLoader>;
+
+	// A job of the asset loader
+	struct Job {
+		// The work step, which runs on a worker thread
+		std::function<void()> fnWork;
+		// The upload step, which runs on the main thread after the work step
+		std::function<void()> fnUpload;
+	};
+
+public:
+	// Init
+	bool Init(const unsigned int uiNumWorkers = 0);
+
+	// Queue a job. The work step runs on a worker thread, and the upload step on the main thread.
+	void QueueJob(std::function<void()> fnWork, std::function<void()> fnUpload);
+
+	// Decode an image on a worker thread and create its texture on the main thread
+	void PreloadTexture(const std::string& sFilename,
+						const bool bInvert = true,
+						const bool bGenerateMipmap = true,
+						const bool bClampToEdge = false);
+	// Read a file on a worker thread and pass its content to fnUpload on the main thread
+	void PreloadFile(const std::string& sFilename,
+					 std::function<void(const std::vector<char>&)> fnUpload);
+
+	// Run the upload steps of the finished jobs. Returns the number of upload steps run.
+	unsigned int ProcessUploads(const double dTimeBudget = 0.0);
+	// Wait for all the queued jobs, running their upload steps
+	void WaitForAll(void);
+	// Check if all the queued jobs are done
+	bool IsIdle(void);
+	// Get the number of jobs which are not done
+	unsigned int GetNumPendingJobs(void);
+
+	// Release the textures held by PreloadTexture
+	void ReleasePreloaded(void);
+
+	// Get the number of worker threads
+	unsigned int GetNumWorkers(void) const;
+
+	// Print out details about this class instance in the console window
+	void PrintSelf(void);
+
+protected:
+	// The worker threads
+	std::vector<std::thread> vWorkers;
+	// The jobs waiting for a worker thread
+	std::deque<Job> dJobs;
+	// The upload steps of the jobs which finished their work step
+	std::deque<std::function<void()>> dUploads;
+	// The number of jobs which are queued but whose upload step has not run
+	unsigned int uiNumPendingJobs;
+	// A bool which is true when the worker threads should stop
+	bool bStop;
+
+	// Guards dJobs, dUploads, uiNumPendingJobs and bStop
+	std::mutex mMutex;
+	// Wakes up the worker threads when a job is queued
+	std::condition_variable cvJobQueued;
+	// Wakes up the main thread when an upload step is queued
+	std::condition_variable cvUploadQueued;
+
+	// The textures loaded by PreloadTexture. They are held until ReleasePreloaded,
+	// so that the users which acquire them later share them instead of loading them again.
+	std::vector<GLuint> vPreloadedTextures;
+
+	// The number of jobs run since the program started
+	unsigned int uiNumJobs;
+
+	// Constructor
+	CAssetLoader(void);
+
+	// Destructor
+	virtual ~CAssetLoader(void);
+
+	// The loop of a worker thread
+	void WorkerLoop(void);
+	// Stop and join the worker threads
+	void StopWorkers(void);
+};
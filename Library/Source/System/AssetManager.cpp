@@ -0,0 +1,356 @@
+/**
+ CAssetManager
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#include "AssetManager.h"
+
+// Include ImageLoader
+#include "ImageLoader.h"
+
+// Include TexturePack
+#include "TexturePack.h"
+
+// Include Render Device
+#include "../RenderControl/RenderDevice.h"
+
+// Include CStopWatch to time the loading of textures
+#include "../TimeControl/StopWatch.h"
+
+#include <cctype>
+#include <vector>
+#include <iostream>
+using namespace std;
+
+/**
+ @brief Constructor This constructor has protected access modifier as this class will be a Singleton
+ */
+CAssetManager::CAssetManager(void)
+	: uiTextureMemory(0)
+	, uiNumDecodes(0)
+	, uiNumPackLoads(0)
+	, dTextureLoadTime(0.0)
+{
+}
+
+/**
+ @brief Destructor This destructor has protected access modifier as this class will be a Singleton
+ */
+CAssetManager::~CAssetManager(void)
+{
+	// Delete the textures which were not released
+	std::map<std::string, TextureAsset>::iterator it;
+	for (it = mTextures.begin(); it != mTextures.end(); ++it)
+	{
+		CRenderDevice::GetActive()->DeleteTexture(it->second.uiTextureID);
+	}
+	mTextures.clear();
+	mTextureKeys.clear();
+}
+
+/**
+@brief Init Initialise this instance
+*/
+bool CAssetManager::Init(void)
+{
+	return true;
+}
+
+/**
+ @brief Get the key of a texture. The same file loaded with different options is a different texture.
+ */
+std::string CAssetManager::MakeTextureKey(	const std::string& sFilename,
+											const bool bInvert,
+											const bool bGenerateMipmap,
+											const bool bClampToEdge)
+{
+	return NormalisePath(sFilename) + "|" +
+		   (bInvert ? "i" : "-") + (bGenerateMipmap ? "m" : "-") + (bClampToEdge ? "c" : "-");
+}
+
+/**
+ @brief Get a texture, loading it if no one holds it yet. Each call must be matched by a ReleaseTexture.
+ @param sFilename The file name of the image
+ @param bInvert A bool which is true if the image is flipped vertically
+ @param bGenerateMipmap A bool which is true if mipmaps should be generated
+ @param bClampToEdge A bool which is true to clamp the texture instead of repeating it
+ @return The OpenGL texture ID, or 0 if the image could not be loaded
+ */
+GLuint CAssetManager::AcquireTexture(	const std::string& sFilename,
+										const bool bInvert,
+										const bool bGenerateMipmap,
+										const bool bClampToEdge)
+{
+	const std::string sKey = MakeTextureKey(sFilename, bInvert, bGenerateMipmap, bClampToEdge);
+	std::map<std::string, TextureAsset>::iterator it = mTextures.find(sKey);
+	if (it != mTextures.end())
+	{
+		it->second.iRefCount++;
+		return it->second.uiTextureID;
+	}
+
+	CStopWatch cStopWatch;
+	cStopWatch.StartTimer();
+
+	// Upload the image from the texture pack if it is there
+	if (IsInTexturePack(sFilename, bInvert))
+	{
+		GLuint uiTextureID = AddPackedTexture(sKey, sFilename, bInvert, bGenerateMipmap, bClampToEdge);
+		dTextureLoadTime += cStopWatch.GetElapsedTime() * 1000.0;
+		return uiTextureID;
+	}
+
+	// Decode the image
+	int iWidth = 0, iHeight = 0, iNumChannels = 0;
+	unsigned char* data = CImageLoader::GetInstance()->Load(sFilename.c_str(), iWidth, iHeight, iNumChannels, bInvert);
+	if (data == NULL)
+	{
+		cout << "CAssetManager: Unable to load " << sFilename << endl;
+		return 0;
+	}
+
+	GLuint uiTextureID = AddTexture(sFilename, bInvert, bGenerateMipmap, bClampToEdge, iWidth, iHeight, iNumChannels, data);
+
+	// Free up the memory of the file data read in
+	free(data);
+
+	dTextureLoadTime += cStopWatch.GetElapsedTime() * 1000.0;
+	return uiTextureID;
+}
+
+/**
+ @brief Check if an image is in the open texture pack, so that it does not need to be decoded
+ @param sFilename The file name of the image
+ @param bInvert A bool which is true if the image is flipped vertically. The pack stores one orientation.
+ */
+bool CAssetManager::IsInTexturePack(const std::string& sFilename, const bool bInvert) const
+{
+	const TexturePackEntry* pEntry = CTexturePack::GetInstance()->Find(NormalisePath(sFilename));
+	if (pEntry == nullptr)
+		return false;
+	return ((pEntry->uiFlags & TEXTURE_PACK_FLIPPED) != 0) == bInvert;
+}
+
+/**
+ @brief Create a texture from an image in the open texture pack. The pixels are uploaded directly from the mapping.
+ */
+GLuint CAssetManager::AddPackedTexture(	const std::string& sKey,
+										const std::string& sFilename,
+										const bool bInvert,
+										const bool bGenerateMipmap,
+										const bool bClampToEdge)
+{
+	const TexturePackEntry* pEntry = CTexturePack::GetInstance()->Find(NormalisePath(sFilename));
+	const bool bHasMipmaps = (pEntry->uiFlags & TEXTURE_PACK_MIPMAPS) != 0;
+
+	int iWidth = 0, iHeight = 0;
+	const unsigned char* pData = CTexturePack::GetInstance()->GetLevelData(pEntry, 0, iWidth, iHeight);
+	// Only generate the mipmaps if the packer did not compute them
+	GLuint uiTextureID = CRenderDevice::GetActive()->CreateTexture(iWidth, iHeight, pEntry->uiNumChannels, pData,
+																	bGenerateMipmap && !bHasMipmaps, bClampToEdge);
+	if (bGenerateMipmap && bHasMipmaps)
+	{
+		for (unsigned int uiLevel = 1; uiLevel < pEntry->uiNumLevels; uiLevel++)
+		{
+			int iLevelWidth = 0, iLevelHeight = 0;
+			pData = CTexturePack::GetInstance()->GetLevelData(pEntry, uiLevel, iLevelWidth, iLevelHeight);
+			CRenderDevice::GetActive()->UploadTextureLevel(uiTextureID, uiLevel, iLevelWidth, iLevelHeight,
+														   pEntry->uiNumChannels, pData);
+		}
+	}
+	uiNumPackLoads++;
+
+	unsigned int uiNumBytes = (unsigned int)(iWidth * iHeight * pEntry->uiNumChannels);
+	// The mipmaps add a third to the size of the texture
+	if (bGenerateMipmap)
+		uiNumBytes += uiNumBytes / 3;
+	RegisterTexture(sKey, uiTextureID, uiNumBytes);
+
+	return uiTextureID;
+}
+
+/**
+ @brief Check if a texture is loaded
+ */
+bool CAssetManager::HasTexture(	const std::string& sFilename,
+								const bool bInvert,
+								const bool bGenerateMipmap,
+								const bool bClampToEdge) const
+{
+	return mTextures.find(MakeTextureKey(sFilename, bInvert, bGenerateMipmap, bClampToEdge)) != mTextures.end();
+}
+
+/**
+ @brief Create a texture from an image which was decoded elsewhere, e.g. by CAssetLoader.
+		If the texture is already loaded, it is shared instead. Each call must be matched by a ReleaseTexture.
+ @param iWidth The width of the image
+ @param iHeight The height of the image
+ @param iNumChannels The number of channels in the image
+ @param pData The pixels of the image, which are still owned by the caller
+ @return The OpenGL texture ID
+ */
+GLuint CAssetManager::AddTexture(	const std::string& sFilename,
+									const bool bInvert,
+									const bool bGenerateMipmap,
+									const bool bClampToEdge,
+									const int iWidth, const int iHeight, const int iNumChannels,
+									const unsigned char* pData)
+{
+	// Every decoded image is counted, even if another copy was loaded in the meantime
+	uiNumDecodes++;
+
+	const std::string sKey = MakeTextureKey(sFilename, bInvert, bGenerateMipmap, bClampToEdge);
+	std::map<std::string, TextureAsset>::iterator it = mTextures.find(sKey);
+	if (it != mTextures.end())
+	{
+		it->second.iRefCount++;
+		return it->second.uiTextureID;
+	}
+
+	// Create the texture
+	GLuint uiTextureID = CRenderDevice::GetActive()->CreateTexture(iWidth, iHeight, iNumChannels, pData,
+																	bGenerateMipmap, bClampToEdge);
+
+	unsigned int uiNumBytes = (unsigned int)(iWidth * iHeight * iNumChannels);
+	// The mipmaps add a third to the size of the texture
+	if (bGenerateMipmap)
+		uiNumBytes += uiNumBytes / 3;
+	RegisterTexture(sKey, uiTextureID, uiNumBytes);
+
+	return uiTextureID;
+}
+
+/**
+ @brief Store a created texture with a reference count of 1
+ @param sKey The key from MakeTextureKey
+ @param uiTextureID The OpenGL texture ID
+ @param uiNumBytes The size of the texture in bytes, including its mipmaps
+ */
+void CAssetManager::RegisterTexture(const std::string& sKey, const GLuint uiTextureID, const unsigned int uiNumBytes)
+{
+	TextureAsset sAsset;
+	sAsset.uiTextureID = uiTextureID;
+	sAsset.iRefCount = 1;
+	sAsset.uiNumBytes = uiNumBytes;
+	sAsset.sKey = sKey;
+
+	mTextures[sKey] = sAsset;
+	mTextureKeys[uiTextureID] = sKey;
+	uiTextureMemory += sAsset.uiNumBytes;
+}
+
+/**
+ @brief Release a texture, deleting it if this was its last user
+ @param uiTextureID The OpenGL texture ID from AcquireTexture. Other IDs are ignored.
+ */
+void CAssetManager::ReleaseTexture(const GLuint uiTextureID)
+{
+	std::map<GLuint, std::string>::iterator itKey = mTextureKeys.find(uiTextureID);
+	if (itKey == mTextureKeys.end())
+		return;
+
+	std::map<std::string, TextureAsset>::iterator it = mTextures.find(itKey->second);
+	if (it == mTextures.end())
+		return;
+
+	it->second.iRefCount--;
+	if (it->second.iRefCount > 0)
+		return;
+
+	CRenderDevice::GetActive()->DeleteTexture(uiTextureID);
+	uiTextureMemory -= it->second.uiNumBytes;
+	mTextures.erase(it);
+	mTextureKeys.erase(itKey);
+}
+
+/**
+ @brief Get the total size of the loaded textures in bytes
+ */
+unsigned int CAssetManager::GetTextureMemory(void) const
+{
+	return uiTextureMemory;
+}
+
+/**
+ @brief Get the number of image files decoded since the program started
+ */
+unsigned int CAssetManager::GetNumDecodes(void) const
+{
+	return uiNumDecodes;
+}
+
+/**
+ @brief Get the number of loaded textures
+ */
+unsigned int CAssetManager::GetNumTextures(void) const
+{
+	return (unsigned int)mTextures.size();
+}
+
+/**
+ @brief Get the number of textures uploaded from the texture pack since the program started
+ */
+unsigned int CAssetManager::GetNumPackLoads(void) const
+{
+	return uiNumPackLoads;
+}
+
+/**
+ @brief Get the time spent by AcquireTexture loading textures in milliseconds.
+		Compare it with and without CSettings::bUseTexturePack, with CSettings::bParallelAssetLoading off.
+ */
+double CAssetManager::GetTextureLoadTime(void) const
+{
+	return dTextureLoadTime;
+}
+
+/**
+ @brief Normalise a file path, so that the same file always has the same key.
+		Backslashes become slashes, repeated slashes and "." are removed, ".." is resolved
+		and the path is lowercased, as the file system on Windows is not case sensitive.
+ @param sFilename The file path to normalise
+ */
+std::string CAssetManager::NormalisePath(const std::string& sFilename)
+{
+	std::vector<std::string> vParts;
+	std::string sPart;
+	for (size_t i = 0; i <= sFilename.size(); i++)
+	{
+		const char c = (i < sFilename.size()) ? sFilename[i] : '/';
+		if ((c == '/') || (c == '\\'))
+		{
+			if (sPart == "..")
+			{
+				if ((!vParts.empty()) && (vParts.back() != ".."))
+					vParts.pop_back();
+				else
+					vParts.push_back(sPart);
+			}
+			else if ((!sPart.empty()) && (sPart != "."))
+				vParts.push_back(sPart);
+			sPart.clear();
+		}
+		else
+			sPart += (char)tolower((unsigned char)c);
+	}
+
+	std::string sPath;
+	for (size_t i = 0; i < vParts.size(); i++)
+	{
+		if (i > 0)
+			sPath += "/";
+		sPath += vParts[i];
+	}
+	return sPath;
+}
+
+/**
+ @brief Print out details about this class instance in the console window
+ */
+void CAssetManager::PrintSelf(void) const
+{
+	cout << "CAssetManager::PrintSelf()" << endl;
+	cout << "Textures: " << mTextures.size() << " (" << uiTextureMemory / 1024 << " KB)" << endl;
+	cout << "Image decodes: " << uiNumDecodes << ", texture pack loads: " << uiNumPackLoads << endl;
+	cout << "Texture load time: " << dTextureLoadTime << " ms" << endl;
+}
@@ -0,0 +1,118 @@
+/**
+ CAssetManager
+ @brief A class which shares the textures loaded from image files.
+		Textures are keyed by their normalised path and load options, and are
+		reference counted. A texture is deleted when its last user releases it.
+		If the image is in the open CTexturePack, it is uploaded from the pack instead of being decoded.
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#pragma once
+
+// Include SingletonTemplate
+#include "../DesignPatterns/SingletonTemplate.h"
+
+// Include GLEW
+#ifndef GLEW_STATIC
+#include <GL/glew.h>
+#define GLEW_STATIC
+#endif
+
+#include <string>
+#include <map>
+
+// A structure storing a shared texture
+struct TextureAsset
+{
+	// The OpenGL texture ID
+	GLuint uiTextureID;
+	// The number of users holding this texture
+	int iRefCount;
+	// The size of the texture in bytes, including its mipmaps
+	unsigned int uiNumBytes;
+	// The key of this texture in CAssetManager
+	std::string sKey;
+};
+
+class CAssetManager : public CSingletonTemplate<CAssetManager>
+{
+	friend CSingletonTemplate<CAssetManager>;
+public:
+	// Init
+	bool Init(void);
+
+	// Get a texture, loading it if no one holds it yet
+	GLuint AcquireTexture(	const std::string& sFilename,
+							const bool bInvert = true,
+							const bool bGenerateMipmap = true,
+							const bool bClampToEdge = false);
+	// Release a texture, deleting it if this was its last user
+	void ReleaseTexture(const GLuint uiTextureID);
+
+	// Check if a texture is loaded
+	bool HasTexture(const std::string& sFilename,
+					const bool bInvert = true,
+					const bool bGenerateMipmap = true,
+					const bool bClampToEdge = false) const;
+	// Check if an image is in the open texture pack, so that it does not need to be decoded
+	bool IsInTexturePack(const std::string& sFilename, const bool bInvert = true) const;
+	// Create a texture from an image which was decoded elsewhere, e.g. by CAssetLoader
+	GLuint AddTexture(	const std::string& sFilename,
+						const bool bInvert,
+						const bool bGenerateMipmap,
+						const bool bClampToEdge,
+						const int iWidth, const int iHeight, const int iNumChannels,
+						const unsigned char* pData);
+
+	// Get the total size of the loaded textures in bytes
+	unsigned int GetTextureMemory(void) const;
+	// Get the number of image files decoded since the program started
+	unsigned int GetNumDecodes(void) const;
+	// Get the number of loaded textures
+	unsigned int GetNumTextures(void) const;
+	// Get the number of textures uploaded from the texture pack since the program started
+	unsigned int GetNumPackLoads(void) const;
+	// Get the time spent by AcquireTexture loading textures in milliseconds
+	double GetTextureLoadTime(void) const;
+
+	// Normalise a file path, so that the same file always has the same key
+	static std::string NormalisePath(const std::string& sFilename);
+
+	// Print out details about this class instance in the console window
+	void PrintSelf(void) const;
+
+protected:
+	// Constructor
+	CAssetManager(void);
+
+	// Destructor
+	virtual ~CAssetManager(void);
+
+	// Get the key of a texture
+	static std::string MakeTextureKey(	const std::string& sFilename,
+										const bool bInvert,
+										const bool bGenerateMipmap,
+										const bool bClampToEdge);
+	// Create a texture from an image in the open texture pack
+	GLuint AddPackedTexture(const std::string& sKey,
+							const std::string& sFilename,
+							const bool bInvert,
+							const bool bGenerateMipmap,
+							const bool bClampToEdge);
+	// Store a created texture with a reference count of 1
+	void RegisterTexture(const std::string& sKey, const GLuint uiTextureID, const unsigned int uiNumBytes);
+
+	// The loaded textures, keyed by normalised path and load options
+	std::map<std::string, TextureAsset> mTextures;
+	// The keys of the loaded textures, keyed by OpenGL texture ID
+	std::map<GLuint, std::string> mTextureKeys;
+
+	// The total size of the loaded textures in bytes
+	unsigned int uiTextureMemory;
+	// The number of image files decoded
+	unsigned int uiNumDecodes;
+	// The number of textures uploaded from the texture pack
+	unsigned int uiNumPackLoads;
+	// The time spent by AcquireTexture loading textures in milliseconds
+	double dTextureLoadTime;
+};
@@ -5,6 +5,8 @@
  */
 #include "ImageLoader.h"
 
+#include <cstring>
+#include <vector>
 #include <iostream>
 using namespace std;
 
@@ -18,6 +20,9 @@ using namespace std;
 #include <includes/stb_image.h>
 #include "filesystem.h"
 
+// Include AssetManager
+#include "AssetManager.h"
+
 /**
  @brief Constructor This constructor has protected access modifier as this class will be a Singleton
  */
@@ -41,56 +46,41 @@ bool CImageLoader::Init(void)
 }
 
 /**
-@brief Load an image and return as unsigned char*
+@brief Load an image and return as unsigned char*.
+	   This can be called from the worker threads of CAssetLoader, so the image is flipped here
+	   instead of with stbi_set_flip_vertically_on_load, which is shared by all threads.
 */
 unsigned char * CImageLoader::Load(const char* filename, int& width, int& height, int& nrChannels, const bool bInvert)
 {
-	// tell stb_image.h to flip loaded texture's on the y-axis.
-	stbi_set_flip_vertically_on_load(bInvert);
-
 	// load image, create texture and generate mipmaps
 	unsigned char *data = stbi_load(FileSystem::getPath(filename).c_str(),
 									&width, &height, &nrChannels, 0);
 
+	// flip the loaded image on the y-axis
+	if ((data) && (bInvert))
+	{
+		const int iRowSize = width * nrChannels;
+		std::vector<unsigned char> vRow(iRowSize);
+		for (int iRow = 0; iRow < height / 2; iRow++)
+		{
+			unsigned char* pTop = data + iRow * iRowSize;
+			unsigned char* pBottom = data + (height - 1 - iRow) * iRowSize;
+			memcpy(&vRow[0], pTop, iRowSize);
+			memcpy(pTop, pBottom, iRowSize);
+			memcpy(pBottom, &vRow[0], iRowSize);
+		}
+	}
+
 	// Return the data but you must remember to free up the memory of the file data read in
 	return data;
 }
 
+/**
+@brief Load an image and return as a Texture ID. The texture is shared through CAssetManager,
+	   so it must be released with CAssetManager::ReleaseTexture.
+*/
 unsigned CImageLoader::LoadTextureGetID(const char* filename,  const bool bInvert)
 {
-	// Load from file
-	int image_width = 0;
-	int image_height = 0;
-	int nrChannels = 0;
-
-	// tell stb_image.h to flip loaded texture's on the y-axis.
-	stbi_set_flip_vertically_on_load(bInvert);
-
-	// load image, create texture and generate mipmaps
-	unsigned char* data = stbi_load(FileSystem::getPath(filename).c_str(),
-		&image_width, &image_height, &nrChannels, 0);
-
-	if (data == NULL)
-		return 0;
-
-	// Create a OpenGL texture identifier
-	GLuint image_texture;
-	glGenTextures(1, &image_texture);
-	glBindTexture(GL_TEXTURE_2D, image_texture);
-
-	// Setup filtering parameters for display
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE); // This is required on WebGL for non power-of-two textures
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE); // Same
-
-				  // Upload pixels into texture
-#if defined(GL_UNPACK_ROW_LENGTH) && !defined(__EMSCRIPTEN__)
-	glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
-#endif
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, image_width, image_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
-	stbi_image_free(data);
-
-	return image_texture;
+	// A texture without mipmaps, clamped to its edges for the GUI
+	return CAssetManager::GetInstance()->AcquireTexture(filename, bInvert, false, true);
 }
-
@@ -0,0 +1,384 @@
+/**
+ CJobSystem
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#include "JobSystem.h"
+
+#include <algorithm>
+#include <iostream>
+using namespace std;
+
+// Include CSettings
+#include "../GameControl/Settings.h"
+// Include CProfiler
+#include "../TimeControl/Profiler.h"
+
+// The index of the queue of each thread. It is 0 for the threads which are not workers.
+static thread_local unsigned int uiThreadQueueIndex = 0;
+
+/**
+ @brief Constructor This constructor has protected access modifier as this class will be a Singleton
+ */
+CJobSystem::CJobSystem(void)
+	: uiNumQueuedJobs(0)
+	, bStop(false)
+	, uiNumJobs(0)
+	, uiNumSteals(0)
+{
+	// The queue of the threads which are not workers
+	vQueues.push_back(new JobQueue());
+}
+
+/**
+ @brief Destructor This destructor has protected access modifier as this class will be a Singleton
+ */
+CJobSystem::~CJobSystem(void)
+{
+	StopWorkers();
+	for (unsigned int i = 0; i < vQueues.size(); i++)
+		delete vQueues[i];
+	vQueues.clear();
+}
+
+/**
+ @brief Init Initialise this instance
+ @param uiNumThreads The number of threads which run the jobs, including the thread which waits for them,
+		or 0 to use one thread per core
+ */
+bool CJobSystem::Init(const unsigned int uiNumThreads)
+{
+	StopWorkers();
+
+	// Create the singletons used by the worker threads here, as CSingletonTemplate::GetInstance is not thread-safe
+	CSettings::GetInstance();
+#ifdef ENABLE_PROFILER
+	CProfiler::GetInstance();
+#endif
+
+	if (CSettings::GetInstance()->bParallelJobs == false)
+		return true;
+
+	unsigned int uiNumWorkers = uiNumThreads;
+	if (uiNumWorkers == 0)
+		uiNumWorkers = std::thread::hardware_concurrency();
+	// The thread which waits for the jobs runs them too
+	uiNumWorkers = (uiNumWorkers > 1 ? uiNumWorkers - 1 : 0);
+
+	bStop = false;
+	for (unsigned int i = 0; i < uiNumWorkers; i++)
+		vQueues.push_back(new JobQueue());
+	for (unsigned int i = 0; i < uiNumWorkers; i++)
+		vWorkers.push_back(std::thread(&CJobSystem::WorkerLoop, this, i + 1));
+
+	return true;
+}
+
+/**
+ @brief Run a job on any thread. If there are no worker threads, the job is run now.
+ @param fnJob The job. It must not make OpenGL calls.
+ @param pCounter The counter which is decremented when the job is done, or NULL
+ */
+void CJobSystem::Run(std::function<void()> fnJob, CJobCounter* pCounter)
+{
+	if (vWorkers.empty())
+	{
+		uiNumJobs++;
+		fnJob();
+		return;
+	}
+
+	Job sJob;
+	sJob.fnJob = fnJob;
+	sJob.pCounter = pCounter;
+	if (pCounter)
+		pCounter->iNumUnfinished.fetch_add(1, std::memory_order_relaxed);
+
+	JobQueue* pQueue = vQueues[GetQueueIndex()];
+	{
+		std::lock_guard<std::mutex> lock(pQueue->mMutex);
+		pQueue->dJobs.push_back(sJob);
+	}
+	uiNumQueuedJobs++;
+
+	// Lock the sleep mutex, so that a worker which is about to sleep sees the job before it waits
+	{
+		std::lock_guard<std::mutex> lock(mSleepMutex);
+	}
+	cvJobQueued.notify_one();
+}
+
+/**
+ @brief Wait for the jobs of a counter. The calling thread runs jobs while it waits,
+		so that it helps to finish them, and so that a job can wait for other jobs.
+ @param cCounter The counter to wait for
+ */
+void CJobSystem::Wait(CJobCounter& cCounter)
+{
+	PROFILE_ZONE("CJobSystem::Wait");
+
+	while (cCounter.IsDone() == false)
+	{
+		Job sJob;
+		if (TakeJob(sJob))
+			Execute(sJob);
+		else
+			std::this_thread::yield();
+	}
+}
+
+/**
+ @brief Split [0, uiCount) into ranges of uiGrainSize items, run fnRange on each range in parallel, and wait for them.
+		The calling thread runs the first range.
+ @param uiCount The number of items
+ @param uiGrainSize The number of items in a range. Use more items per range when each item is cheap to run.
+ @param fnRange The function which is run on each range, with its first item and one past its last item
+ */
+void CJobSystem::ParallelFor(const unsigned int uiCount,
+							 const unsigned int uiGrainSize,
+							 const std::function<void(const unsigned int uiBegin, const unsigned int uiEnd)>& fnRange)
+{
+	if (uiCount == 0)
+		return;
+
+	const unsigned int uiRangeSize = max(uiGrainSize, 1u);
+	if ((vWorkers.empty()) || (uiCount <= uiRangeSize))
+	{
+		fnRange(0, uiCount);
+		return;
+	}
+
+	CJobCounter cCounter;
+	for (unsigned int uiBegin = uiRangeSize; uiBegin < uiCount; uiBegin += uiRangeSize)
+	{
+		const unsigned int uiEnd = min(uiBegin + uiRangeSize, uiCount);
+		Run([&fnRange, uiBegin, uiEnd]() { fnRange(uiBegin, uiEnd); }, &cCounter);
+	}
+
+	fnRange(0, uiRangeSize);
+	Wait(cCounter);
+}
+
+/**
+ @brief Get the number of threads which run the jobs, including the thread which waits for them
+ */
+unsigned int CJobSystem::GetNumThreads(void) const
+{
+	return (unsigned int)vWorkers.size() + 1;
+}
+
+/**
+ @brief Print out details about this class instance in the console window
+ */
+void CJobSystem::PrintSelf(void)
+{
+	cout << "CJobSystem::PrintSelf()" << endl;
+	cout << "Threads: " << GetNumThreads() << endl;
+	cout << "Jobs run: " << uiNumJobs << ", stolen: " << uiNumSteals << ", queued: " << uiNumQueuedJobs << endl;
+}
+
+/**
+ @brief Get the index of the queue of the calling thread
+ */
+unsigned int CJobSystem::GetQueueIndex(void) const
+{
+	return (uiThreadQueueIndex < vQueues.size() ? uiThreadQueueIndex : 0);
+}
+
+/**
+ @brief Take the newest job from the queue of the calling thread, or steal the oldest job from another queue
+ @param sJob The job which was taken
+ @return A bool value. true if a job was taken, else false
+ */
+bool CJobSystem::TakeJob(Job& sJob)
+{
+	if (uiNumQueuedJobs.load(std::memory_order_relaxed) == 0)
+		return false;
+
+	const unsigned int uiOwnIndex = GetQueueIndex();
+	{
+		JobQueue* pQueue = vQueues[uiOwnIndex];
+		std::lock_guard<std::mutex> lock(pQueue->mMutex);
+		if (!pQueue->dJobs.empty())
+		{
+			sJob = pQueue->dJobs.back();
+			pQueue->dJobs.pop_back();
+			uiNumQueuedJobs--;
+			return true;
+		}
+	}
+
+	// Start from the next queue, so that the threads do not all steal from the same queue
+	for (unsigned int i = 1; i < vQueues.size(); i++)
+	{
+		JobQueue* pQueue = vQueues[(uiOwnIndex + i) % vQueues.size()];
+		std::lock_guard<std::mutex> lock(pQueue->mMutex);
+		if (!pQueue->dJobs.empty())
+		{
+			sJob = pQueue->dJobs.front();
+			pQueue->dJobs.pop_front();
+			uiNumQueuedJobs--;
+			uiNumSteals++;
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ @brief Run a job and decrement its counter
+ @param sJob The job
+ */
+void CJobSystem::Execute(Job& sJob)
+{
+	uiNumJobs++;
+	sJob.fnJob();
+	if (sJob.pCounter)
+		sJob.pCounter->iNumUnfinished.fetch_sub(1, std::memory_order_release);
+}
+
+/**
+ @brief The loop of a worker thread
+ @param uiQueueIndex The index of the queue of this worker thread
+ */
+void CJobSystem::WorkerLoop(const unsigned int uiQueueIndex)
+{
+	uiThreadQueueIndex = uiQueueIndex;
+	PROFILE_THREAD_NAME("Job worker");
+
+	while (true)
+	{
+		Job sJob;
+		if (TakeJob(sJob))
+		{
+			PROFILE_ZONE("CJobSystem::Job");
+			Execute(sJob);
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(mSleepMutex);
+		cvJobQueued.wait(lock, [this]() { return bStop || uiNumQueuedJobs.load() > 0; });
+		if (bStop && uiNumQueuedJobs.load() == 0)
+			return;
+	}
+}
+
+/**
+ @brief Stop and join the worker threads, and delete their queues
+ */
+void CJobSystem::StopWorkers(void)
+{
+	{
+		std::lock_guard<std::mutex> lock(mSleepMutex);
+		bStop = true;
+	}
+	cvJobQueued.notify_all();
+	for (unsigned int i = 0; i < vWorkers.size(); i++)
+	{
+		if (vWorkers[i].joinable())
+			vWorkers[i].join();
+	}
+	vWorkers.clear();
+
+	// Keep the queue of the threads which are not workers
+	while (vQueues.size() > 1)
+	{
+		delete vQueues.back();
+		vQueues.pop_back();
+	}
+}
+
+/**
+ @brief Constructor
+ */
+CJobGraph::CJobGraph(void)
+{
+}
+
+/**
+ @brief Destructor
+ */
+CJobGraph::~CJobGraph(void)
+{
+	Clear();
+}
+
+/**
+ @brief Add a job
+ @param fnJob The job. It must not make OpenGL calls.
+ @return The index of the job, which is used to add its dependencies
+ */
+unsigned int CJobGraph::AddJob(std::function<void()> fnJob)
+{
+	Node* pNode = new Node();
+	pNode->fnJob = fnJob;
+	pNode->uiNumPredecessors = 0;
+	pNode->uiNumPending = 0;
+	vNodes.push_back(pNode);
+	return (unsigned int)vNodes.size() - 1;
+}
+
+/**
+ @brief Make a job wait until another job is done. The dependencies must not form a cycle.
+ @param uiBefore The index of the job which is run first
+ @param uiAfter The index of the job which waits for it
+ */
+void CJobGraph::AddDependency(const unsigned int uiBefore, const unsigned int uiAfter)
+{
+	if ((uiBefore >= vNodes.size()) || (uiAfter >= vNodes.size()) || (uiBefore == uiAfter))
+	{
+		cout << "CJobGraph::AddDependency: Invalid job index." << endl;
+		return;
+	}
+	vNodes[uiBefore]->vSuccessors.push_back(uiAfter);
+	vNodes[uiAfter]->uiNumPredecessors++;
+}
+
+/**
+ @brief Run the jobs on CJobSystem and wait for all of them
+ */
+void CJobGraph::Run(void)
+{
+	PROFILE_ZONE("CJobGraph::Run");
+
+	for (unsigned int i = 0; i < vNodes.size(); i++)
+		vNodes[i]->uiNumPending.store(vNodes[i]->uiNumPredecessors, std::memory_order_relaxed);
+
+	CJobSystem* cJobSystem = CJobSystem::GetInstance();
+	for (unsigned int i = 0; i < vNodes.size(); i++)
+	{
+		if (vNodes[i]->uiNumPredecessors == 0)
+			cJobSystem->Run([this, i]() { RunNode(i); }, &cCounter);
+	}
+	cJobSystem->Wait(cCounter);
+}
+
+/**
+ @brief Remove all the jobs
+ */
+void CJobGraph::Clear(void)
+{
+	for (unsigned int i = 0; i < vNodes.size(); i++)
+		delete vNodes[i];
+	vNodes.clear();
+}
+
+/**
+ @brief Run a job, and queue the jobs which depend on it once all the jobs which they depend on are done.
+		They are queued before this job is counted as done, so the counter of the run does not reach 0 early.
+ @param uiIndex The index of the job
+ */
+void CJobGraph::RunNode(const unsigned int uiIndex)
+{
+	Node* pNode = vNodes[uiIndex];
+	if (pNode->fnJob)
+		pNode->fnJob();
+
+	CJobSystem* cJobSystem = CJobSystem::GetInstance();
+	for (unsigned int i = 0; i < pNode->vSuccessors.size(); i++)
+	{
+		const unsigned int uiSuccessor = pNode->vSuccessors[i];
+		if (vNodes[uiSuccessor]->uiNumPending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			cJobSystem->Run([this, uiSuccessor]() { RunNode(uiSuccessor); }, &cCounter);
+	}
+}
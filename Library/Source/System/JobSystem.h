@@ -0,0 +1,156 @@
+/**
+ CJobSystem
+ @brief A class which runs the per-frame game work, e.g. the enemy updates, on a pool of worker threads.
+		Each thread has its own queue of jobs. A thread runs the newest job in its own queue first,
+		and steals the oldest job from another queue when its own is empty, so that the work spreads
+		over the cores without one shared queue which every thread contends on.
+		A thread which waits for its jobs runs jobs while it waits, so that jobs can wait for other jobs.
+		Jobs can be run one by one, split over a range with ParallelFor, or ordered in a CJobGraph.
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#pragma once
+
+// Include SingletonTemplate
+#include "../DesignPatterns/SingletonTemplate.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class CJobSystem : public CSingletonTemplate<CJobSystem>
+{
+	friend CSingletonTemplate<CJobSystem>;
+public:
+	/**
+	 CJobCounter
+	 @brief The number of jobs which are not done, which Wait waits for
+	 */
+	class CJobCounter
+	{
+	public:
+		// Constructor
+		CJobCounter(void) : iNumUnfinished(0) {}
+
+		// Check if all the jobs of this counter are done
+		bool IsDone(void) const { return iNumUnfinished.load(std::memory_order_acquire) == 0; }
+
+	protected:
+		friend class CJobSystem;
+		std::atomic<int> iNumUnfinished;
+	};
+
+	// Init
+	bool Init(const unsigned int uiNumThreads = 0);
+
+	// Run a job on any thread. The counter, if any, is decremented when the job is done.
+	void Run(std::function<void()> fnJob, CJobCounter* pCounter = NULL);
+	// Wait for the jobs of a counter, running jobs on the calling thread while waiting
+	void Wait(CJobCounter& cCounter);
+
+	// Split [0, uiCount) into ranges of uiGrainSize items, run fnRange on each range in parallel, and wait for them
+	void ParallelFor(const unsigned int uiCount,
+					 const unsigned int uiGrainSize,
+					 const std::function<void(const unsigned int uiBegin, const unsigned int uiEnd)>& fnRange);
+
+	// Get the number of threads which run the jobs, including the thread which waits for them
+	unsigned int GetNumThreads(void) const;
+
+	// Print out details about this class instance in the console window
+	void PrintSelf(void);
+
+protected:
+	// A job and the counter which it decrements when it is done
+	struct Job {
+		std::function<void()> fnJob;
+		CJobCounter* pCounter;
+	};
+
+	// The queue of jobs of a thread. The owner pushes and pops at the back, and the other threads steal from the front.
+	struct JobQueue {
+		std::deque<Job> dJobs;
+		std::mutex mMutex;
+	};
+
+	// The worker threads
+	std::vector<std::thread> vWorkers;
+	// The queue of each thread. Index 0 is used by the threads which are not workers, e.g. the main thread.
+	std::vector<JobQueue*> vQueues;
+	// The number of jobs in all the queues
+	std::atomic<unsigned int> uiNumQueuedJobs;
+	// A bool which is true when the worker threads should stop
+	bool bStop;
+
+	// Guards bStop, and lets the worker threads sleep until a job is queued
+	std::mutex mSleepMutex;
+	std::condition_variable cvJobQueued;
+
+	// The number of jobs run, and the number of jobs which were stolen from another thread's queue
+	std::atomic<unsigned int> uiNumJobs;
+	std::atomic<unsigned int> uiNumSteals;
+
+	// Constructor
+	CJobSystem(void);
+
+	// Destructor
+	virtual ~CJobSystem(void);
+
+	// Get the index of the queue of the calling thread
+	unsigned int GetQueueIndex(void) const;
+	// Take a job from the queue of the calling thread, or steal one from another queue
+	bool TakeJob(Job& sJob);
+	// Run a job and decrement its counter
+	void Execute(Job& sJob);
+
+	// The loop of a worker thread
+	void WorkerLoop(const unsigned int uiQueueIndex);
+	// Stop and join the worker threads
+	void StopWorkers(void);
+};
+
+/**
+ CJobGraph
+ @brief A set of jobs with dependencies between them. A job is run after all the jobs which it depends on are done,
+		and the jobs which do not depend on each other run in parallel.
+ */
+class CJobGraph
+{
+public:
+	// Constructor
+	CJobGraph(void);
+	// Destructor
+	~CJobGraph(void);
+
+	// Add a job, and return its index
+	unsigned int AddJob(std::function<void()> fnJob);
+	// Make a job wait until another job is done
+	void AddDependency(const unsigned int uiBefore, const unsigned int uiAfter);
+
+	// Run the jobs on CJobSystem and wait for all of them. The graph can be run again.
+	void Run(void);
+
+	// Remove all the jobs
+	void Clear(void);
+
+protected:
+	// A job in the graph
+	struct Node {
+		std::function<void()> fnJob;
+		// The jobs which depend on this job
+		std::vector<unsigned int> vSuccessors;
+		// The number of jobs which this job depends on, and the number of them which are not done in a run
+		unsigned int uiNumPredecessors;
+		std::atomic<unsigned int> uiNumPending;
+	};
+
+	// Run a job, and queue the jobs which depend on it once they have no jobs to wait for
+	void RunNode(const unsigned int uiIndex);
+
+	std::vector<Node*> vNodes;
+	// The counter of the jobs of the current run
+	CJobSystem::CJobCounter cCounter;
+};
@@ -0,0 +1,237 @@
+/**
+ CTexturePack
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#include "TexturePack.h"
+
+#include <cstring>
+#include <iostream>
+using namespace std;
+
+// Include FileSystem
+#include "filesystem.h"
+
+#ifdef _WIN32
+	#include <windows.h>
+#else
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
+
+/**
+ @brief Constructor This constructor has protected access modifier as this class will be a Singleton
+ */
+CTexturePack::CTexturePack(void)
+	: pMapping(NULL)
+	, uiMappingSize(0)
+#ifdef _WIN32
+	, hFile(INVALID_HANDLE_VALUE)
+	, hMapping(NULL)
+#else
+	, iFile(-1)
+#endif
+{
+}
+
+/**
+ @brief Destructor This destructor has protected access modifier as this class will be a Singleton
+ */
+CTexturePack::~CTexturePack(void)
+{
+	Close();
+}
+
+/**
+ @brief Open a texture pack, closing the one which is open
+ @param sFilename The file name of the pack, relative to the root directory of the assets
+ @return true if the pack was opened, false if it is missing or invalid
+ */
+bool CTexturePack::Open(const std::string& sFilename)
+{
+	Close();
+
+	if (MapFile(FileSystem::getPath(sFilename)) == false)
+	{
+		cout << "CTexturePack: Unable to open " << sFilename << ". Run TexturePacker to create it." << endl;
+		return false;
+	}
+	if (ReadIndex() == false)
+	{
+		cout << "CTexturePack: " << sFilename << " is not a valid texture pack. Run TexturePacker to create it again." << endl;
+		Close();
+		return false;
+	}
+
+	this->sFilename = sFilename;
+	return true;
+}
+
+/**
+ @brief Close the texture pack. The textures which were uploaded from it are not affected.
+ */
+void CTexturePack::Close(void)
+{
+	mEntries.clear();
+#ifdef _WIN32
+	if (pMapping)
+		UnmapViewOfFile(pMapping);
+	if (hMapping)
+		CloseHandle(hMapping);
+	if (hFile != INVALID_HANDLE_VALUE)
+		CloseHandle(hFile);
+	hMapping = NULL;
+	hFile = INVALID_HANDLE_VALUE;
+#else
+	if (pMapping)
+		munmap((void*)pMapping, uiMappingSize);
+	if (iFile >= 0)
+		close(iFile);
+	iFile = -1;
+#endif
+	pMapping = NULL;
+	uiMappingSize = 0;
+	sFilename.clear();
+}
+
+/**
+ @brief Check if a texture pack is open
+ */
+bool CTexturePack::IsOpen(void) const
+{
+	return pMapping != NULL;
+}
+
+/**
+ @brief Find an image by its normalised path
+ @param sNormalisedName The path of the image file, normalised by CAssetManager::NormalisePath
+ @return The entry of the image, or nullptr if it is not in the pack
+ */
+const TexturePackEntry* CTexturePack::Find(const std::string& sNormalisedName) const
+{
+	std::map<std::string, const TexturePackEntry*>::const_iterator it = mEntries.find(sNormalisedName);
+	if (it == mEntries.end())
+		return nullptr;
+	return it->second;
+}
+
+/**
+ @brief Get the pixels of a mipmap level of an image
+ @param pEntry The entry of the image
+ @param uiLevel The mipmap level, where 0 is the full size image
+ @param iWidth The width of this level
+ @param iHeight The height of this level
+ @return The pixels of this level, which stay valid until the pack is closed
+ */
+const unsigned char* CTexturePack::GetLevelData(const TexturePackEntry* pEntry, const unsigned int uiLevel,
+												int& iWidth, int& iHeight) const
+{
+	unsigned int uiOffset = pEntry->uiDataOffset;
+	for (unsigned int i = 0; i < uiLevel; i++)
+	{
+		uiOffset += GetTexturePackLevelSize(pEntry->uiWidth, i) * GetTexturePackLevelSize(pEntry->uiHeight, i) * pEntry->uiNumChannels;
+		uiOffset = AlignTexturePackOffset(uiOffset);
+	}
+	iWidth = (int)GetTexturePackLevelSize(pEntry->uiWidth, uiLevel);
+	iHeight = (int)GetTexturePackLevelSize(pEntry->uiHeight, uiLevel);
+	return pMapping + uiOffset;
+}
+
+/**
+ @brief Get the number of images in the pack
+ */
+unsigned int CTexturePack::GetNumEntries(void) const
+{
+	return (unsigned int)mEntries.size();
+}
+
+/**
+ @brief Get the size of the pack in bytes
+ */
+unsigned int CTexturePack::GetSize(void) const
+{
+	return uiMappingSize;
+}
+
+/**
+ @brief Print out details about this class instance in the console window
+ */
+void CTexturePack::PrintSelf(void) const
+{
+	cout << "CTexturePack::PrintSelf()" << endl;
+	if (IsOpen() == false)
+	{
+		cout << "No texture pack is open" << endl;
+		return;
+	}
+	cout << "File: " << sFilename << endl;
+	cout << "Images: " << mEntries.size() << " (" << uiMappingSize / 1024 << " KB)" << endl;
+}
+
+/**
+ @brief Map a file into memory, read-only
+ @param sPath The full path of the file
+ */
+bool CTexturePack::MapFile(const std::string& sPath)
+{
+#ifdef _WIN32
+	hFile = CreateFileA(sPath.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+						FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (hFile == INVALID_HANDLE_VALUE)
+		return false;
+	LARGE_INTEGER liSize;
+	if ((GetFileSizeEx(hFile, &liSize) == FALSE) || (liSize.QuadPart <= 0) || (liSize.HighPart != 0))
+		return false;
+	uiMappingSize = (unsigned int)liSize.QuadPart;
+	hMapping = CreateFileMappingA(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (hMapping == NULL)
+		return false;
+	pMapping = (const unsigned char*)MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+#else
+	iFile = open(sPath.c_str(), O_RDONLY);
+	if (iFile < 0)
+		return false;
+	struct stat sStat;
+	if ((fstat(iFile, &sStat) != 0) || (sStat.st_size <= 0))
+		return false;
+	uiMappingSize = (unsigned int)sStat.st_size;
+	void* pView = mmap(NULL, uiMappingSize, PROT_READ, MAP_PRIVATE, iFile, 0);
+	pMapping = (pView == MAP_FAILED) ? NULL : (const unsigned char*)pView;
+#endif
+	return pMapping != NULL;
+}
+
+/**
+ @brief Check the header and the index of the mapped pack, and fill mEntries
+ */
+bool CTexturePack::ReadIndex(void)
+{
+	if (uiMappingSize < sizeof(TexturePackHeader))
+		return false;
+
+	const TexturePackHeader* pHeader = (const TexturePackHeader*)pMapping;
+	if ((memcmp(pHeader->acMagic, TEXTURE_PACK_MAGIC, 4) != 0) ||
+		(pHeader->uiVersion != TEXTURE_PACK_VERSION) ||
+		(pHeader->uiFileSize != uiMappingSize) ||
+		(sizeof(TexturePackHeader) + (unsigned long long)pHeader->uiNumEntries * sizeof(TexturePackEntry) > uiMappingSize))
+		return false;
+
+	const TexturePackEntry* pEntries = (const TexturePackEntry*)(pMapping + sizeof(TexturePackHeader));
+	for (unsigned int i = 0; i < pHeader->uiNumEntries; i++)
+	{
+		const TexturePackEntry* pEntry = &pEntries[i];
+		if ((pEntry->acName[TEXTURE_PACK_NAME_LENGTH - 1] != '\0') || (pEntry->uiNumLevels == 0))
+			return false;
+
+		// Check that the last level ends inside the file
+		int iWidth = 0, iHeight = 0;
+		const unsigned char* pLastLevel = GetLevelData(pEntry, pEntry->uiNumLevels - 1, iWidth, iHeight);
+		if ((unsigned long long)(pLastLevel - pMapping) + (unsigned long long)iWidth * iHeight * pEntry->uiNumChannels > uiMappingSize)
+			return false;
+
+		mEntries[pEntry->acName] = pEntry;
+	}
+	return true;
+}
@@ -0,0 +1,73 @@
+/**
+ CTexturePack
+ @brief A class which memory-maps a texture pack written by the TexturePacker tool.
+		CAssetManager uploads the images in the pack directly from the mapping,
+		instead of decoding their image files.
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#pragma once
+
+// Include SingletonTemplate
+#include "../DesignPatterns/SingletonTemplate.h"
+
+// Include the layout of a texture pack
+#include "TexturePackFormat.h"
+
+#include <string>
+#include <map>
+
+class CTexturePack : public CSingletonTemplate<CTexturePack>
+{
+	friend CSingletonTemplate<CTexturePack>;
+public:
+	// Open a texture pack, closing the one which is open
+	bool Open(const std::string& sFilename);
+	// Close the texture pack
+	void Close(void);
+	// Check if a texture pack is open
+	bool IsOpen(void) const;
+
+	// Find an image by its normalised path. Returns nullptr if it is not in the pack.
+	const TexturePackEntry* Find(const std::string& sNormalisedName) const;
+	// Get the pixels of a mipmap level of an image
+	const unsigned char* GetLevelData(	const TexturePackEntry* pEntry, const unsigned int uiLevel,
+										int& iWidth, int& iHeight) const;
+
+	// Get the number of images in the pack
+	unsigned int GetNumEntries(void) const;
+	// Get the size of the pack in bytes
+	unsigned int GetSize(void) const;
+
+	// Print out details about this class instance in the console window
+	void PrintSelf(void) const;
+
+protected:
+	// The file name of the pack
+	std::string sFilename;
+	// The start of the mapping
+	const unsigned char* pMapping;
+	// The size of the mapping in bytes
+	unsigned int uiMappingSize;
+	// The handles of the file and of the mapping
+#ifdef _WIN32
+	void* hFile;
+	void* hMapping;
+#else
+	int iFile;
+#endif
+
+	// The images in the pack, keyed by their normalised path
+	std::map<std::string, const TexturePackEntry*> mEntries;
+
+	// Constructor
+	CTexturePack(void);
+
+	// Destructor
+	virtual ~CTexturePack(void);
+
+	// Map a file into memory
+	bool MapFile(const std::string& sPath);
+	// Check the header and the index of the mapped pack
+	bool ReadIndex(void);
+};
@@ -0,0 +1,74 @@
+/**
+ TexturePackFormat
+ @brief The layout of a texture pack file, which is written by the TexturePacker tool
+		and memory-mapped by CTexturePack. A pack holds decoded images, so that no
+		image file is decoded at runtime.
+
+		The file starts with a TexturePackHeader, followed by uiNumEntries TexturePackEntry.
+		The pixels of each entry follow, one mipmap level after another, with every level
+		starting on a TEXTURE_PACK_ALIGNMENT boundary.
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#pragma once
+
+// The first 4 bytes of a texture pack
+#define TEXTURE_PACK_MAGIC "NTPK"
+// Incremented whenever the layout changes
+const unsigned int TEXTURE_PACK_VERSION = 1;
+// The maximum length of the name of an entry, including the terminating 0
+const unsigned int TEXTURE_PACK_NAME_LENGTH = 120;
+// The alignment of the pixels of each mipmap level in bytes
+const unsigned int TEXTURE_PACK_ALIGNMENT = 16;
+
+// The flags of a TexturePackEntry
+enum TEXTURE_PACK_FLAGS
+{
+	// The image is flipped vertically, as CImageLoader::Load does when bInvert is true
+	TEXTURE_PACK_FLIPPED = 1,
+	// The image has precomputed mipmap levels
+	TEXTURE_PACK_MIPMAPS = 2,
+};
+
+// The header of a texture pack
+struct TexturePackHeader
+{
+	char acMagic[4];
+	unsigned int uiVersion;
+	unsigned int uiNumEntries;
+	// The size of the whole file in bytes
+	unsigned int uiFileSize;
+};
+
+// An image in a texture pack
+struct TexturePackEntry
+{
+	// The path of the image file, normalised as CAssetManager::NormalisePath does
+	char acName[TEXTURE_PACK_NAME_LENGTH];
+	unsigned int uiWidth;
+	unsigned int uiHeight;
+	unsigned int uiNumChannels;
+	// The number of mipmap levels, including the full size image
+	unsigned int uiNumLevels;
+	// A combination of TEXTURE_PACK_FLAGS
+	unsigned int uiFlags;
+	// The offset of the first level from the start of the file
+	unsigned int uiDataOffset;
+};
+
+/**
+ @brief Get the size of a mipmap level. Each level is half the size of the previous one, down to 1 pixel.
+ */
+inline unsigned int GetTexturePackLevelSize(const unsigned int uiSize, const unsigned int uiLevel)
+{
+	const unsigned int uiLevelSize = uiSize >> uiLevel;
+	return (uiLevelSize > 0 ? uiLevelSize : 1);
+}
+
+/**
+ @brief Round up a number of bytes to TEXTURE_PACK_ALIGNMENT
+ */
+inline unsigned int AlignTexturePackOffset(const unsigned int uiOffset)
+{
+	return (uiOffset + TEXTURE_PACK_ALIGNMENT - 1) / TEXTURE_PACK_ALIGNMENT * TEXTURE_PACK_ALIGNMENT;
+}
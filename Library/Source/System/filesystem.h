@@ -33,7 +33,7 @@ private:
 	{
 		char buff[FILENAME_MAX]; //create string buffer to hold path
 		GetCurrentDir(buff, FILENAME_MAX);
-		string current_working_dir(buff);
+		std::string current_working_dir(buff);
 
 		static char const * envRoot = current_working_dir.c_str();	// getenv("LOGL_ROOT_PATH");
 		static char const * givenRoot = (envRoot != nullptr ? envRoot : CSettings::GetInstance()->logl_root);
@@ -1,5 +1,11 @@
 #include "FPSCounter.h"
+
+// Include CStopWatch to read the CPU time of this process
+#include "StopWatch.h"
+
 #include <iostream>
+#include <cmath>
+#include <algorithm>
 using namespace std;
 
 CFPSCounter::CFPSCounter()
@@ -7,6 +13,13 @@ CFPSCounter::CFPSCounter()
 	, nFrames(0)
 	, iFrameRate(0)
 	, dFrameTime(0.0)
+	, dFrameTimeSum(0.0)
+	, dFrameTimeSquaredSum(0.0)
+	, dMaxFrameTimeCurrent(0.0)
+	, dFrameTimeJitter(0.0)
+	, dMaxFrameTime(0.0)
+	, dLastProcessTime(0.0)
+	, dCPUUsage(0.0)
 {
 	Init();
 }
@@ -24,6 +37,13 @@ void CFPSCounter::Init(void)
 	nFrames = 0;
 	iFrameRate = 0;
 	dFrameTime = 60;
+	dFrameTimeSum = 0.0;
+	dFrameTimeSquaredSum = 0.0;
+	dMaxFrameTimeCurrent = 0.0;
+	dFrameTimeJitter = 0.0;
+	dMaxFrameTime = 0.0;
+	dLastProcessTime = CStopWatch::GetProcessTime();
+	dCPUUsage = 0.0;
 }
 
 // Update the class instance
@@ -35,10 +55,29 @@ void CFPSCounter::Update(const double deltaTime)
 	// Update the frame count
 	nFrames++;
 
+	// Update the frame time statistics in milliseconds
+	const double dFrameTimeMS = deltaTime * 1000.0;
+	dFrameTimeSum += dFrameTimeMS;
+	dFrameTimeSquaredSum += dFrameTimeMS * dFrameTimeMS;
+	dMaxFrameTimeCurrent = std::max(dMaxFrameTimeCurrent, dFrameTimeMS);
+
 	if (dElapsedTime >= 1.0){ // If last update was more than 1 sec ago...
 		// Calculate the current frame rate
 		dFrameTime = 1000.0 / double(nFrames);
 
+		// Calculate the standard deviation of the frame times
+		const double dMean = dFrameTimeSum / nFrames;
+		dFrameTimeJitter = sqrt(std::max(0.0, dFrameTimeSquaredSum / nFrames - dMean * dMean));
+		dMaxFrameTime = dMaxFrameTimeCurrent;
+		dFrameTimeSum = 0.0;
+		dFrameTimeSquaredSum = 0.0;
+		dMaxFrameTimeCurrent = 0.0;
+
+		// Calculate the CPU usage of this process
+		const double dProcessTime = CStopWatch::GetProcessTime();
+		dCPUUsage = (dProcessTime - dLastProcessTime) / dElapsedTime * 100.0;
+		dLastProcessTime = dProcessTime;
+
 		// Update the frame count for the last 1 second
 		iFrameRate = nFrames;
 
@@ -65,3 +104,21 @@ double CFPSCounter::GetFrameTime(void) const
 {
 	return dFrameTime;
 }
+
+// Get the standard deviation of the frame times in the last 1 second, in milliseconds
+double CFPSCounter::GetFrameTimeJitter(void) const
+{
+	return dFrameTimeJitter;
+}
+
+// Get the longest frame time in the last 1 second, in milliseconds
+double CFPSCounter::GetMaxFrameTime(void) const
+{
+	return dMaxFrameTime;
+}
+
+// Get the CPU time used by this process in the last 1 second, as a percentage of one core
+double CFPSCounter::GetCPUUsage(void) const
+{
+	return dCPUUsage;
+}
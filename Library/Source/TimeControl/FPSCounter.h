@@ -33,6 +33,13 @@ public:
 	// Get the current frame time
 	double GetFrameTime(void) const;
 
+	// Get the standard deviation of the frame times in the last 1 second, in milliseconds
+	double GetFrameTimeJitter(void) const;
+	// Get the longest frame time in the last 1 second, in milliseconds
+	double GetMaxFrameTime(void) const;
+	// Get the CPU time used by this process in the last 1 second, as a percentage of one core
+	double GetCPUUsage(void) const;
+
 protected:
 	// Count the elapsed time since the last reset
 	double dElapsedTime;
@@ -43,6 +50,17 @@ protected:
 	// Count the elapsed time since the last reset
 	double dFrameTime;
 
+	// The sum of the frame times and their squares, and the longest frame time for the current second
+	double dFrameTimeSum;
+	double dFrameTimeSquaredSum;
+	double dMaxFrameTimeCurrent;
+	// The frame time jitter and longest frame time for the last 1 second
+	double dFrameTimeJitter;
+	double dMaxFrameTime;
+	// The process CPU time at the last reset, and the CPU usage for the last 1 second
+	double dLastProcessTime;
+	double dCPUUsage;
+
 	// Constructor
 	CFPSCounter(void);
 };
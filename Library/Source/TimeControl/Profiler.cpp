@@ -0,0 +1,313 @@
+/**
+ CProfiler
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#include "Profiler.h"
+
+#include <algorithm>
+#include <climits>
+#include <fstream>
+#include <iostream>
+using namespace std;
+
+// The index of each thread in CProfiler, which is given out when a thread first records a zone
+static thread_local unsigned int uiThreadIndex = UINT_MAX;
+// The number of zones which are open on each thread
+static thread_local unsigned int uiThreadDepth = 0;
+
+/**
+ @brief Constructor This constructor has protected access modifier as this class will be a Singleton
+ */
+CProfiler::CProfiler(void)
+	: startTime(Clock::now())
+	, ullWriteIndex(0)
+	, uiNumThreads(0)
+	, uiNextFrame(0)
+	, dFrameTimeP50(0.0)
+	, dFrameTimeP95(0.0)
+	, dFrameTimeP99(0.0)
+	, ullFrameStartIndex(0)
+	, llFrameStart(0)
+{
+	for (unsigned int i = 0; i < NUM_EVENTS; i++)
+		arrSequences[i].store(0, std::memory_order_relaxed);
+	for (unsigned int i = 0; i < MAX_THREADS; i++)
+		arrThreadNames[i] = nullptr;
+
+	vFrameTimes.reserve(NUM_FRAMES);
+	vSortedFrameTimes.reserve(NUM_FRAMES);
+}
+
+/**
+ @brief Destructor This destructor has protected access modifier as this class will be a Singleton
+ */
+CProfiler::~CProfiler(void)
+{
+}
+
+/**
+ @brief Get the time in nanoseconds since this class instance was created
+ */
+long long CProfiler::GetTime(void) const
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - startTime).count();
+}
+
+/**
+ @brief Get the index of the calling thread, which is given out when a thread first records a zone
+ */
+unsigned int CProfiler::GetThreadIndex(void)
+{
+	if (uiThreadIndex == UINT_MAX)
+		uiThreadIndex = uiNumThreads.fetch_add(1, std::memory_order_relaxed);
+	return uiThreadIndex;
+}
+
+/**
+ @brief Name the calling thread in the Chrome trace
+ @param pName The name, which must stay valid while the profiler is used
+ */
+void CProfiler::SetThreadName(const char* pName)
+{
+	const unsigned int uiThread = GetThreadIndex();
+	if (uiThread < MAX_THREADS)
+		arrThreadNames[uiThread] = pName;
+}
+
+/**
+ @brief Record a zone. This may be called from any thread, and does not lock.
+ @param pName The name of the zone, which must stay valid while the profiler is used
+ @param llStart The start time in nanoseconds from GetTime
+ @param llEnd The end time in nanoseconds from GetTime
+ @param uiDepth The number of zones which enclose this zone on its thread
+ */
+void CProfiler::Record(const char* pName, const long long llStart, const long long llEnd, const unsigned int uiDepth)
+{
+	// Claim a slot. When the ring buffer is full, the oldest event is overwritten.
+	const unsigned long long ullIndex = ullWriteIndex.fetch_add(1, std::memory_order_relaxed);
+	const unsigned int uiSlot = (unsigned int)(ullIndex & (NUM_EVENTS - 1));
+
+	// Mark the slot as being written, so that a reader skips it until it is complete
+	arrSequences[uiSlot].store(2 * ullIndex + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	Event& sEvent = arrEvents[uiSlot];
+	sEvent.pName = pName;
+	sEvent.llStart = llStart;
+	sEvent.llDuration = llEnd - llStart;
+	sEvent.uiThread = GetThreadIndex();
+	sEvent.uiDepth = uiDepth;
+
+	arrSequences[uiSlot].store(2 * (ullIndex + 1), std::memory_order_release);
+}
+
+/**
+ @brief End a frame. It updates the frame time percentiles and the zone times.
+ @param dElapsedTime The time which the frame took in seconds
+ */
+void CProfiler::EndFrame(const double dElapsedTime)
+{
+	// Record the frame as a zone, so that the frames can be seen in the Chrome trace
+	const long long llFrameEnd = GetTime();
+	Record("Frame", llFrameStart, llFrameEnd, 0);
+
+	// Update the frame time percentiles
+	const double dFrameTime = dElapsedTime * 1000.0;
+	if (vFrameTimes.size() < NUM_FRAMES)
+		vFrameTimes.push_back(dFrameTime);
+	else
+		vFrameTimes[uiNextFrame] = dFrameTime;
+	uiNextFrame = (uiNextFrame + 1) % NUM_FRAMES;
+
+	vSortedFrameTimes.assign(vFrameTimes.begin(), vFrameTimes.end());
+	std::sort(vSortedFrameTimes.begin(), vSortedFrameTimes.end());
+	const size_t uiLast = vSortedFrameTimes.size() - 1;
+	dFrameTimeP50 = vSortedFrameTimes[(size_t)(uiLast * 0.50 + 0.5)];
+	dFrameTimeP95 = vSortedFrameTimes[(size_t)(uiLast * 0.95 + 0.5)];
+	dFrameTimeP99 = vSortedFrameTimes[(size_t)(uiLast * 0.99 + 0.5)];
+
+	// Sum the zones which ended in this frame. Only the events which are still in the ring buffer are counted.
+	for (unsigned int i = 0; i < vZoneStats.size(); i++)
+	{
+		vZoneStats[i].dFrameTime = 0.0;
+		vZoneStats[i].uiFrameCalls = 0;
+	}
+	const unsigned long long ullEndIndex = ullWriteIndex.load(std::memory_order_acquire);
+	if (ullEndIndex - ullFrameStartIndex > NUM_EVENTS)
+		ullFrameStartIndex = ullEndIndex - NUM_EVENTS;
+	Event sEvent;
+	for (unsigned long long ullIndex = ullFrameStartIndex; ullIndex < ullEndIndex; ullIndex++)
+	{
+		if (!ReadEvent(ullIndex, sEvent))
+			continue;
+
+		unsigned int uiZone = 0;
+		while ((uiZone < vZoneStats.size()) && (vZoneStats[uiZone].pName != sEvent.pName))
+			uiZone++;
+		if (uiZone == vZoneStats.size())
+		{
+			ZoneStats sZoneStats;
+			sZoneStats.pName = sEvent.pName;
+			sZoneStats.dFrameTime = 0.0;
+			sZoneStats.uiFrameCalls = 0;
+			sZoneStats.dAverageTime = 0.0;
+			vZoneStats.push_back(sZoneStats);
+		}
+		vZoneStats[uiZone].dFrameTime += sEvent.llDuration * 1e-6;
+		vZoneStats[uiZone].uiFrameCalls++;
+	}
+	// Average the zone times over about the last 30 frames
+	for (unsigned int i = 0; i < vZoneStats.size(); i++)
+		vZoneStats[i].dAverageTime += (vZoneStats[i].dFrameTime - vZoneStats[i].dAverageTime) / 30.0;
+
+	ullFrameStartIndex = ullEndIndex;
+	llFrameStart = llFrameEnd;
+}
+
+/**
+ @brief Get the median frame time over the last NUM_FRAMES frames in milliseconds
+ */
+double CProfiler::GetFrameTimeP50(void) const
+{
+	return dFrameTimeP50;
+}
+
+/**
+ @brief Get the 95th percentile frame time over the last NUM_FRAMES frames in milliseconds
+ */
+double CProfiler::GetFrameTimeP95(void) const
+{
+	return dFrameTimeP95;
+}
+
+/**
+ @brief Get the 99th percentile frame time over the last NUM_FRAMES frames in milliseconds
+ */
+double CProfiler::GetFrameTimeP99(void) const
+{
+	return dFrameTimeP99;
+}
+
+/**
+ @brief Get the time of each zone over the recent frames, in the order in which they were first recorded
+ */
+const std::vector<CProfiler::ZoneStats>& CProfiler::GetZoneStats(void) const
+{
+	return vZoneStats;
+}
+
+/**
+ @brief Get the number of zones which were recorded, including the ones which were overwritten in the ring buffer
+ */
+unsigned long long CProfiler::GetNumEvents(void) const
+{
+	return ullWriteIndex.load(std::memory_order_relaxed);
+}
+
+/**
+ @brief Write the zones in the ring buffer to a Chrome trace file, which can be opened in chrome://tracing
+ @param filename The name of the file to write
+ @return A bool value. true if the file was written, else false
+ */
+bool CProfiler::WriteChromeTrace(const std::string& filename) const
+{
+	ofstream outFile(filename.c_str());
+	if (!outFile.is_open())
+	{
+		cout << "Unable to write the Chrome trace to " << filename << endl;
+		return false;
+	}
+
+	outFile << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[" << endl;
+	bool bFirst = true;
+
+	// Name the threads
+	unsigned int uiNumNamedThreads = uiNumThreads.load(std::memory_order_relaxed);
+	if (uiNumNamedThreads > MAX_THREADS)
+		uiNumNamedThreads = MAX_THREADS;
+	for (unsigned int i = 0; i < uiNumNamedThreads; i++)
+	{
+		if (arrThreadNames[i] == nullptr)
+			continue;
+		outFile << (bFirst ? "" : ",\n")
+				<< "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << i
+				<< ",\"args\":{\"name\":\"" << arrThreadNames[i] << "\"}}";
+		bFirst = false;
+	}
+
+	// Write the complete events with their times in microseconds
+	const unsigned long long ullEndIndex = ullWriteIndex.load(std::memory_order_acquire);
+	const unsigned long long ullStartIndex = (ullEndIndex > NUM_EVENTS ? ullEndIndex - NUM_EVENTS : 0);
+	unsigned int uiNumWritten = 0;
+	Event sEvent;
+	outFile.setf(ios::fixed);
+	outFile.precision(3);
+	for (unsigned long long ullIndex = ullStartIndex; ullIndex < ullEndIndex; ullIndex++)
+	{
+		if (!ReadEvent(ullIndex, sEvent))
+			continue;
+
+		outFile << (bFirst ? "" : ",\n")
+				<< "{\"name\":\"" << sEvent.pName
+				<< "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << sEvent.uiThread
+				<< ",\"ts\":" << sEvent.llStart * 1e-3
+				<< ",\"dur\":" << sEvent.llDuration * 1e-3 << "}";
+		bFirst = false;
+		uiNumWritten++;
+	}
+	outFile << endl << "]}" << endl;
+
+	cout << "Wrote " << uiNumWritten << " zones to the Chrome trace " << filename << endl;
+	return true;
+}
+
+/**
+ @brief PrintSelf
+ */
+void CProfiler::PrintSelf(void) const
+{
+	cout << "CProfiler::PrintSelf()" << endl;
+	cout << "Frame time p50: " << dFrameTimeP50 << " ms, p95: " << dFrameTimeP95 << " ms, p99: " << dFrameTimeP99 << " ms" << endl;
+	for (unsigned int i = 0; i < vZoneStats.size(); i++)
+		cout << vZoneStats[i].pName << ": " << vZoneStats[i].dAverageTime << " ms" << endl;
+}
+
+/**
+ @brief Copy the event at an index if it was written completely and is not overwritten
+ @param ullIndex The index of the event
+ @param sEvent The copy of the event
+ @return A bool value. true if the event was copied, else false
+ */
+bool CProfiler::ReadEvent(const unsigned long long ullIndex, Event& sEvent) const
+{
+	const unsigned int uiSlot = (unsigned int)(ullIndex & (NUM_EVENTS - 1));
+	const unsigned long long ullSequence = 2 * (ullIndex + 1);
+	if (arrSequences[uiSlot].load(std::memory_order_acquire) != ullSequence)
+		return false;
+	sEvent = arrEvents[uiSlot];
+	// Check that the slot was not overwritten while it was copied
+	std::atomic_thread_fence(std::memory_order_acquire);
+	return (arrSequences[uiSlot].load(std::memory_order_relaxed) == ullSequence);
+}
+
+/**
+ @brief Constructor which starts the zone
+ @param pName The name of the zone, which must stay valid while the profiler is used
+ */
+CProfileZone::CProfileZone(const char* pName)
+	: pName(pName)
+	, llStart(CProfiler::GetInstance()->GetTime())
+	, uiDepth(uiThreadDepth++)
+{
+}
+
+/**
+ @brief Destructor which ends and records the zone
+ */
+CProfileZone::~CProfileZone(void)
+{
+	uiThreadDepth--;
+	CProfiler* cProfiler = CProfiler::GetInstance();
+	cProfiler->Record(pName, llStart, cProfiler->GetTime(), uiDepth);
+}
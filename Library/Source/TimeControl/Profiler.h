@@ -0,0 +1,153 @@
+/**
+ CProfiler
+ @brief A profiler which records scoped zones from any thread into a lock-free ring buffer.
+		The zones are added with PROFILE_ZONE, and only exist when ENABLE_PROFILER is defined,
+		so that they cost nothing when the profiler is compiled out.
+		It keeps the frame time percentiles and the time of each zone over the recent frames,
+		and writes the zones in the ring buffer to a Chrome trace file, which can be opened in chrome://tracing.
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#pragma once
+
+// Include SingletonTemplate
+#include "../DesignPatterns/SingletonTemplate.h"
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#ifdef ENABLE_PROFILER
+	#define PROFILE_CONCAT_INNER(a, b) a##b
+	#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+	// Record the time from here to the end of the scope as a zone. The name must be a string literal.
+	#define PROFILE_ZONE(name) CProfileZone PROFILE_CONCAT(cProfileZone, __LINE__)(name)
+	// Record the time from here to the end of the function as a zone named after the function
+	#define PROFILE_FUNCTION() PROFILE_ZONE(__FUNCTION__)
+	// End a frame, which took dElapsedTime seconds
+	#define PROFILE_END_FRAME(dElapsedTime) CProfiler::GetInstance()->EndFrame(dElapsedTime)
+	// Name the calling thread in the Chrome trace. The name must be a string literal.
+	#define PROFILE_THREAD_NAME(name) CProfiler::GetInstance()->SetThreadName(name)
+#else
+	#define PROFILE_ZONE(name)
+	#define PROFILE_FUNCTION()
+	#define PROFILE_END_FRAME(dElapsedTime)
+	#define PROFILE_THREAD_NAME(name)
+#endif
+
+class CProfiler : public CSingletonTemplate<CProfiler>
+{
+	friend CSingletonTemplate<CProfiler>;
+public:
+	// The number of zones which the ring buffer holds. It must be a power of 2.
+	static const unsigned int NUM_EVENTS = 1 << 16;
+	// The number of frames which the frame time percentiles are computed over
+	static const unsigned int NUM_FRAMES = 300;
+	// The most threads which can be named
+	static const unsigned int MAX_THREADS = 64;
+
+	// The time of a zone over the recent frames
+	struct ZoneStats
+	{
+		const char* pName;
+		// The time in milliseconds and the number of calls in the last frame
+		double dFrameTime;
+		unsigned int uiFrameCalls;
+		// The time in milliseconds per frame, averaged over the recent frames
+		double dAverageTime;
+	};
+
+	// Get the time in nanoseconds since this class instance was created
+	long long GetTime(void) const;
+	// Get the index of the calling thread, which is given out when a thread first records a zone
+	unsigned int GetThreadIndex(void);
+	// Name the calling thread in the Chrome trace. The name must stay valid while the profiler is used.
+	void SetThreadName(const char* pName);
+
+	// Record a zone. This is called by CProfileZone, and may be called from any thread.
+	void Record(const char* pName, const long long llStart, const long long llEnd, const unsigned int uiDepth);
+
+	// End a frame, which took dElapsedTime seconds. It updates the frame time percentiles and the zone times.
+	void EndFrame(const double dElapsedTime);
+
+	// Get a frame time percentile over the last NUM_FRAMES frames in milliseconds
+	double GetFrameTimeP50(void) const;
+	double GetFrameTimeP95(void) const;
+	double GetFrameTimeP99(void) const;
+	// Get the time of each zone over the recent frames, in the order in which they were first recorded
+	const std::vector<ZoneStats>& GetZoneStats(void) const;
+	// Get the number of zones which were recorded, including the ones which were overwritten in the ring buffer
+	unsigned long long GetNumEvents(void) const;
+
+	// Write the zones in the ring buffer to a Chrome trace file
+	bool WriteChromeTrace(const std::string& filename) const;
+
+	// PrintSelf
+	void PrintSelf(void) const;
+
+protected:
+	typedef std::chrono::steady_clock Clock;
+
+	// A recorded zone
+	struct Event
+	{
+		const char* pName;
+		// The start time and duration in nanoseconds
+		long long llStart;
+		long long llDuration;
+		unsigned int uiThread;
+		unsigned int uiDepth;
+	};
+
+	// Constructor
+	CProfiler(void);
+	// Destructor
+	virtual ~CProfiler(void);
+
+	// Copy the event at an index if it was written completely and is not overwritten, else return false
+	bool ReadEvent(const unsigned long long ullIndex, Event& sEvent) const;
+
+	// The time which the timestamps are measured from
+	Clock::time_point startTime;
+
+	// The ring buffer of events. Each slot has a sequence number, which is odd while the slot is written,
+	// and 2 * (index + 1) after the event at that index was written, so that a reader can skip a torn event.
+	Event arrEvents[NUM_EVENTS];
+	std::atomic<unsigned long long> arrSequences[NUM_EVENTS];
+	// The index of the next event to write
+	std::atomic<unsigned long long> ullWriteIndex;
+
+	// The number of threads which were given an index, and their names
+	std::atomic<unsigned int> uiNumThreads;
+	const char* arrThreadNames[MAX_THREADS];
+
+	// The frame times in milliseconds over the last NUM_FRAMES frames, and a copy which is sorted to find the percentiles
+	std::vector<double> vFrameTimes;
+	std::vector<double> vSortedFrameTimes;
+	unsigned int uiNextFrame;
+	double dFrameTimeP50, dFrameTimeP95, dFrameTimeP99;
+
+	// The time of each zone, and the index of the first event and the start time of the current frame
+	std::vector<ZoneStats> vZoneStats;
+	unsigned long long ullFrameStartIndex;
+	long long llFrameStart;
+};
+
+/**
+ CProfileZone
+ @brief Records the time from its construction to its destruction as a zone in CProfiler
+ */
+class CProfileZone
+{
+public:
+	// Constructor
+	explicit CProfileZone(const char* pName);
+	// Destructor
+	~CProfileZone(void);
+
+protected:
+	const char* pName;
+	long long llStart;
+	unsigned int uiDepth;
+};
@@ -1,47 +1,73 @@
 #include "StopWatch.h"
 
-#define TARGET_RESOLUTION 1         // 1-millisecond target resolution
+#include <algorithm>
+#include <thread>
 
-/**
-@brief Constructor
-*/
-CStopWatch::CStopWatch(void)
-{
-	QueryPerformanceFrequency(&frequency);
+#ifdef _WIN32
+	#ifndef NOMINMAX
+	#define NOMINMAX
+	#endif
+	#include <windows.h>
+	#pragma comment(lib, "winmm.lib")
+#else
+	#include <time.h>
+	#include <errno.h>
+#endif
 
-	TIMECAPS tc;
+const double CStopWatch::MIN_SPIN_TIME = 0.25;
+const double CStopWatch::MAX_SPIN_TIME = 2.0;
 
-	if (timeGetDevCaps(&tc, sizeof(TIMECAPS)) != TIMERR_NOERROR)
+#ifdef _WIN32
+/**
+ @brief Sets the resolution of Sleep to 1 millisecond while the program runs
+ */
+struct CTimerResolution
+{
+	CTimerResolution(void)
+	{
+		timeBeginPeriod(1);
+	}
+	~CTimerResolution(void)
 	{
-		// Error; application can't continue.
+		timeEndPeriod(1);
 	}
+};
+#endif
 
-	wTimerRes = min(max(tc.wPeriodMin, TARGET_RESOLUTION), tc.wPeriodMax);
-	timeBeginPeriod(wTimerRes);
+/**
+@brief Constructor
+*/
+CStopWatch::CStopWatch(void)
+	: dSpinThreshold(MIN_SPIN_TIME)
+	, dSleepTime(0.0)
+	, dSpinTime(0.0)
+{
+	prevTime = currTime = Clock::now();
 }
 
 /**
 @brief Destructor
-*/ 
+*/
 CStopWatch::~CStopWatch(void)
 {
-	StopTimer();
 }
 
 /**
 @brief Initialise this class instance
 */
-void Init(void)
+void CStopWatch::Init(void)
 {
-
+	dSpinThreshold = MIN_SPIN_TIME;
+	ResetWaitTimes();
+	StartTimer();
 }
 
 /**
 @brief Start Timer
-*/ 
+*/
 void CStopWatch::StartTimer(void)
 {
-	QueryPerformanceCounter(&prevTime);
+	prevTime = Clock::now();
 }
 
 
@@ -50,45 +76,148 @@ void CStopWatch::StartTimer(void)
  */
 void CStopWatch::StopTimer(void)
 {
-	timeEndPeriod(wTimerRes);
+	currTime = Clock::now();
 }
 
 /**
  @brief Get elapsed time in seconds since the last call to this function
- */ 
+ */
 double CStopWatch::GetElapsedTime(void)
 {
-	LARGE_INTEGER time;
-	QueryPerformanceCounter(&currTime);
-	time.QuadPart = currTime.QuadPart - prevTime.QuadPart;
+	currTime = Clock::now();
+	const double dTime = ToMilliseconds(currTime - prevTime) * 0.001;
 	prevTime = currTime;
-	return LIToSecs(time);
+	return dTime;
+}
+
+/**
+ @brief Wait until this time in milliseconds has passed since the timer was started or last read.
+		It sleeps for most of the wait, and spins for the last fraction of a millisecond
+		so that the deadline is not overshot by the resolution of the OS scheduler.
+ @param dTime The time in milliseconds
+ */
+void CStopWatch::WaitUntil(const double dTime)
+{
+	const Clock::time_point deadline = prevTime + std::chrono::duration_cast<Clock::duration>(
+		std::chrono::duration<double, std::milli>(dTime));
+
+	Clock::time_point now = Clock::now();
+	if (now >= deadline)
+		return;
+
+	// Sleep until the spin threshold before the deadline
+	const Clock::time_point sleepTarget = deadline - std::chrono::duration_cast<Clock::duration>(
+		std::chrono::duration<double, std::milli>(dSpinThreshold));
+	if (now < sleepTarget)
+	{
+		SleepUntil(sleepTarget);
+		const Clock::time_point wakeTime = Clock::now();
+		dSleepTime += ToMilliseconds(wakeTime - now);
+
+		// Spin for longer if the sleep overshot into the spin, and let it shrink back slowly otherwise
+		const double dOvershoot = ToMilliseconds(wakeTime - sleepTarget);
+		if (dOvershoot > dSpinThreshold)
+			dSpinThreshold = std::min(MAX_SPIN_TIME, dOvershoot * 1.5);
+		else
+			dSpinThreshold = std::max(MIN_SPIN_TIME, dSpinThreshold * 0.99);
+		now = wakeTime;
+	}
+
+	// Spin for the rest of the wait
+	const Clock::time_point spinStart = now;
+	while (now < deadline)
+	{
+		std::this_thread::yield();
+		now = Clock::now();
+	}
+	dSpinTime += ToMilliseconds(now - spinStart);
+}
+
+/**
+ @brief Get the time in milliseconds which WaitUntil spent sleeping since the last ResetWaitTimes
+ */
+double CStopWatch::GetSleepTime(void) const
+{
+	return dSleepTime;
 }
 
 /**
- @brief Wait until this time in milliseconds has passed
+ @brief Get the time in milliseconds which WaitUntil spent spinning since the last ResetWaitTimes
  */
-void CStopWatch::WaitUntil(const long long llTime)
+double CStopWatch::GetSpinTime(void) const
 {
-	LARGE_INTEGER nowTime;
-	LONGLONG timeElapsed;
-	while (true)
+	return dSpinTime;
+}
+
+/**
+ @brief Reset the sleeping and spinning times
+ */
+void CStopWatch::ResetWaitTimes(void)
+{
+	dSleepTime = 0.0;
+	dSpinTime = 0.0;
+}
+
+/**
+ @brief Get the CPU time used by all the threads of this process in seconds
+ */
+double CStopWatch::GetProcessTime(void)
+{
+#ifdef _WIN32
+	FILETIME ftCreation, ftExit, ftKernel, ftUser;
+	if (!GetProcessTimes(GetCurrentProcess(), &ftCreation, &ftExit, &ftKernel, &ftUser))
+		return 0.0;
+	ULARGE_INTEGER uliKernel, uliUser;
+	uliKernel.LowPart = ftKernel.dwLowDateTime;
+	uliKernel.HighPart = ftKernel.dwHighDateTime;
+	uliUser.LowPart = ftUser.dwLowDateTime;
+	uliUser.HighPart = ftUser.dwHighDateTime;
+	// FILETIME is in 100 nanosecond units
+	return (double)(uliKernel.QuadPart + uliUser.QuadPart) * 1e-7;
+#else
+	struct timespec ts;
+	if (clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts) != 0)
+		return 0.0;
+	return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+#endif
+}
+
+/**
+ @brief Sleep until a time, which may be overshot by the resolution of the OS scheduler
+ @param time The time to wake up at
+ */
+void CStopWatch::SleepUntil(const Clock::time_point& time)
+{
+#ifdef _WIN32
+	// Sleep is only as fine as the timer resolution, which is 15.6 ms unless it is raised
+	static CTimerResolution cTimerResolution;
+
+	const double dTime = ToMilliseconds(time - Clock::now());
+	if (dTime >= 1.0)
+		Sleep((DWORD)dTime);
+#else
+	long long llTime = std::chrono::duration_cast<std::chrono::nanoseconds>(time - Clock::now()).count();
+	if (llTime <= 0)
+		return;
+
+	// Sleep until an absolute time, so that a sleep which is interrupted by a signal can be resumed
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	llTime += ts.tv_nsec;
+	ts.tv_sec += (time_t)(llTime / 1000000000LL);
+	ts.tv_nsec = (long)(llTime % 1000000000LL);
+	while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR)
 	{
-		QueryPerformanceCounter(&nowTime);
-		timeElapsed = ((nowTime.QuadPart - prevTime.QuadPart) * 1000 / frequency.QuadPart);
-		if (timeElapsed > llTime)
-			return;
-		else if (llTime - timeElapsed > 1)
-			Sleep(1);
 	}
+#endif
 }
 
 /**
- @brief Convert from Large Integer to seconds in double
- @param L A LARGE_INTEGER & containing the time value
- @return The time in seconds unit and in double data type
+ @brief Convert from a duration to milliseconds in double
+ @param duration The duration
+ @return The duration in milliseconds unit and in double data type
  */
-double CStopWatch::LIToSecs(LARGE_INTEGER & L)
+double CStopWatch::ToMilliseconds(const Clock::duration& duration)
 {
-	return ((double)L.QuadPart / (double)frequency.QuadPart);
+	return std::chrono::duration<double, std::milli>(duration).count();
 }
@@ -5,17 +5,21 @@
  */
 #pragma once
 
-#include <windows.h>
+#include <chrono>
 
 class CStopWatch
 {
 public:
+	// The least and most time before a deadline in milliseconds which WaitUntil spins for instead of sleeping
+	static const double MIN_SPIN_TIME;
+	static const double MAX_SPIN_TIME;
+
 	// Constructor
 	CStopWatch(void);
 
 	// Destructor
 	~CStopWatch(void);
-	
+
 	// Initialise this class instance
 	void Init(void);
 
@@ -28,14 +32,31 @@ public:
 	// Get elapsed time in seconds since the last call to this function
 	double GetElapsedTime(void);
 
-	// Wait until this time in milliseconds has passed
-	void WaitUntil(const long long llTime);
+	// Wait until this time in milliseconds has passed since the timer was started or last read
+	void WaitUntil(const double dTime);
+
+	// Get the time in milliseconds which WaitUntil spent sleeping and spinning since the last ResetWaitTimes
+	double GetSleepTime(void) const;
+	double GetSpinTime(void) const;
+	// Reset the sleeping and spinning times
+	void ResetWaitTimes(void);
+
+	// Get the CPU time used by all the threads of this process in seconds
+	static double GetProcessTime(void);
 
 protected:
-	LARGE_INTEGER frequency;
-	LARGE_INTEGER prevTime, currTime;
-	UINT     wTimerRes;
+	typedef std::chrono::steady_clock Clock;
+
+	Clock::time_point prevTime, currTime;
+
+	// The time before a deadline in milliseconds which WaitUntil spins for. It grows when a sleep overshoots.
+	double dSpinThreshold;
+	// The time in milliseconds which WaitUntil spent sleeping and spinning
+	double dSleepTime;
+	double dSpinTime;
 
-	// Convert from Large Integer to seconds in double
-	double LIToSecs(LARGE_INTEGER & L);
+	// Sleep until a time, which may be overshot by the resolution of the OS scheduler
+	static void SleepUntil(const Clock::time_point& time);
+	// Convert from a duration to milliseconds in double
+	static double ToMilliseconds(const Clock::duration& duration);
 };
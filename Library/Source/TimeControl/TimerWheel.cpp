@@ -0,0 +1,232 @@
+/**
+ CTimerWheel
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#include "TimerWheel.h"
+
+#include <cmath>
+
+// Allows for the rounding of the times, so that a delay of a whole number of ticks is not rounded up to the next tick
+static const double TICK_EPSILON = 1e-6;
+
+const int CTimerWheel::NONE;
+
+/**
+ @brief Constructor
+ */
+CTimerWheel::CTimerWheel(void)
+	: dTickLength(1.0 / 60.0)
+	, dTime(0.0)
+	, ullNow(0)
+	, iFirstFree(NONE)
+	, uiNumTimers(0)
+{
+	vSlots.assign(NUM_LEVELS * NUM_SLOTS, NONE);
+}
+
+/**
+ @brief Destructor
+ */
+CTimerWheel::~CTimerWheel(void)
+{
+}
+
+/**
+ @brief Initialise this class instance. It removes all the timers.
+ @param dTickLength The length of a tick in seconds. The timers expire on the first tick after their delay.
+ */
+void CTimerWheel::Init(const double dTickLength)
+{
+	this->dTickLength = (dTickLength > 0.0 ? dTickLength : 1.0 / 60.0);
+	Clear();
+}
+
+/**
+ @brief Add a timer
+ @param dDelay The time in seconds until the timer expires. It expires on the next tick if it is not more than a tick.
+ @param uiPayload The value which is returned by Advance when the timer expires
+ @return The handle of the timer, which is never 0
+ */
+unsigned int CTimerWheel::Add(const double dDelay, const unsigned int uiPayload)
+{
+	int iTimer = iFirstFree;
+	if (iTimer != NONE)
+	{
+		iFirstFree = vTimers[iTimer].iNext;
+	}
+	else
+	{
+		iTimer = (int)vTimers.size();
+		vTimers.push_back(Timer());
+	}
+
+	const double dTicks = ceil(dDelay / dTickLength - TICK_EPSILON);
+	Timer& sTimer = vTimers[iTimer];
+	sTimer.ullExpiry = ullNow + (dTicks > 1.0 ? (unsigned long long)dTicks : 1);
+	sTimer.uiPayload = uiPayload;
+	Schedule(iTimer);
+	uiNumTimers++;
+
+	return (unsigned int)iTimer + 1;
+}
+
+/**
+ @brief Cancel a timer which has not expired
+ @param uiHandle The handle which Add returned. It is ignored if it is 0, or if the timer is free.
+ */
+void CTimerWheel::Cancel(const unsigned int uiHandle)
+{
+	const int iTimer = (int)uiHandle - 1;
+	if ((uiHandle == 0) || (iTimer >= (int)vTimers.size()) || (vTimers[iTimer].iSlot == NONE))
+		return;
+
+	Unlink(iTimer);
+	vTimers[iTimer].iNext = iFirstFree;
+	iFirstFree = iTimer;
+	uiNumTimers--;
+}
+
+/**
+ @brief Remove all the timers, and start counting the time from 0
+ */
+void CTimerWheel::Clear(void)
+{
+	vTimers.clear();
+	vSlots.assign(NUM_LEVELS * NUM_SLOTS, NONE);
+	iFirstFree = NONE;
+	uiNumTimers = 0;
+	dTime = 0.0;
+	ullNow = 0;
+}
+
+/**
+ @brief Advance the time, and run the ticks which it passed
+ @param dElapsedTime The time in seconds since the last call
+ @param vExpired The payloads of the timers which expired are added to it, in the order they expired
+ */
+void CTimerWheel::Advance(const double dElapsedTime, std::vector<unsigned int>& vExpired)
+{
+	dTime += dElapsedTime;
+	const unsigned long long ullTarget = (unsigned long long)floor(dTime / dTickLength + TICK_EPSILON);
+
+	// Without timers, no tick has any work to do
+	if (uiNumTimers == 0)
+	{
+		if (ullTarget > ullNow)
+			ullNow = ullTarget;
+		return;
+	}
+
+	while (ullNow < ullTarget)
+		Tick(vExpired);
+}
+
+/**
+ @brief Get the number of timers which have not expired
+ */
+unsigned int CTimerWheel::GetNumTimers(void) const
+{
+	return uiNumTimers;
+}
+
+/**
+ @brief Put a timer into the slot of its expiry. The level is chosen by the time until the expiry,
+		so a timer never goes into a slot which the wheel has passed in this round.
+ @param iTimer The index of the timer
+ */
+void CTimerWheel::Schedule(const int iTimer)
+{
+	Timer& sTimer = vTimers[iTimer];
+	const unsigned long long ullDelta = (sTimer.ullExpiry > ullNow ? sTimer.ullExpiry - ullNow : 0);
+	const unsigned long long ullExpiry = ullNow + ullDelta;
+
+	unsigned int uiLevel = 0;
+	while ((uiLevel + 1 < NUM_LEVELS) && (ullDelta >= (1ULL << (NUM_SLOT_BITS * (uiLevel + 1)))))
+		uiLevel++;
+
+	unsigned int uiSlot;
+	if (ullDelta >= (1ULL << (NUM_SLOT_BITS * NUM_LEVELS)))
+	{
+		// Beyond the span of the wheel. Wait in the last slot of the top level which is reached before it wraps.
+		uiSlot = (unsigned int)((ullNow >> (NUM_SLOT_BITS * uiLevel)) + NUM_SLOTS - 1) & (NUM_SLOTS - 1);
+	}
+	else
+	{
+		uiSlot = (unsigned int)(ullExpiry >> (NUM_SLOT_BITS * uiLevel)) & (NUM_SLOTS - 1);
+	}
+
+	const int iSlot = (int)(uiLevel * NUM_SLOTS + uiSlot);
+	sTimer.iSlot = iSlot;
+	sTimer.iPrev = NONE;
+	sTimer.iNext = vSlots[iSlot];
+	if (sTimer.iNext != NONE)
+		vTimers[sTimer.iNext].iPrev = iTimer;
+	vSlots[iSlot] = iTimer;
+}
+
+/**
+ @brief Remove a timer from its slot
+ @param iTimer The index of the timer
+ */
+void CTimerWheel::Unlink(const int iTimer)
+{
+	Timer& sTimer = vTimers[iTimer];
+	if (sTimer.iPrev != NONE)
+		vTimers[sTimer.iPrev].iNext = sTimer.iNext;
+	else
+		vSlots[sTimer.iSlot] = sTimer.iNext;
+	if (sTimer.iNext != NONE)
+		vTimers[sTimer.iNext].iPrev = sTimer.iPrev;
+	sTimer.iPrev = sTimer.iNext = sTimer.iSlot = NONE;
+}
+
+/**
+ @brief Move the timers of the current slot of a level to the slots of their expiry, in the levels below it
+ @param uiLevel The level
+ */
+void CTimerWheel::Cascade(const unsigned int uiLevel)
+{
+	const unsigned int uiSlot = (unsigned int)(ullNow >> (NUM_SLOT_BITS * uiLevel)) & (NUM_SLOTS - 1);
+	int iTimer = vSlots[uiLevel * NUM_SLOTS + uiSlot];
+	vSlots[uiLevel * NUM_SLOTS + uiSlot] = NONE;
+	while (iTimer != NONE)
+	{
+		const int iNext = vTimers[iTimer].iNext;
+		Schedule(iTimer);
+		iTimer = iNext;
+	}
+}
+
+/**
+ @brief Run a tick. When a level wraps around, the next slot of the level above it is moved down first.
+ @param vExpired The payloads of the timers which expired are added to it
+ */
+void CTimerWheel::Tick(std::vector<unsigned int>& vExpired)
+{
+	ullNow++;
+
+	for (unsigned int uiLevel = 1; uiLevel < NUM_LEVELS; uiLevel++)
+	{
+		if ((ullNow & ((1ULL << (NUM_SLOT_BITS * uiLevel)) - 1)) != 0)
+			break;
+		Cascade(uiLevel);
+	}
+
+	const int iSlot = (int)(ullNow & (NUM_SLOTS - 1));
+	int iTimer = vSlots[iSlot];
+	vSlots[iSlot] = NONE;
+	while (iTimer != NONE)
+	{
+		Timer& sTimer = vTimers[iTimer];
+		const int iNext = sTimer.iNext;
+		vExpired.push_back(sTimer.uiPayload);
+
+		sTimer.iPrev = sTimer.iSlot = NONE;
+		sTimer.iNext = iFirstFree;
+		iFirstFree = iTimer;
+		uiNumTimers--;
+
+		iTimer = iNext;
+	}
+}
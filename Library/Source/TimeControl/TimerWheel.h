@@ -0,0 +1,81 @@
+/**
+ CTimerWheel
+ @brief A hierarchical timer wheel, which runs many timers with the cost of the timers which expire.
+		Time is counted in ticks. Each level has 64 slots, and a slot of a level spans all the slots of the level
+		below it. A timer is put in the slot of the level whose span holds its expiry, and it is moved down a level
+		when the wheel reaches that slot, so that it is touched at most once per level before it expires.
+		Adding and cancelling a timer take constant time.
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#pragma once
+
+#include <vector>
+
+class CTimerWheel
+{
+public:
+	// The number of slots in each level, and the number of levels
+	static const unsigned int NUM_SLOT_BITS = 6;
+	static const unsigned int NUM_SLOTS = 1 << NUM_SLOT_BITS;
+	static const unsigned int NUM_LEVELS = 4;
+
+	// Constructor
+	CTimerWheel(void);
+
+	// Destructor
+	~CTimerWheel(void);
+
+	// Initialise this class instance, with the length of a tick in seconds
+	void Init(const double dTickLength);
+
+	// Add a timer which expires after dDelay seconds. It returns the handle of the timer, which is never 0.
+	unsigned int Add(const double dDelay, const unsigned int uiPayload);
+	// Cancel a timer which has not expired. The handle must not be used after that.
+	void Cancel(const unsigned int uiHandle);
+	// Remove all the timers
+	void Clear(void);
+
+	// Advance the time, and add the payloads of the timers which expired to vExpired, in the order they expired
+	void Advance(const double dElapsedTime, std::vector<unsigned int>& vExpired);
+
+	// Get the number of timers which have not expired
+	unsigned int GetNumTimers(void) const;
+
+protected:
+	// A timer, which is in the list of a slot, or in the list of free timers
+	struct Timer
+	{
+		unsigned long long ullExpiry;
+		unsigned int uiPayload;
+		// The previous and next timer in the list, or NONE
+		int iPrev;
+		int iNext;
+		// The index of the slot in vSlots, or NONE if it is free
+		int iSlot;
+	};
+
+	static const int NONE = -1;
+
+	// The length of a tick in seconds
+	double dTickLength;
+	// The time which has passed in seconds, and the number of ticks which were run
+	double dTime;
+	unsigned long long ullNow;
+
+	// The timers, and the first free timer
+	std::vector<Timer> vTimers;
+	int iFirstFree;
+	unsigned int uiNumTimers;
+	// The first timer of each slot, with the slots of level 0 first
+	std::vector<int> vSlots;
+
+	// Put a timer into the slot of its expiry
+	void Schedule(const int iTimer);
+	// Remove a timer from its slot
+	void Unlink(const int iTimer);
+	// Move the timers of a slot to the slots of their expiry
+	void Cascade(const unsigned int uiLevel);
+	// Run a tick, and add the payloads of the timers which expired to vExpired
+	void Tick(std::vector<unsigned int>& vExpired);
+};
@@ -0,0 +1,309 @@
+/**
+ CTexturePacker
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#include "TexturePacker.h"
+
+#include <cstring>
+#include <cctype>
+#include <fstream>
+#include <iostream>
+using namespace std;
+
+// STB Image
+#define STB_IMAGE_IMPLEMENTATION
+#include <includes/stb_image.h>
+
+#ifdef _WIN32
+	#include <windows.h>
+#else
+	#include <dirent.h>
+	#include <sys/stat.h>
+#endif
+
+/**
+ @brief Constructor
+ */
+CTexturePacker::CTexturePacker(void)
+	: bFlip(true)
+	, bMipmaps(true)
+{
+}
+
+/**
+ @brief Destructor
+ */
+CTexturePacker::~CTexturePacker(void)
+{
+}
+
+/**
+ @brief Flip the images vertically, as CImageLoader::Load does when bInvert is true.
+		The game only uses a packed image when it loads it with the same orientation.
+ */
+void CTexturePacker::SetFlip(const bool bFlip)
+{
+	this->bFlip = bFlip;
+}
+
+/**
+ @brief Compute the mipmap levels of the images, so that the game does not call glGenerateMipmap
+ */
+void CTexturePacker::SetMipmaps(const bool bMipmaps)
+{
+	this->bMipmaps = bMipmaps;
+}
+
+/**
+ @brief Add the image files in a directory of the assets and its subdirectories
+ @param sAssetDirectory The directory of the assets, which the game loads its files from
+ @param sSubDirectory The directory to add, relative to sAssetDirectory, e.g. "Image"
+ @return false if the directory could not be read
+ */
+bool CTexturePacker::AddDirectory(const std::string& sAssetDirectory, const std::string& sSubDirectory)
+{
+	const std::string sDirectory = sAssetDirectory + "/" + sSubDirectory;
+	std::vector<std::string> vFiles, vDirectories;
+
+#ifdef _WIN32
+	WIN32_FIND_DATAA sFindData;
+	HANDLE hFind = FindFirstFileA((sDirectory + "/*").c_str(), &sFindData);
+	if (hFind == INVALID_HANDLE_VALUE)
+	{
+		cout << "Unable to read " << sDirectory << endl;
+		return false;
+	}
+	do
+	{
+		const std::string sName = sFindData.cFileName;
+		if ((sName == ".") || (sName == ".."))
+			continue;
+		if (sFindData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+			vDirectories.push_back(sName);
+		else
+			vFiles.push_back(sName);
+	} while (FindNextFileA(hFind, &sFindData));
+	FindClose(hFind);
+#else
+	DIR* pDir = opendir(sDirectory.c_str());
+	if (pDir == NULL)
+	{
+		cout << "Unable to read " << sDirectory << endl;
+		return false;
+	}
+	while (struct dirent* pEntry = readdir(pDir))
+	{
+		const std::string sName = pEntry->d_name;
+		if ((sName == ".") || (sName == ".."))
+			continue;
+		struct stat sStat;
+		if (stat((sDirectory + "/" + sName).c_str(), &sStat) != 0)
+			continue;
+		if (S_ISDIR(sStat.st_mode))
+			vDirectories.push_back(sName);
+		else
+			vFiles.push_back(sName);
+	}
+	closedir(pDir);
+#endif
+
+	for (unsigned int i = 0; i < vFiles.size(); i++)
+	{
+		if (IsImageFile(vFiles[i]) == false)
+			continue;
+
+		SourceImage sSource;
+		sSource.sPath = sDirectory + "/" + vFiles[i];
+		// Normalise the name as CAssetManager::NormalisePath does
+		sSource.sName = sSubDirectory + "/" + vFiles[i];
+		for (unsigned int j = 0; j < sSource.sName.size(); j++)
+		{
+			if (sSource.sName[j] == '\\')
+				sSource.sName[j] = '/';
+			else
+				sSource.sName[j] = (char)tolower((unsigned char)sSource.sName[j]);
+		}
+		vSourceImages.push_back(sSource);
+	}
+
+	for (unsigned int i = 0; i < vDirectories.size(); i++)
+	{
+		if (AddDirectory(sAssetDirectory, sSubDirectory + "/" + vDirectories[i]) == false)
+			return false;
+	}
+	return true;
+}
+
+/**
+ @brief Decode the added image files and write them into a texture pack
+ @param sFilename The file name of the texture pack
+ @return false if an image could not be decoded or the pack could not be written
+ */
+bool CTexturePacker::Write(const std::string& sFilename)
+{
+	// Decode the images
+	std::vector<PackedImage> vImages(vSourceImages.size());
+	for (unsigned int i = 0; i < vSourceImages.size(); i++)
+	{
+		if (Decode(vSourceImages[i], vImages[i]) == false)
+			return false;
+	}
+
+	// Lay out the pixels after the header and the index
+	unsigned int uiOffset = AlignTexturePackOffset(
+		(unsigned int)(sizeof(TexturePackHeader) + vImages.size() * sizeof(TexturePackEntry)));
+	for (unsigned int i = 0; i < vImages.size(); i++)
+	{
+		vImages[i].sEntry.uiDataOffset = uiOffset;
+		for (unsigned int uiLevel = 0; uiLevel < vImages[i].vLevels.size(); uiLevel++)
+			uiOffset = AlignTexturePackOffset(uiOffset + (unsigned int)vImages[i].vLevels[uiLevel].size());
+	}
+
+	TexturePackHeader sHeader;
+	memcpy(sHeader.acMagic, TEXTURE_PACK_MAGIC, 4);
+	sHeader.uiVersion = TEXTURE_PACK_VERSION;
+	sHeader.uiNumEntries = (unsigned int)vImages.size();
+	sHeader.uiFileSize = uiOffset;
+
+	std::ofstream file(sFilename.c_str(), std::ios::binary | std::ios::trunc);
+	if (!file.is_open())
+	{
+		cout << "Unable to write " << sFilename << endl;
+		return false;
+	}
+
+	file.write((const char*)&sHeader, sizeof(sHeader));
+	for (unsigned int i = 0; i < vImages.size(); i++)
+		file.write((const char*)&vImages[i].sEntry, sizeof(TexturePackEntry));
+
+	const char acPadding[TEXTURE_PACK_ALIGNMENT] = { 0 };
+	for (unsigned int i = 0; i < vImages.size(); i++)
+	{
+		for (unsigned int uiLevel = 0; uiLevel < vImages[i].vLevels.size(); uiLevel++)
+		{
+			// Pad up to the start of this level
+			const unsigned int uiPosition = (unsigned int)file.tellp();
+			file.write(acPadding, AlignTexturePackOffset(uiPosition) - uiPosition);
+
+			const std::vector<unsigned char>& vLevel = vImages[i].vLevels[uiLevel];
+			file.write((const char*)&vLevel[0], vLevel.size());
+		}
+	}
+	const unsigned int uiPosition = (unsigned int)file.tellp();
+	file.write(acPadding, AlignTexturePackOffset(uiPosition) - uiPosition);
+
+	if (!file.good())
+	{
+		cout << "Unable to write " << sFilename << endl;
+		return false;
+	}
+
+	cout << "Packed " << vImages.size() << " images into " << sFilename
+		 << " (" << sHeader.uiFileSize / 1024 << " KB)" << endl;
+	return true;
+}
+
+/**
+ @brief Check if a file is an image which stb_image can decode
+ */
+bool CTexturePacker::IsImageFile(const std::string& sFilename)
+{
+	const size_t uiDot = sFilename.find_last_of('.');
+	if (uiDot == std::string::npos)
+		return false;
+	std::string sExtension = sFilename.substr(uiDot + 1);
+	for (unsigned int i = 0; i < sExtension.size(); i++)
+		sExtension[i] = (char)tolower((unsigned char)sExtension[i]);
+	return (sExtension == "png") || (sExtension == "tga") || (sExtension == "jpg") || (sExtension == "bmp");
+}
+
+/**
+ @brief Decode an image file and compute its mipmap levels
+ @param sSource The image file
+ @param sImage The decoded image
+ */
+bool CTexturePacker::Decode(const SourceImage& sSource, PackedImage& sImage) const
+{
+	if (sSource.sName.size() >= TEXTURE_PACK_NAME_LENGTH)
+	{
+		cout << "The name of " << sSource.sName << " is too long" << endl;
+		return false;
+	}
+
+	int iWidth = 0, iHeight = 0, iNumChannels = 0;
+	unsigned char* pData = stbi_load(sSource.sPath.c_str(), &iWidth, &iHeight, &iNumChannels, 0);
+	if (pData == NULL)
+	{
+		cout << "Unable to decode " << sSource.sPath << ": " << stbi_failure_reason() << endl;
+		return false;
+	}
+
+	const unsigned int uiRowSize = iWidth * iNumChannels;
+	std::vector<unsigned char> vLevel(uiRowSize * iHeight);
+	for (int iRow = 0; iRow < iHeight; iRow++)
+	{
+		// Flip the image on the y-axis, as CImageLoader::Load does
+		const int iSourceRow = bFlip ? (iHeight - 1 - iRow) : iRow;
+		memcpy(&vLevel[iRow * uiRowSize], pData + iSourceRow * uiRowSize, uiRowSize);
+	}
+	stbi_image_free(pData);
+
+	memset(&sImage.sEntry, 0, sizeof(TexturePackEntry));
+	strncpy(sImage.sEntry.acName, sSource.sName.c_str(), TEXTURE_PACK_NAME_LENGTH - 1);
+	sImage.sEntry.uiWidth = iWidth;
+	sImage.sEntry.uiHeight = iHeight;
+	sImage.sEntry.uiNumChannels = iNumChannels;
+	sImage.sEntry.uiFlags = (bFlip ? TEXTURE_PACK_FLIPPED : 0) | (bMipmaps ? TEXTURE_PACK_MIPMAPS : 0);
+	sImage.vLevels.push_back(vLevel);
+
+	// Halve the image down to 1x1, as glGenerateMipmap does
+	unsigned int uiWidth = iWidth, uiHeight = iHeight;
+	while ((bMipmaps) && ((uiWidth > 1) || (uiHeight > 1)))
+	{
+		std::vector<unsigned char> vNextLevel;
+		Downsample(sImage.vLevels.back(), uiWidth, uiHeight, iNumChannels, vNextLevel);
+		uiWidth = GetTexturePackLevelSize(uiWidth, 1);
+		uiHeight = GetTexturePackLevelSize(uiHeight, 1);
+		sImage.vLevels.push_back(vNextLevel);
+	}
+	sImage.sEntry.uiNumLevels = (unsigned int)sImage.vLevels.size();
+
+	return true;
+}
+
+/**
+ @brief Halve an image with a box filter
+ @param vSource The pixels of the image
+ @param uiWidth The width of the image
+ @param uiHeight The height of the image
+ @param uiNumChannels The number of channels in the image
+ @param vDestination The pixels of the halved image
+ */
+void CTexturePacker::Downsample(const std::vector<unsigned char>& vSource, const unsigned int uiWidth, const unsigned int uiHeight,
+								const unsigned int uiNumChannels, std::vector<unsigned char>& vDestination)
+{
+	const unsigned int uiNewWidth = GetTexturePackLevelSize(uiWidth, 1);
+	const unsigned int uiNewHeight = GetTexturePackLevelSize(uiHeight, 1);
+	vDestination.resize(uiNewWidth * uiNewHeight * uiNumChannels);
+
+	for (unsigned int y = 0; y < uiNewHeight; y++)
+	{
+		// An odd row or column at the edge is averaged with itself
+		const unsigned int y0 = y * 2;
+		const unsigned int y1 = (y0 + 1 < uiHeight) ? y0 + 1 : y0;
+		for (unsigned int x = 0; x < uiNewWidth; x++)
+		{
+			const unsigned int x0 = x * 2;
+			const unsigned int x1 = (x0 + 1 < uiWidth) ? x0 + 1 : x0;
+			for (unsigned int c = 0; c < uiNumChannels; c++)
+			{
+				const unsigned int uiSum =	vSource[(y0 * uiWidth + x0) * uiNumChannels + c] +
+											vSource[(y0 * uiWidth + x1) * uiNumChannels + c] +
+											vSource[(y1 * uiWidth + x0) * uiNumChannels + c] +
+											vSource[(y1 * uiWidth + x1) * uiNumChannels + c];
+				vDestination[(y * uiNewWidth + x) * uiNumChannels + c] = (unsigned char)((uiSum + 2) / 4);
+			}
+		}
+	}
+}
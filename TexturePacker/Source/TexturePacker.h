@@ -0,0 +1,64 @@
+/**
+ CTexturePacker
+ @brief A class which decodes image files offline and writes them into a texture pack,
+		which the game memory-maps with CTexturePack instead of decoding the image files.
+ By: Toh Da Jun
+ Date: Oct 2026
+ */
+#pragma once
+
+// Include the layout of a texture pack
+#include <System/TexturePackFormat.h>
+
+#include <string>
+#include <vector>
+
+class CTexturePacker
+{
+	// An image file to pack
+	struct SourceImage {
+		// The full path of the file
+		std::string sPath;
+		// The path of the file relative to the asset directory, normalised as CAssetManager::NormalisePath does
+		std::string sName;
+	};
+
+	// A decoded image with its mipmap levels
+	struct PackedImage {
+		TexturePackEntry sEntry;
+		std::vector<std::vector<unsigned char>> vLevels;
+	};
+
+public:
+	// Constructor
+	CTexturePacker(void);
+
+	// Destructor
+	~CTexturePacker(void);
+
+	// Flip the images vertically, as CImageLoader::Load does when bInvert is true
+	void SetFlip(const bool bFlip);
+	// Compute the mipmap levels of the images
+	void SetMipmaps(const bool bMipmaps);
+
+	// Add the image files in a directory of the assets and its subdirectories
+	bool AddDirectory(const std::string& sAssetDirectory, const std::string& sSubDirectory);
+	// Decode the added image files and write them into a texture pack
+	bool Write(const std::string& sFilename);
+
+protected:
+	// The image files to pack
+	std::vector<SourceImage> vSourceImages;
+	// Flip the images vertically
+	bool bFlip;
+	// Compute the mipmap levels of the images
+	bool bMipmaps;
+
+	// Check if a file is an image which stb_image can decode
+	static bool IsImageFile(const std::string& sFilename);
+	// Decode an image file and compute its mipmap levels
+	bool Decode(const SourceImage& sSource, PackedImage& sImage) const;
+	// Halve an image with a box filter
+	static void Downsample(	const std::vector<unsigned char>& vSource, const unsigned int uiWidth, const unsigned int uiHeight,
+							const unsigned int uiNumChannels, std::vector<unsigned char>& vDestination);
+};
@@ -0,0 +1,49 @@
+/**
+ main.cpp
+ @brief This file contains the main function of the TexturePacker tool, which decodes the images
+		of the game offline and writes them into a texture pack for CTexturePack.
+
+		Usage: TexturePacker <asset directory> <texture pack> [--no-mipmaps] [--no-flip]
+		e.g.   TexturePacker App App/Image/Textures.pack
+ */
+#include "TexturePacker.h"
+
+#include <string>
+#include <iostream>
+using namespace std;
+
+/**
+ @brief This function is the main function which is called by the operating system when you run the executables
+ @return This function returns the error codes
+ */
+int main(int argc, char* argv[])
+{
+	if (argc < 3)
+	{
+		cout << "Usage: TexturePacker <asset directory> <texture pack> [--no-mipmaps] [--no-flip]" << endl;
+		return 1;
+	}
+
+	CTexturePacker cTexturePacker;
+	for (int i = 3; i < argc; i++)
+	{
+		const std::string sOption = argv[i];
+		if (sOption == "--no-mipmaps")
+			cTexturePacker.SetMipmaps(false);
+		else if (sOption == "--no-flip")
+			cTexturePacker.SetFlip(false);
+		else
+		{
+			cout << "Unknown option " << sOption << endl;
+			return 1;
+		}
+	}
+
+	// Pack the images which the game loads from the Image directory of the assets
+	if (cTexturePacker.AddDirectory(argv[1], "Image") == false)
+		return 1;
+	if (cTexturePacker.Write(argv[2]) == false)
+		return 1;
+
+	return 0;
+}